@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: Apache-2.0
+/** @file
+
+  Main stub for the benchmark runner.
+
+  @c CATCH_CONFIG_ENABLE_BENCHMARKING is defined on the target so every translation unit
+  agrees on the configuration.
+ */
+
+#define CATCH_CONFIG_RUNNER
+#include "catch.hpp"
+
+int
+main(int argc, char *argv[]) {
+  return Catch::Session().run(argc, argv);
+}
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0
+/** @file
+
+    IntrusiveHashMap benchmarks - insert and lookup at several load factors.
+*/
+
+#include <string>
+#include <vector>
+
+#include "swoc/IntrusiveHashMap.h"
+#include "swoc/ext/HashFNV.h"
+#include "catch.hpp"
+
+namespace {
+
+struct Item {
+  std::string _key;
+  Item *_next{nullptr};
+  Item *_prev{nullptr};
+
+  explicit Item(std::string_view key) : _key(key) {}
+};
+
+struct ItemLinkage : public swoc::IntrusiveLinkage<Item> {
+  static std::string_view
+  key_of(Item *item) {
+    return item->_key;
+  }
+  static uint64_t
+  hash_of(std::string_view key) {
+    return swoc::Hash64FNV1a{}.hash_immediate(key);
+  }
+  static bool
+  equal(std::string_view lhs, std::string_view rhs) {
+    return lhs == rhs;
+  }
+};
+
+using Map = swoc::IntrusiveHashMap<ItemLinkage>;
+
+constexpr size_t N_ITEMS = 10000;
+
+} // namespace
+
+TEST_CASE("IntrusiveHashMap benchmarks", "[IntrusiveHashMap]") {
+  std::vector<Item> items;
+  items.reserve(N_ITEMS);
+  for (size_t k = 0; k < N_ITEMS; ++k) {
+    items.emplace_back("key-" + std::to_string(k));
+  }
+
+  // Average bucket load at which the table expands - 1 is the default.
+  for (size_t load : {size_t(1), size_t(4), size_t(16)}) {
+    std::string tag = " - average load " + std::to_string(load);
+
+    BENCHMARK(("insert 10K" + tag).c_str()) {
+      Map map;
+      map.set_expansion_policy(Map::AVERAGE).set_expansion_limit(load);
+      for (auto &item : items) {
+        map.insert(&item);
+      }
+      return map.count();
+    };
+
+    Map map;
+    map.set_expansion_policy(Map::AVERAGE).set_expansion_limit(load);
+    for (auto &item : items) {
+      map.insert(&item);
+    }
+
+    uint32_t state = 1;
+    BENCHMARK(("lookup" + tag).c_str()) {
+      state     = state * 1664525u + 1013904223u;
+      auto spot = map.find(items[state % N_ITEMS]._key);
+      return spot != map.end();
+    };
+  }
+}
@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: Apache-2.0
+/** @file
+
+    Lexicon benchmarks - name and value lookup.
+*/
+
+#include <string_view>
+
+#include "swoc/Lexicon.h"
+#include "catch.hpp"
+
+namespace {
+
+enum class Method { INVALID, GET, POST, PUT, DELETE, HEAD, OPTIONS, CONNECT, TRACE, PATCH };
+
+using MethodNames = swoc::Lexicon<Method>;
+
+MethodNames Names{
+  {{Method::GET, "GET"},
+   {Method::POST, "POST"},
+   {Method::PUT, "PUT"},
+   {Method::DELETE, "DELETE"},
+   {Method::HEAD, "HEAD"},
+   {Method::OPTIONS, "OPTIONS"},
+   {Method::CONNECT, "CONNECT"},
+   {Method::TRACE, "TRACE"},
+   {Method::PATCH, "PATCH"}},
+  "INVALID",
+  Method::INVALID
+};
+
+std::string_view const QUERIES[] = {"GET", "POST", "DELETE", "get", "OPTIONS", "nosuchmethod", "PATCH", "HEAD"};
+
+} // namespace
+
+TEST_CASE("Lexicon benchmarks", "[Lexicon]") {
+  size_t idx = 0;
+
+  BENCHMARK("name to value") {
+    idx = (idx + 1) % (sizeof(QUERIES) / sizeof(QUERIES[0]));
+    return Names[QUERIES[idx]];
+  };
+
+  BENCHMARK("value to name") {
+    idx = (idx + 1) % 9;
+    return Names[static_cast<Method>(idx + 1)].size();
+  };
+}
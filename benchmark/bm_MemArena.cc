@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: Apache-2.0
+/** @file
+
+    MemArena benchmarks - allocation and generation cycling.
+*/
+
+#include "swoc/MemArena.h"
+#include "catch.hpp"
+
+using swoc::MemArena;
+
+TEST_CASE("MemArena benchmarks", "[MemArena]") {
+  static constexpr size_t N_ALLOC   = 1000;
+  static constexpr size_t ALLOC_LEN = 64;
+
+  BENCHMARK("alloc 64 x 1000 - cold arena") {
+    MemArena arena;
+    for (size_t k = 0; k < N_ALLOC; ++k) {
+      arena.alloc(ALLOC_LEN);
+    }
+    return arena.size();
+  };
+
+  BENCHMARK("alloc 64 x 1000 - reserved arena") {
+    MemArena arena{N_ALLOC * ALLOC_LEN};
+    for (size_t k = 0; k < N_ALLOC; ++k) {
+      arena.alloc(ALLOC_LEN);
+    }
+    return arena.size();
+  };
+
+  MemArena cycler{N_ALLOC * ALLOC_LEN};
+  BENCHMARK("freeze / thaw generation cycle") {
+    for (size_t k = 0; k < N_ALLOC; ++k) {
+      cycler.alloc(ALLOC_LEN);
+    }
+    cycler.freeze();
+    cycler.thaw();
+    return cycler.size();
+  };
+}
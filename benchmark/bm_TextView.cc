@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: Apache-2.0
+/** @file
+
+    TextView benchmarks - splitting, trimming, numeric parsing.
+*/
+
+#include <cctype>
+
+#include "swoc/TextView.h"
+#include "catch.hpp"
+
+using swoc::TextView;
+
+TEST_CASE("TextView benchmarks", "[TextView]") {
+  TextView const PATH{"/a/fairly/long/path/with/many/segments/and/a/file.ext"};
+  TextView const LINE{"   Cache-Control:  max-age=86400, public, s-maxage=3600   "};
+  TextView const NUMBER{"1234567890"};
+  TextView const HEX{"deadbeefcafe"};
+
+  BENCHMARK("split path segments") {
+    TextView src{PATH};
+    size_t n = 0;
+    while (src) {
+      n += src.take_prefix_at('/').size();
+    }
+    return n;
+  };
+
+  BENCHMARK("take_prefix_at token") {
+    TextView src{LINE};
+    return src.take_prefix_at(':').size();
+  };
+
+  BENCHMARK("trim whitespace") { return TextView{LINE}.trim_if(&isspace).size(); };
+
+  BENCHMARK("ltrim + rtrim") { return TextView{LINE}.ltrim(' ').rtrim(' ').size(); };
+
+  BENCHMARK("svtou decimal") { return swoc::svtou(NUMBER); };
+
+  BENCHMARK("svtou hex") { return swoc::svtou(HEX, nullptr, 16); };
+}
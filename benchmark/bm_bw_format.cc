@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: Apache-2.0
+/** @file
+
+    BufferWriter formatting benchmarks.
+*/
+
+#include <string_view>
+
+#include "swoc/bwf_base.h"
+#include "catch.hpp"
+
+TEST_CASE("bwformat benchmarks", "[bwf]") {
+  swoc::LocalBufferWriter<256> w;
+  std::string_view text{"benchmark"};
+
+  BENCHMARK("print literal") { return w.clear().print("A text with no specifiers at all.").extent(); };
+
+  BENCHMARK("print mixed specs") { return w.clear().print("{} = {} : {}", 56, text, -17).extent(); };
+
+  BENCHMARK("print formatted int") { return w.clear().print("{:08x}", 0xDEADBEEFu).extent(); };
+
+  BENCHMARK("print aligned string") { return w.clear().print("{:>20}", text).extent(); };
+}
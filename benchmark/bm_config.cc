@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0
+/** @file
+
+    Configuration parse benchmarks - including proof the parse makes no heap allocation.
+*/
+
+#include <atomic>
+#include <new>
+#include <string>
+
+#include "swoc/swoc_config.h"
+#include "swoc/bwf_base.h"
+#include "catch.hpp"
+
+using swoc::MemArena;
+using swoc::TextView;
+
+// Global allocation counter - counts every heap allocation in the process. This is how the
+// zero allocation claim is checked rather than assumed: the count is read around the parse.
+static std::atomic<size_t> Alloc_Count{0};
+
+void *
+operator new(size_t n) {
+  ++Alloc_Count;
+  if (void *p = std::malloc(n)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void *p) noexcept {
+  std::free(p);
+}
+
+void
+operator delete(void *p, size_t) noexcept {
+  std::free(p);
+}
+
+namespace {
+
+/// Build a representative config - @a n_hosts host groups with repeated field names and values.
+std::string
+make_config(size_t n_hosts) {
+  std::string zret;
+  zret.reserve(n_hosts * 128);
+  swoc::bwappend(zret, "name \"benchmark\";\nport 8080;\nlog {{ path \"/var/log/bm.log\"; level info; }}\n");
+  for (size_t idx = 0; idx < n_hosts; ++idx) {
+    swoc::bwappend(zret,
+                   "host-{} {{\n  addr 10.{}.{}.1;\n  role {};\n  tags [ prod, edge, \"zone {}\" ];\n  retry 3;\n}}\n", idx,
+                   idx / 256, idx % 256, idx % 2 ? "cache" : "origin", idx % 8);
+  }
+  return zret;
+}
+
+} // namespace
+
+TEST_CASE("config parse benchmarks", "[config]") {
+  static constexpr size_t N_HOSTS = 1000;
+  std::string const text          = make_config(N_HOSTS);
+
+  // The zero allocation claim, checked outside the benchmark loop: with the arena reserved,
+  // the entire parse - mapping aside, this is in-memory - touches only the arena. Arena blocks
+  // come from malloc, not operator new, so those are watched via the block hook.
+  {
+    static constexpr size_t RESERVE = size_t{2} << 20; // ample for the graph plus interning.
+    MemArena arena{RESERVE};
+    arena.require(RESERVE); // force the reserved block now.
+    size_t n_blocks = 0;
+    arena.set_block_alloc_hook([&n_blocks](MemArena &, size_t) { ++n_blocks; });
+    swoc::config::Parser parser{arena};
+    size_t mark           = Alloc_Count.load();
+    auto &&[root, errata] = parser.parse(text);
+    REQUIRE(Alloc_Count.load() == mark); // zero heap allocations...
+    REQUIRE(n_blocks == 0);              // ... and no arena growth either.
+    REQUIRE(errata.is_ok());
+    REQUIRE(root->_count == 3 + N_HOSTS);
+  }
+
+  BENCHMARK("parse 1000 host config - cold arena") {
+    MemArena arena;
+    swoc::config::Parser parser{arena};
+    auto &&[root, errata] = parser.parse(text);
+    return root->_count;
+  };
+
+  BENCHMARK("parse 1000 host config - reserved arena") {
+    MemArena arena{size_t{2} << 20};
+    swoc::config::Parser parser{arena};
+    auto &&[root, errata] = parser.parse(text);
+    return root->_count;
+  };
+}
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0
+/** @file
+
+    IPSpace benchmarks - mark and find at increasing range counts.
+
+    The 10M case takes a while to set up and is hidden - run "libswoc_benchmarks [ip-large]"
+    to include it.
+*/
+
+#include <cstdint>
+
+#include "swoc/swoc_ip.h"
+#include "catch.hpp"
+
+using swoc::IP4Addr;
+using swoc::IP4Range;
+using swoc::IPRange;
+
+namespace {
+
+using Space = swoc::IPSpace<unsigned>;
+
+/// Base of the generated ranges - avoids the zero network.
+constexpr uint32_t BASE = 0x0A000000;
+/// Address stride between range starts - ranges are 256 addresses with a gap.
+constexpr uint32_t STRIDE = 384;
+
+/// Mark @a n disjoint 256 address ranges in @a space.
+/// @note @c IPSpace is not movable so the space is filled in place.
+size_t
+fill_space(Space &space, size_t n) {
+  for (size_t k = 0; k < n; ++k) {
+    uint32_t lo = BASE + uint32_t(k) * STRIDE;
+    space.mark(IPRange{IP4Range{IP4Addr{lo}, IP4Addr{lo + 255}}}, unsigned(k & 0xFu));
+  }
+  return space.count();
+}
+
+/// Cheap deterministic address sequence over the covered region.
+struct AddrGen {
+  uint32_t _state = 0x243F6A88; ///< LCG state.
+  uint32_t _limit;              ///< Size of the covered address region.
+
+  explicit AddrGen(size_t n_ranges) : _limit(uint32_t(n_ranges) * STRIDE) {}
+
+  IP4Addr
+  next() {
+    _state = _state * 1664525u + 1013904223u;
+    return IP4Addr{BASE + _state % _limit};
+  }
+};
+
+/// Benchmark find over @a space built with @a n ranges.
+void
+bench_find(Space &space, size_t n, char const *name) {
+  AddrGen gen{n};
+  BENCHMARK(name) {
+    auto spot = space.find(gen.next());
+    return spot != space.end();
+  };
+}
+
+} // namespace
+
+TEST_CASE("IPSpace benchmarks", "[ip]") {
+  BENCHMARK("mark 1K ranges") {
+    Space space;
+    return fill_space(space, 1000);
+  };
+
+  Space space_1k;
+  fill_space(space_1k, 1000);
+  bench_find(space_1k, 1000, "find - 1K ranges");
+
+  Space space_1m;
+  fill_space(space_1m, 1000 * 1000);
+  bench_find(space_1m, 1000 * 1000, "find - 1M ranges");
+}
+
+TEST_CASE("IPSpace benchmarks - large", "[.][ip-large]") {
+  constexpr size_t N = 10 * 1000 * 1000;
+  Space space;
+  fill_space(space, N);
+  bench_find(space, N, "find - 10M ranges");
+}
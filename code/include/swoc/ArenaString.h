@@ -0,0 +1,265 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    Arena allocated mutable string.
+*/
+
+#pragma once
+
+#include <cstring>
+#include <string_view>
+
+#include "swoc/MemArena.h"
+#include "swoc/TextView.h"
+#include "swoc/bwf_base.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** A mutable string that allocates exclusively from a bound @c MemArena.
+ *
+ * This is the small transaction lifetime string - the use cases of @c std::string without
+ * dragging @c malloc in to the request path. The storage lives in the arena and is reclaimed
+ * with it; the string itself never frees anything. The arena must outlive the string.
+ *
+ * Growth exploits arena locality: while the string is the most recent allocation in the arena
+ * it is extended in place by claiming adjacent remnant bytes, with no copy at all. If other
+ * allocations have intervened the contents are relocated within the arena (the abandoned bytes
+ * stay in the arena until it is cleared, as with all arena storage).
+ *
+ * The string converts implicitly to @c TextView / @c std::string_view and is a @c bwprint
+ * target, so it composes with the rest of the formatting machinery.
+ */
+class ArenaString {
+  using self_type = ArenaString; ///< Self reference type.
+
+public:
+  /// Minimum capacity of a non-empty string.
+  static constexpr size_t MIN_CAPACITY = 16;
+
+  /** Construct an empty string.
+   *
+   * @param arena The arena for storage.
+   *
+   * No storage is allocated until content is added.
+   */
+  explicit ArenaString(MemArena &arena) : _arena(&arena) {}
+
+  /** Construct with a copy of @a text.
+   *
+   * @param arena The arena for storage.
+   * @param text Initial content, copied in to the arena.
+   */
+  ArenaString(MemArena &arena, TextView text) : _arena(&arena) { this->assign(text); }
+
+  // Copying would silently alias or duplicate arena storage - require it to be explicit
+  // via construction from the view.
+  ArenaString(self_type const &)          = delete;
+  self_type &operator=(self_type const &) = delete;
+
+  /// Move construct, taking the storage from @a that.
+  ArenaString(self_type &&that) : _arena(that._arena), _data(that._data), _size(that._size), _capacity(that._capacity) {
+    that._data = nullptr;
+    that._size = that._capacity = 0;
+  }
+
+  /// @return Pointer to the content.
+  char *data() { return _data; }
+
+  /// @return Pointer to the content.
+  char const *data() const { return _data; }
+
+  /// @return Size of the content in bytes.
+  size_t size() const { return _size; }
+
+  /// @return @c true if there is no content, @c false otherwise.
+  bool empty() const { return 0 == _size; }
+
+  /// @return Size of the storage in bytes.
+  size_t capacity() const { return _capacity; }
+
+  /// @return The content as a view.
+  TextView view() const { return {_data, _size}; }
+
+  /// Convert to a view.
+  operator TextView() const { return {_data, _size}; }
+
+  /// Convert to a view.
+  operator std::string_view() const { return {_data, _size}; }
+
+  /// Access the character at @a idx.
+  char &operator[](size_t idx) { return _data[idx]; }
+
+  /// Access the character at @a idx.
+  char const &operator[](size_t idx) const { return _data[idx]; }
+
+  /// Remove the content. Storage is retained for re-use.
+  self_type &
+  clear() {
+    _size = 0;
+    return *this;
+  }
+
+  /** Guarantee storage for @a n bytes of content.
+   *
+   * @param n Required capacity.
+   * @return @a this.
+   */
+  self_type &
+  reserve(size_t n) {
+    if (n > _capacity) {
+      this->grow(n);
+    }
+    return *this;
+  }
+
+  /** Set the content size to @a n.
+   *
+   * @param n New size.
+   * @return @a this.
+   *
+   * If the string is extended the new bytes are zero filled.
+   */
+  self_type &
+  resize(size_t n) {
+    this->reserve(n);
+    if (n > _size) {
+      std::memset(_data + _size, 0, n - _size);
+    }
+    _size = n;
+    return *this;
+  }
+
+  /// Set the content to a copy of @a text.
+  self_type &
+  assign(TextView text) {
+    _size = 0;
+    return this->append(text);
+  }
+
+  /// Append a copy of @a text to the content.
+  self_type &
+  append(TextView text) {
+    this->reserve(_size + text.size());
+    std::memcpy(_data + _size, text.data(), text.size());
+    _size += text.size();
+    return *this;
+  }
+
+  /// Append the character @a c to the content.
+  self_type &
+  append(char c) {
+    this->reserve(_size + 1);
+    _data[_size++] = c;
+    return *this;
+  }
+
+  /// Append a copy of @a text to the content.
+  self_type &
+  operator+=(TextView text) {
+    return this->append(text);
+  }
+
+  /// Append the character @a c to the content.
+  self_type &
+  operator+=(char c) {
+    return this->append(c);
+  }
+
+  /// Access the bound arena.
+  MemArena &arena() { return *_arena; }
+
+protected:
+  /** Grow the storage to at least @a n bytes.
+   *
+   * @param n Required capacity.
+   *
+   * If the string is the most recent allocation in the arena the adjacent remnant is claimed
+   * and the content is not copied. Otherwise fresh storage is allocated and the content moved.
+   */
+  void
+  grow(size_t n) {
+    size_t cap = std::max({n, 2 * _capacity, MIN_CAPACITY});
+    if (_data != nullptr) {
+      auto remnant = _arena->remnant();
+      if (_data + _capacity == remnant.data() && remnant.size() >= cap - _capacity) {
+        _arena->alloc(cap - _capacity); // extend in place - no copy.
+        _capacity = cap;
+        return;
+      }
+    }
+    auto span = _arena->alloc(cap).rebind<char>();
+    if (_size > 0) {
+      std::memcpy(span.data(), _data, _size);
+    }
+    _data     = span.data();
+    _capacity = cap;
+  }
+
+  MemArena *_arena;      ///< Storage source.
+  char *_data = nullptr; ///< Content.
+  size_t _size     = 0;  ///< Content size.
+  size_t _capacity = 0;  ///< Storage size.
+};
+
+/// @cond INTERNAL_DETAIL
+inline bool
+operator==(ArenaString const &lhs, std::string_view rhs) {
+  return lhs.view() == rhs;
+}
+inline bool
+operator==(std::string_view lhs, ArenaString const &rhs) {
+  return lhs == rhs.view();
+}
+inline bool
+operator!=(ArenaString const &lhs, std::string_view rhs) {
+  return lhs.view() != rhs;
+}
+inline bool
+operator!=(std::string_view lhs, ArenaString const &rhs) {
+  return lhs != rhs.view();
+}
+/// @endcond
+
+/** Generate formatted output in to an @c ArenaString @a s using format @a fmt with arguments in the tuple @a args.
+ *
+ * @tparam Args Format argument types.
+ * @param s Output string.
+ * @param fmt Format string.
+ * @param args Arguments for @a fmt.
+ * @return @a s
+ */
+template <typename... Args>
+ArenaString &
+bwprint_v(ArenaString &s, TextView fmt, std::tuple<Args...> const &args) {
+  if (auto hint = bwf::size_hint(fmt, args); hint > s.capacity()) {
+    s.reserve(hint); // one resize up front instead of a second format pass.
+  }
+  auto const capacity = s.capacity();
+  auto printer        = [&]() { return FixedBufferWriter(s.data(), s.capacity()).print_v(fmt, args).extent(); };
+  // Extend to the full capacity first - @c resize after the fact zero fills the added
+  // characters, which would clobber output written past the current size.
+  s.resize(capacity);
+  size_t n = printer();
+  s.resize(n);        // adjust to the actual output length.
+  if (n > capacity) { // dropped data, try again.
+    printer();
+  }
+  return s;
+}
+
+/** Generate formatted output in to an @c ArenaString @a s using format @a fmt with arguments @a args.
+ *
+ * @tparam Args Format argument types.
+ * @param s Output string.
+ * @param fmt Format string.
+ * @param args Arguments for @a fmt.
+ * @return @a s
+ */
+template <typename... Args>
+ArenaString &
+bwprint(ArenaString &s, TextView fmt, Args &&...args) {
+  return bwprint_v(s, fmt, std::forward_as_tuple(args...));
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
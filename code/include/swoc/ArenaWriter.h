@@ -5,6 +5,8 @@
  */
 #pragma once
 
+#include <vector>
+
 #include "swoc/swoc_version.h"
 #include "swoc/MemSpan.h"
 #include "swoc/bwf_base.h"
@@ -58,6 +60,181 @@ protected:
   void realloc(size_t n);
 };
 
+/** Buffer writer that chains fixed size chunks in a @c MemArena.
+ *
+ * Unlike @c ArenaWriter, which must keep its output contiguous and therefore moves the
+ * accumulated output when it overflows, overflow here starts a new chunk in place. The total
+ * bytes copied is linear in the output size, which matters for large emissions (JSON dumps,
+ * metrics). The output is available as a list of chunk spans, or can be assembled in to a single
+ * contiguous span once at the end.
+ *
+ * Chunk memory is allocated in the arena as it fills, therefore the output survives the writer
+ * and other arena use between writes (at the cost of starting a new chunk).
+ *
+ * @note The writer grows as needed and is never in an error state - @c extent and @c size are
+ * always the same.
+ */
+class ChunkedArenaWriter : public BufferWriter {
+  using self_type  = ChunkedArenaWriter; ///< Self reference type.
+  using super_type = BufferWriter;       ///< Parent type.
+
+public:
+  /// Default reservation unit.
+  static constexpr size_t DEFAULT_CHUNK_SIZE = 4096;
+
+  /** Constructor.
+   *
+   * @param arena Arena to use for storage.
+   * @param chunk_size Initial reservation unit - subsequent reservations grow geometrically.
+   */
+  ChunkedArenaWriter(MemArena &arena, size_t chunk_size = DEFAULT_CHUNK_SIZE);
+
+  /** Pre-reserve space for an expected total of @a n bytes of output.
+   *
+   * @param n Expected output size.
+   * @return @a this
+   *
+   * This is an optimization only - it reserves contiguous arena space so that the output is a
+   * single chunk if the estimate holds.
+   */
+  self_type &reserve(size_t n);
+
+  /// Write a single character @a c to the output.
+  self_type &write(char c) override;
+
+  /// Write @a length bytes, starting at @a data, to the output.
+  self_type &write(void const *data, size_t length) override;
+
+  // Bring in non-overridden methods.
+  using super_type::write;
+
+  /// @return The first byte of the first chunk of output, or @c nullptr if there is none.
+  /// @note The output is not contiguous in general - use @c chunks or @c assemble.
+  char const *data() const override;
+
+  /// @return @c false - the writer grows as needed and does not discard output.
+  bool error() const override;
+
+  /// @return The start of the unused space in the current reservation.
+  char *aux_data() override;
+
+  /// @return The extent plus the unused space in the current reservation.
+  size_t capacity() const override;
+
+  /// @return Total number of bytes written.
+  size_t extent() const override;
+
+  /// Add @a n bytes written via @c aux_data to the output.
+  bool commit(size_t n) override;
+
+  /// Drop @a n bytes from the end of the output.
+  /// @note Arena memory for dropped bytes is not reclaimed.
+  self_type &discard(size_t n) override;
+
+  /// Reduce the space available in the current reservation by @a n bytes.
+  self_type &restrict(size_t n) override;
+
+  /// Restore @a n bytes of space removed by @c restrict.
+  self_type &restore(size_t n) override;
+
+  /** Copy data in the output.
+   *
+   * @internal Justification for formatted output is done in the nested fixed writers, not the
+   * target writer, therefore this is unused and not supported across chunks - it always throws.
+   */
+  self_type &copy(size_t dst, size_t src, size_t n) override;
+
+  /// Output the contents to the @a stream.
+  std::ostream &operator>>(std::ostream &stream) const override;
+
+  /// @return The accumulated chunks, in output order.
+  MemSpan<MemSpan<char const> const> chunks() const;
+
+  /** Assemble the output in to a single contiguous span.
+   *
+   * @return A span containing all of the output, allocated from the arena.
+   *
+   * If the output is already a single chunk no copying is done. Otherwise each byte is copied
+   * exactly once and the writer is updated to have the result as its only chunk.
+   */
+  MemSpan<char const> assemble();
+
+protected:
+  MemArena &_arena;                     ///< Arena for the chunks.
+  size_t _next_reserve;                 ///< Size of the next reservation - doubled each time.
+  std::vector<MemSpan<char const>> _chunks; ///< Accumulated output chunks.
+  size_t _extent = 0;                   ///< Total bytes written.
+  size_t _restricted = 0;               ///< Bytes removed from the reservation by @c restrict.
+
+  /** Add [ @a data , @a n ) to the chunk list.
+   *
+   * If the bytes directly follow the last chunk it is extended, otherwise a new chunk is started.
+   */
+  void append(char const *data, size_t n);
+
+  /// Reserve at least @a n bytes of contiguous space, growing geometrically.
+  void expand(size_t n);
+};
+
 inline swoc::ArenaWriter::ArenaWriter(swoc::MemArena &arena) : super_type(arena.remnant()), _arena(arena) {}
 
+inline ChunkedArenaWriter::ChunkedArenaWriter(MemArena &arena, size_t chunk_size)
+  : _arena(arena), _next_reserve(chunk_size) {}
+
+inline auto
+ChunkedArenaWriter::reserve(size_t n) -> self_type & {
+  if (n > _arena.remaining()) {
+    _arena.require(n);
+  }
+  return *this;
+}
+
+inline auto
+ChunkedArenaWriter::write(char c) -> self_type & {
+  return this->write(&c, 1);
+}
+
+inline char const *
+ChunkedArenaWriter::data() const {
+  return _chunks.empty() ? nullptr : _chunks.front().data();
+}
+
+inline bool
+ChunkedArenaWriter::error() const {
+  return false;
+}
+
+inline char *
+ChunkedArenaWriter::aux_data() {
+  return static_cast<char *>(_arena.remnant().data());
+}
+
+inline size_t
+ChunkedArenaWriter::capacity() const {
+  auto avail = _arena.remaining();
+  return _extent + (_restricted < avail ? avail - _restricted : 0);
+}
+
+inline size_t
+ChunkedArenaWriter::extent() const {
+  return _extent;
+}
+
+inline auto
+ChunkedArenaWriter::restrict(size_t n) -> self_type & {
+  _restricted += n;
+  return *this;
+}
+
+inline auto
+ChunkedArenaWriter::restore(size_t n) -> self_type & {
+  _restricted -= std::min(n, _restricted);
+  return *this;
+}
+
+inline MemSpan<MemSpan<char const> const>
+ChunkedArenaWriter::chunks() const {
+  return {_chunks.data(), _chunks.size()};
+}
+
 }} // namespace swoc::SWOC_VERSION_NS
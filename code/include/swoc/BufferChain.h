@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+ * Buffer chain (rope) @c BufferWriter.
+ */
+#pragma once
+
+#include <sys/uio.h>
+
+#include <vector>
+
+#include "swoc/swoc_version.h"
+#include "swoc/MemSpan.h"
+#include "swoc/MemArena.h"
+#include "swoc/IntrusiveDList.h"
+#include "swoc/BufferWriter.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+/** A rope of fixed size blocks implementing the @c BufferWriter interface.
+ *
+ * Output is accumulated in a chain of fixed size blocks - overflow starts a new block instead of
+ * truncating (as @c FixedBufferWriter) or moving the accumulated output (as @c ArenaWriter), so
+ * the writer suits streaming large emissions. The block list is iterable and exportable as an
+ * @c iovec array for @c writev / @c sendmsg submission, and another chain can be appended in
+ * O(1) - the donor's blocks are spliced on and its memory adopted.
+ *
+ * Block memory is drawn from an internal @c MemArena seeded from the @c ArenaPool, and is
+ * retired back to the pool on destruction, so chains created and destroyed at high rate recycle
+ * their blocks instead of paying malloc round trips.
+ *
+ * @note The writer grows as needed and is never in an error state - @c extent and @c size are
+ * always the same.
+ */
+class BufferChain : public BufferWriter {
+  using self_type  = BufferChain;  ///< Self reference type.
+  using super_type = BufferWriter; ///< Parent type.
+
+public:
+  /// Default block size.
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 4096;
+
+  /// A fixed size block of output.
+  struct Block {
+    Block *_next = nullptr; ///< Forward link.
+    Block *_prev = nullptr; ///< Backward link.
+    MemSpan<char> _space;   ///< Block storage.
+    size_t _size = 0;       ///< Bytes of valid data.
+
+    /// Linkage for the chain.
+    using Linkage = swoc::IntrusiveLinkage<Block>;
+
+    /// @return The valid data in the block.
+    MemSpan<char const>
+    view() const {
+      return {_space.data(), _size};
+    }
+
+    /// @return The number of unused bytes in the block.
+    size_t
+    remaining() const {
+      return _space.size() - _size;
+    }
+  };
+
+  /// The block chain type.
+  using BlockList      = IntrusiveDList<Block::Linkage>;
+  using iterator       = BlockList::iterator;       ///< Block iterator.
+  using const_iterator = BlockList::const_iterator; ///< Const block iterator.
+
+  /** Constructor.
+   *
+   * @param block_size Size of each block.
+   */
+  explicit BufferChain(size_t block_size = DEFAULT_BLOCK_SIZE);
+
+  BufferChain(self_type const &that)            = delete;
+  self_type &operator=(self_type const &that)   = delete;
+  BufferChain(self_type &&that)                 = default;
+
+  ~BufferChain() override;
+
+  /// Write a single character @a c to the chain.
+  self_type &write(char c) override;
+
+  /// Write @a length bytes, starting at @a data, to the chain.
+  self_type &write(void const *data, size_t length) override;
+
+  // Bring in non-overridden methods.
+  using super_type::write;
+
+  /// @return The first byte of the first block, or @c nullptr if there is none.
+  /// @note The output is not contiguous in general - iterate the blocks.
+  char const *data() const override;
+
+  /// @return @c false - the chain grows as needed and does not discard output.
+  bool error() const override;
+
+  /// @return The start of the unused space in the last block, or @c nullptr if it is full.
+  char *aux_data() override;
+
+  /// @return The extent plus the unused space in the last block.
+  size_t capacity() const override;
+
+  /// @return Total number of bytes written.
+  size_t extent() const override;
+
+  /// Add @a n bytes written via @c aux_data to the output.
+  bool commit(size_t n) override;
+
+  /// Drop @a n bytes from the end of the output.
+  /// @note Emptied blocks are dropped from the chain but their memory is not reclaimed.
+  self_type &discard(size_t n) override;
+
+  /// Reduce the space available in the last block by @a n bytes.
+  self_type &restrict(size_t n) override;
+
+  /// Restore @a n bytes of space removed by @c restrict.
+  self_type &restore(size_t n) override;
+
+  /** Copy data in the output.
+   *
+   * @internal Justification for formatted output is done in nested fixed writers, not the
+   * target writer, therefore this is unused and not supported across blocks - it always throws.
+   */
+  self_type &copy(size_t dst, size_t src, size_t n) override;
+
+  /// Output the contents to the @a stream.
+  std::ostream &operator>>(std::ostream &stream) const override;
+
+  /// @return The configured block size.
+  size_t block_size() const;
+
+  /// @return The number of blocks in the chain.
+  size_t block_count() const;
+
+  /// @return Iterator for the first block.
+  const_iterator begin() const;
+
+  /// @return Iterator past the last block.
+  const_iterator end() const;
+
+  /** Fill @a iov with the blocks of the chain.
+   *
+   * @param iov The array to fill.
+   * @return The number of elements filled - the smaller of the block count and the array size.
+   *
+   * The filled prefix of @a iov can be passed directly to @c writev / @c sendmsg.
+   */
+  size_t fill_iov(MemSpan<struct iovec> iov) const;
+
+  /** Append the contents of @a that to @a this.
+   *
+   * @param that Donor chain - empty afterward.
+   * @return @a this
+   *
+   * O(1) - the blocks are spliced onto the chain and the donor's memory is adopted. No data is
+   * copied. Subsequent writes to @a that start a fresh chain.
+   */
+  self_type &append(self_type &&that);
+
+  /// Discard all output. The blocks are released for reuse by @a this.
+  void clear();
+
+protected:
+  size_t _block_size;            ///< Size of each block.
+  MemArena _arena;               ///< Block storage.
+  std::vector<MemArena> _donors; ///< Storage adopted from appended chains.
+  BlockList _blocks;             ///< The chain.
+  size_t _extent     = 0;        ///< Total bytes written.
+  size_t _restricted = 0;        ///< Bytes removed from the last block by @c restrict.
+
+  /// @return The last block, with at least one byte of space - a new block if needed.
+  Block *writable_block();
+};
+
+inline auto
+BufferChain::write(char c) -> self_type & {
+  return this->write(&c, 1);
+}
+
+inline char const *
+BufferChain::data() const {
+  return _blocks.empty() ? nullptr : _blocks.head()->_space.data();
+}
+
+inline bool
+BufferChain::error() const {
+  return false;
+}
+
+inline size_t
+BufferChain::extent() const {
+  return _extent;
+}
+
+inline auto
+BufferChain::restrict(size_t n) -> self_type & {
+  _restricted += n;
+  return *this;
+}
+
+inline auto
+BufferChain::restore(size_t n) -> self_type & {
+  _restricted -= std::min(n, _restricted);
+  return *this;
+}
+
+inline size_t
+BufferChain::block_size() const {
+  return _block_size;
+}
+
+inline size_t
+BufferChain::block_count() const {
+  return _blocks.count();
+}
+
+inline auto
+BufferChain::begin() const -> const_iterator {
+  return _blocks.begin();
+}
+
+inline auto
+BufferChain::end() const -> const_iterator {
+  return _blocks.end();
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
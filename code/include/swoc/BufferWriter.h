@@ -16,6 +16,7 @@
 #include <string_view>
 
 #include "swoc/swoc_version.h"
+#include "swoc/swoc_stats.h"
 #include "swoc/TextView.h"
 #include "swoc/MemSpan.h"
 #include "swoc/bwf_fwd.h"
@@ -214,6 +215,27 @@ public:
    */
   template <typename... Args> BufferWriter &print_v(const bwf::Format &fmt, const std::tuple<Args...> &args);
 
+  /** Formatted output to the buffer.
+   *
+   * @tparam N Item capacity of the format.
+   * @tparam Args Types of the format input parameters.
+   * @param fmt Compile time parsed format.
+   * @param args Arguments for the format string.
+   * @return @a this.
+   */
+  template <std::size_t N, typename... Args> BufferWriter &print(bwf::FixedFormat<N> const &fmt, Args &&...args);
+
+  /** Formatted output to the buffer.
+   *
+   * @tparam N Item capacity of the format.
+   * @tparam Args Types of the parameter for formatting.
+   * @param fmt Compile time parsed format.
+   * @param args The format parameters in a tuple.
+   * @return @a this
+   */
+  template <std::size_t N, typename... Args>
+  BufferWriter &print_v(bwf::FixedFormat<N> const &fmt, std::tuple<Args...> const &args);
+
   /** Write formatted output of @a args to @a this buffer.
    *
    * @tparam Binding Type for the name binding instance.
@@ -264,6 +286,16 @@ public:
    */
   template <typename Binding> BufferWriter &print_n(Binding const &names, TextView const &fmt);
 
+  /** Write formatted output to @a this buffer.
+   *
+   * @param names Name set for specifier names.
+   * @param fmt Pre-parsed format.
+   *
+   * As the @c TextView overload, for a format that has already been parsed. Name resolutions are
+   * cached in @a fmt so that repeated use against the same @a names does no name lookups.
+   */
+  template <typename Binding> BufferWriter &print_n(Binding const &names, bwf::Format const &fmt);
+
   /** Write formattted data.
    *
    * @tparam T Data type.
@@ -403,6 +435,10 @@ public:
   template <typename... Args> self_type &print(bwf::Format const &fmt, Args &&...args);
 
   template <typename... Args> self_type &print_v(bwf::Format const &fmt, std::tuple<Args...> const &args);
+
+  template <std::size_t N, typename... Args> self_type &print(bwf::FixedFormat<N> const &fmt, Args &&...args);
+
+  template <std::size_t N, typename... Args> self_type &print_v(bwf::FixedFormat<N> const &fmt, std::tuple<Args...> const &args);
   /// @endcond
 
 protected:
@@ -539,6 +575,9 @@ inline FixedBufferWriter &
 FixedBufferWriter::write(char c) {
   if (_attempted < _capacity) {
     _buffer[_attempted] = c;
+  } else if (_buffer) { // null buffer writers are sizing, not truncating.
+    SWOC_STAT_INC(_buffer_truncate);
+    SWOC_PROBE1(buffer_truncate, this);
   }
   ++_attempted;
 
@@ -552,8 +591,12 @@ FixedBufferWriter::write(const void *data, size_t length) {
   if (_buffer) {
     if (newSize <= _capacity) {
       std::memcpy(_buffer + _attempted, data, length);
-    } else if (_attempted < _capacity) {
-      std::memcpy(_buffer + _attempted, data, _capacity - _attempted);
+    } else {
+      if (_attempted < _capacity) {
+        std::memcpy(_buffer + _attempted, data, _capacity - _attempted);
+      }
+      SWOC_STAT_INC(_buffer_truncate);
+      SWOC_PROBE2(buffer_truncate, this, newSize - _capacity);
     }
   }
   _attempted = newSize;
@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   IP address space with columnar payload storage.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <swoc/IPRange.h>
+#include <swoc/FlatHashMap.h>
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** An @c IPSpace variant that stores payloads in a separate deduplicated column.
+ *
+ * @tparam PAYLOAD The color class.
+ * @tparam OPS Payload hash and equality operations - see @c FlatHashOps.
+ *
+ * @c IPSpace embeds the payload in every range node. For a large payload that pushes the node
+ * past a cache line and drags payload bytes through the cache on every comparison during a
+ * search. This class keeps the range tree nodes minimal by storing a 32 bit handle per range
+ * and the payloads themselves in a contiguous array to the side. A search touches only the
+ * compact key / link nodes; the payload is fetched once at the end.
+ *
+ * Payloads are deduplicated - equal payloads share one handle and one array slot - so a space
+ * with many ranges but few distinct colors (the common case for classification data) stores
+ * each color exactly once. @c PAYLOAD must therefore be copyable and usable as a hash key via
+ * @a OPS, and a payload must not be mutated through the space as that would change it for
+ * every range sharing the handle.
+ *
+ * The interface is the marking subset of @c IPSpace - @c blend is not provided because the
+ * handles are shared. Distinct payload slots are never reclaimed; a color that is no longer
+ * referenced by any range persists in the column until @c clear.
+ */
+template <typename PAYLOAD, typename OPS = FlatHashOps<PAYLOAD>> class ColumnIPSpace {
+  using self_type = ColumnIPSpace;
+
+public:
+  using payload_t   = PAYLOAD;  ///< Export payload type.
+  using handle_type = uint32_t; ///< Per node payload handle.
+
+protected:
+  using space_type = IPSpace<handle_type>; ///< Range storage - nodes hold only handles.
+
+public:
+  /** Constant iterator.
+   *
+   * Dereferencing yields a value with @c range and @c payload accessors, in the style of
+   * @c FlatIPSpace. The space is mutable only through its own methods so there is no
+   * non-const iteration.
+   */
+  class const_iterator {
+    using self_type = const_iterator; ///< Self reference type.
+    friend class ColumnIPSpace;
+
+  public:
+    const_iterator() = default;
+
+    self_type &
+    operator++() {
+      ++_iter;
+      return *this;
+    }
+
+    self_type &
+    operator--() {
+      --_iter;
+      return *this;
+    }
+
+    /// The value is the iterator itself - it provides the accessors.
+    self_type const &operator*() const { return *this; }
+
+    /// Member access to the accessors.
+    self_type const *operator->() const { return this; }
+
+    /// @return The range.
+    IPRange
+    range() const {
+      return std::get<0>(*_iter);
+    }
+
+    /// @return The payload for the range.
+    PAYLOAD const &
+    payload() const {
+      return (*_column)[std::get<1>(*_iter)];
+    }
+
+    bool operator==(self_type const &that) const { return _iter == that._iter; }
+    bool operator!=(self_type const &that) const { return _iter != that._iter; }
+
+  protected:
+    const_iterator(typename space_type::const_iterator const &iter, std::vector<PAYLOAD> const *column)
+      : _iter(iter), _column(column) {}
+
+    typename space_type::const_iterator _iter;     ///< Iterator over the handle space.
+    std::vector<PAYLOAD> const *_column = nullptr; ///< Payload column.
+  };
+
+  /// Iterators are always constant.
+  using iterator = const_iterator;
+
+  /// Construct an empty space.
+  ColumnIPSpace() = default;
+
+  /** Mark the @a range with @a payload.
+   *
+   * @param range Range to mark.
+   * @param payload Payload to assign.
+   * @return @a this.
+   *
+   * All addresses in @a range are set to have the @a payload.
+   */
+  self_type &
+  mark(IPRange const &range, PAYLOAD const &payload) {
+    _space.mark(range, this->intern(payload));
+    return *this;
+  }
+
+  /** Fill the @a range with @a payload.
+   *
+   * @param range Range to fill.
+   * @param payload Payload for the range.
+   * @return @a this.
+   *
+   * Addresses in @a range are set to have @a payload if they do not already have a payload.
+   */
+  self_type &
+  fill(IPRange const &range, PAYLOAD const &payload) {
+    _space.fill(range, this->intern(payload));
+    return *this;
+  }
+
+  /** Append @a range with @a payload.
+   *
+   * @param range Range to append.
+   * @param payload Payload for the range.
+   * @return @a this.
+   *
+   * Fast path for loading data already sorted by address - see @c IPSpace::append.
+   */
+  self_type &
+  append(IPRange const &range, PAYLOAD const &payload) {
+    _space.append(range, this->intern(payload));
+    return *this;
+  }
+
+  /** Erase addresses in @a range.
+   *
+   * @param range Range to erase.
+   * @return @a this.
+   */
+  self_type &
+  erase(IPRange const &range) {
+    _space.erase(range);
+    return *this;
+  }
+
+  /** Find the payload for an @a addr.
+   *
+   * @param addr Address to find.
+   * @return An iterator for the range containing @a addr, or the @c end iterator if not found.
+   */
+  const_iterator
+  find(IPAddr const &addr) const {
+    return {_space.find(addr), &_column};
+  }
+
+  /// @return The number of distinct ranges.
+  size_t
+  count() const {
+    return _space.count();
+  }
+
+  /// @return The number of distinct payloads in the column.
+  size_t
+  payload_count() const {
+    return _column.size();
+  }
+
+  /// @return @c true if there are no ranges in the space, @c false otherwise.
+  bool
+  empty() const {
+    return _space.empty();
+  }
+
+  /// Remove all ranges and payloads.
+  self_type &
+  clear() {
+    _space.clear();
+    _column.clear();
+    _index.clear();
+    return *this;
+  }
+
+  /// @return Iterator for the first range.
+  const_iterator
+  begin() const {
+    return {_space.begin(), &_column};
+  }
+
+  /// @return Iterator past the last range.
+  const_iterator
+  end() const {
+    return {_space.end(), &_column};
+  }
+
+protected:
+  /// @return The handle for @a payload, adding it to the column if novel.
+  handle_type
+  intern(PAYLOAD const &payload) {
+    if (auto spot = _index.find(payload); spot != _index.end()) {
+      return spot->second;
+    }
+    auto handle = handle_type(_column.size());
+    _column.push_back(payload);
+    _index.insert({payload, handle});
+    return handle;
+  }
+
+  space_type _space;                              ///< Ranges, with payload handles in the nodes.
+  std::vector<PAYLOAD> _column;                   ///< Payloads, indexed by handle.
+  FlatHashMap<PAYLOAD, handle_type, OPS> _index;  ///< Payload deduplication index.
+};
+
+}} // namespace swoc::SWOC_VERSION_NS
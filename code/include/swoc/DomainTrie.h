@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   Domain name matching trie.
+ */
+
+#pragma once
+
+#include <optional>
+
+#include "swoc/swoc_version.h"
+#include "swoc/TextView.h"
+#include "swoc/MemArena.h"
+#include "swoc/IntrusiveHashMap.h"
+#include "swoc/ext/HashFNV.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** A reversed label trie for matching host names against domain patterns.
+ *
+ * Patterns are either exact host names ("ns1.example.com") or wildcards ("*.example.com", which
+ * matches any host with at least one label before "example.com" - not "example.com" itself). The
+ * bare pattern "*" matches every non-empty host. Matching walks the host labels right to left via
+ * @c take_suffix_at, so cost is proportional to the label count of the host, not the pattern
+ * count. An exact match wins over a wildcard and a deeper wildcard wins over a shallower one.
+ *
+ * Labels are compared without regard to case, per DNS. Trailing dots on patterns and hosts are
+ * ignored. Node and label storage is arena allocated - the trie allocates nothing per match.
+ *
+ * @tparam PAYLOAD Value stored per pattern and returned by @c match.
+ */
+template <typename PAYLOAD> class DomainTrie {
+  using self_type = DomainTrie; ///< Self reference type.
+
+public:
+  DomainTrie() = default;
+
+  /// Not copyable - nodes are intrusively linked in to instance storage.
+  DomainTrie(self_type const &that)           = delete;
+  self_type &operator=(self_type const &that) = delete;
+
+  /** Add @a pattern with @a payload.
+   *
+   * @param pattern Exact host name or wildcard domain pattern.
+   * @param payload Value to return when @a pattern is the best match.
+   * @return @a this
+   *
+   * Marking an already present pattern replaces its payload.
+   */
+  self_type &mark(TextView pattern, PAYLOAD payload);
+
+  /** Match @a host against the patterns.
+   *
+   * @param host Host name to match.
+   * @return The payload of the most specific matching pattern, or @c nullptr if none match.
+   */
+  PAYLOAD const *match(TextView host) const;
+
+  /// @overload
+  PAYLOAD *match(TextView host);
+
+  /// @return The number of patterns in the trie.
+  size_t count() const;
+
+protected:
+  /// A trie node - one domain label deep.
+  struct Node {
+    Node *_next   = nullptr; ///< Forward hash link.
+    Node *_prev   = nullptr; ///< Backward hash link.
+    Node *_parent = nullptr; ///< Node for the enclosing domain.
+    TextView _label;         ///< Label text, arena owned.
+    std::optional<PAYLOAD> _exact; ///< Payload for a pattern ending at this node.
+    std::optional<PAYLOAD> _wild;  ///< Payload for a wildcard at this node.
+  };
+
+  /// Node lookup key - all nodes live in one table, keyed by parent and label.
+  struct Key {
+    Node const *_parent; ///< Parent node.
+    TextView _label;     ///< Label under the parent.
+  };
+
+  /// @cond INTERNAL_DETAIL
+  struct Linkage {
+    static Node *&
+    next_ptr(Node *node) {
+      return node->_next;
+    }
+    static Node *&
+    prev_ptr(Node *node) {
+      return node->_prev;
+    }
+    static Key
+    key_of(Node *node) {
+      return {node->_parent, node->_label};
+    }
+    static uint32_t
+    hash_of(Key const &key) {
+      Hash32FNV1a h;
+      h.update({reinterpret_cast<char const *>(&key._parent), sizeof(key._parent)});
+      return h.update_nocase(key._label).final().get();
+    }
+    static bool
+    equal(Key const &lhs, Key const &rhs) {
+      return lhs._parent == rhs._parent && TextView::CaselessEqual{}(lhs._label, rhs._label);
+    }
+  };
+  /// @endcond
+
+  Node _root;                           ///< Anchor for top level labels - not in the table.
+  IntrusiveHashMap<Linkage> _table;     ///< All nodes, keyed by (parent, label).
+  MemArena _arena;                      ///< Node and label storage.
+  size_t _count = 0;                    ///< Number of patterns.
+
+  /// Find the child of @a parent for @a label, creating it if needed.
+  Node *descend(Node *parent, TextView const &label);
+};
+
+template <typename PAYLOAD>
+auto
+DomainTrie<PAYLOAD>::descend(Node *parent, TextView const &label) -> Node * {
+  auto spot = _table.find(Key{parent, label});
+  if (spot != _table.end()) {
+    return &*spot;
+  }
+  auto span = _arena.alloc(label.size()).rebind<char>();
+  memcpy(span, label);
+  Node *node    = _arena.make<Node>();
+  node->_parent = parent;
+  node->_label  = span;
+  _table.insert(node);
+  return node;
+}
+
+template <typename PAYLOAD>
+auto
+DomainTrie<PAYLOAD>::mark(TextView pattern, PAYLOAD payload) -> self_type & {
+  pattern.rtrim('.');
+  bool wild_p = false;
+  if ("*" == pattern) {
+    wild_p  = true;
+    pattern = TextView{};
+  } else if (pattern.starts_with("*.")) {
+    wild_p = true;
+    pattern.remove_prefix(2);
+  }
+
+  Node *node = &_root;
+  while (!pattern.empty()) {
+    node = this->descend(node, pattern.take_suffix_at('.'));
+  }
+  auto &slot = wild_p ? node->_wild : node->_exact;
+  if (!slot.has_value()) {
+    ++_count;
+  }
+  slot = std::move(payload);
+  return *this;
+}
+
+template <typename PAYLOAD>
+PAYLOAD const *
+DomainTrie<PAYLOAD>::match(TextView host) const {
+  host.rtrim('.');
+  if (host.empty()) {
+    return nullptr;
+  }
+  Node const *node    = &_root;
+  PAYLOAD const *best = _root._wild ? &*_root._wild : nullptr;
+  while (!host.empty()) {
+    auto label = host.take_suffix_at('.');
+    auto spot  = _table.find(Key{node, label});
+    if (spot == _table.end()) {
+      return best;
+    }
+    node = &*spot;
+    if (host.empty()) {
+      return node->_exact ? &*node->_exact : best;
+    }
+    if (node->_wild) {
+      best = &*node->_wild;
+    }
+  }
+  return best;
+}
+
+template <typename PAYLOAD>
+PAYLOAD *
+DomainTrie<PAYLOAD>::match(TextView host) {
+  return const_cast<PAYLOAD *>(static_cast<self_type const *>(this)->match(host));
+}
+
+template <typename PAYLOAD>
+size_t
+DomainTrie<PAYLOAD>::count() const {
+  return _count;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   Concurrent read / incremental update wrapper for IP address spaces.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include <swoc/FlatIPSpace.h>
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** Epoch published IP address space.
+ *
+ * @tparam PAYLOAD The color class - as for @c IPSpace.
+ *
+ * This supports the common deployment where many threads query a space continuously while a feed
+ * updates it periodically. A single master @c IPSpace is owned by the writer and mutated
+ * incrementally under a writer lock - it is never copied. Each update publishes a new epoch as a
+ * frozen @c FlatIPSpace snapshot, which readers obtain by reference count. A snapshot is immutable
+ * and remains valid for as long as the reader holds it, regardless of subsequent updates - an old
+ * epoch is reclaimed exactly when its last reader releases it, so there is no explicit quiescence
+ * protocol and readers never block writers.
+ *
+ * Readers should obtain a snapshot once per batch of lookups, not per lookup -
+ *
+ * @code
+ * auto space = epoch_space.snapshot();
+ * for ( auto const& addr : addrs ) {
+ *   if ( auto spot = space->find(addr) ; spot != space->end() ) { ... }
+ * }
+ * @endcode
+ *
+ * @internal Publication uses the @c std::shared_ptr atomic access functions. These are not
+ * guaranteed lock free by the standard but the critical section is a pointer exchange - in
+ * practice readers proceed without contending the writer lock or each other in any measurable
+ * way, and the snapshot itself is wait free once obtained.
+ */
+template <typename PAYLOAD> class EpochIPSpace {
+  using self_type = EpochIPSpace;
+
+public:
+  using space_type    = IPSpace<PAYLOAD>;                   ///< The mutable space type.
+  using snapshot_type = FlatIPSpace<PAYLOAD>;               ///< The published (immutable) space type.
+  using snapshot_ptr  = std::shared_ptr<snapshot_type const>; ///< Reader handle for a snapshot.
+
+  /// Construct with an empty space, published as epoch 0.
+  EpochIPSpace();
+
+  EpochIPSpace(self_type const &that)         = delete;
+  self_type &operator=(self_type const &that) = delete;
+
+  /** Get the current snapshot.
+   *
+   * @return A handle for the most recently published epoch.
+   *
+   * Safe to call from any thread at any time. The snapshot does not change under the caller - a
+   * subsequent @c update is visible only to later @c snapshot calls.
+   */
+  snapshot_ptr snapshot() const;
+
+  /** Apply @a mutator to the space and publish the result.
+   *
+   * @tparam F Mutation functor type (deduced).
+   * @param mutator Functor invoked with a reference to the master @c IPSpace.
+   * @return The newly published epoch.
+   *
+   * @a mutator may call any mutating method on the space - @c mark, @c blend, @c erase, etc. The
+   * mutation is applied incrementally to the master copy, then frozen and published as a new
+   * epoch. Updates are serialized with respect to each other; readers are unaffected until
+   * publication.
+   */
+  template <typename F> uint64_t update(F &&mutator);
+
+  /// @return The epoch of the most recent publication.
+  uint64_t epoch() const;
+
+protected:
+  space_type _space;                 ///< Master copy - mutated incrementally, never copied.
+  mutable std::mutex _writer_mutex;  ///< Serializes updates.
+  snapshot_ptr _snapshot;            ///< Current epoch, accessed atomically.
+  std::atomic<uint64_t> _epoch{0};   ///< Publication counter.
+};
+
+// --- Implementation
+
+template <typename PAYLOAD> EpochIPSpace<PAYLOAD>::EpochIPSpace() : _snapshot(std::make_shared<snapshot_type const>()) {}
+
+template <typename PAYLOAD>
+auto
+EpochIPSpace<PAYLOAD>::snapshot() const -> snapshot_ptr {
+  return std::atomic_load_explicit(&_snapshot, std::memory_order_acquire);
+}
+
+template <typename PAYLOAD>
+template <typename F>
+uint64_t
+EpochIPSpace<PAYLOAD>::update(F &&mutator) {
+  std::lock_guard<std::mutex> lock{_writer_mutex};
+  mutator(_space);
+  auto next = std::make_shared<snapshot_type const>(_space.freeze());
+  std::atomic_store_explicit(&_snapshot, snapshot_ptr{std::move(next)}, std::memory_order_release);
+  return ++_epoch;
+}
+
+template <typename PAYLOAD>
+uint64_t
+EpochIPSpace<PAYLOAD>::epoch() const {
+  return _epoch.load(std::memory_order_acquire);
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
@@ -85,6 +85,14 @@ public:
   /// If an @c Annotation is added with an explicit @c Severity that is smaller the @c Annotation is discarded instead of added.
   /// This defaults to zero and no filtering is done unless it is overwritten.
   static Severity FILTER_SEVERITY;
+  /// Minimum @c Errata severity for which deferred annotations are materialized.
+  /// A deferred annotation (@see note_dv) is formatted only if the severity of the @c Errata is at
+  /// least this when the instance is sunk or printed. This defaults to zero and deferred
+  /// annotations are always materialized unless it is overwritten.
+  static Severity SINK_SEVERITY;
+
+  /// Maximum total size of the arguments for a deferred annotation.
+  static constexpr size_t DEFERRED_ARG_SIZE = 64;
 
   static inline TextView AUTOTEXT_SEVERITY      = "{}";     ///< Format for auto generated annotation with severity.
   static inline TextView AUTOTEXT_CODE          = "{}";     ///< Format for auto generated annotation with error code.
@@ -127,11 +135,26 @@ public:
     /// Set the @a severity of @a this.
     self_type &assign(Severity severity);
 
+    /// Check if @a this is a deferred annotation that has not been materialized.
+    /// @note The text is empty until the annotation is materialized.
+    bool is_deferred() const;
+
   protected:
+    /// Type erased formatter for a deferred annotation - instantiated over the argument types.
+    using deferred_formatter_type = BufferWriter &(*)(BufferWriter &, bwf::Format const &, void const *);
+
     std::string_view _text;            ///< Annotation text.
     unsigned short _level{0};          ///< Nesting level for display purposes.
     std::optional<Severity> _severity; ///< Severity.
 
+    /// @{{
+    /// Deferred formatting state. The format is an external (presumed stable) pre-parsed format,
+    /// the arguments a localized copy. @a _fmt is reset to @c nullptr when the text is materialized.
+    bwf::Format const *_fmt                  = nullptr;
+    deferred_formatter_type _formatter       = nullptr;
+    MemSpan<void const> _args;
+    /// @}}
+
     /// @{{
     /// Policy and links for intrusive list.
     self_type *_next{nullptr};
@@ -198,12 +221,12 @@ protected:
     TextView _annotation_severity_glue_text = DEFAULT_SEVERITY_GLUE_TEXT;
     TextView _severity_glue_text            = DEFAULT_SEVERITY_GLUE_TEXT;
     TextView _indent_text                   = DEFAULT_INDENT_TEXT;
-    bool _glue_final_p                      = true; ///< Add glue after the last annotation?
+    bool _glue_final_p                      = true;  ///< Add glue after the last annotation?
+    bool _deferred_p                        = false; ///< Any unmaterialized deferred annotations?
 
-    std::optional<Severity> _severity; ///< Severity.
-    code_type _code{DEFAULT_CODE};     ///< Message code / ID
-    Container _notes;                  ///< The message stack.
-    swoc::MemArena _arena;             ///< Annotation text storage.
+    code_type _code{DEFAULT_CODE}; ///< Message code / ID
+    Container _notes;              ///< The message stack.
+    swoc::MemArena _arena;         ///< Annotation text storage.
   };
 
 public:
@@ -440,6 +463,60 @@ public:
   template <typename... Args>
   self_type &note_sv(std::optional<Severity> severity, std::string_view fmt, std::tuple<Args...> const &args);
 
+  /** Append a deferred @c Annotation.
+   * @param fmt Pre-parsed format.
+   * @param args Arguments for values in @a fmt.
+   * @return A reference to this object.
+   *
+   * The annotation is not formatted - @a fmt is captured by reference and @a args are copied in to
+   * @a this. Formatting is done only if the severity of @a this is at least @c SINK_SEVERITY when
+   * the instance is sunk or printed. This keeps annotating cheap on paths that rarely fail.
+   *
+   * @a fmt must be stable for the lifetime of @a this (in practice, a @c static ). The arguments
+   * must be trivially copyable, fit in @c DEFERRED_ARG_SIZE bytes in total, and any referenced
+   * memory (e.g. for a @c string_view argument) must also be stable.
+   *
+   * @see SINK_SEVERITY
+   * @see materialize
+   */
+  template <typename... Args> self_type &note(bwf::Format const &fmt, Args &&...args);
+
+  /** Append a deferred @c Annotation with a local @a severity.
+   * @param severity Local severity.
+   * @param fmt Pre-parsed format.
+   * @param args Arguments for values in @a fmt.
+   * @return A reference to this object.
+   *
+   * The severity is updated to @a severity if the latter is more severe.
+   *
+   * @see note(bwf::Format const&, Args&&...)
+   */
+  template <typename... Args> self_type &note(Severity severity, bwf::Format const &fmt, Args &&...args);
+
+  /** Append a deferred @c Annotation.
+   * @param severity Local severity.
+   * @param fmt Pre-parsed format.
+   * @param args Arguments for values in @a fmt.
+   * @return A reference to this object.
+   *
+   * This is the effective implementation method for the deferred styles of the @a note method.
+   *
+   * @see note(bwf::Format const&, Args&&...)
+   */
+  template <typename... Args>
+  self_type &note_dv(std::optional<Severity> severity, bwf::Format const &fmt, std::tuple<Args...> const &args);
+
+  /** Materialize deferred annotations.
+   *
+   * @return @a this
+   *
+   * If the severity of @a this is at least @c SINK_SEVERITY each deferred annotation is formatted
+   * and becomes a normal text annotation. Otherwise this is a no-op - the annotations remain
+   * deferred and render as empty. This is invoked implicitly when the instance is sunk or printed
+   * and needs to be called explicitly only to access annotation text directly.
+   */
+  self_type const &materialize() const;
+
   /** Copy messages from @a that to @a this.
    *
    * @param that Source object from which to copy.
@@ -672,6 +749,30 @@ public:
     register_sink(Sink::Handle(new SinkWrapper(std::move(f))));
   }
 
+  /** Enable asynchronous sink delivery.
+   *
+   * @param bypass Severity at or above which delivery remains synchronous.
+   *
+   * When enabled, a sunk @c Errata is moved (cheap - the handle is two words) onto a lock
+   * free queue and delivered to the registered sinks by a background thread, keeping
+   * serialization and I/O off the sinking thread. An erratum with severity at or above
+   * @a bypass is delivered synchronously in the sinking thread as usual - intended for
+   * severities where the process may not survive long enough for the background thread to
+   * run. Note a bypassed erratum can therefore be delivered before earlier queued erratum.
+   *
+   * Calling again updates @a bypass without restarting the background thread.
+   *
+   * @see disable_async_sink
+   */
+  static void enable_async_sink(Severity bypass);
+
+  /** Disable asynchronous sink delivery.
+   *
+   * Queued erratum are drained to the sinks and the background thread is joined before this
+   * returns. Subsequent sinking is synchronous. A no-op if not enabled.
+   */
+  static void disable_async_sink();
+
   /** Simple formatted output.
    */
   std::ostream &write(std::ostream &out) const;
@@ -683,6 +784,28 @@ protected:
   /// @see clear
   Data *_data = nullptr;
 
+  /// Severity.
+  /// @internal Kept in the handle, not @c Data, so that severity only instances (the common success
+  /// path) never allocate. The entire handle is two words.
+  std::optional<Severity> _severity;
+
+  /** Format a deferred annotation.
+   *
+   * @tparam T Tuple type of the deferred arguments.
+   * @param w Output.
+   * @param fmt Captured format.
+   * @param args Localized copy of the arguments.
+   * @return @a w
+   *
+   * @internal Instantiations of this provide the type erasure for deferred annotations - the
+   * annotation stores only a pointer to the instantiation and untyped argument memory.
+   */
+  template <typename T>
+  static BufferWriter &
+  deferred_format(BufferWriter &w, bwf::Format const &fmt, void const *args) {
+    return w.print_v(fmt, *static_cast<T const *>(args));
+  }
+
   /// Force data existence.
   /// @return A pointer to the data.
   Data *data();
@@ -831,6 +954,29 @@ public:
    */
   template <typename... Args> self_type &note(Severity severity, std::string_view fmt, Args &&...args);
 
+  /** Append a deferred message in to the result.
+   *
+   * @tparam Args Format argument types.
+   * @param fmt Pre-parsed format.
+   * @param args Arguments for @a fmt.
+   * @return @a *this
+   *
+   * @see Errata::note(bwf::Format const&, Args&&...)
+   */
+  template <typename... Args> self_type &note(bwf::Format const &fmt, Args &&...args);
+
+  /** Append a deferred message in to the result.
+   *
+   * @tparam Args Format argument types.
+   * @param severity Local severity.
+   * @param fmt Pre-parsed format.
+   * @param args Arguments for @a fmt.
+   * @return @a *this
+   *
+   * @see Errata::note(bwf::Format const&, Args&&...)
+   */
+  template <typename... Args> self_type &note(Severity severity, bwf::Format const &fmt, Args &&...args);
+
   /** Copy messages from @a that to @a this.
    *
    * @param that Source object from which to copy.
@@ -979,7 +1125,10 @@ inline Errata::Annotation::Annotation(std::string_view text, std::optional<Sever
 
 inline Errata::Annotation &
 Errata::Annotation::clear() {
-  _text = std::string_view{};
+  _text      = std::string_view{};
+  _fmt       = nullptr;
+  _formatter = nullptr;
+  _args      = MemSpan<void const>{};
   return *this;
 }
 
@@ -1011,6 +1160,11 @@ Errata::Annotation::assign(Errata::Severity severity) -> self_type & {
   return *this;
 }
 
+inline bool
+Errata::Annotation::is_deferred() const {
+  return nullptr != _fmt;
+}
+
 /* ----------------------------------------------------------------------- */
 // Inline methods for Errata::Data
 
@@ -1038,20 +1192,17 @@ Errata::Data::empty() const {
 
 inline Errata::Errata(self_type &&that) noexcept {
   std::swap(_data, that._data);
+  std::swap(_severity, that._severity);
 }
 
 inline Errata::Errata(code_type const &ec) {
   this->data()->_code = ec;
 }
 
-inline Errata::Errata(Severity severity) {
-  this->data()->_severity = severity;
-}
+inline Errata::Errata(Severity severity) : _severity(severity) {}
 
-inline Errata::Errata(const code_type &ec, Severity severity) {
-  auto d       = this->data();
-  d->_severity = severity;
-  d->_code     = ec;
+inline Errata::Errata(const code_type &ec, Severity severity) : _severity(severity) {
+  this->data()->_code = ec;
 }
 
 inline Errata::Errata(code_type const &ec, AutoText) {
@@ -1059,8 +1210,7 @@ inline Errata::Errata(code_type const &ec, AutoText) {
   this->note(AUTOTEXT_CODE, ec);
 }
 
-inline Errata::Errata(Severity severity, AutoText) {
-  this->data()->_severity = severity;
+inline Errata::Errata(Severity severity, AutoText) : _severity(severity) {
   this->note(AUTOTEXT_SEVERITY, severity);
 }
 
@@ -1093,9 +1243,14 @@ Errata::Errata(std::string_view fmt, Args &&...args) : Errata(DEFAULT_CODE, DEFA
 inline Errata &
 Errata::clear() {
   if (_data) {
-    _data->~Data(); // destructs the @c MemArena in @a _data which releases memory.
+    // Move the arena out of @a _data so the blocks survive destruction, then retire them to
+    // the pool for re-use by later instances. @a _data itself lives in one of those blocks.
+    MemArena arena{std::move(_data->_arena)};
+    _data->~Data();
     _data = nullptr;
+    ArenaPool::retire(std::move(arena));
   }
+  _severity.reset();
   return *this;
 }
 
@@ -1104,6 +1259,7 @@ Errata::operator=(self_type &&that) -> self_type & {
   if (this != &that) {
     this->clear();
     std::swap(_data, that._data);
+    std::swap(_severity, that._severity);
   }
   return *this;
 }
@@ -1135,16 +1291,16 @@ Errata::assign(code_type code) -> self_type & {
 
 inline bool
 Errata::has_severity() const {
-  return _data && _data->_severity.has_value();
+  return _severity.has_value();
 }
 inline auto
 Errata::severity() const -> Severity {
-  return this->has_severity() ? _data->_severity.value() : DEFAULT_SEVERITY;
+  return _severity.value_or(DEFAULT_SEVERITY);
 }
 
 inline auto
 Errata::assign(Severity severity) -> self_type & {
-  this->data()->_severity = severity;
+  _severity = severity;
   return *this;
 }
 
@@ -1155,7 +1311,7 @@ Errata::length() const {
 
 inline bool
 Errata::is_ok() const {
-  return nullptr == _data || this->severity() < FAILURE_SEVERITY;
+  return (nullptr == _data && !_severity.has_value()) || this->severity() < FAILURE_SEVERITY;
 }
 
 inline const Errata::Annotation &
@@ -1248,6 +1404,43 @@ Errata::note(Severity severity, std::string_view fmt, Args &&...args) {
   return this->note_sv(severity, fmt, std::forward_as_tuple(args...));
 }
 
+template <typename... Args>
+Errata &
+Errata::note_dv(std::optional<Severity> severity, bwf::Format const &fmt, std::tuple<Args...> const &args) {
+  using args_type = std::tuple<typename std::decay<Args>::type...>;
+  static_assert((std::is_trivially_copyable<typename std::decay<Args>::type>::value && ...),
+                "Deferred annotation arguments must be trivially copyable.");
+  static_assert(sizeof(args_type) <= DEFERRED_ARG_SIZE, "Deferred annotation arguments exceed DEFERRED_ARG_SIZE bytes.");
+
+  if (severity.has_value()) {
+    this->update(*severity);
+  }
+
+  if (!severity.has_value() || *severity >= FILTER_SEVERITY) {
+    auto d         = this->data();
+    auto *loc_args = d->_arena.make<args_type>(args); // localize the arguments.
+    auto *n        = d->_arena.make<Annotation>(std::string_view{}, severity);
+    n->_fmt        = &fmt;
+    n->_formatter  = &self_type::deferred_format<args_type>;
+    n->_args       = MemSpan<void const>{loc_args, sizeof(args_type)};
+    d->_notes.append(n);
+    d->_deferred_p = true;
+  }
+  return *this;
+}
+
+template <typename... Args>
+Errata &
+Errata::note(bwf::Format const &fmt, Args &&...args) {
+  return this->note_dv({}, fmt, std::forward_as_tuple(args...));
+}
+
+template <typename... Args>
+Errata &
+Errata::note(Severity severity, bwf::Format const &fmt, Args &&...args) {
+  return this->note_dv(severity, fmt, std::forward_as_tuple(args...));
+}
+
 inline Errata::iterator
 Errata::begin() {
   return _data ? _data->_notes.begin() : iterator();
@@ -1364,6 +1557,22 @@ Rv<R>::note(Severity severity, std::string_view fmt, Args &&...args) -> self_typ
   return *this;
 }
 
+template <typename R>
+template <typename... Args>
+auto
+Rv<R>::note(bwf::Format const &fmt, Args &&...args) -> self_type & {
+  _errata.note(fmt, std::forward<Args>(args)...);
+  return *this;
+}
+
+template <typename R>
+template <typename... Args>
+auto
+Rv<R>::note(Severity severity, bwf::Format const &fmt, Args &&...args) -> self_type & {
+  _errata.note(severity, fmt, std::forward<Args>(args)...);
+  return *this;
+}
+
 template <typename R>
 bool
 Rv<R>::is_ok() const {
@@ -1477,6 +1686,35 @@ BufferWriter &bwformat(BufferWriter &w, bwf::Spec const &spec, Errata::Annotatio
 
 BufferWriter &bwformat(BufferWriter &w, bwf::Spec const &spec, Errata const &);
 
+namespace errata {
+/** Serialize @a errata as a JSON object directly to @a w.
+ *
+ * @param w Output.
+ * @param errata Source message.
+ * @param note_min Minimum local severity for an annotation to be included.
+ * @return @a w
+ *
+ * The annotation list is walked exactly once with text escaped inline in to the destination -
+ * no intermediate strings. The object has a @c severity key (if set), @c code / @c code_text
+ * keys (if the code is set), and a @c notes array of objects with @c level, optional
+ * @c severity, and @c text keys. Annotations without a local severity are always included,
+ * others are dropped if below @a note_min.
+ */
+BufferWriter &to_json(BufferWriter &w, Errata const &errata, Errata::Severity note_min = Errata::Severity{0});
+
+/** Serialize @a errata in logfmt form directly to @a w.
+ *
+ * @param w Output.
+ * @param errata Source message.
+ * @param note_min Minimum local severity for an annotation to be included.
+ * @return @a w
+ *
+ * Emits <tt>severity=... code=... code_text="..." note0="..." note1="..."</tt> with values
+ * escaped inline, one pass over the annotation list. Filtering is as for @c to_json.
+ */
+BufferWriter &to_logfmt(BufferWriter &w, Errata const &errata, Errata::Severity note_min = Errata::Severity{0});
+} // namespace errata
+
 }} // namespace swoc::SWOC_VERSION_NS
 
 // Tuple / structured binding support.
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   File descriptor sink @c BufferWriter.
+ */
+
+#pragma once
+
+#include "swoc/swoc_version.h"
+#include "swoc/BufferChain.h"
+#include "swoc/Errata.h"
+#include "swoc/swoc_file.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** A @c BufferWriter that drains to a file descriptor.
+ *
+ * Output is accumulated in an internal @c BufferChain and flushed to the descriptor with a single
+ * @c writev of the block list - once when the buffered data reaches the flush threshold, once on
+ * explicit @c flush, and once on destruction. Formatted output therefore goes from the formatter
+ * to the kernel with no intermediate line buffer or stdio copy.
+ *
+ * The descriptor may be a file, pipe, or connected socket. I/O errors are captured in an
+ * @c Errata available from @c errata - after an error the buffered data that could not be
+ * written is dropped (keeping memory bounded) and the writer reports @c error until @c clear_error
+ * is called.
+ */
+class FileWriter : public BufferWriter {
+  using self_type  = FileWriter;   ///< Self reference type.
+  using super_type = BufferWriter; ///< Parent type.
+
+public:
+  /// Default size of the internal buffer blocks.
+  static constexpr size_t DEFAULT_BLOCK_SIZE = BufferChain::DEFAULT_BLOCK_SIZE;
+  /// Default amount of buffered data that triggers an automatic flush.
+  static constexpr size_t DEFAULT_FLUSH_SIZE = 0x10000;
+
+  /** Constructor.
+   *
+   * @param fd Open descriptor - the writer takes ownership and closes it on destruction.
+   * @param flush_size Buffered byte count that triggers an automatic flush.
+   * @param block_size Size of the internal buffer blocks.
+   */
+  explicit FileWriter(file::unique_fd &&fd, size_t flush_size = DEFAULT_FLUSH_SIZE, size_t block_size = DEFAULT_BLOCK_SIZE);
+
+  /// Not copyable - the descriptor is owned.
+  FileWriter(self_type const &that)           = delete;
+  self_type &operator=(self_type const &that) = delete;
+
+  /// Flush any buffered output and close the descriptor.
+  ~FileWriter() override;
+
+  /// Write a single character @a c.
+  self_type &write(char c) override;
+
+  /// Write @a length bytes starting at @a data.
+  self_type &write(void const *data, size_t length) override;
+
+  // Bring in non-overridden methods.
+  using super_type::write;
+
+  /// @return The first byte of the unflushed output, or @c nullptr if there is none.
+  char const *data() const override;
+
+  /// @return @c true if an I/O error has occurred and not been cleared.
+  bool error() const override;
+
+  /// @return The start of unused space in the current block, or @c nullptr if it is full.
+  char *aux_data() override;
+
+  /// @return Bytes flushed plus the capacity of the internal chain.
+  size_t capacity() const override;
+
+  /// @return Total number of bytes written, flushed or still buffered.
+  size_t extent() const override;
+
+  /// Add @a n bytes written via @c aux_data to the output.
+  bool commit(size_t n) override;
+
+  /// Drop @a n bytes from the end of the unflushed output.
+  self_type &discard(size_t n) override;
+
+  /// Reduce the space available in the current block by @a n bytes.
+  self_type &restrict(size_t n) override;
+
+  /// Restore @a n bytes of space removed by @c restrict.
+  self_type &restore(size_t n) override;
+
+  /// @internal Not supported - as for @c BufferChain, justification across blocks always throws.
+  self_type &copy(size_t dst, size_t src, size_t n) override;
+
+  /// Output the unflushed content to the @a stream.
+  std::ostream &operator>>(std::ostream &stream) const override;
+
+  /** Write the buffered output to the descriptor.
+   *
+   * @return @c true if all buffered data was written.
+   *
+   * The block list is submitted via @c writev - short writes and @c EINTR are retried. On a hard
+   * error the failure is noted in @c errata, the remaining buffered data is dropped, and the
+   * writer enters the error state.
+   */
+  bool flush();
+
+  /// @return The number of bytes successfully written to the descriptor.
+  size_t flushed() const;
+
+  /// @return The accumulated I/O errors.
+  Errata const &errata() const;
+
+  /// Leave the error state, discarding the accumulated errors.
+  self_type &clear_error();
+
+protected:
+  /// Maximum number of elements per @c writev call.
+  static constexpr size_t MAX_IOV = 1024;
+
+  file::unique_fd _fd; ///< Sink descriptor.
+  BufferChain _chain;  ///< Buffered output.
+  size_t _flush_size;  ///< Automatic flush threshold.
+  size_t _flushed = 0; ///< Bytes written to the descriptor.
+  bool _error_p = false; ///< Whether an I/O error has occurred.
+  Errata _errata;      ///< Captured I/O errors.
+};
+
+inline auto
+FileWriter::write(char c) -> self_type & {
+  return this->write(&c, 1);
+}
+
+inline char const *
+FileWriter::data() const {
+  return _chain.data();
+}
+
+inline bool
+FileWriter::error() const {
+  return _error_p;
+}
+
+inline char *
+FileWriter::aux_data() {
+  return _chain.aux_data();
+}
+
+inline size_t
+FileWriter::capacity() const {
+  return _flushed + _chain.capacity();
+}
+
+inline size_t
+FileWriter::extent() const {
+  return _flushed + _chain.extent();
+}
+
+inline bool
+FileWriter::commit(size_t n) {
+  return _chain.commit(n);
+}
+
+inline auto
+FileWriter::discard(size_t n) -> self_type & {
+  _chain.discard(n);
+  return *this;
+}
+
+inline auto
+FileWriter::restrict(size_t n) -> self_type & {
+  _chain.restrict(n);
+  return *this;
+}
+
+inline auto
+FileWriter::restore(size_t n) -> self_type & {
+  _chain.restore(n);
+  return *this;
+}
+
+inline auto
+FileWriter::copy(size_t dst, size_t src, size_t n) -> self_type & {
+  _chain.copy(dst, src, n);
+  return *this;
+}
+
+inline std::ostream &
+FileWriter::operator>>(std::ostream &stream) const {
+  return _chain >> stream;
+}
+
+inline size_t
+FileWriter::flushed() const {
+  return _flushed;
+}
+
+inline Errata const &
+FileWriter::errata() const {
+  return _errata;
+}
+
+inline auto
+FileWriter::clear_error() -> self_type & {
+  _error_p = false;
+  _errata.clear();
+  return *this;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    Callable wrapper with fixed inline storage - a @c std::function that never allocates.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "swoc/swoc_version.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** Callable wrapper with fixed inline storage.
+ *
+ * @tparam SIG Function signature, e.g. <tt>int(char, double)</tt>.
+ * @tparam N Capture storage size in bytes.
+ *
+ * This is a replacement for @c std::function for situations where allocation is unacceptable,
+ * such as callables stored in arena allocated tables or registered per transaction on a hot
+ * path. The target callable is constructed directly in a member buffer of @a N bytes - a
+ * callable whose captures do not fit is a compile time error, never a silent allocation.
+ *
+ * Invocation costs a single indirect call through a stored function pointer, the same as
+ * @c std::function without the branch to find out where the target lives.
+ *
+ * A target that is trivially copyable and trivially destructible - e.g. a lambda capturing
+ * only pointers, views, and scalars - makes the wrapper itself trivially relocatable: it can
+ * be moved with @c memcpy and abandoned without running a destructor, which is exactly what
+ * arena or hash table storage does to its elements. Such instances report @c true from
+ * @c is_trivial. Non-trivial targets are still supported - move and destruction are
+ * dispatched through a per-type operations table - but such instances must be properly
+ * destructed.
+ */
+template <typename SIG, size_t N = 4 * sizeof(void *)> class FixedFunction;
+
+/// Specialization to deduce the return and argument types from the signature.
+template <typename R, typename... ARGS, size_t N> class FixedFunction<R(ARGS...), N> {
+  using self_type = FixedFunction; ///< Self reference type.
+
+  /// Per-type operations for targets that are not trivially relocatable.
+  struct Ops {
+    void (*_move)(void *dst, void *src); ///< Move construct @a src into @a dst, destruct @a src.
+    void (*_destroy)(void *tgt);         ///< Destruct @a tgt.
+  };
+
+public:
+  /// Result type of invocation.
+  using result_type = R;
+
+  /// Construct empty.
+  FixedFunction() = default;
+
+  /// Construct with target callable @a f.
+  template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, self_type>>>
+  FixedFunction(F &&f) {
+    this->assign(std::forward<F>(f));
+  }
+
+  /// Move construct, taking the target from @a that.
+  FixedFunction(self_type &&that) noexcept {
+    this->relocate_from(that);
+  }
+
+  FixedFunction(self_type const &) = delete; // Target may not be copyable - no copying.
+
+  ~FixedFunction() {
+    this->reset();
+  }
+
+  /// Move assign, replacing any current target with that of @a that.
+  self_type &
+  operator=(self_type &&that) noexcept {
+    if (this != &that) {
+      this->reset();
+      this->relocate_from(that);
+    }
+    return *this;
+  }
+
+  self_type &operator=(self_type const &) = delete;
+
+  /// Replace any current target with the callable @a f.
+  template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, self_type>>>
+  self_type &
+  operator=(F &&f) {
+    this->reset();
+    this->assign(std::forward<F>(f));
+    return *this;
+  }
+
+  /// Remove the target, making @a this empty.
+  self_type &
+  reset() {
+    if (_ops) {
+      _ops->_destroy(&_storage);
+      _ops = nullptr;
+    }
+    _invoke = nullptr;
+    return *this;
+  }
+
+  /// Invoke the target.
+  R
+  operator()(ARGS... args) const {
+    return _invoke(const_cast<void *>(static_cast<void const *>(&_storage)), std::forward<ARGS>(args)...);
+  }
+
+  /// @return @c true if there is a target, @c false if empty.
+  explicit operator bool() const { return _invoke != nullptr; }
+
+  /** Check if @a this can be relocated trivially.
+   *
+   * @return @c true if @a this can be moved with @c memcpy and abandoned without destruction.
+   *
+   * This is a property of the current target - an empty instance is trivial.
+   */
+  bool is_trivial() const { return _ops == nullptr; }
+
+protected:
+  /// Construct the target @a f in local storage.
+  template <typename F>
+  void
+  assign(F &&f) {
+    using target_type = std::decay_t<F>;
+    static_assert(std::is_invocable_r_v<R, target_type &, ARGS...>, "FixedFunction: target is not callable with this signature");
+    static_assert(sizeof(target_type) <= N, "FixedFunction: target capture does not fit in the inline storage");
+    static_assert(alignof(target_type) <= alignof(std::max_align_t), "FixedFunction: target is over-aligned");
+
+    new (&_storage) target_type(std::forward<F>(f));
+    _invoke = [](void *tgt, ARGS... args) -> R {
+      return (*static_cast<target_type *>(tgt))(std::forward<ARGS>(args)...);
+    };
+    if constexpr (!(std::is_trivially_copyable_v<target_type> && std::is_trivially_destructible_v<target_type>)) {
+      static constexpr Ops OPS{
+        [](void *dst, void *src) -> void {
+          auto t = static_cast<target_type *>(src);
+          new (dst) target_type(std::move(*t));
+          t->~target_type();
+        },
+        [](void *tgt) -> void { static_cast<target_type *>(tgt)->~target_type(); }};
+      _ops = &OPS;
+    }
+  }
+
+  /// Take the target from @a that, leaving @a that empty. @a this must be empty.
+  void
+  relocate_from(self_type &that) noexcept {
+    if (that._ops) {
+      that._ops->_move(&_storage, &that._storage);
+      _ops      = that._ops;
+      that._ops = nullptr;
+    } else {
+      std::memcpy(&_storage, &that._storage, N);
+    }
+    _invoke      = that._invoke;
+    that._invoke = nullptr;
+  }
+
+  alignas(std::max_align_t) std::byte _storage[N]; ///< Target storage.
+  R (*_invoke)(void *, ARGS...) = nullptr;         ///< Invocation thunk, @c nullptr if empty.
+  Ops const *_ops               = nullptr;         ///< Non-trivial target operations, @c nullptr if trivial.
+};
+
+}} // namespace swoc::SWOC_VERSION_NS
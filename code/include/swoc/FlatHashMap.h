@@ -0,0 +1,750 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+  Flat (open addressing) hash map.
+
+  Companion to @c IntrusiveHashMap for element types that cannot carry intrusive linkage. Elements
+  are stored in a single flat array which is probed through a parallel array of control bytes, one
+  byte per slot. The control bytes for a group of slots are scanned with SIMD compares where
+  available so a lookup normally touches a single cache line of metadata plus the matching slot,
+  rather than walking a chain of separately allocated nodes.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <tuple>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "swoc/swoc_version.h"
+#include "swoc/MemArena.h"
+#include "swoc/TextView.h"
+#include "swoc/swoc_hash.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** Default key support for @c FlatHashMap.
+ *
+ * @tparam K Key type.
+ *
+ * This provides the hash and equality operations for a key type. The generic form uses
+ * @c std::hash and @c operator== - specializations are provided for string like keys which
+ * hash with the wide block hash (see "swoc/swoc_hash.h") so views and strings interoperate.
+ */
+template <typename K> struct FlatHashOps {
+  /// Hash @a key.
+  static size_t
+  hash_of(K const &key) {
+    return std::hash<K>()(key);
+  }
+
+  /// Equality check for @a lhs and @a rhs.
+  static bool
+  equal(K const &lhs, K const &rhs) {
+    return lhs == rhs;
+  }
+};
+
+/// String view keys - wide block hash over the contents.
+template <> struct FlatHashOps<std::string_view> {
+  static size_t
+  hash_of(std::string_view const &key) {
+    return hash::hash_64(key.data(), key.size());
+  }
+
+  static bool
+  equal(std::string_view const &lhs, std::string_view const &rhs) {
+    return lhs == rhs;
+  }
+};
+
+/// @c TextView keys hash identically to @c std::string_view keys.
+template <> struct FlatHashOps<TextView> : public FlatHashOps<std::string_view> {};
+
+/** A hash map with open addressed flat storage.
+ *
+ * @tparam K Key type.
+ * @tparam V Value (mapped) type.
+ * @tparam OPS Key operations - see @c FlatHashOps.
+ *
+ * Elements are @c std::pair<K const, V> in a single slot array. Each slot has a control byte -
+ * empty, deleted, or the low 7 bits of the element hash. Probing scans control bytes a group
+ * (16 slots) at a time, so a lookup that would walk a bucket chain in @c IntrusiveHashMap is a
+ * couple of byte compares in one cache line here.
+ *
+ * The growth interface mirrors @c IntrusiveHashMap - an @c ExpansionPolicy selects when the
+ * table expands and @c expand() forces it. Slot storage can optionally be drawn from a
+ * @c MemArena so the map can live entirely inside arena owned memory. Note that when arena
+ * backed, storage discarded by expansion remains in the arena - use @c reserve() to size the
+ * table up front if that matters.
+ *
+ * The key type must be copyable - keys are copied into the map on insert and when the table is
+ * expanded. View style keys (e.g. @c TextView) do not copy the underlying data, the caller
+ * must guarantee that outlives the map entry.
+ */
+template <typename K, typename V, typename OPS = FlatHashOps<K>> class FlatHashMap {
+  using self_type = FlatHashMap; ///< Self reference type.
+
+public:
+  using key_type    = K;                        ///< Key type.
+  using mapped_type = V;                        ///< Value type for a key.
+  using value_type  = std::pair<K const, V>;    ///< Element type.
+
+  /// When the table is expanded.
+  enum ExpansionPolicy {
+    MANUAL,  ///< Client must explicitly expand the table.
+    AVERAGE, ///< Table expands if percent occupancy exceeds the limit. [default]
+    MAXIMUM  ///< Table expands if any probe sequence exceeds the limit (in groups).
+  };
+
+  static constexpr size_t DEFAULT_EXPANSION_LIMIT         = 87; ///< Percent occupancy, roughly 7/8.
+  static constexpr ExpansionPolicy DEFAULT_EXPANSION_POLICY = AVERAGE;
+
+protected:
+  static constexpr size_t GROUP_SIZE    = 16;   ///< Control bytes probed per step.
+  static constexpr uint8_t CTRL_EMPTY   = 0x80; ///< Slot never occupied.
+  static constexpr uint8_t CTRL_DELETED = 0xFE; ///< Slot occupied then erased.
+  static constexpr size_t NPOS          = ~size_t{0}; ///< Invalid slot index.
+
+  /** Iterator implementation.
+   *
+   * @tparam P Element type - @c value_type or @c value_type @c const.
+   *
+   * Walks the control byte array in step with the slot array, skipping slots that are not
+   * occupied.
+   */
+  template <typename P> class iterator_impl {
+    using self_type = iterator_impl; ///< Self reference type.
+    friend class FlatHashMap;
+    template <typename U> friend class iterator_impl;
+
+  public:
+    using value_type        = P;
+    using pointer           = P *;
+    using reference         = P &;
+    using difference_type   = ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    iterator_impl() = default;
+
+    /// Implicit conversion from mutable to constant iterator.
+    template <typename U, typename = std::enable_if_t<std::is_same_v<U const, P>>>
+    iterator_impl(iterator_impl<U> const &that) : _ctrl(that._ctrl), _slot(that._slot), _limit(that._limit) {}
+
+    reference
+    operator*() const {
+      return *_slot;
+    }
+
+    pointer
+    operator->() const {
+      return _slot;
+    }
+
+    self_type &
+    operator++() {
+      ++_ctrl;
+      ++_slot;
+      this->seek();
+      return *this;
+    }
+
+    self_type
+    operator++(int) {
+      self_type zret{*this};
+      ++*this;
+      return zret;
+    }
+
+    bool
+    operator==(self_type const &that) const {
+      return _ctrl == that._ctrl;
+    }
+
+    bool
+    operator!=(self_type const &that) const {
+      return _ctrl != that._ctrl;
+    }
+
+  protected:
+    iterator_impl(uint8_t const *ctrl, pointer slot, uint8_t const *limit) : _ctrl(ctrl), _slot(slot), _limit(limit) {
+      this->seek();
+    }
+
+    /// Advance to the next occupied slot, if not already on one.
+    void
+    seek() {
+      while (_ctrl != _limit && (*_ctrl & 0x80)) {
+        ++_ctrl;
+        ++_slot;
+      }
+    }
+
+    uint8_t const *_ctrl  = nullptr; ///< Current control byte.
+    pointer _slot         = nullptr; ///< Current slot.
+    uint8_t const *_limit = nullptr; ///< End of the control byte array.
+  };
+
+public:
+  using iterator       = iterator_impl<value_type>;
+  using const_iterator = iterator_impl<value_type const>;
+
+  /// Default construct an empty map - no memory is allocated until the first insert.
+  FlatHashMap() = default;
+
+  /** Construct an arena backed map.
+   *
+   * @param arena Arena from which to allocate slot storage.
+   *
+   * @a arena must outlive @a this. The map does not release storage back to the arena.
+   */
+  explicit FlatHashMap(MemArena &arena) : _arena(&arena) {}
+
+  FlatHashMap(self_type &&that) noexcept;
+  self_type &operator=(self_type &&that) noexcept;
+
+  ~FlatHashMap();
+
+  /** Find an element with key @a key.
+   *
+   * @param key Key to search for.
+   * @return Iterator for the element, or the end iterator if not found.
+   */
+  iterator find(key_type const &key);
+  const_iterator find(key_type const &key) const;
+
+  /** Insert @a value if its key is not already present.
+   *
+   * @param value Element to insert.
+   * @return An iterator for the element with the key and a flag - @c true if @a value was
+   * inserted, @c false if an element with that key was already present (the map is unchanged).
+   */
+  std::pair<iterator, bool> insert(value_type const &value);
+  std::pair<iterator, bool> insert(value_type &&value);
+
+  /** Access the value for @a key, default constructing it if not present.
+   *
+   * @param key Key for the element.
+   * @return A reference to the value for @a key.
+   */
+  mapped_type &operator[](key_type const &key);
+
+  /** Remove the element with key @a key.
+   *
+   * @param key Key to search for.
+   * @return @c true if an element was removed, @c false if not found.
+   */
+  bool erase(key_type const &key);
+
+  /** Remove the element at @a spot.
+   *
+   * @param spot Iterator for the element to remove.
+   * @return An iterator for the next element.
+   */
+  iterator erase(iterator const &spot);
+
+  /// Remove all elements. Capacity is retained.
+  self_type &clear();
+
+  /// Number of elements in the map.
+  size_t count() const;
+
+  /// Number of slots in the table.
+  size_t capacity() const;
+
+  /** Reserve capacity for @a n elements.
+   *
+   * @param n Number of elements.
+   * @return @a this
+   *
+   * The table is expanded, if needed, so that @a n elements fit without further expansion
+   * under the current expansion limit. Most useful for arena backed maps.
+   */
+  self_type &reserve(size_t n);
+
+  /** Expand the table.
+
+      Useful primarily when the expansion policy is set to @c MANUAL.
+   */
+  void expand();
+
+  /// Set the expansion policy to @a policy.
+  self_type &set_expansion_policy(ExpansionPolicy policy);
+
+  /// Get the current expansion policy.
+  ExpansionPolicy get_expansion_policy() const;
+
+  /// Set the limit value for the expansion policy.
+  self_type &set_expansion_limit(size_t n);
+
+  /// Get the limit value for the expansion policy.
+  size_t get_expansion_limit() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+protected:
+  /// Result of probing for a key.
+  struct Probe {
+    size_t _match = NPOS; ///< Slot with a matching key, if any.
+    size_t _open  = NPOS; ///< First open (empty or deleted) slot in the probe sequence.
+    size_t _depth = 0;    ///< Number of groups probed.
+  };
+
+  /// Bit mask of slots in the group at @a ctrl whose control byte is @a byte.
+  static uint32_t group_match(uint8_t const *ctrl, uint8_t byte);
+  /// Bit mask of empty slots in the group at @a ctrl.
+  static uint32_t group_empty(uint8_t const *ctrl);
+  /// Bit mask of open (empty or deleted) slots in the group at @a ctrl.
+  static uint32_t group_open(uint8_t const *ctrl);
+  /// Index of the lowest set bit in @a mask, which must be non-zero.
+  static unsigned low_bit(uint32_t mask);
+
+  /// Probe the table for @a key with hash @a h.
+  Probe probe(size_t h, key_type const &key) const;
+
+  /// Find the first open slot in the probe sequence for hash @a h.
+  size_t open_slot_for(size_t h) const;
+
+  /** Find or claim the slot for @a key, expanding per policy.
+   *
+   * @return The slot index and a flag - @c true if the slot was claimed (the caller must
+   * construct the element there), @c false if an element with @a key is already in the slot.
+   */
+  std::pair<size_t, bool> prepare(key_type const &key);
+
+  /// Expand the table if required by the expansion policy before an insert.
+  void maybe_expand();
+
+  /// Rebuild the table with @a n slots, dropping deleted slot markers.
+  void rehash(size_t n);
+
+  /// Allocate storage for @a n slots and reset the control bytes.
+  void allocate(size_t n);
+
+  /// Release the storage at @a slots, if heap allocated.
+  void release(value_type *slots);
+
+  /// Destruct all live elements.
+  void destroy_elements();
+
+  value_type *_slots = nullptr; ///< Slot array.
+  uint8_t *_ctrl     = nullptr; ///< Control byte per slot, after the slots in the same allocation.
+  size_t _mask       = 0;       ///< Capacity - 1. Capacity is a power of 2 and a multiple of @c GROUP_SIZE.
+  size_t _count      = 0;       ///< Number of elements.
+  size_t _occupied   = 0;       ///< Slots that are not empty - elements plus deletion markers.
+  MemArena *_arena   = nullptr; ///< Optional source for slot storage.
+
+  ExpansionPolicy _expansion_policy{DEFAULT_EXPANSION_POLICY}; ///< When to expand the table.
+  size_t _expansion_limit{DEFAULT_EXPANSION_LIMIT};            ///< Limit value for expansion.
+
+  // noncopyable
+  FlatHashMap(self_type const &)            = delete;
+  self_type &operator=(self_type const &)   = delete;
+};
+
+// ---------------------
+
+template <typename K, typename V, typename OPS>
+uint32_t
+FlatHashMap<K, V, OPS>::group_match(uint8_t const *ctrl, uint8_t byte) {
+#if defined(__SSE2__)
+  __m128i g = _mm_loadu_si128(reinterpret_cast<__m128i const *>(ctrl));
+  return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8(static_cast<char>(byte)))));
+#else
+  uint32_t zret = 0;
+  for (unsigned idx = 0; idx < GROUP_SIZE; ++idx) {
+    zret |= uint32_t(ctrl[idx] == byte) << idx;
+  }
+  return zret;
+#endif
+}
+
+template <typename K, typename V, typename OPS>
+uint32_t
+FlatHashMap<K, V, OPS>::group_empty(uint8_t const *ctrl) {
+  return self_type::group_match(ctrl, CTRL_EMPTY);
+}
+
+template <typename K, typename V, typename OPS>
+uint32_t
+FlatHashMap<K, V, OPS>::group_open(uint8_t const *ctrl) {
+  // Open slots are exactly those with the sign bit set in the control byte.
+#if defined(__SSE2__)
+  __m128i g = _mm_loadu_si128(reinterpret_cast<__m128i const *>(ctrl));
+  return static_cast<uint32_t>(_mm_movemask_epi8(g));
+#else
+  uint32_t zret = 0;
+  for (unsigned idx = 0; idx < GROUP_SIZE; ++idx) {
+    zret |= uint32_t((ctrl[idx] & 0x80) != 0) << idx;
+  }
+  return zret;
+#endif
+}
+
+template <typename K, typename V, typename OPS>
+unsigned
+FlatHashMap<K, V, OPS>::low_bit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+  unsigned zret = 0;
+  while (0 == (mask & 1)) {
+    mask >>= 1;
+    ++zret;
+  }
+  return zret;
+#endif
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::probe(size_t h, key_type const &key) const -> Probe {
+  Probe zret;
+  if (!_ctrl) {
+    return zret;
+  }
+  uint8_t h2         = h & 0x7F;
+  size_t group_mask  = (_mask + 1) / GROUP_SIZE - 1;
+  size_t group_idx   = (h >> 7) & group_mask;
+  // Triangular probing over a power of 2 group count visits every group, so this terminates
+  // as long as at least one empty slot exists, which the expansion logic guarantees.
+  for (size_t n = 0;; ++n) {
+    uint8_t const *group = _ctrl + group_idx * GROUP_SIZE;
+    for (uint32_t m = self_type::group_match(group, h2); m; m &= m - 1) {
+      size_t idx = group_idx * GROUP_SIZE + self_type::low_bit(m);
+      if (OPS::equal(_slots[idx].first, key)) {
+        zret._match = idx;
+        zret._depth = n + 1;
+        return zret;
+      }
+    }
+    if (NPOS == zret._open) {
+      if (uint32_t m = self_type::group_open(group); m) {
+        zret._open = group_idx * GROUP_SIZE + self_type::low_bit(m);
+      }
+    }
+    if (self_type::group_empty(group) || n >= group_mask) {
+      zret._depth = n + 1;
+      return zret;
+    }
+    group_idx = (group_idx + n + 1) & group_mask;
+  }
+}
+
+template <typename K, typename V, typename OPS>
+size_t
+FlatHashMap<K, V, OPS>::open_slot_for(size_t h) const {
+  size_t group_mask = (_mask + 1) / GROUP_SIZE - 1;
+  size_t group_idx  = (h >> 7) & group_mask;
+  for (size_t n = 0;; ++n) {
+    if (uint32_t m = self_type::group_open(_ctrl + group_idx * GROUP_SIZE); m) {
+      return group_idx * GROUP_SIZE + self_type::low_bit(m);
+    }
+    group_idx = (group_idx + n + 1) & group_mask;
+  }
+}
+
+template <typename K, typename V, typename OPS>
+void
+FlatHashMap<K, V, OPS>::allocate(size_t n) {
+  size_t bytes = n * (sizeof(value_type) + 1);
+  void *raw    = _arena ? _arena->alloc(bytes, alignof(value_type)).data()
+                        : ::operator new(bytes, std::align_val_t(alignof(value_type)));
+  _slots = static_cast<value_type *>(raw);
+  _ctrl  = reinterpret_cast<uint8_t *>(_slots + n);
+  memset(_ctrl, CTRL_EMPTY, n);
+  _mask = n - 1;
+}
+
+template <typename K, typename V, typename OPS>
+void
+FlatHashMap<K, V, OPS>::release(value_type *slots) {
+  if (slots && !_arena) {
+    ::operator delete(slots, std::align_val_t(alignof(value_type)));
+  }
+  // Arena storage stays in the arena.
+}
+
+template <typename K, typename V, typename OPS>
+void
+FlatHashMap<K, V, OPS>::rehash(size_t n) {
+  uint8_t *old_ctrl     = _ctrl;
+  value_type *old_slots = _slots;
+  size_t old_capacity   = this->capacity();
+
+  this->allocate(n);
+  _occupied = _count; // deletion markers do not survive a rehash.
+  for (size_t idx = 0; idx < old_capacity; ++idx) {
+    if (0 == (old_ctrl[idx] & 0x80)) {
+      size_t spot = this->open_slot_for(OPS::hash_of(old_slots[idx].first));
+      _ctrl[spot] = old_ctrl[idx];
+      new (_slots + spot) value_type{std::move(old_slots[idx])};
+      old_slots[idx].~value_type();
+    }
+  }
+  this->release(old_slots);
+}
+
+template <typename K, typename V, typename OPS>
+void
+FlatHashMap<K, V, OPS>::maybe_expand() {
+  if (!_ctrl) {
+    this->rehash(GROUP_SIZE);
+    return;
+  }
+  size_t cap = _mask + 1;
+  bool grow  = (_occupied + 1) >= cap; // always keep an empty slot so probing terminates.
+  if (AVERAGE == _expansion_policy) {
+    grow = grow || (_occupied + 1) * 100 > cap * _expansion_limit;
+  }
+  if (grow) {
+    // If most of the occupancy is deletion markers, rebuilding at the same size suffices.
+    this->rehash(_count * 2 >= cap ? cap * 2 : cap);
+  }
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::prepare(key_type const &key) -> std::pair<size_t, bool> {
+  this->maybe_expand();
+  size_t h = OPS::hash_of(key);
+  Probe p  = this->probe(h, key);
+  if (NPOS != p._match) {
+    return {p._match, false};
+  }
+  if (MAXIMUM == _expansion_policy && p._depth > _expansion_limit) {
+    this->rehash(2 * (_mask + 1));
+    p = this->probe(h, key);
+  }
+  if (CTRL_EMPTY == _ctrl[p._open]) {
+    ++_occupied;
+  }
+  _ctrl[p._open] = h & 0x7F;
+  ++_count;
+  return {p._open, true};
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::find(key_type const &key) -> iterator {
+  Probe p = this->probe(OPS::hash_of(key), key);
+  return NPOS == p._match ? this->end() : iterator{_ctrl + p._match, _slots + p._match, _ctrl + this->capacity()};
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::find(key_type const &key) const -> const_iterator {
+  Probe p = this->probe(OPS::hash_of(key), key);
+  return NPOS == p._match ? this->end() : const_iterator{_ctrl + p._match, _slots + p._match, _ctrl + this->capacity()};
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::insert(value_type const &value) -> std::pair<iterator, bool> {
+  auto [idx, inserted] = this->prepare(value.first);
+  if (inserted) {
+    new (_slots + idx) value_type{value};
+  }
+  return {iterator{_ctrl + idx, _slots + idx, _ctrl + this->capacity()}, inserted};
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::insert(value_type &&value) -> std::pair<iterator, bool> {
+  auto [idx, inserted] = this->prepare(value.first);
+  if (inserted) {
+    new (_slots + idx) value_type{std::move(value)};
+  }
+  return {iterator{_ctrl + idx, _slots + idx, _ctrl + this->capacity()}, inserted};
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::operator[](key_type const &key) -> mapped_type & {
+  auto [idx, inserted] = this->prepare(key);
+  if (inserted) {
+    new (_slots + idx) value_type{std::piecewise_construct, std::forward_as_tuple(key), std::tuple<>{}};
+  }
+  return _slots[idx].second;
+}
+
+template <typename K, typename V, typename OPS>
+bool
+FlatHashMap<K, V, OPS>::erase(key_type const &key) {
+  Probe p = this->probe(OPS::hash_of(key), key);
+  if (NPOS == p._match) {
+    return false;
+  }
+  _slots[p._match].~value_type();
+  _ctrl[p._match] = CTRL_DELETED;
+  --_count;
+  return true;
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::erase(iterator const &spot) -> iterator {
+  size_t idx = spot._ctrl - _ctrl;
+  _slots[idx].~value_type();
+  _ctrl[idx] = CTRL_DELETED;
+  --_count;
+  iterator zret{spot};
+  return ++zret; // skips the now deleted slot.
+}
+
+template <typename K, typename V, typename OPS>
+void
+FlatHashMap<K, V, OPS>::destroy_elements() {
+  size_t cap = this->capacity();
+  for (size_t idx = 0; idx < cap; ++idx) {
+    if (0 == (_ctrl[idx] & 0x80)) {
+      _slots[idx].~value_type();
+    }
+  }
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::clear() -> self_type & {
+  this->destroy_elements();
+  if (_ctrl) {
+    memset(_ctrl, CTRL_EMPTY, _mask + 1);
+  }
+  _count = _occupied = 0;
+  return *this;
+}
+
+template <typename K, typename V, typename OPS> FlatHashMap<K, V, OPS>::~FlatHashMap() {
+  this->destroy_elements();
+  this->release(_slots);
+}
+
+template <typename K, typename V, typename OPS>
+FlatHashMap<K, V, OPS>::FlatHashMap(self_type &&that) noexcept
+  : _slots(that._slots), _ctrl(that._ctrl), _mask(that._mask), _count(that._count), _occupied(that._occupied),
+    _arena(that._arena), _expansion_policy(that._expansion_policy), _expansion_limit(that._expansion_limit) {
+  that._slots = nullptr;
+  that._ctrl  = nullptr;
+  that._mask  = 0;
+  that._count = that._occupied = 0;
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::operator=(self_type &&that) noexcept -> self_type & {
+  if (this != &that) {
+    this->destroy_elements();
+    this->release(_slots);
+    _slots            = that._slots;
+    _ctrl             = that._ctrl;
+    _mask             = that._mask;
+    _count            = that._count;
+    _occupied         = that._occupied;
+    _arena            = that._arena;
+    _expansion_policy = that._expansion_policy;
+    _expansion_limit  = that._expansion_limit;
+    that._slots       = nullptr;
+    that._ctrl        = nullptr;
+    that._mask        = 0;
+    that._count = that._occupied = 0;
+  }
+  return *this;
+}
+
+template <typename K, typename V, typename OPS>
+size_t
+FlatHashMap<K, V, OPS>::count() const {
+  return _count;
+}
+
+template <typename K, typename V, typename OPS>
+size_t
+FlatHashMap<K, V, OPS>::capacity() const {
+  return _ctrl ? _mask + 1 : 0;
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::reserve(size_t n) -> self_type & {
+  size_t needed = GROUP_SIZE;
+  // Smallest power of 2 capacity that holds @a n elements under the occupancy limit.
+  size_t limit = AVERAGE == _expansion_policy ? _expansion_limit : DEFAULT_EXPANSION_LIMIT;
+  while (n * 100 > needed * limit) {
+    needed *= 2;
+  }
+  if (needed > this->capacity()) {
+    this->rehash(needed);
+  }
+  return *this;
+}
+
+template <typename K, typename V, typename OPS>
+void
+FlatHashMap<K, V, OPS>::expand() {
+  this->rehash(_ctrl ? 2 * (_mask + 1) : GROUP_SIZE);
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::set_expansion_policy(ExpansionPolicy policy) -> self_type & {
+  _expansion_policy = policy;
+  return *this;
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::get_expansion_policy() const -> ExpansionPolicy {
+  return _expansion_policy;
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::set_expansion_limit(size_t n) -> self_type & {
+  _expansion_limit = n;
+  return *this;
+}
+
+template <typename K, typename V, typename OPS>
+size_t
+FlatHashMap<K, V, OPS>::get_expansion_limit() const {
+  return _expansion_limit;
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::begin() -> iterator {
+  return iterator{_ctrl, _slots, _ctrl + this->capacity()};
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::end() -> iterator {
+  size_t cap = this->capacity();
+  return iterator{_ctrl + cap, _slots + cap, _ctrl + cap};
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::begin() const -> const_iterator {
+  return const_iterator{_ctrl, _slots, _ctrl + this->capacity()};
+}
+
+template <typename K, typename V, typename OPS>
+auto
+FlatHashMap<K, V, OPS>::end() const -> const_iterator {
+  size_t cap = this->capacity();
+  return const_iterator{_ctrl + cap, _slots + cap, _ctrl + cap};
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
@@ -0,0 +1,605 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   Immutable flattened IP address space.
+ */
+
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include <cstring>
+
+#include <swoc/IPRange.h>
+#include <swoc/swoc_file.h>
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+template <typename PAYLOAD> class TrieIPSpace; // Trie indexed form - see "swoc/TrieIPSpace.h".
+
+/** Immutable flattened form of @c IPSpace.
+ *
+ * @tparam PAYLOAD The color class.
+ *
+ * This is a read-only variant of @c IPSpace for spaces that are loaded once and then queried
+ * heavily. The ranges are stored in sorted arrays, one per address family, so a lookup is a binary
+ * search over contiguous memory rather than a walk of tree nodes - a few cache lines instead of a
+ * cache miss per node. An instance is created from a populated space via @c IPSpace::freeze or
+ * constructed as a view over externally managed arrays.
+ *
+ * @see IPSpace::freeze
+ */
+template <typename PAYLOAD> class FlatIPSpace {
+  using self_type = FlatIPSpace;
+
+public:
+  using payload_t = PAYLOAD; ///< Export payload type.
+  /// Iterator value, a range and payload.
+  using value_type = detail::ip_space_const_value_type<PAYLOAD>;
+
+  /// A flattened IPv4 range and its payload.
+  struct Node4 {
+    IP4Range _range;  ///< Address range.
+    PAYLOAD _payload; ///< Payload for @a _range.
+  };
+
+  /// A flattened IPv6 range and its payload.
+  struct Node6 {
+    IP6Range _range;  ///< Address range.
+    PAYLOAD _payload; ///< Payload for @a _range.
+  };
+
+  /// Construct an empty space.
+  FlatIPSpace() = default;
+
+  FlatIPSpace(self_type const &that) = delete;
+
+  /// Move constructor - takes ownership of the storage in @a that.
+  FlatIPSpace(self_type &&that) noexcept;
+
+  /** Construct from a populated @a space.
+   *
+   * @param space Source space.
+   *
+   * The ranges and payloads in @a space are copied in to internal arrays with sequential writes -
+   * @a space is not modified and the two instances are subsequently independent.
+   */
+  explicit FlatIPSpace(IPSpace<PAYLOAD> const &space);
+
+  /** Construct as a view over external arrays.
+   *
+   * @param ip4 Sorted IPv4 nodes.
+   * @param ip6 Sorted IPv6 nodes.
+   *
+   * The nodes are not copied - the caller must keep the memory valid and unchanged for the
+   * lifetime of this instance. The memory is never written and so may be a read-only mapping.
+   */
+  FlatIPSpace(MemSpan<Node4 const> const &ip4, MemSpan<Node6 const> const &ip6);
+
+  self_type &operator=(self_type const &that) = delete;
+  self_type &operator=(self_type &&that)      = delete;
+
+  ~FlatIPSpace();
+
+  /** Constant iterator.
+   * The value type is a range and a payload, both constant.
+   *
+   * @internal As with @c IPSpace the value type is synthesized in the iterator because the nodes
+   * are family specific while the value type is family independent.
+   */
+  class const_iterator {
+    using self_type = const_iterator; ///< Self reference type.
+    friend class FlatIPSpace;
+    template <typename P> friend class TrieIPSpace; // constructs iterators from trie results.
+
+  public:
+    using value_type = FlatIPSpace::value_type; ///< Import for API compliance.
+    // STL algorithm compliance.
+    using iterator_category = std::bidirectional_iterator_tag;
+    using pointer           = value_type const *;
+    using reference         = value_type const &;
+    using difference_type   = int;
+
+    /// Default constructor.
+    const_iterator() = default;
+
+    /// Copy constructor.
+    const_iterator(self_type const &that) = default;
+
+    /// Assignment.
+    self_type &operator=(self_type const &that) = default;
+
+    /// Pre-increment.
+    /// Move to the next element in the space.
+    /// @return The iterator.
+    self_type &operator++();
+
+    /// Pre-decrement.
+    /// Move to the previous element in the space.
+    /// @return The iterator.
+    self_type &operator--();
+
+    /// Post-increment.
+    /// Move to the next element in the space.
+    /// @return The iterator value before the increment.
+    self_type operator++(int);
+
+    /// Post-decrement.
+    /// Move to the previous element in the space.
+    /// @return The iterator value before the decrement.
+    self_type operator--(int);
+
+    /// Dereference.
+    /// @return A reference to the referent.
+    reference operator*() const;
+
+    /// Dereference.
+    /// @return A pointer to the referent.
+    pointer operator->() const;
+
+    /// Equality
+    bool operator==(self_type const &that) const;
+
+    /// Inequality
+    bool operator!=(self_type const &that) const;
+
+  protected:
+    /** Construct at a specific position.
+     *
+     * @param space Containing space.
+     * @param idx Element index - IPv4 nodes first, then IPv6.
+     */
+    const_iterator(FlatIPSpace const *space, size_t idx);
+
+    /// Update the synthesized value from the current position.
+    void update();
+
+    FlatIPSpace const *_space = nullptr; ///< Containing space.
+    size_t _idx               = 0;       ///< Element index.
+    value_type _value;                   ///< Synthesized value for dereference.
+  };
+
+  /// Iterators are always constant - the space is immutable.
+  using iterator = const_iterator;
+
+  /** Find the payload for an @a addr.
+   *
+   * @param addr Address to find.
+   * @return An iterator for the range containing @a addr, or the @c end iterator if not found.
+   */
+  const_iterator find(IPAddr const &addr) const;
+
+  /// @overload
+  const_iterator find(IP4Addr const &addr) const;
+
+  /// @overload
+  const_iterator find(IP6Addr const &addr) const;
+
+  /// @return The number of distinct ranges.
+  size_t count() const;
+
+  /// @return The number of IPv4 ranges.
+  size_t count_ip4() const;
+
+  /// @return The number of IPv6 ranges.
+  size_t count_ip6() const;
+
+  /** Number of ranges for a specific address family.
+   *
+   * @param f Address family.
+   * @return The number of ranges of @a family.
+   */
+  size_t count(sa_family_t f) const;
+
+  /// @return @c true if there are no ranges in the space, @c false otherwise.
+  bool empty() const;
+
+  /// @return Iterator for the first range.
+  const_iterator begin() const;
+
+  /// @return Iterator past the last range.
+  const_iterator end() const;
+
+  /** Header for the serialized form.
+   *
+   * The serialized image is this header followed by the node arrays at the recorded byte offsets.
+   * Everything is stored by offset, never by pointer, so an image is position independent and a
+   * single read-only mapping of it can be shared across processes. Data is in native byte order -
+   * the magic number doubles as an endianness check since a byte swapped image fails to validate.
+   *
+   * Serialization requires @c PAYLOAD be trivially copyable.
+   */
+  struct SerialHeader {
+    static constexpr uint32_t MAGIC   = 0x53504946; ///< Format marker - "FIPS" as little endian bytes.
+    static constexpr uint32_t VERSION = 1;          ///< Current format version.
+
+    uint32_t _magic;        ///< Format marker - must be @c MAGIC.
+    uint32_t _version;      ///< Format version.
+    uint64_t _payload_size; ///< @c sizeof(PAYLOAD) - guards against payload type mismatch.
+    uint64_t _n4;           ///< Number of IPv4 nodes.
+    uint64_t _n6;           ///< Number of IPv6 nodes.
+    uint64_t _offset4;      ///< Byte offset of the IPv4 node array.
+    uint64_t _offset6;      ///< Byte offset of the IPv6 node array.
+  };
+
+  /// @return The number of bytes required to serialize @a this.
+  size_t serialized_size() const;
+
+  /** Serialize in to @a buffer.
+   *
+   * @param buffer Destination memory - must be at least @c serialized_size bytes.
+   * @param ec Error code return.
+   * @return The number of bytes written, 0 on error.
+   */
+  size_t serialize(MemSpan<void> const &buffer, std::error_code &ec) const;
+
+  /** Write the serialized form to the file at @a p.
+   *
+   * @param p Path to file - created or truncated.
+   * @param ec Error code return.
+   * @return @c true if the file was written, @c false if @a ec has an error code.
+   */
+  bool store(file::path const &p, std::error_code &ec) const;
+
+  /** Construct a view over a serialized @a image.
+   *
+   * @param image Serialized image.
+   * @param ec Error code return.
+   * @return The space, empty on error.
+   *
+   * Zero copy - the result refers directly in to @a image, which must remain valid and unchanged
+   * for the lifetime of the result. @a image is never written and may be a read-only mapping.
+   */
+  static self_type view(MemSpan<void const> const &image, std::error_code &ec);
+
+  /** Memory map the serialized file at @a p.
+   *
+   * @param p Path to a file written by @c store.
+   * @param ec Error code return.
+   * @return The space, empty on error.
+   *
+   * The file is mapped read-only and shared - no data is parsed or copied and concurrent maps in
+   * other processes share the same physical pages. The instance owns the mapping, which is
+   * released when the instance is destroyed.
+   */
+  static self_type map(file::path const &p, std::error_code &ec);
+
+protected:
+  /** Search @a nodes for the node containing @a addr.
+   *
+   * @tparam N Node type.
+   * @tparam A Address type.
+   * @param nodes Sorted node array.
+   * @param addr Search value.
+   * @return The containing node, or @c nullptr if no range contains @a addr.
+   *
+   * This is a branchless binary search - the probe index update compiles to a conditional move so
+   * the hardware never mispredicts on the (random) comparison results.
+   */
+  template <typename N, typename A> static N const *search(MemSpan<N> const &nodes, A const &addr);
+
+  /// @return @a size rounded up to a multiple of @a align.
+  static constexpr size_t
+  align_up(size_t size, size_t align) {
+    return (size + align - 1) & ~(align - 1);
+  }
+
+  /// @internal Stored non-const to synthesize iterator values - the public API is entirely const.
+  MemSpan<Node4> _ip4;    ///< Sorted IPv4 nodes.
+  MemSpan<Node6> _ip6;    ///< Sorted IPv6 nodes.
+  MemArena _arena;        ///< Node storage, when built from a space rather than a view.
+  MemSpan<void> _mapping; ///< Memory mapped image, when constructed via @c map.
+};
+
+// --- Implementation
+
+template <typename PAYLOAD>
+FlatIPSpace<PAYLOAD>::FlatIPSpace(self_type &&that) noexcept
+  : _ip4(that._ip4), _ip6(that._ip6), _arena(std::move(that._arena)), _mapping(that._mapping) {
+  that._ip4     = MemSpan<Node4>{};
+  that._ip6     = MemSpan<Node6>{};
+  that._mapping = MemSpan<void>{};
+}
+
+template <typename PAYLOAD> FlatIPSpace<PAYLOAD>::FlatIPSpace(IPSpace<PAYLOAD> const &space) {
+  _ip4 = _arena.alloc(sizeof(Node4) * space.count_ip4(), alignof(Node4)).template rebind<Node4>();
+  _ip6 = _arena.alloc(sizeof(Node6) * space.count_ip6(), alignof(Node6)).template rebind<Node6>();
+  auto n4 = _ip4.data();
+  for (auto spot = space.begin(AF_INET), limit = space.end(AF_INET); spot != limit; ++spot, ++n4) {
+    new (n4) Node4{spot->range_view().ip4(), spot->payload()};
+  }
+  auto n6 = _ip6.data();
+  for (auto spot = space.begin(AF_INET6), limit = space.end(AF_INET6); spot != limit; ++spot, ++n6) {
+    new (n6) Node6{spot->range_view().ip6(), spot->payload()};
+  }
+}
+
+template <typename PAYLOAD>
+FlatIPSpace<PAYLOAD>::FlatIPSpace(MemSpan<Node4 const> const &ip4, MemSpan<Node6 const> const &ip6)
+  : _ip4(const_cast<Node4 *>(ip4.data()), ip4.count()), _ip6(const_cast<Node6 *>(ip6.data()), ip6.count()) {}
+
+template <typename PAYLOAD> FlatIPSpace<PAYLOAD>::~FlatIPSpace() {
+  if (_arena.size() > 0) { // nodes are owned - destroy the payloads, the arena releases the memory.
+    for (auto &n : _ip4) {
+      std::destroy_at(&n._payload);
+    }
+    for (auto &n : _ip6) {
+      std::destroy_at(&n._payload);
+    }
+  }
+  if (!_mapping.empty()) {
+    ::munmap(_mapping.data(), _mapping.size());
+  }
+}
+
+template <typename PAYLOAD>
+template <typename N, typename A>
+auto
+FlatIPSpace<PAYLOAD>::search(MemSpan<N> const &nodes, A const &addr) -> N const * {
+  N const *base = nodes.data();
+  size_t n      = nodes.count();
+  if (0 == n) {
+    return nullptr;
+  }
+  while (n > 1) { // narrow to the last node with min() <= @a addr.
+    size_t half = n / 2;
+    base        = (base[half]._range.min() <= addr) ? base + half : base;
+    n -= half;
+  }
+  return base->_range.contains(addr) ? base : nullptr;
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::find(IP4Addr const &addr) const -> const_iterator {
+  auto n = self_type::search(_ip4, addr);
+  return n ? const_iterator{this, size_t(n - _ip4.data())} : this->end();
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::find(IP6Addr const &addr) const -> const_iterator {
+  auto n = self_type::search(_ip6, addr);
+  return n ? const_iterator{this, _ip4.count() + size_t(n - _ip6.data())} : this->end();
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::find(IPAddr const &addr) const -> const_iterator {
+  if (addr.is_ip4()) {
+    return this->find(addr.ip4());
+  } else if (addr.is_ip6()) {
+    return this->find(addr.ip6());
+  }
+  return this->end();
+}
+
+template <typename PAYLOAD>
+size_t
+FlatIPSpace<PAYLOAD>::count() const {
+  return _ip4.count() + _ip6.count();
+}
+
+template <typename PAYLOAD>
+size_t
+FlatIPSpace<PAYLOAD>::count_ip4() const {
+  return _ip4.count();
+}
+
+template <typename PAYLOAD>
+size_t
+FlatIPSpace<PAYLOAD>::count_ip6() const {
+  return _ip6.count();
+}
+
+template <typename PAYLOAD>
+size_t
+FlatIPSpace<PAYLOAD>::count(sa_family_t f) const {
+  return IP4Addr::AF_value == f ? _ip4.count() : IP6Addr::AF_value == f ? _ip6.count() : 0;
+}
+
+template <typename PAYLOAD>
+bool
+FlatIPSpace<PAYLOAD>::empty() const {
+  return _ip4.empty() && _ip6.empty();
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::begin() const -> const_iterator {
+  return const_iterator{this, 0};
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::end() const -> const_iterator {
+  return const_iterator{this, this->count()};
+}
+
+template <typename PAYLOAD>
+size_t
+FlatIPSpace<PAYLOAD>::serialized_size() const {
+  size_t zret = align_up(sizeof(SerialHeader), alignof(Node4)) + _ip4.data_size();
+  return align_up(zret, alignof(Node6)) + _ip6.data_size();
+}
+
+template <typename PAYLOAD>
+size_t
+FlatIPSpace<PAYLOAD>::serialize(MemSpan<void> const &buffer, std::error_code &ec) const {
+  static_assert(std::is_trivially_copyable_v<PAYLOAD>, "FlatIPSpace serialization requires a trivially copyable payload");
+  if (buffer.size() < this->serialized_size()) {
+    ec = std::make_error_code(std::errc::no_buffer_space);
+    return 0;
+  }
+  SerialHeader header;
+  header._magic        = SerialHeader::MAGIC;
+  header._version      = SerialHeader::VERSION;
+  header._payload_size = sizeof(PAYLOAD);
+  header._n4           = _ip4.count();
+  header._n6           = _ip6.count();
+  header._offset4      = align_up(sizeof(SerialHeader), alignof(Node4));
+  header._offset6      = align_up(header._offset4 + _ip4.data_size(), alignof(Node6));
+
+  auto base = static_cast<char *>(buffer.data());
+  memcpy(base, &header, sizeof(header));
+  memcpy(base + header._offset4, _ip4.data(), _ip4.data_size());
+  memcpy(base + header._offset6, _ip6.data(), _ip6.data_size());
+  return header._offset6 + _ip6.data_size();
+}
+
+template <typename PAYLOAD>
+bool
+FlatIPSpace<PAYLOAD>::store(file::path const &p, std::error_code &ec) const {
+  std::vector<char> image(this->serialized_size());
+  auto n = this->serialize(MemSpan<void>(image.data(), image.size()), ec);
+  if (ec) {
+    return false;
+  }
+  file::unique_fd fd{::open(p.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644)};
+  if (fd < 0) {
+    ec = std::error_code(errno, std::system_category());
+    return false;
+  }
+  if (::write(fd, image.data(), n) != ssize_t(n)) {
+    ec = std::error_code(errno, std::system_category());
+    return false;
+  }
+  return true;
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::view(MemSpan<void const> const &image, std::error_code &ec) -> self_type {
+  static_assert(std::is_trivially_copyable_v<PAYLOAD>, "FlatIPSpace serialization requires a trivially copyable payload");
+  SerialHeader header;
+  if (image.size() < sizeof(header)) {
+    ec = std::make_error_code(std::errc::invalid_argument);
+    return {};
+  }
+  memcpy(&header, image.data(), sizeof(header)); // copy out to avoid alignment assumptions.
+  if (SerialHeader::MAGIC != header._magic || SerialHeader::VERSION != header._version ||
+      sizeof(PAYLOAD) != header._payload_size ||
+      header._offset4 + header._n4 * sizeof(Node4) > image.size() ||
+      header._offset6 + header._n6 * sizeof(Node6) > image.size()) {
+    ec = std::make_error_code(std::errc::invalid_argument);
+    return {};
+  }
+  auto base = static_cast<char const *>(image.data());
+  return self_type{MemSpan<Node4 const>(reinterpret_cast<Node4 const *>(base + header._offset4), size_t(header._n4)),
+                   MemSpan<Node6 const>(reinterpret_cast<Node6 const *>(base + header._offset6), size_t(header._n6))};
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::map(file::path const &p, std::error_code &ec) -> self_type {
+  file::unique_fd fd{::open(p.c_str(), O_RDONLY)};
+  if (fd < 0) {
+    ec = std::error_code(errno, std::system_category());
+    return {};
+  }
+  auto stat = file::status(p, ec);
+  if (ec) {
+    return {};
+  }
+  size_t size = file::file_size(stat);
+  void *addr  = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  if (MAP_FAILED == addr) {
+    ec = std::error_code(errno, std::system_category());
+    return {};
+  }
+  auto zret = self_type::view(MemSpan<void const>(addr, size), ec);
+  if (ec) {
+    ::munmap(addr, size);
+    return {};
+  }
+  zret._mapping = MemSpan<void>(addr, size);
+  return zret;
+}
+
+// --- FlatIPSpace::const_iterator
+
+template <typename PAYLOAD> FlatIPSpace<PAYLOAD>::const_iterator::const_iterator(FlatIPSpace const *space, size_t idx) : _space(space), _idx(idx) {
+  this->update();
+}
+
+template <typename PAYLOAD>
+void
+FlatIPSpace<PAYLOAD>::const_iterator::update() {
+  auto n4 = _space->_ip4.count();
+  if (_idx < n4) {
+    auto &n = _space->_ip4[_idx];
+    _value.assign(n._range, n._payload);
+  } else if (_idx - n4 < _space->_ip6.count()) {
+    auto &n = _space->_ip6[_idx - n4];
+    _value.assign(n._range, n._payload);
+  } else {
+    _value.clear();
+  }
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::const_iterator::operator++() -> self_type & {
+  ++_idx;
+  this->update();
+  return *this;
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::const_iterator::operator--() -> self_type & {
+  --_idx;
+  this->update();
+  return *this;
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::const_iterator::operator++(int) -> self_type {
+  self_type zret{*this};
+  ++*this;
+  return zret;
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::const_iterator::operator--(int) -> self_type {
+  self_type zret{*this};
+  --*this;
+  return zret;
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::const_iterator::operator*() const -> reference {
+  return _value;
+}
+
+template <typename PAYLOAD>
+auto
+FlatIPSpace<PAYLOAD>::const_iterator::operator->() const -> pointer {
+  return &_value;
+}
+
+template <typename PAYLOAD>
+bool
+FlatIPSpace<PAYLOAD>::const_iterator::operator==(self_type const &that) const {
+  return _space == that._space && _idx == that._idx;
+}
+
+template <typename PAYLOAD>
+bool
+FlatIPSpace<PAYLOAD>::const_iterator::operator!=(self_type const &that) const {
+  return !(*this == that);
+}
+
+// --- IPSpace::freeze
+
+template <typename PAYLOAD>
+FlatIPSpace<PAYLOAD>
+IPSpace<PAYLOAD>::freeze() const {
+  return FlatIPSpace<PAYLOAD>{*this};
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
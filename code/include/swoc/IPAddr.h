@@ -13,6 +13,13 @@
 #include "swoc/MemSpan.h"
 #include "swoc/swoc_ip_util.h"
 
+/// Use native 128 bit arithmetic for IPv6 address math where the compiler provides it.
+#if defined(__SIZEOF_INT128__)
+#define SWOC_HAS_INT128 1
+#else
+#define SWOC_HAS_INT128 0
+#endif
+
 namespace swoc { inline namespace SWOC_VERSION_NS {
 
 using std::string_view;
@@ -115,6 +122,17 @@ public:
    */
   bool load(string_view const &text);
 
+  /** Parse a column of address strings.
+   *
+   * @param texts Text for each address.
+   * @param addrs Parsed results, parallel to @a texts.
+   * @return The number of addresses successfully parsed.
+   *
+   * @a addrs must be at least as large as @a texts. Entries that fail to parse are set to
+   * @c INADDR_ANY, as with @c load.
+   */
+  static size_t parse_many(MemSpan<string_view const> const &texts, MemSpan<self_type> const &addrs);
+
   /// Standard ternary compare.
   int cmp(self_type const &that) const;
 
@@ -341,6 +359,17 @@ public:
   */
   bool load(string_view const &str);
 
+  /** Parse a column of address strings.
+   *
+   * @param texts Text for each address.
+   * @param addrs Parsed results, parallel to @a texts.
+   * @return The number of addresses successfully parsed.
+   *
+   * @a addrs must be at least as large as @a texts. Entries that fail to parse are cleared,
+   * as with @c load.
+   */
+  static size_t parse_many(MemSpan<string_view const> const &texts, MemSpan<self_type> const &addrs);
+
   /// Generic three value compare.
   int cmp(self_type const &that) const;
 
@@ -450,6 +479,35 @@ protected:
   /// Type used to store the address.
   using word_store_type = std::array<word_type, N_STORE>;
 
+#if SWOC_HAS_INT128
+  /// Unsigned 128 bit type, used for single operation address math.
+  __extension__ typedef unsigned __int128 u128;
+
+  /// @return The address as a single 128 bit value.
+  u128
+  as_u128() const {
+    return (u128{_addr._store[MSW]} << WORD_WIDTH) | _addr._store[LSW];
+  }
+
+  /** Store @a v as the address value.
+   *
+   * @param v The address as a 128 bit value.
+   * @return @a this.
+   */
+  self_type &
+  assign_u128(u128 v) {
+    _addr._store[MSW] = static_cast<word_type>(v >> WORD_WIDTH);
+    _addr._store[LSW] = static_cast<word_type>(v);
+    return *this;
+  }
+
+  /// @return A 128 bit mask with the upper @a cidr bits set.
+  static u128
+  u128_cidr_mask(unsigned cidr) {
+    return cidr ? ~u128{0} << (WIDTH - cidr) : u128{0};
+  }
+#endif
+
   /// Type for digging around inside the address, with the various forms of access.
   /// These are in sort of host order - @a _store elements are host order, but the
   /// MSW and LSW are swapped (big-endian). This makes various bits of the implementation
@@ -479,6 +537,17 @@ protected:
   /// @param src Input value to resorder.
   static void reorder(unsigned char dst[WORD_SIZE], unsigned char const src[WORD_SIZE]);
 
+  /** Parse full form IPv6 text - eight colon separated hex quads.
+   *
+   * @param src Whitespace trimmed text.
+   * @return @c true if @a src parsed, @c false to fall back to the general parser.
+   *
+   * Table driven fast path for already normalized text, the dominant form in logs. Compressed
+   * ("::"), bracketed, and mixed IPv4 forms are left to the general parser. @a this is updated
+   * only on success.
+   */
+  bool parse_full_form(string_view const &src);
+
   /** Construct from two 64 bit values.
    *
    * @param msw The most significant 64 bits, host order.
@@ -586,6 +655,16 @@ public:
    */
   bool load(string_view const &text);
 
+  /** Parse a column of address strings of either family.
+   *
+   * @param texts Text for each address.
+   * @param addrs Parsed results, parallel to @a texts.
+   * @return The number of addresses successfully parsed.
+   *
+   * @a addrs must be at least as large as @a texts. Entries that fail to parse are invalid.
+   */
+  static size_t parse_many(MemSpan<string_view const> const &texts, MemSpan<self_type> const &addrs);
+
   /// Generic compare.
   int cmp(self_type const &that) const;
 
@@ -1029,17 +1108,25 @@ IP6Addr::operator=(sockaddr_in6 const *addr) -> self_type & {
 
 inline auto
 IP6Addr::operator++() -> self_type & {
+#if SWOC_HAS_INT128
+  this->assign_u128(this->as_u128() + 1);
+#else
   if (++(_addr._store[LSW]) == 0) {
     ++(_addr._store[MSW]);
   }
+#endif
   return *this;
 }
 
 inline auto
 IP6Addr::operator--() -> self_type & {
+#if SWOC_HAS_INT128
+  this->assign_u128(this->as_u128() - 1);
+#else
   if (--(_addr._store[LSW]) == ~static_cast<uint64_t>(0)) {
     --(_addr._store[MSW]);
   }
+#endif
   return *this;
 }
 
@@ -1067,9 +1154,13 @@ operator!=(IP6Addr const &lhs, IP6Addr const &rhs) {
 /// @return @c true if @a lhs is less than @a rhs.
 inline bool
 operator<(IP6Addr const &lhs, IP6Addr const &rhs) {
+#if SWOC_HAS_INT128
+  return lhs.as_u128() < rhs.as_u128();
+#else
   return lhs._addr._store[IP6Addr::MSW] < rhs._addr._store[IP6Addr::MSW] ||
          (lhs._addr._store[IP6Addr::MSW] == rhs._addr._store[IP6Addr::MSW] &&
           lhs._addr._store[IP6Addr::LSW] < rhs._addr._store[IP6Addr::LSW]);
+#endif
 }
 
 /// @return @c true if @a lhs is greater than @a rhs.
@@ -1081,9 +1172,13 @@ operator>(IP6Addr const &lhs, IP6Addr const &rhs) {
 /// @return @c true if @a lhs is less than or equal to @a rhs.
 inline bool
 operator<=(IP6Addr const &lhs, IP6Addr const &rhs) {
+#if SWOC_HAS_INT128
+  return lhs.as_u128() <= rhs.as_u128();
+#else
   return lhs._addr._store[IP6Addr::MSW] < rhs._addr._store[IP6Addr::MSW] ||
          (lhs._addr._store[IP6Addr::MSW] == rhs._addr._store[IP6Addr::MSW] &&
           lhs._addr._store[IP6Addr::LSW] <= rhs._addr._store[IP6Addr::LSW]);
+#endif
 }
 
 /// @return @c true if @a lhs is greater than or equal to @a rhs.
@@ -1100,6 +1195,9 @@ IP6Addr::copy_to(sockaddr *sa) const {
 
 inline auto
 IP6Addr::operator&=(IPMask const &mask) -> self_type & {
+#if SWOC_HAS_INT128
+  this->assign_u128(this->as_u128() & u128_cidr_mask(mask._cidr));
+#else
   if (mask._cidr <= WORD_WIDTH) {
     _addr._store[LSW] = 0;
     if (0 == mask._cidr) {
@@ -1110,11 +1208,15 @@ IP6Addr::operator&=(IPMask const &mask) -> self_type & {
   } else if (mask._cidr < WIDTH) {
     _addr._store[LSW] &= (WORD_MASK << (2 * WORD_WIDTH - mask._cidr));
   }
+#endif
   return *this;
 }
 
 inline auto
 IP6Addr::operator|=(IPMask const &mask) -> self_type & {
+#if SWOC_HAS_INT128
+  this->assign_u128(this->as_u128() | ~u128_cidr_mask(mask._cidr));
+#else
   if (mask._cidr > WORD_WIDTH) {
     if (mask._cidr < WIDTH) {
       _addr._store[LSW] |= (WORD_MASK >> (mask._cidr - WORD_WIDTH));
@@ -1127,6 +1229,7 @@ IP6Addr::operator|=(IPMask const &mask) -> self_type & {
       _addr._store[MSW] |= (WORD_MASK >> mask._cidr);
     }
   }
+#endif
   return *this;
 }
 
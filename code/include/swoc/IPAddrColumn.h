@@ -0,0 +1,307 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   Structure of arrays container for batches of IP addresses.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <swoc/IPAddr.h>
+#include <swoc/FlatIPSpace.h>
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace ip {
+
+/** Structure of arrays container for batches of IP addresses.
+ *
+ * The variant style @c IPAddr is convenient for single addresses but poor for analytic scans -
+ * every element drags a family tag and padding through the cache and forces a branch per element.
+ * This container segregates a batch in to a packed IPv4 column and a packed IPv6 column at
+ * insertion time, each paired with an index column recording the original insertion order, so
+ * results can be mapped back to the source rows. The per element branch is paid once on insert
+ * and the batch operations then run over homogeneous contiguous arrays.
+ *
+ * @code
+ * swoc::ip::AddrColumn col;
+ * for ( auto const& addr : batch ) { col.append(addr); }
+ * col.sort();
+ * std::vector<bool> hits(col.count());
+ * col.test(space, hits); // hits[i] - was batch[i] in the space?
+ * @endcode
+ */
+class AddrColumn {
+  using self_type = AddrColumn; ///< Self reference type.
+
+public:
+  /// Original order index type - an insertion batch is limited to 2^32 addresses.
+  using index_type = uint32_t;
+
+  AddrColumn() = default;
+
+  /** Reserve column storage.
+   *
+   * @param n4 Expected number of IPv4 addresses.
+   * @param n6 Expected number of IPv6 addresses.
+   * @return @a this
+   */
+  self_type &reserve(size_t n4, size_t n6);
+
+  /** Append @a addr to the batch.
+   *
+   * @param addr Address to add.
+   * @return @a this
+   *
+   * An address of any other family is counted in the insertion order but stored in neither
+   * column, so index mapping for subsequent addresses is preserved.
+   */
+  self_type &append(IPAddr const &addr);
+
+  /// @overload
+  self_type &append(IP4Addr const &addr);
+
+  /// @overload
+  self_type &append(IP6Addr const &addr);
+
+  /// @return The number of addresses appended, including non-IP family values.
+  size_t count() const;
+
+  /// @return The number of IPv4 addresses.
+  size_t count_ip4() const;
+
+  /// @return The number of IPv6 addresses.
+  size_t count_ip6() const;
+
+  /// @return @c true if no addresses have been appended.
+  bool empty() const;
+
+  /// @return The IPv4 column.
+  MemSpan<IP4Addr const> ip4() const;
+
+  /// @return The IPv6 column.
+  MemSpan<IP6Addr const> ip6() const;
+
+  /// @return The original insertion index for each element of the IPv4 column.
+  MemSpan<index_type const> ip4_index() const;
+
+  /// @return The original insertion index for each element of the IPv6 column.
+  MemSpan<index_type const> ip6_index() const;
+
+  /** Sort each column in ascending address order.
+   *
+   * @return @a this
+   *
+   * The index columns are permuted identically so original order mapping is preserved. Equal
+   * addresses stay in insertion order. The IPv4 column is sorted as packed 64 bit
+   * (address, index) keys - no indirection in the comparisons, so the sort runs at scalar
+   * integer speed.
+   */
+  self_type &sort();
+
+  /** Remove duplicate addresses from each column.
+   *
+   * @return @a this
+   *
+   * The columns must be sorted. The first appended instance of each address (the one with the
+   * smallest index) is kept.
+   */
+  self_type &unique();
+
+  /** Test batch membership in @a space.
+   *
+   * @tparam PAYLOAD Payload type of the space.
+   * @param space Space to probe.
+   * @param results Membership flag per address, indexed by original insertion order.
+   * @return The number of addresses found in @a space.
+   *
+   * Equivalent to @c space.find on each address, but the probes are issued a homogeneous column
+   * at a time - no family dispatch in the loop - and sorted input makes consecutive probes walk
+   * nearly identical search paths, keeping the upper tree levels cache resident.
+   *
+   * @a results should hold at least @c count flags - addresses whose index is out of range for
+   * @a results are skipped. Entries for non-IP family values are untouched.
+   */
+  template <typename PAYLOAD> size_t test(FlatIPSpace<PAYLOAD> const &space, std::vector<bool> &results) const;
+
+  /// Remove all addresses.
+  void clear();
+
+protected:
+  std::vector<IP4Addr> _v4;    ///< IPv4 column.
+  std::vector<index_type> _x4; ///< Original index per IPv4 element.
+  std::vector<IP6Addr> _v6;    ///< IPv6 column.
+  std::vector<index_type> _x6; ///< Original index per IPv6 element.
+  index_type _serial = 0;      ///< Next insertion index.
+};
+
+// --- Implementation
+
+inline auto
+AddrColumn::reserve(size_t n4, size_t n6) -> self_type & {
+  _v4.reserve(n4);
+  _x4.reserve(n4);
+  _v6.reserve(n6);
+  _x6.reserve(n6);
+  return *this;
+}
+
+inline auto
+AddrColumn::append(IP4Addr const &addr) -> self_type & {
+  _v4.push_back(addr);
+  _x4.push_back(_serial++);
+  return *this;
+}
+
+inline auto
+AddrColumn::append(IP6Addr const &addr) -> self_type & {
+  _v6.push_back(addr);
+  _x6.push_back(_serial++);
+  return *this;
+}
+
+inline auto
+AddrColumn::append(IPAddr const &addr) -> self_type & {
+  if (addr.is_ip4()) {
+    return this->append(addr.ip4());
+  } else if (addr.is_ip6()) {
+    return this->append(addr.ip6());
+  }
+  ++_serial; // hold the slot so later indices still map to source rows.
+  return *this;
+}
+
+inline size_t
+AddrColumn::count() const {
+  return _serial;
+}
+
+inline size_t
+AddrColumn::count_ip4() const {
+  return _v4.size();
+}
+
+inline size_t
+AddrColumn::count_ip6() const {
+  return _v6.size();
+}
+
+inline bool
+AddrColumn::empty() const {
+  return 0 == _serial;
+}
+
+inline MemSpan<IP4Addr const>
+AddrColumn::ip4() const {
+  return {_v4.data(), _v4.size()};
+}
+
+inline MemSpan<IP6Addr const>
+AddrColumn::ip6() const {
+  return {_v6.data(), _v6.size()};
+}
+
+inline auto
+AddrColumn::ip4_index() const -> MemSpan<index_type const> {
+  return {_x4.data(), _x4.size()};
+}
+
+inline auto
+AddrColumn::ip6_index() const -> MemSpan<index_type const> {
+  return {_x6.data(), _x6.size()};
+}
+
+inline auto
+AddrColumn::sort() -> self_type & {
+  // IPv4 - pack each (address, index) pair in to a single 64 bit key. The sort then moves and
+  // compares plain integers, and the ascending index in the low bits makes it stable.
+  std::vector<uint64_t> keys;
+  keys.reserve(_v4.size());
+  for (size_t idx = 0; idx < _v4.size(); ++idx) {
+    keys.push_back((uint64_t(_v4[idx].host_order()) << 32) | _x4[idx]);
+  }
+  std::sort(keys.begin(), keys.end());
+  for (size_t idx = 0; idx < keys.size(); ++idx) {
+    _v4[idx] = IP4Addr{in_addr_t(keys[idx] >> 32)};
+    _x4[idx] = index_type(keys[idx]);
+  }
+
+  // IPv6 - 16 byte keys do not pack, so sort a permutation and apply it to both columns.
+  std::vector<index_type> perm(_v6.size());
+  for (index_type idx = 0; idx < perm.size(); ++idx) {
+    perm[idx] = idx;
+  }
+  std::sort(perm.begin(), perm.end(), [&](index_type lhs, index_type rhs) {
+    return _v6[lhs] != _v6[rhs] ? _v6[lhs] < _v6[rhs] : _x6[lhs] < _x6[rhs];
+  });
+  std::vector<IP6Addr> v6;
+  std::vector<index_type> x6;
+  v6.reserve(perm.size());
+  x6.reserve(perm.size());
+  for (auto idx : perm) {
+    v6.push_back(_v6[idx]);
+    x6.push_back(_x6[idx]);
+  }
+  _v6 = std::move(v6);
+  _x6 = std::move(x6);
+  return *this;
+}
+
+inline auto
+AddrColumn::unique() -> self_type & {
+  size_t out = 0;
+  for (size_t idx = 0; idx < _v4.size(); ++idx) {
+    if (0 == idx || _v4[idx] != _v4[out - 1]) {
+      _v4[out] = _v4[idx];
+      _x4[out] = _x4[idx];
+      ++out;
+    }
+  }
+  _v4.resize(out);
+  _x4.resize(out);
+
+  out = 0;
+  for (size_t idx = 0; idx < _v6.size(); ++idx) {
+    if (0 == idx || _v6[idx] != _v6[out - 1]) {
+      _v6[out] = _v6[idx];
+      _x6[out] = _x6[idx];
+      ++out;
+    }
+  }
+  _v6.resize(out);
+  _x6.resize(out);
+  return *this;
+}
+
+template <typename PAYLOAD>
+size_t
+AddrColumn::test(FlatIPSpace<PAYLOAD> const &space, std::vector<bool> &results) const {
+  size_t zret = 0;
+  auto limit  = space.end();
+  for (size_t idx = 0; idx < _v4.size(); ++idx) {
+    if (_x4[idx] < results.size() && space.find(_v4[idx]) != limit) {
+      results[_x4[idx]] = true;
+      ++zret;
+    }
+  }
+  for (size_t idx = 0; idx < _v6.size(); ++idx) {
+    if (_x6[idx] < results.size() && space.find(_v6[idx]) != limit) {
+      results[_x6[idx]] = true;
+      ++zret;
+    }
+  }
+  return zret;
+}
+
+inline void
+AddrColumn::clear() {
+  _v4.clear();
+  _x4.clear();
+  _v6.clear();
+  _x6.clear();
+  _serial = 0;
+}
+
+} // namespace ip
+}} // namespace swoc::SWOC_VERSION_NS
@@ -9,6 +9,8 @@
 #include <string_view>
 #include <variant> // for std::monostate
 #include <tuple>
+#include <vector>
+#include <algorithm>
 
 #include <swoc/DiscreteRange.h>
 #include <swoc/IPAddr.h>
@@ -1101,6 +1103,8 @@ ip_space_const_value_type<PAYLOAD>::operator==(std::tuple<swoc::IPRange, PAYLOAD
 
 } // namespace detail
 
+template <typename PAYLOAD> class FlatIPSpace; // Immutable flattened form - see "swoc/FlatIPSpace.h".
+
 /** Coloring of IP address space.
  *
  * @tparam PAYLOAD The color class.
@@ -1147,6 +1151,18 @@ public:
    */
   self_type &fill(IPRange const &range, PAYLOAD const &payload);
 
+  /** Append @a range with @a payload.
+   *
+   * @param range Range to append.
+   * @param payload Payload to assign.
+   * @return @a this
+   *
+   * Fast path for loading sorted data - if @a range starts past the last range of its family the
+   * insertion is amortized constant time, merging with that range if adjacent with an equal
+   * payload. Otherwise this devolves to @c mark. @see Builder for loading unsorted data in bulk.
+   */
+  self_type &append(IPRange const &range, PAYLOAD const &payload);
+
   /** Erase addresses in @a range.
    *
    * @param range Address range.
@@ -1201,6 +1217,123 @@ public:
   /// Remove all ranges.
   void clear();
 
+  /** Rewrite the nodes into contiguous slabs in key order.
+   *
+   * @return @a this
+   *
+   * Improves locality for iteration and range scans after bulk loading.
+   * @see DiscreteSpace::compact
+   */
+  self_type &compact();
+
+  /** Freeze the space in to a flat immutable form.
+   *
+   * @return A @c FlatIPSpace with the same ranges and payloads as @a this.
+   *
+   * @a this is not modified. The result does not share storage with @a this and remains valid
+   * after @a this is modified or destroyed.
+   *
+   * @note Defined in "swoc/FlatIPSpace.h", which must be included to use this method.
+   */
+  FlatIPSpace<PAYLOAD> freeze() const;
+
+  /** Replace the contents of @a this with the union of @a lhs and @a rhs.
+   *
+   * @tparam F Payload combining functor type.
+   * @param lhs A space.
+   * @param rhs A space.
+   * @param combiner Functor to combine payloads where the spaces overlap.
+   * @return @a this
+   *
+   * Both spaces are walked once per family and the result is built with the sorted append fast
+   * path - linear in the total range count, in contrast to iterating one space and blending in
+   * to the other. @a this must not be either input.
+   * @see DiscreteSpace::assign_union
+   */
+  template <typename F> self_type &assign_union(self_type const &lhs, self_type const &rhs, F &&combiner);
+
+  /** Replace the contents of @a this with the intersection of @a lhs and @a rhs.
+   *
+   * @tparam F Payload combining functor type.
+   * @param lhs A space.
+   * @param rhs A space.
+   * @param combiner Functor to combine the payloads of intersecting ranges.
+   * @return @a this
+   *
+   * Linear as for @c assign_union. @a this must not be either input.
+   */
+  template <typename F> self_type &assign_intersection(self_type const &lhs, self_type const &rhs, F &&combiner);
+
+  /// @overload Intersection keeping the @a lhs payload.
+  self_type &assign_intersection(self_type const &lhs, self_type const &rhs);
+
+  /** Replace the contents of @a this with @a lhs minus the coverage of @a rhs.
+   *
+   * @param lhs The base space.
+   * @param rhs The space to subtract - only its coverage matters, payloads are ignored.
+   * @return @a this
+   *
+   * Linear as for @c assign_union. @a this must not be either input.
+   */
+  self_type &assign_difference(self_type const &lhs, self_type const &rhs);
+
+  /** Bulk loader for a space.
+   *
+   * Collects (range, payload) pairs and then loads them in to a space in a single pass. The pairs
+   * are sorted by family and minimum address so almost all of the insertions take the sorted append
+   * fast path, making the load linear in the number of pairs rather than the O(n log n) of
+   * repeated @c mark calls. Overlapping pairs are marked in ascending order of minimum address,
+   * pairs with equal minimums in staging order - the pair marked later takes the overlap.
+   *
+   * @code
+   * IPSpace<unsigned>::Builder builder;
+   * for ( auto const& [ range, value ] : feed ) {
+   *   builder.insert(range, value);
+   * }
+   * builder.commit(space);
+   * @endcode
+   */
+  class Builder {
+    using self_type = Builder; ///< Self reference type.
+
+  public:
+    Builder() = default; ///< Construct an empty builder.
+
+    /** Reserve staging room for @a n pairs.
+     *
+     * @param n Number of pairs expected.
+     * @return @a this
+     */
+    self_type &reserve(size_t n);
+
+    /** Stage @a range with @a payload for loading.
+     *
+     * @param range Range to load.
+     * @param payload Payload to assign.
+     * @return @a this
+     */
+    self_type &insert(IPRange const &range, PAYLOAD const &payload);
+
+    /** Load the staged pairs in to @a space.
+     *
+     * @param space Target space.
+     * @return @a space
+     *
+     * The staged pairs are released, leaving the builder empty and ready for another batch.
+     */
+    IPSpace &commit(IPSpace &space);
+
+    /// @return The number of staged pairs.
+    size_t count() const;
+
+    /// Discard all staged pairs.
+    void clear();
+
+  protected:
+    std::vector<std::pair<IP4Range, PAYLOAD>> _ip4; ///< Staged IPv4 pairs.
+    std::vector<std::pair<IP6Range, PAYLOAD>> _ip6; ///< Staged IPv6 pairs.
+  };
+
   /** Constant iterator.
    * The value type is a tuple of the IP address range and the @a PAYLOAD. Both are constant.
    *
@@ -1417,6 +1550,20 @@ public:
    */
   const_iterator find(IP6Addr const &addr) const;
 
+  /** Find the payloads for a batch of @a addrs.
+   *
+   * @param addrs Addresses to find.
+   * @param results Iterator for each address - the @c end iterator for a miss.
+   * @return The number of addresses found.
+   *
+   * Equivalent to @c find on each address, but the tree searches for each family are walked in
+   * an interleaved fashion with software prefetch so their node fetches overlap, which raises
+   * throughput substantially for batches on large spaces.
+   *
+   * At most <tt>min(addrs.count(), results.count())</tt> lookups are performed.
+   */
+  size_t find(MemSpan<IPAddr const> const &addrs, MemSpan<iterator> const &results);
+
   /// @return An iterator to the first element.
   iterator begin();
 
@@ -1514,6 +1661,10 @@ protected:
  * addresses without any additional data.
  *
  * @note Because there is only one value stored, there is no difference between @c mark and @c fill.
+ *
+ * @internal IPv4 membership is kept in compressed per /16 chunks rather than the range tree so
+ * that bulk singleton sets (e.g. address block lists) cost bits per address instead of a tree
+ * node per address. IPv6 membership remains in the range tree.
  */
 class IPRangeSet {
   using self_type = IPRangeSet;
@@ -1532,6 +1683,137 @@ class IPRangeSet {
   /// Range set type.
   using Space = swoc::IPSpace<Mark>;
 
+  /** Compressed IPv4 membership storage.
+   *
+   * Addresses are grouped in to chunks by /16 network. Each chunk stores the lower 16 bits of
+   * its addresses in the format best suited to its density -
+   *
+   * - @c ARRAY : sorted array of values, for sparse chunks.
+   * - @c RUN : sorted array of value ranges, for chunks populated by range marking.
+   * - @c BITMAP : bit vector indexed by value, for dense chunks.
+   *
+   * A chunk converts to @c BITMAP once either other format would be larger, capping a chunk at
+   * 8KB regardless of how it is populated.
+   */
+  class Packed4 {
+    using self_type = Packed4; ///< Self reference type.
+
+    /// Storage for one /16 network.
+    struct Chunk {
+      /// Value storage format.
+      enum Format : uint8_t {
+        ARRAY, ///< Sorted array of values.
+        RUN,   ///< Sorted array of value range (min, max) pairs, disjoint and non-adjacent.
+        BITMAP ///< Bit vector indexed by value.
+      };
+
+      static constexpr size_t ARRAY_MAX    = 4096; ///< Maximum # of values in @c ARRAY format.
+      static constexpr size_t RUN_MAX      = 2048; ///< Maximum # of ranges in @c RUN format.
+      static constexpr size_t BITMAP_WORDS = 4096; ///< 65536 bits in 16 bit words.
+
+      uint16_t _key;          ///< The /16 network - upper 16 bits of the addresses.
+      Format _format = ARRAY; ///< Active format for @a _data.
+      /// Value storage, interpreted according to @a _format.
+      std::vector<uint16_t> _data;
+
+      /// @return @c true if value @a v is in the chunk.
+      bool contains(uint16_t v) const;
+
+      /// Add the values [ @a lo, @a hi ] to the chunk.
+      void mark(uint16_t lo, uint16_t hi);
+
+      /** Find the first maximal value range starting at or after @a from.
+       *
+       * @param from Minimum acceptable starting value [0..0x10000].
+       * @param lo [out] Range minimum.
+       * @param hi [out] Range maximum.
+       * @return @c true if a range was found, @c false if not.
+       */
+      bool next_run(uint32_t from, uint16_t &lo, uint16_t &hi) const;
+
+      /** Find the last maximal value range ending at or before @a upto.
+       *
+       * @param upto Maximum acceptable ending value [-1..0xFFFF].
+       * @param lo [out] Range minimum.
+       * @param hi [out] Range maximum.
+       * @return @c true if a range was found, @c false if not.
+       */
+      bool prev_run(int32_t upto, uint16_t &lo, uint16_t &hi) const;
+
+      /// @return The number of maximal value ranges in the chunk.
+      size_t n_runs() const;
+
+      /// Convert @c ARRAY format data to @c RUN format.
+      void to_run();
+
+      /// Convert to @c BITMAP format.
+      void to_bitmap();
+
+      /// Merge the range [ @a lo, @a hi ] in to @c RUN format data.
+      void run_insert(uint16_t lo, uint16_t hi);
+
+      /// Set the bits [ @a lo, @a hi ] in the bit vector @a bits.
+      static void set_bits(std::vector<uint16_t> &bits, uint16_t lo, uint16_t hi);
+    };
+
+  public:
+    /// Add the addresses in @a r to the set.
+    void mark(IP4Range const &r);
+
+    /// @return @c true if @a addr is in the set.
+    bool contains(IP4Addr const &addr) const;
+
+    /// @return The number of maximal address ranges in the set.
+    size_t count() const;
+
+    /// @return @c true if there are no addresses in the set.
+    bool empty() const;
+
+    /// Remove all addresses from the set.
+    void clear();
+
+    /** Find the first maximal address range.
+     *
+     * @param r [out] The range found.
+     * @return @c true if the set is not empty.
+     */
+    bool first(IP4Range &r) const;
+
+    /** Find the maximal address range following @a r.
+     *
+     * @param r [in,out] The current range, updated to the next range.
+     * @return @c true if there was a next range.
+     */
+    bool next(IP4Range &r) const;
+
+    /** Find the last maximal address range.
+     *
+     * @param r [out] The range found.
+     * @return @c true if the set is not empty.
+     */
+    bool last(IP4Range &r) const;
+
+    /** Find the maximal address range preceding @a r.
+     *
+     * @param r [in,out] The current range, updated to the previous range.
+     * @return @c true if there was a previous range.
+     */
+    bool prev(IP4Range &r) const;
+
+  protected:
+    /// Find or create the chunk for the /16 network @a key.
+    Chunk &chunk_for(uint16_t key);
+
+    /// Scan forward for a maximal range starting in chunk @a cidx at value @a from or later.
+    bool scan_fwd(size_t cidx, uint32_t from, IP4Range &r) const;
+
+    /// Scan backward for a maximal range ending in chunk @a cidx at value @a upto or earlier.
+    bool scan_bwd(size_t cidx, int32_t upto, IP4Range &r) const;
+
+    /// Chunks, sorted by @a _key.
+    std::vector<Chunk> _chunks;
+  };
+
 public:
   /// Default construct empty set.
   IPRangeSet() = default;
@@ -1623,10 +1905,17 @@ public:
     bool operator!=(self_type const &that) const;
 
   protected:
-    const_iterator(super_type const &spot) : _iter(spot) {}
+    /// Construct positioned in the IPv6 data at @a spot.
+    const_iterator(IPRangeSet const *set, super_type const &spot) : _set(set), _iter(spot) {}
+
+    /// Construct positioned at the start of the set.
+    const_iterator(IPRangeSet const *set) : _set(set), _iter(set->_addrs.begin()) { _v4_p = set->_ip4.first(_r4); }
 
-    super_type _iter; ///< Underlying iterator.
-    IPRange _r;       ///< Some less temporary storage for dereferences.
+    IPRangeSet const *_set = nullptr; ///< Containing set.
+    super_type _iter;                 ///< Underlying IPv6 iterator.
+    bool _v4_p = false;               ///< @c true if positioned in the IPv4 data.
+    IP4Range _r4;                     ///< Current IPv4 range.
+    mutable IPRangeView _rv;          ///< Some less temporary storage for dereferences.
   };
 
   using iterator = const_iterator;
@@ -1634,51 +1923,471 @@ public:
   /// @return Iterator to first range.
   const_iterator
   begin() const {
-    return _addrs.begin();
+    return const_iterator(this);
   }
   /// @return Iterator past last range.
   const_iterator
   end() const {
-    return _addrs.end();
+    return const_iterator(this, _addrs.end());
   }
 
 protected:
-  /// The address set.
-  Space _addrs;
+  Packed4 _ip4; ///< The IPv4 address set.
+  Space _addrs; ///< The IPv6 address set.
 };
 
 inline auto
 IPRangeSet::mark(swoc::IPRange const &r) -> self_type & {
-  _addrs.mark(r, MARK);
+  if (r.is(AF_INET)) {
+    _ip4.mark(r.ip4());
+  } else if (r.is(AF_INET6)) {
+    _addrs.mark(r, MARK);
+  }
   return *this;
 }
 
 inline auto
 IPRangeSet::fill(swoc::IPRange const &r) -> self_type & {
-  _addrs.mark(r, MARK);
-  return *this;
+  return this->mark(r);
 }
 
 inline bool
 IPRangeSet::contains(swoc::IPAddr const &addr) const {
-  return _addrs.find(addr) != _addrs.end();
+  return addr.is_ip4() ? _ip4.contains(addr.ip4()) : _addrs.find(addr) != _addrs.end();
 }
 
 inline size_t
 IPRangeSet::count() const {
-  return _addrs.count();
+  return _ip4.count() + _addrs.count();
 }
 
 inline bool
 IPRangeSet::empty() const {
-  return _addrs.empty();
+  return _ip4.empty() && _addrs.empty();
 }
 
 inline void
 IPRangeSet::clear() {
+  _ip4.clear();
   _addrs.clear();
 }
 
+inline bool
+IPRangeSet::Packed4::Chunk::contains(uint16_t v) const {
+  if (BITMAP == _format) {
+    return 0 != (_data[v >> 4] & uint16_t(1u << (v & 0xF)));
+  } else if (ARRAY == _format) {
+    return std::binary_search(_data.begin(), _data.end(), v);
+  }
+  // RUN - count the ranges with a minimum no greater than @a v, check the last such range.
+  size_t l = 0, r = _data.size() / 2;
+  while (l < r) {
+    size_t m = (l + r) / 2;
+    if (_data[2 * m] <= v) {
+      l = m + 1;
+    } else {
+      r = m;
+    }
+  }
+  return l > 0 && _data[2 * l - 1] >= v;
+}
+
+inline void
+IPRangeSet::Packed4::Chunk::set_bits(std::vector<uint16_t> &bits, uint16_t lo, uint16_t hi) {
+  size_t wlo    = lo >> 4, whi = hi >> 4;
+  uint16_t mlo  = uint16_t(0xFFFFu << (lo & 0xF));
+  uint16_t mhi  = uint16_t(0xFFFFu >> (0xF - (hi & 0xF)));
+  if (wlo == whi) {
+    bits[wlo] |= mlo & mhi;
+  } else {
+    bits[wlo] |= mlo;
+    for (size_t w = wlo + 1; w < whi; ++w) {
+      bits[w] = 0xFFFF;
+    }
+    bits[whi] |= mhi;
+  }
+}
+
+inline void
+IPRangeSet::Packed4::Chunk::to_run() {
+  std::vector<uint16_t> runs;
+  for (size_t i = 0, n = _data.size(); i < n;) {
+    size_t j = i + 1;
+    while (j < n && _data[j] == _data[j - 1] + 1) {
+      ++j;
+    }
+    runs.push_back(_data[i]);
+    runs.push_back(_data[j - 1]);
+    i = j;
+  }
+  _data   = std::move(runs);
+  _format = RUN;
+}
+
+inline void
+IPRangeSet::Packed4::Chunk::to_bitmap() {
+  std::vector<uint16_t> bits(BITMAP_WORDS, 0);
+  if (ARRAY == _format) {
+    for (uint16_t v : _data) {
+      bits[v >> 4] |= uint16_t(1u << (v & 0xF));
+    }
+  } else { // RUN
+    for (size_t i = 0, n = _data.size(); i < n; i += 2) {
+      set_bits(bits, _data[i], _data[i + 1]);
+    }
+  }
+  _data   = std::move(bits);
+  _format = BITMAP;
+}
+
+inline void
+IPRangeSet::Packed4::Chunk::run_insert(uint16_t lo, uint16_t hi) {
+  size_t n = _data.size() / 2;
+  // Find the first range that is neither entirely before nor left adjacent to [lo, hi].
+  size_t l = 0, r = n;
+  while (l < r) {
+    size_t m = (l + r) / 2;
+    if (uint32_t(_data[2 * m + 1]) + 1 < lo) {
+      l = m + 1;
+    } else {
+      r = m;
+    }
+  }
+  size_t first = l;
+  size_t limit = first;
+  while (limit < n && uint32_t(_data[2 * limit]) <= uint32_t(hi) + 1) {
+    ++limit;
+  }
+  if (first == limit) { // no overlap nor adjacency - plain insertion.
+    _data.insert(_data.begin() + 2 * first, {lo, hi});
+  } else { // merge with the overlapping / adjacent ranges.
+    _data[2 * first]     = std::min(lo, _data[2 * first]);
+    _data[2 * first + 1] = std::max(hi, _data[2 * limit - 1]);
+    _data.erase(_data.begin() + 2 * first + 2, _data.begin() + 2 * limit);
+  }
+}
+
+inline void
+IPRangeSet::Packed4::Chunk::mark(uint16_t lo, uint16_t hi) {
+  if (BITMAP == _format) {
+    set_bits(_data, lo, hi);
+    return;
+  }
+  if (ARRAY == _format) {
+    if (lo == hi) { // singleton - insert in place.
+      auto spot = std::lower_bound(_data.begin(), _data.end(), lo);
+      if (spot == _data.end() || *spot != lo) {
+        _data.insert(spot, lo);
+        if (_data.size() > ARRAY_MAX) {
+          this->to_bitmap();
+        }
+      }
+      return;
+    }
+    this->to_run(); // range marking - convert to range format.
+  }
+  this->run_insert(lo, hi);
+  if (_data.size() > 2 * RUN_MAX) {
+    this->to_bitmap();
+  }
+}
+
+inline bool
+IPRangeSet::Packed4::Chunk::next_run(uint32_t from, uint16_t &lo, uint16_t &hi) const {
+  if (from > 0xFFFF) {
+    return false;
+  }
+  if (ARRAY == _format) {
+    auto spot = std::lower_bound(_data.begin(), _data.end(), uint16_t(from));
+    if (spot == _data.end()) {
+      return false;
+    }
+    lo         = *spot;
+    auto limit = spot + 1;
+    while (limit != _data.end() && *limit == *(limit - 1) + 1) {
+      ++limit;
+    }
+    hi = *(limit - 1);
+    return true;
+  } else if (RUN == _format) {
+    // Maximal ranges are non-adjacent, therefore the target is the first range starting at or
+    // after @a from.
+    size_t l = 0, r = _data.size() / 2;
+    while (l < r) {
+      size_t m = (l + r) / 2;
+      if (_data[2 * m] < from) {
+        l = m + 1;
+      } else {
+        r = m;
+      }
+    }
+    if (l >= _data.size() / 2) {
+      return false;
+    }
+    lo = _data[2 * l];
+    hi = _data[2 * l + 1];
+    return true;
+  }
+  // BITMAP - find the first set bit at or after @a from, then the first clear bit after that.
+  uint32_t v = from;
+  while (v < 0x10000) {
+    uint16_t word = _data[v >> 4] & uint16_t(0xFFFFu << (v & 0xF));
+    if (word) {
+      v = (v & ~0xFu) + __builtin_ctz(word);
+      break;
+    }
+    v = (v & ~0xFu) + 16;
+  }
+  if (v >= 0x10000) {
+    return false;
+  }
+  lo = uint16_t(v);
+  ++v;
+  while (v < 0x10000) {
+    uint16_t word = uint16_t(~_data[v >> 4]) & uint16_t(0xFFFFu << (v & 0xF));
+    if (word) {
+      v = (v & ~0xFu) + __builtin_ctz(word);
+      break;
+    }
+    v = (v & ~0xFu) + 16;
+  }
+  hi = uint16_t(v - 1);
+  return true;
+}
+
+inline bool
+IPRangeSet::Packed4::Chunk::prev_run(int32_t upto, uint16_t &lo, uint16_t &hi) const {
+  if (upto < 0) {
+    return false;
+  }
+  if (ARRAY == _format) {
+    auto spot = std::upper_bound(_data.begin(), _data.end(), uint16_t(upto));
+    if (spot == _data.begin()) {
+      return false;
+    }
+    hi = *--spot;
+    while (spot != _data.begin() && *(spot - 1) + 1 == *spot) {
+      --spot;
+    }
+    lo = *spot;
+    return true;
+  } else if (RUN == _format) {
+    // Count the ranges that end at or before @a upto, the target is the last such range.
+    size_t l = 0, r = _data.size() / 2;
+    while (l < r) {
+      size_t m = (l + r) / 2;
+      if (_data[2 * m + 1] <= upto) {
+        l = m + 1;
+      } else {
+        r = m;
+      }
+    }
+    if (0 == l) {
+      return false;
+    }
+    lo = _data[2 * (l - 1)];
+    hi = _data[2 * (l - 1) + 1];
+    return true;
+  }
+  // BITMAP - find the last set bit at or before @a upto, then the last clear bit before that.
+  int32_t v = upto;
+  while (v >= 0) {
+    uint16_t word = _data[v >> 4] & uint16_t(0xFFFFu >> (0xF - (v & 0xF)));
+    if (word) {
+      v = (v & ~0xF) + (15 - __builtin_clz(uint32_t(word) << 16));
+      break;
+    }
+    v = (v & ~0xF) - 1;
+  }
+  if (v < 0) {
+    return false;
+  }
+  hi = uint16_t(v);
+  --v;
+  while (v >= 0) {
+    uint16_t word = uint16_t(~_data[v >> 4]) & uint16_t(0xFFFFu >> (0xF - (v & 0xF)));
+    if (word) {
+      v = (v & ~0xF) + (15 - __builtin_clz(uint32_t(word) << 16));
+      break;
+    }
+    v = (v & ~0xF) - 1;
+  }
+  lo = uint16_t(v + 1);
+  return true;
+}
+
+inline size_t
+IPRangeSet::Packed4::Chunk::n_runs() const {
+  if (RUN == _format) {
+    return _data.size() / 2;
+  } else if (ARRAY == _format) {
+    size_t zret = _data.empty() ? 0 : 1;
+    for (size_t i = 1, n = _data.size(); i < n; ++i) {
+      if (_data[i] != _data[i - 1] + 1) {
+        ++zret;
+      }
+    }
+    return zret;
+  }
+  // BITMAP - count the set bits whose predecessor bit is clear.
+  size_t zret    = 0;
+  uint32_t carry = 0; // final bit of the previous word.
+  for (uint16_t word : _data) {
+    uint32_t w = word;
+    zret += __builtin_popcount(w & ~((w << 1) | carry) & 0xFFFFu);
+    carry = (w >> 15) & 1;
+  }
+  return zret;
+}
+
+inline auto
+IPRangeSet::Packed4::chunk_for(uint16_t key) -> Chunk & {
+  auto spot = std::lower_bound(_chunks.begin(), _chunks.end(), key,
+                               [](Chunk const &c, uint16_t k) { return c._key < k; });
+  if (spot == _chunks.end() || spot->_key != key) {
+    spot = _chunks.insert(spot, Chunk{key, Chunk::ARRAY, {}});
+  }
+  return *spot;
+}
+
+inline void
+IPRangeSet::Packed4::mark(IP4Range const &r) {
+  if (r.empty()) {
+    return;
+  }
+  uint32_t rmin = r.min().host_order();
+  uint32_t rmax = r.max().host_order();
+  for (uint32_t key = rmin >> 16, last = rmax >> 16; key <= last; ++key) {
+    uint16_t lo = (key == rmin >> 16) ? uint16_t(rmin & 0xFFFF) : uint16_t(0);
+    uint16_t hi = (key == last) ? uint16_t(rmax & 0xFFFF) : uint16_t(0xFFFF);
+    this->chunk_for(uint16_t(key)).mark(lo, hi);
+  }
+}
+
+inline bool
+IPRangeSet::Packed4::contains(IP4Addr const &addr) const {
+  uint32_t v   = addr.host_order();
+  uint16_t key = uint16_t(v >> 16);
+  auto spot    = std::lower_bound(_chunks.begin(), _chunks.end(), key,
+                                  [](Chunk const &c, uint16_t k) { return c._key < k; });
+  return spot != _chunks.end() && spot->_key == key && spot->contains(uint16_t(v & 0xFFFF));
+}
+
+inline size_t
+IPRangeSet::Packed4::count() const {
+  size_t zret = 0;
+  for (size_t i = 0, n = _chunks.size(); i < n; ++i) {
+    zret += _chunks[i].n_runs();
+    if (i > 0 && _chunks[i - 1]._key + 1 == _chunks[i]._key && _chunks[i - 1].contains(0xFFFF) && _chunks[i].contains(0)) {
+      --zret; // maximal range spans the chunk boundary - count it once.
+    }
+  }
+  return zret;
+}
+
+inline bool
+IPRangeSet::Packed4::empty() const {
+  return _chunks.empty();
+}
+
+inline void
+IPRangeSet::Packed4::clear() {
+  _chunks.clear();
+}
+
+inline bool
+IPRangeSet::Packed4::scan_fwd(size_t cidx, uint32_t from, IP4Range &r) const {
+  for (size_t n = _chunks.size(); cidx < n; ++cidx, from = 0) {
+    uint16_t lo, hi;
+    if (_chunks[cidx].next_run(from, lo, hi)) {
+      uint32_t rmin = (uint32_t(_chunks[cidx]._key) << 16) | lo;
+      // Extend across adjacent chunks while the range abuts the chunk boundary.
+      while (0xFFFF == hi && cidx + 1 < n && _chunks[cidx]._key + 1 == _chunks[cidx + 1]._key) {
+        uint16_t nlo, nhi;
+        if (_chunks[cidx + 1].next_run(0, nlo, nhi) && 0 == nlo) {
+          ++cidx;
+          hi = nhi;
+        } else {
+          break;
+        }
+      }
+      r.assign(IP4Addr{rmin}, IP4Addr{(uint32_t(_chunks[cidx]._key) << 16) | hi});
+      return true;
+    }
+  }
+  return false;
+}
+
+inline bool
+IPRangeSet::Packed4::scan_bwd(size_t cidx, int32_t upto, IP4Range &r) const {
+  while (true) {
+    uint16_t lo, hi;
+    if (_chunks[cidx].prev_run(upto, lo, hi)) {
+      uint32_t rmax = (uint32_t(_chunks[cidx]._key) << 16) | hi;
+      // Extend across adjacent chunks while the range abuts the chunk boundary.
+      while (0 == lo && cidx > 0 && _chunks[cidx - 1]._key + 1 == _chunks[cidx]._key) {
+        uint16_t plo, phi;
+        if (_chunks[cidx - 1].prev_run(0xFFFF, plo, phi) && 0xFFFF == phi) {
+          --cidx;
+          lo = plo;
+        } else {
+          break;
+        }
+      }
+      r.assign(IP4Addr{(uint32_t(_chunks[cidx]._key) << 16) | lo}, IP4Addr{rmax});
+      return true;
+    }
+    if (0 == cidx) {
+      return false;
+    }
+    --cidx;
+    upto = 0xFFFF;
+  }
+}
+
+inline bool
+IPRangeSet::Packed4::first(IP4Range &r) const {
+  return this->scan_fwd(0, 0, r);
+}
+
+inline bool
+IPRangeSet::Packed4::next(IP4Range &r) const {
+  uint32_t rmax = r.max().host_order();
+  uint16_t key  = uint16_t(rmax >> 16);
+  auto spot     = std::lower_bound(_chunks.begin(), _chunks.end(), key,
+                                   [](Chunk const &c, uint16_t k) { return c._key < k; });
+  size_t cidx   = spot - _chunks.begin();
+  uint32_t from = (rmax & 0xFFFF) + 1;
+  if (from > 0xFFFF) {
+    ++cidx;
+    from = 0;
+  }
+  return this->scan_fwd(cidx, from, r);
+}
+
+inline bool
+IPRangeSet::Packed4::last(IP4Range &r) const {
+  return !_chunks.empty() && this->scan_bwd(_chunks.size() - 1, 0xFFFF, r);
+}
+
+inline bool
+IPRangeSet::Packed4::prev(IP4Range &r) const {
+  uint32_t rmin = r.min().host_order();
+  uint16_t key  = uint16_t(rmin >> 16);
+  auto spot     = std::lower_bound(_chunks.begin(), _chunks.end(), key,
+                                   [](Chunk const &c, uint16_t k) { return c._key < k; });
+  size_t cidx   = spot - _chunks.begin();
+  int32_t upto  = int32_t(rmin & 0xFFFF) - 1;
+  if (upto < 0) {
+    if (0 == cidx) {
+      return false;
+    }
+    --cidx;
+    upto = 0xFFFF;
+  }
+  return this->scan_bwd(cidx, upto, r);
+}
+
 inline bool
 IPRangeSet::Mark::operator==(IPRangeSet::Mark::self_type const &) {
   return true;
@@ -2480,6 +3189,67 @@ IPSpace<PAYLOAD>::fill(IPRange const &range, PAYLOAD const &payload) -> self_typ
   return *this;
 }
 
+template <typename PAYLOAD>
+auto
+IPSpace<PAYLOAD>::append(IPRange const &range, PAYLOAD const &payload) -> self_type & {
+  if (range.is(AF_INET)) {
+    _ip4.append(range.ip4(), payload);
+  } else if (range.is(AF_INET6)) {
+    _ip6.append(range.ip6(), payload);
+  }
+  return *this;
+}
+
+template <typename PAYLOAD>
+auto
+IPSpace<PAYLOAD>::Builder::reserve(size_t n) -> self_type & {
+  _ip4.reserve(n);
+  _ip6.reserve(n);
+  return *this;
+}
+
+template <typename PAYLOAD>
+auto
+IPSpace<PAYLOAD>::Builder::insert(IPRange const &range, PAYLOAD const &payload) -> self_type & {
+  if (range.is(AF_INET)) {
+    _ip4.emplace_back(range.ip4(), payload);
+  } else if (range.is(AF_INET6)) {
+    _ip6.emplace_back(range.ip6(), payload);
+  }
+  return *this;
+}
+
+template <typename PAYLOAD>
+IPSpace<PAYLOAD> &
+IPSpace<PAYLOAD>::Builder::commit(IPSpace &space) {
+  // Stable sort preserves staging order for overlapping pairs so a later pair overwrites an
+  // earlier one when marked.
+  auto by_min = [](auto const &lhs, auto const &rhs) { return lhs.first.min() < rhs.first.min(); };
+  std::stable_sort(_ip4.begin(), _ip4.end(), by_min);
+  std::stable_sort(_ip6.begin(), _ip6.end(), by_min);
+  for (auto const &[range, payload] : _ip4) {
+    space._ip4.append(range, payload);
+  }
+  for (auto const &[range, payload] : _ip6) {
+    space._ip6.append(range, payload);
+  }
+  this->clear();
+  return space;
+}
+
+template <typename PAYLOAD>
+size_t
+IPSpace<PAYLOAD>::Builder::count() const {
+  return _ip4.size() + _ip6.size();
+}
+
+template <typename PAYLOAD>
+void
+IPSpace<PAYLOAD>::Builder::clear() {
+  _ip4.clear();
+  _ip6.clear();
+}
+
 template <typename PAYLOAD>
 auto
 IPSpace<PAYLOAD>::erase(IPRange const &range) -> self_type & {
@@ -2526,6 +3296,48 @@ IPSpace<PAYLOAD>::clear() {
   _ip6.clear();
 }
 
+template <typename PAYLOAD>
+auto
+IPSpace<PAYLOAD>::compact() -> self_type & {
+  _ip4.compact();
+  _ip6.compact();
+  return *this;
+}
+
+template <typename PAYLOAD>
+template <typename F>
+auto
+IPSpace<PAYLOAD>::assign_union(self_type const &lhs, self_type const &rhs, F &&combiner) -> self_type & {
+  _ip4.assign_union(lhs._ip4, rhs._ip4, combiner);
+  _ip6.assign_union(lhs._ip6, rhs._ip6, combiner);
+  return *this;
+}
+
+template <typename PAYLOAD>
+template <typename F>
+auto
+IPSpace<PAYLOAD>::assign_intersection(self_type const &lhs, self_type const &rhs, F &&combiner) -> self_type & {
+  _ip4.assign_intersection(lhs._ip4, rhs._ip4, combiner);
+  _ip6.assign_intersection(lhs._ip6, rhs._ip6, combiner);
+  return *this;
+}
+
+template <typename PAYLOAD>
+auto
+IPSpace<PAYLOAD>::assign_intersection(self_type const &lhs, self_type const &rhs) -> self_type & {
+  _ip4.assign_intersection(lhs._ip4, rhs._ip4);
+  _ip6.assign_intersection(lhs._ip6, rhs._ip6);
+  return *this;
+}
+
+template <typename PAYLOAD>
+auto
+IPSpace<PAYLOAD>::assign_difference(self_type const &lhs, self_type const &rhs) -> self_type & {
+  _ip4.assign_difference(lhs._ip4, rhs._ip4);
+  _ip6.assign_difference(lhs._ip6, rhs._ip6);
+  return *this;
+}
+
 template <typename PAYLOAD>
 auto
 IPSpace<PAYLOAD>::begin() -> iterator {
@@ -2620,6 +3432,42 @@ IPSpace<PAYLOAD>::find(IPAddr const &addr) const -> const_iterator {
   return this->end();
 }
 
+template <typename PAYLOAD>
+size_t
+IPSpace<PAYLOAD>::find(MemSpan<IPAddr const> const &addrs, MemSpan<iterator> const &results) {
+  size_t n_lookup = std::min(addrs.count(), results.count());
+
+  // Partition by family, keeping the original indices for scattering the results back.
+  std::vector<IP4Addr> a4;
+  std::vector<IP6Addr> a6;
+  std::vector<size_t> idx4;
+  std::vector<size_t> idx6;
+  for (size_t i = 0; i < n_lookup; ++i) {
+    if (addrs[i].is_ip4()) {
+      a4.push_back(addrs[i].ip4());
+      idx4.push_back(i);
+    } else if (addrs[i].is_ip6()) {
+      a6.push_back(addrs[i].ip6());
+      idx6.push_back(i);
+    } else {
+      results[i] = this->end();
+    }
+  }
+
+  std::vector<typename IP4Space::iterator> r4(a4.size());
+  std::vector<typename IP6Space::iterator> r6(a6.size());
+  size_t n_found = _ip4.find(MemSpan<IP4Addr const>(a4.data(), a4.size()), MemSpan<typename IP4Space::iterator>(r4.data(), r4.size())) +
+                   _ip6.find(MemSpan<IP6Addr const>(a6.data(), a6.size()), MemSpan<typename IP6Space::iterator>(r6.data(), r6.size()));
+
+  for (size_t k = 0; k < r4.size(); ++k) {
+    results[idx4[k]] = r4[k] != _ip4.end() ? iterator{r4[k], _ip6.begin()} : this->end();
+  }
+  for (size_t k = 0; k < r6.size(); ++k) {
+    results[idx6[k]] = r6[k] != _ip6.end() ? iterator{_ip4.end(), r6[k]} : this->end();
+  }
+  return n_found;
+}
+
 template <typename PAYLOAD>
 auto
 IPSpace<PAYLOAD>::find(IP4Addr const &addr) -> iterator {
@@ -2704,48 +3552,67 @@ IPSpace<PAYLOAD>::empty() const {
 
 inline auto
 IPRangeSet::const_iterator::operator++() -> self_type & {
-  ++_iter;
+  if (_v4_p) {
+    // On IPv4 exhaustion @a _iter is already positioned at the first IPv6 range.
+    _v4_p = _set->_ip4.next(_r4);
+  } else {
+    ++_iter;
+  }
   return *this;
 }
 
 inline auto
 IPRangeSet::const_iterator::operator--() -> self_type & {
-  --_iter;
+  if (_v4_p) {
+    _set->_ip4.prev(_r4);
+  } else if (_iter == _set->_addrs.begin() && _set->_ip4.last(_r4)) {
+    _v4_p = true;
+  } else {
+    --_iter;
+  }
   return *this;
 }
 
 inline auto
 IPRangeSet::const_iterator::operator++(int) -> self_type {
   self_type zret{*this};
-  ++_iter;
+  ++*this;
   return zret;
 }
 
 inline auto
 IPRangeSet::const_iterator::operator--(int) -> self_type {
   self_type zret{*this};
-  --_iter;
+  --*this;
   return zret;
 }
 
 inline auto
 IPRangeSet::const_iterator::operator*() const -> reference {
+  if (_v4_p) {
+    _rv.assign(_r4);
+    return _rv;
+  }
   return _iter->_rv;
 }
 
 inline auto
 IPRangeSet::const_iterator::operator->() const -> pointer {
+  if (_v4_p) {
+    _rv.assign(_r4);
+    return &_rv;
+  }
   return &(_iter->_rv);
 }
 
 inline bool
 IPRangeSet::const_iterator::operator==(IPRangeSet::const_iterator::self_type const &that) const {
-  return _iter == that._iter;
+  return _v4_p == that._v4_p && (_v4_p ? _r4 == that._r4 : _iter == that._iter);
 }
 
 inline bool
 IPRangeSet::const_iterator::operator!=(IPRangeSet::const_iterator::self_type const &that) const {
-  return _iter != that._iter;
+  return !(*this == that);
 }
 
 }} // namespace swoc::SWOC_VERSION_NS
@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   Streaming loader for line delimited IP range feeds.
+ */
+
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <vector>
+
+#include <swoc/IPRange.h>
+#include <swoc/swoc_file.h>
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace ip {
+
+/** Streaming reader for line delimited IP range feeds.
+ *
+ * The feed file is parsed in place - the file is memory mapped when possible, otherwise it is
+ * read in chunks in to a reusable buffer. In neither case is the entire file staged in memory as
+ * a @c std::string, which matters for feeds in the hundreds of megabytes. In the mapped case the
+ * kernel read ahead overlaps I/O with parsing.
+ *
+ * Each line is expected to contain one range in any format accepted by @c IPRange::load - a
+ * single address, a dash separated address pair, or a CIDR network. Blank lines and lines
+ * starting with '#' are skipped. Malformed lines are counted and skipped.
+ *
+ * @code
+ * std::error_code ec;
+ * swoc::ip::RangeFeedReader feed{path, ec};
+ * swoc::IPRange r;
+ * while (feed.next(r)) {
+ *   space.mark(r, payload);
+ * }
+ * @endcode
+ *
+ * For bulk loading, @c load batches the ranges through @c IPSpace::Builder which is much faster
+ * than marking ranges one at a time.
+ */
+class RangeFeedReader {
+  using self_type = RangeFeedReader; ///< Self reference type.
+
+public:
+  /// Initial chunk size for streamed (unmapped) reading.
+  static constexpr size_t CHUNK_SIZE = 256 * 1024;
+  /// Default number of ranges staged per @c IPSpace::Builder commit.
+  static constexpr size_t BATCH_SIZE = 16384;
+
+  /** Open the feed at @a feed_path.
+   *
+   * @param feed_path Path to the feed file.
+   * @param ec Error code return - set if the file could not be opened.
+   *
+   * On error the reader is empty - @c next returns @c false immediately.
+   */
+  RangeFeedReader(file::path const &feed_path, std::error_code &ec);
+
+  /// Not copyable - the instance holds a file descriptor and possibly a mapping.
+  RangeFeedReader(self_type const &) = delete;
+  self_type &operator=(self_type const &) = delete;
+
+  ~RangeFeedReader();
+
+  /** Parse the next range from the feed.
+   *
+   * @param r [out] The parsed range.
+   * @return @c true if a range was parsed, @c false at end of feed.
+   *
+   * Blank and comment lines are skipped silently, malformed lines are skipped and counted.
+   */
+  bool next(IPRange &r);
+
+  /** Parse ranges in to @a batch.
+   *
+   * @param batch Destination for the parsed ranges.
+   * @return The number of ranges parsed, which is less than the batch size only at end of feed.
+   */
+  size_t load(MemSpan<IPRange> const &batch);
+
+  /** Load the entire feed in to @a space.
+   *
+   * @tparam PAYLOAD Payload type of the space.
+   * @param space Target space.
+   * @param payload Payload to assign to every range.
+   * @param batch_size Number of ranges staged per bulk commit.
+   * @return The number of ranges loaded.
+   */
+  template <typename PAYLOAD>
+  size_t load(IPSpace<PAYLOAD> &space, PAYLOAD const &payload, size_t batch_size = BATCH_SIZE);
+
+  /// @return The number of the most recently read line, starting from 1.
+  size_t line_no() const;
+
+  /// @return The number of malformed lines skipped so far.
+  size_t error_count() const;
+
+  /// @return The raw text of the most recently read line.
+  TextView line() const;
+
+protected:
+  /** Read the next line from the feed.
+   *
+   * @param text [out] The line, without the terminating newline.
+   * @return @c true if a line was read, @c false at end of feed.
+   */
+  bool next_line(TextView &text);
+
+  /** Refill the chunk buffer, preserving any trailing partial line.
+   *
+   * @return @c true if more data was read, @c false at end of feed.
+   */
+  bool fill();
+
+  file::unique_fd _fd;       ///< Feed file descriptor.
+  MemSpan<void> _mapping;    ///< File mapping, if the file was mapped.
+  std::vector<char> _buffer; ///< Chunk buffer for streamed reading.
+  TextView _content;         ///< Unconsumed feed content.
+  TextView _line;            ///< Most recently read line.
+  size_t _line_no = 0;       ///< Current line number.
+  size_t _errors  = 0;       ///< Number of malformed lines.
+  bool _mapped_p  = false;   ///< The file is memory mapped.
+  bool _eof_p     = false;   ///< No more data to read.
+};
+
+// --- Implementation ---
+
+inline RangeFeedReader::RangeFeedReader(file::path const &feed_path, std::error_code &ec)
+  : _fd(::open(feed_path.c_str(), O_RDONLY)) {
+  if (_fd < 0) {
+    ec     = std::error_code(errno, std::system_category());
+    _eof_p = true;
+    return;
+  }
+  struct stat st;
+  if (0 != ::fstat(_fd, &st)) {
+    ec     = std::error_code(errno, std::system_category());
+    _eof_p = true;
+    return;
+  }
+  if (S_ISREG(st.st_mode) && st.st_size > 0) {
+    void *m = ::mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (MAP_FAILED != m) {
+      ::madvise(m, size_t(st.st_size), MADV_SEQUENTIAL); // overlap read ahead with parsing.
+      _mapping.assign(m, size_t(st.st_size));
+      _content.assign(static_cast<char const *>(m), size_t(st.st_size));
+      _mapped_p = true;
+      return;
+    }
+  }
+  // Not mappable - stream it through a chunk buffer.
+  _buffer.resize(CHUNK_SIZE);
+}
+
+inline RangeFeedReader::~RangeFeedReader() {
+  if (nullptr != _mapping.data()) {
+    ::munmap(_mapping.data(), _mapping.size());
+  }
+}
+
+inline bool
+RangeFeedReader::fill() {
+  if (_mapped_p || _eof_p) {
+    return false;
+  }
+  size_t residue = _content.size();
+  if (residue > 0 && _content.data() != _buffer.data()) {
+    std::memmove(_buffer.data(), _content.data(), residue);
+  }
+  if (residue == _buffer.size()) { // line longer than the buffer - grow it.
+    _buffer.resize(2 * _buffer.size());
+  }
+  auto n = ::read(_fd, _buffer.data() + residue, _buffer.size() - residue);
+  if (n <= 0) {
+    _eof_p = true;
+  }
+  _content.assign(_buffer.data(), residue + (n > 0 ? size_t(n) : 0));
+  return n > 0;
+}
+
+inline bool
+RangeFeedReader::next_line(TextView &text) {
+  while (true) {
+    if (_content.empty() && !this->fill()) {
+      return false;
+    }
+    if (auto idx = _content.find('\n'); TextView::npos != idx) {
+      text = _content.prefix(idx);
+      _content.remove_prefix(idx + 1);
+      ++_line_no;
+      return true;
+    }
+    // No newline - read more if possible, otherwise the residue is the final line.
+    if (!this->fill()) {
+      text = _content;
+      _content.clear();
+      ++_line_no;
+      return true;
+    }
+  }
+}
+
+inline bool
+RangeFeedReader::next(IPRange &r) {
+  TextView text;
+  while (this->next_line(text)) {
+    _line     = text;
+    auto span = text.trim_if(&isspace);
+    if (span.empty() || '#' == *span) {
+      continue; // blank or comment line.
+    }
+    if (r.load(span)) {
+      return true;
+    }
+    ++_errors;
+  }
+  return false;
+}
+
+inline size_t
+RangeFeedReader::load(MemSpan<IPRange> const &batch) {
+  size_t n = 0;
+  while (n < batch.count() && this->next(batch[n])) {
+    ++n;
+  }
+  return n;
+}
+
+template <typename PAYLOAD>
+size_t
+RangeFeedReader::load(IPSpace<PAYLOAD> &space, PAYLOAD const &payload, size_t batch_size) {
+  typename IPSpace<PAYLOAD>::Builder builder;
+  builder.reserve(batch_size);
+  size_t zret = 0;
+  IPRange r;
+  while (this->next(r)) {
+    builder.insert(r, payload);
+    if (0 == ++zret % batch_size) {
+      builder.commit(space);
+    }
+  }
+  builder.commit(space);
+  return zret;
+}
+
+inline size_t
+RangeFeedReader::line_no() const {
+  return _line_no;
+}
+
+inline size_t
+RangeFeedReader::error_count() const {
+  return _errors;
+}
+
+inline TextView
+RangeFeedReader::line() const {
+  return _line;
+}
+
+} // namespace ip
+}} // namespace swoc::SWOC_VERSION_NS
@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   String interning table.
+ */
+
+#pragma once
+
+#include "swoc/swoc_version.h"
+#include "swoc/TextView.h"
+#include "swoc/MemSpan.h"
+#include "swoc/MemArena.h"
+#include "swoc/IntrusiveHashMap.h"
+#include "swoc/ext/HashFNV.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** A string deduplication (interning) table.
+ *
+ * Equal strings are stored exactly once in an internal arena and every intern of the same text
+ * returns the same stable @c TextView, so strings can be compared by pointer identity and bulk
+ * repeated values (payload tags, field names) collapse to one copy. Entry storage is never
+ * relocated - returned views remain valid for the life of the table.
+ *
+ * Entries are reference counted by @c intern / @c release. A released entry is removed from the
+ * table when its count reaches zero so the text can be interned afresh later, though its arena
+ * storage is only reclaimed by @c clear.
+ *
+ * The table is not internally locked. Once @c freeze is called no further modification is
+ * allowed and the table may be read concurrently from any number of threads without
+ * synchronization.
+ */
+class InternTable {
+  using self_type = InternTable; ///< Self reference type.
+
+public:
+  /// Default initial arena reservation.
+  static constexpr size_t DEFAULT_RESERVE = 4096;
+
+  /** Constructor.
+   *
+   * @param reserve Initial arena reservation in bytes.
+   */
+  explicit InternTable(size_t reserve = DEFAULT_RESERVE);
+
+  /// Not copyable - entries are referenced by stable views.
+  InternTable(self_type const &that)          = delete;
+  self_type &operator=(self_type const &that) = delete;
+
+  /** Intern @a text.
+   *
+   * @param text Text to intern.
+   * @return A stable view of the single stored copy of @a text.
+   *
+   * If @a text is already interned its reference count is incremented and the existing view
+   * returned, otherwise the text is copied in to the arena. Interning in a frozen table throws
+   * @c std::logic_error.
+   */
+  TextView intern(TextView const &text);
+
+  /** Bulk intern.
+   *
+   * @param texts Texts to intern.
+   * @param views Interned view for each text, parallel to @a texts.
+   * @return The number of texts that were not already interned.
+   *
+   * @a views must be at least as large as @a texts. Equivalent to @c intern on each element -
+   * one call site for loading a large feed.
+   */
+  size_t intern(MemSpan<TextView const> const &texts, MemSpan<TextView> const &views);
+
+  /** Find the interned view for @a text.
+   *
+   * @param text Text to find.
+   * @return The stored view, or an empty view if @a text is not interned.
+   *
+   * The reference count is not changed. Safe for concurrent use on a frozen table.
+   */
+  TextView find(TextView const &text) const;
+
+  /** Release one reference to @a text.
+   *
+   * @param text Previously interned text.
+   * @return The remaining reference count - 0 if the entry was removed or was not present.
+   *
+   * Releasing in a frozen table throws @c std::logic_error.
+   */
+  unsigned release(TextView const &text);
+
+  /** Reference count for @a text.
+   *
+   * @param text Text to check.
+   * @return The number of outstanding interns, 0 if not interned.
+   */
+  unsigned ref_count(TextView const &text) const;
+
+  /// @return The number of distinct interned strings.
+  size_t count() const;
+
+  /// @return Total bytes of storage in the table.
+  size_t size() const;
+
+  /** Freeze the table.
+   *
+   * @return @a this
+   *
+   * No further modification is allowed - @c intern of a new string and @c release throw. The
+   * table then supports lock free concurrent reads via @c find. Intended for tables that are
+   * fully loaded at start up.
+   */
+  self_type &freeze();
+
+  /// @return @c true if @a this has been frozen.
+  bool is_frozen() const;
+
+  /// Remove all entries and release the storage. Outstanding views are invalidated.
+  void clear();
+
+protected:
+  /// An interned string - the text bytes ride directly behind the node.
+  struct Item {
+    Item *_next = nullptr; ///< Forward hash link.
+    Item *_prev = nullptr; ///< Backward hash link.
+    uint32_t _size;        ///< Text size in bytes.
+    uint32_t _refs;        ///< Outstanding intern count.
+
+    /// @return The interned text.
+    TextView
+    view() const {
+      return {reinterpret_cast<char const *>(this + 1), _size};
+    }
+
+    /// @cond INTERNAL_DETAIL
+    struct Linkage {
+      static Item *&
+      next_ptr(Item *item) {
+        return item->_next;
+      }
+      static Item *&
+      prev_ptr(Item *item) {
+        return item->_prev;
+      }
+      static std::string_view
+      key_of(Item *item) {
+        return item->view();
+      }
+      static uint32_t
+      hash_of(std::string_view s) {
+        return Hash32FNV1a().hash_immediate(s);
+      }
+      static bool
+      equal(std::string_view const &lhs, std::string_view const &rhs) {
+        return lhs == rhs;
+      }
+    };
+    /// @endcond
+  };
+
+  MemArena _arena;                         ///< Entry storage.
+  IntrusiveHashMap<Item::Linkage> _table;  ///< Entry index.
+  bool _frozen_p = false;                  ///< Whether @c freeze has been done.
+};
+
+inline size_t
+InternTable::count() const {
+  return _table.count();
+}
+
+inline size_t
+InternTable::size() const {
+  return _arena.size();
+}
+
+inline bool
+InternTable::is_frozen() const {
+  return _frozen_p;
+}
+
+inline auto
+InternTable::freeze() -> self_type & {
+  _frozen_p = true;
+  return *this;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
@@ -339,24 +339,64 @@ public:
    */
   self_type split_suffix(unsigned n);
 
+  /** Remove and return all elements.
+   *
+   * @return A list containing every element formerly in @a this, which becomes empty.
+   *
+   * O(1) - the entire chain is transferred. Handy for draining a shared list under a lock
+   * and then processing the elements outside of it.
+   */
+  self_type take_all();
+
   /** Append a list.
    *
    * @param src List to append.
    * @return @a this
    *
-   * The elements are removed from @a src, which becomes empty.
+   * The elements are removed from @a src, which becomes empty. O(1).
    */
   self_type &append(self_type &src);
 
+  /// @see append(self_type &)
+  self_type &append(self_type &&src);
+
+  /** Append a chain of elements.
+   *
+   * @param head First element of the chain.
+   * @param tail Last element of the chain.
+   * @param n Number of elements in the chain.
+   * @return @a this
+   *
+   * The chain must be correctly linked from @a head to @a tail and not in any list. O(1) -
+   * the count is taken from @a n rather than walking the chain, for splicing in batches
+   * whose size is already known (e.g. draining a work queue).
+   */
+  self_type &append(value_type *head, value_type *tail, size_t n);
+
   /** Prepend a list.
    *
    * @param src List to prepend.
    * @return @a this
    *
-   * The elements are removed from @a src, which becomes empty.
+   * The elements are removed from @a src, which becomes empty. O(1).
    */
   self_type &prepend(self_type &src);
 
+  /// @see prepend(self_type &)
+  self_type &prepend(self_type &&src);
+
+  /** Prepend a chain of elements.
+   *
+   * @param head First element of the chain.
+   * @param tail Last element of the chain.
+   * @param n Number of elements in the chain.
+   * @return @a this
+   *
+   * The chain must be correctly linked from @a head to @a tail and not in any list. O(1).
+   * @see append(value_type *, value_type *, size_t)
+   */
+  self_type &prepend(value_type *head, value_type *tail, size_t n);
+
   /** Splice in a list after an existing element.
    *
    * @param target Element in the lsit.
@@ -1148,6 +1188,56 @@ IntrusiveDList<L>::prepend(IntrusiveDList::self_type &src) -> self_type & {
   return *this;
 }
 
+template <typename L>
+auto
+IntrusiveDList<L>::take_all() -> self_type {
+  return std::move(*this); // move construction resets @a this.
+}
+
+template <typename L>
+auto
+IntrusiveDList<L>::prepend(self_type &&src) -> self_type & {
+  return this->prepend(src);
+}
+
+template <typename L>
+auto
+IntrusiveDList<L>::prepend(value_type *head, value_type *tail, size_t n) -> self_type & {
+  if (head) {
+    L::prev_ptr(head) = nullptr;
+    if (nullptr != (L::next_ptr(tail) = _head)) {
+      L::prev_ptr(_head) = tail;
+    } else {
+      _tail = tail;
+    }
+    _head   = head;
+    _count += n;
+  }
+  return *this;
+}
+
+template <typename L>
+auto
+IntrusiveDList<L>::append(self_type &&src) -> self_type & {
+  return this->append(src);
+}
+
+template <typename L>
+auto
+IntrusiveDList<L>::append(value_type *head, value_type *tail, size_t n) -> self_type & {
+  if (head) {
+    L::next_ptr(tail) = nullptr;
+    if (nullptr != (L::prev_ptr(head) = _tail)) {
+      L::next_ptr(_tail) = head;
+    } else {
+      _head = head;
+    }
+    _tail   = tail;
+    _count += n;
+  }
+  return *this;
+}
+
 template <typename L>
 auto
 IntrusiveDList<L>::append(IntrusiveDList::self_type &src) -> self_type & {
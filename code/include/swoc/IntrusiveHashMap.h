@@ -13,8 +13,10 @@
 #include <vector>
 #include <array>
 #include <algorithm>
+#include <cstdint>
 
 #include "swoc/swoc_version.h"
+#include "swoc/swoc_stats.h"
 #include "swoc/IntrusiveDList.h"
 
 namespace swoc { inline namespace SWOC_VERSION_NS {
@@ -33,6 +35,13 @@ namespace swoc { inline namespace SWOC_VERSION_NS {
     @see @c setExpansionLimit()
     @see @c expand()
 
+    Expansion normally rehashes every element in one pass, which for very large maps can be a
+    noticeable stall. If incremental expansion is enabled the old bucket array is kept live and
+    a bounded number of buckets are migrated to the new array on each insert or lookup, so the
+    cost of expansion is amortized and worst case single operation latency stays bounded.
+    @see @c set_incremental_expansion()
+    @see @c set_migration_step()
+
     The hash table is configured by a descriptor class. This must contain the following members
 
     - The static method <tt>key_type key_of(value_type *)</tt> which returns the key for an instance of @c value_type.
@@ -131,6 +140,8 @@ public:
   static size_t constexpr DEFAULT_BUCKET_COUNT = 7; ///< POOMA.
   /// The default expansion policy limit.
   static size_t constexpr DEFAULT_EXPANSION_LIMIT = 4; ///< Value from previous version.
+  /// The default number of old buckets migrated per operation during incremental expansion.
+  static size_t constexpr DEFAULT_MIGRATION_STEP = 4; ///< POOMA.
   /// Expansion policy if not specified in constructor.
   static ExpansionPolicy constexpr DEFAULT_EXPANSION_POLICY = AVERAGE;
 
@@ -260,12 +271,89 @@ public:
    */
   template <typename F> self_type &apply(F &&f);
 
+  /** Cursor for bucket at a time iteration.
+   *
+   * A cursor marks a position in a walk over the buckets of the map so the walk can be
+   * suspended and resumed. The intended use is scanning a large map under an external lock
+   * without holding the lock for the entire scan - process one bucket per lock acquisition
+   * via @c for_each_bucket and release the lock between calls.
+   *
+   * The cursor records the map generation each time it is used. If the map is structurally
+   * changed while the walk is suspended the cursor is stale - resuming is still memory safe
+   * but elements that moved between buckets may be visited twice or not at all. Use
+   * @c is_valid to detect this and restart if an exact scan is required.
+   *
+   * @see for_each_bucket
+   * @see generation
+   */
+  struct BucketCursor {
+    size_t _idx{0};          ///< Next bucket slot to visit.
+    uint64_t _generation{0}; ///< Map generation as of the last use of the cursor.
+  };
+
+  /// @return A cursor positioned at the first bucket.
+  BucketCursor bucket_cursor() const;
+
+  /// @return @c true if the map has not been structurally changed since @a cursor was last used.
+  bool is_valid(BucketCursor const &cursor) const;
+
+  /** Process the next occupied bucket in the walk marked by @a cursor.
+   *
+   * @tparam F A functional object of the form <tt>void F(value_type&)</tt>
+   * @param cursor Walk position, updated by this call.
+   * @param f Function applied to each element in the bucket.
+   * @return @c true if a bucket was processed, @c false if the walk is complete.
+   *
+   * As with @c apply the next element is picked up before @a f is invoked, so @a f may erase
+   * (or destroy) the element passed to it. Mutations done by @a f through this map leave the
+   * cursor valid - only changes made between calls make it stale.
+   *
+   * @note Buckets not yet migrated during an incremental expansion are not visited - scans
+   * needing every element should not overlap a migration. @see is_migrating
+   */
+  template <typename F> bool for_each_bucket(BucketCursor &cursor, F &&f);
+
+  /** Structural generation of the map.
+   *
+   * @return A counter incremented by every insert, erase, expansion, and @c clear.
+   *
+   * This makes invalidation checks cheap - a reader can record the generation, drop its lock,
+   * and later compare to detect whether iterators or cursors obtained earlier are still exact.
+   */
+  uint64_t generation() const;
+
   /** Expand the hash if needed.
 
       Useful primarily when the expansion policy is set to @c MANUAL.
+
+      If incremental expansion is enabled this only allocates the new bucket array and starts
+      the migration - elements move to the new array in bounded steps on subsequent operations.
    */
   void expand();
 
+  /** Enable or disable incremental expansion.
+   *
+   * @param enable @c true to migrate buckets incrementally on expansion, @c false to rehash in one pass.
+   * @return @a this
+   */
+  self_type &set_incremental_expansion(bool enable);
+
+  /// Check if incremental expansion is enabled.
+  bool get_incremental_expansion() const;
+
+  /** Set the number of old buckets migrated per operation during incremental expansion.
+   *
+   * @param n Buckets to migrate per insert or lookup.
+   * @return @a this
+   */
+  self_type &set_migration_step(size_t n);
+
+  /// Get the number of old buckets migrated per operation.
+  size_t get_migration_step() const;
+
+  /// Check if an incremental migration is in progress.
+  bool is_migrating() const;
+
   /// Number of elements in the map.
   size_t count() const;
 
@@ -294,10 +382,35 @@ protected:
   /// List of non-empty buckets.
   IntrusiveDList<typename Bucket::Linkage> _active_buckets;
 
+  /// Previous bucket array during incremental expansion, empty otherwise.
+  Table _old_table;
+  /// Next bucket in @a _old_table to migrate - buckets before this index are already empty.
+  size_t _migrate_idx{0};
+
   Bucket *bucket_for(key_type key);
 
+  /// Insert @a v without any migration or targeting logic - the original insert.
+  void insert_impl(value_type *v);
+
+  /// Move every element in @a b to its bucket in the current table.
+  void migrate_bucket(Bucket *b);
+
+  /// Migrate the old bucket for @a key, if it has not been migrated yet.
+  void migrate_bucket_of(key_type key);
+
+  /// Migrate up to @c _migration_step old buckets.
+  void take_migration_step();
+
+  /// Complete any in progress migration.
+  void finish_migration();
+
+  /// Structural generation - incremented on every insert, erase, expansion, and @c clear.
+  uint64_t _generation{0};
+
   ExpansionPolicy _expansion_policy{DEFAULT_EXPANSION_POLICY}; ///< When to exand the table.
   size_t _expansion_limit{DEFAULT_EXPANSION_LIMIT};            ///< Limit value for expansion.
+  bool _incremental_p{false};                                  ///< Expand incrementally?
+  size_t _migration_step{DEFAULT_MIGRATION_STEP};              ///< Old buckets migrated per operation.
 
   // noncopyable
   IntrusiveHashMap(const IntrusiveHashMap &) = delete;
@@ -423,6 +536,10 @@ IntrusiveHashMap<H>::clear() -> self_type & {
   for (auto &b : _table) {
     b.clear();
   }
+  // Drop any in progress migration along with the elements.
+  _old_table.clear();
+  _migrate_idx = 0;
+  ++_generation;
   // Clear container data.
   _list.clear();
   _active_buckets.clear();
@@ -432,6 +549,23 @@ IntrusiveHashMap<H>::clear() -> self_type & {
 template <typename H>
 auto
 IntrusiveHashMap<H>::find(key_type key) -> iterator {
+  if (!_old_table.empty()) {
+    this->take_migration_step();
+  }
+  if (!_old_table.empty()) { // an element is in exactly one table - check the old one first.
+    size_t idx = H::hash_of(key) % _old_table.size();
+    if (idx >= _migrate_idx) {
+      Bucket *b         = &_old_table[idx];
+      value_type *v     = b->_v;
+      value_type *limit = b->limit();
+      while (v != limit && !H::equal(key, H::key_of(v))) {
+        v = H::next_ptr(v);
+      }
+      if (v != limit) {
+        return _list.iterator_for(v);
+      }
+    }
+  }
   Bucket *b         = this->bucket_for(key);
   value_type *v     = b->_v;
   value_type *limit = b->limit();
@@ -483,7 +617,16 @@ template <typename H>
 auto
 IntrusiveHashMap<H>::find(value_type *v) -> iterator {
   Bucket *b = this->bucket_for(H::key_of(v));
-  return b->contains(v) ? _list.iterator_for(v) : this->end();
+  if (b->contains(v)) {
+    return _list.iterator_for(v);
+  }
+  if (!_old_table.empty()) {
+    size_t idx = H::hash_of(H::key_of(v)) % _old_table.size();
+    if (idx >= _migrate_idx && _old_table[idx].contains(v)) {
+      return _list.iterator_for(v);
+    }
+  }
+  return this->end();
 }
 
 template <typename H>
@@ -495,6 +638,19 @@ IntrusiveHashMap<H>::find(value_type const *v) const -> const_iterator {
 template <typename H>
 void
 IntrusiveHashMap<H>::insert(value_type *v) {
+  if (!_old_table.empty()) {
+    // Migrate the old bucket for this key first so elements with equal keys stay adjacent,
+    // then make the usual bounded progress on the migration.
+    this->migrate_bucket_of(H::key_of(v));
+    this->take_migration_step();
+  }
+  this->insert_impl(v);
+}
+
+template <typename H>
+void
+IntrusiveHashMap<H>::insert_impl(value_type *v) {
+  ++_generation;
   auto key         = H::key_of(v);
   Bucket *bucket   = this->bucket_for(key);
   value_type *spot = bucket->_v;
@@ -542,9 +698,13 @@ IntrusiveHashMap<H>::insert(value_type *v) {
 template <typename H>
 auto
 IntrusiveHashMap<H>::erase(iterator const &loc) -> iterator {
+  ++_generation;
   value_type *v     = loc;
   iterator zret     = ++(this->iterator_for(v)); // get around no const_iterator -> iterator.
   Bucket *b         = this->bucket_for(H::key_of(v));
+  if (!_old_table.empty() && !b->contains(v)) { // not migrated yet, it's in the old bucket.
+    b = &_old_table[H::hash_of(H::key_of(v)) % _old_table.size()];
+  }
   value_type *nv    = H::next_ptr(v);
   value_type *limit = b->limit();
   if (b->_v == v) {    // removed first element in bucket, update bucket
@@ -574,6 +734,8 @@ IntrusiveHashMap<H>::erase(value_type *value) {
 template <typename H>
 auto
 IntrusiveHashMap<H>::erase(iterator const &start, iterator const &limit) -> iterator {
+  ++_generation;
+  this->finish_migration(); // ranges span buckets, the migration bookkeeping is per bucket.
   auto spot{start};
   Bucket *bucket{this->bucket_for(spot)};
   while (spot != limit) {
@@ -632,9 +794,116 @@ IntrusiveHashMap<H>::apply(F &&f) -> self_type & {
   return detail::IntrusiveHashMapApply(*this, f);
 };
 
+template <typename H>
+auto
+IntrusiveHashMap<H>::bucket_cursor() const -> BucketCursor {
+  return BucketCursor{0, _generation};
+}
+
+template <typename H>
+bool
+IntrusiveHashMap<H>::is_valid(BucketCursor const &cursor) const {
+  return cursor._generation == _generation;
+}
+
+template <typename H>
+uint64_t
+IntrusiveHashMap<H>::generation() const {
+  return _generation;
+}
+
+template <typename H>
+template <typename F>
+bool
+IntrusiveHashMap<H>::for_each_bucket(BucketCursor &cursor, F &&f) {
+  while (cursor._idx < _table.size() && nullptr == _table[cursor._idx]._v) {
+    ++cursor._idx;
+  }
+  if (cursor._idx >= _table.size()) {
+    cursor._generation = _generation;
+    return false;
+  }
+  Bucket &b         = _table[cursor._idx++];
+  value_type *v     = b._v;
+  value_type *limit = b.limit();
+  while (v != limit) {
+    value_type *nv = H::next_ptr(v); // pick up the next element first so @a f can erase.
+    f(*v);
+    v = nv;
+  }
+  cursor._generation = _generation; // mutations by @a f do not invalidate the cursor.
+  return true;
+}
+
+template <typename H>
+void
+IntrusiveHashMap<H>::migrate_bucket(Bucket *b) {
+  ExpansionPolicy org_expansion_policy = _expansion_policy;
+  _expansion_policy                    = MANUAL; // no auto expand while migrating.
+  // Always take the first element so the bucket bookkeeping stays exact.
+  while (value_type *v = b->_v) {
+    value_type *nv = H::next_ptr(v);
+    if (b->limit() == nv) { // that was the last element, deactivate the bucket.
+      _active_buckets.erase(b);
+      b->clear();
+    } else {
+      b->_v = nv;
+      --b->_count;
+    }
+    _list.erase(v);
+    this->insert_impl(v);
+  }
+  _expansion_policy = org_expansion_policy;
+}
+
+template <typename H>
+void
+IntrusiveHashMap<H>::migrate_bucket_of(key_type key) {
+  size_t idx = H::hash_of(key) % _old_table.size();
+  if (idx >= _migrate_idx) {
+    this->migrate_bucket(&_old_table[idx]);
+  }
+}
+
+template <typename H>
+void
+IntrusiveHashMap<H>::take_migration_step() {
+  size_t n = _migration_step;
+  while (n-- > 0 && _migrate_idx < _old_table.size()) {
+    this->migrate_bucket(&_old_table[_migrate_idx++]);
+  }
+  if (_migrate_idx >= _old_table.size()) {
+    _old_table.clear();
+    _migrate_idx = 0;
+  }
+}
+
+template <typename H>
+void
+IntrusiveHashMap<H>::finish_migration() {
+  while (_migrate_idx < _old_table.size()) {
+    this->migrate_bucket(&_old_table[_migrate_idx++]);
+  }
+  _old_table.clear();
+  _migrate_idx = 0;
+}
+
 template <typename H>
 void
 IntrusiveHashMap<H>::expand() {
+  ++_generation;
+  SWOC_STAT_INC(_hash_map_expand);
+  SWOC_PROBE2(hash_map_expand, this, _table.size());
+  this->finish_migration(); // only one migration at a time.
+
+  if (_incremental_p) {
+    auto n = *std::lower_bound(PRIME.begin(), PRIME.end(), _table.size() + 1);
+    _old_table   = std::move(_table);
+    _table       = Table(n);
+    _migrate_idx = 0;
+    return; // elements migrate on subsequent operations.
+  }
+
   ExpansionPolicy org_expansion_policy = _expansion_policy; // save for restore.
   value_type *old                      = _list.head();      // save for repopulating.
   auto old_size                        = _table.size();
@@ -691,4 +960,36 @@ IntrusiveHashMap<H>::get_expansion_limit() const {
   return _expansion_limit;
 }
 
+template <typename H>
+auto
+IntrusiveHashMap<H>::set_incremental_expansion(bool enable) -> self_type & {
+  _incremental_p = enable;
+  return *this;
+}
+
+template <typename H>
+bool
+IntrusiveHashMap<H>::get_incremental_expansion() const {
+  return _incremental_p;
+}
+
+template <typename H>
+auto
+IntrusiveHashMap<H>::set_migration_step(size_t n) -> self_type & {
+  _migration_step = n;
+  return *this;
+}
+
+template <typename H>
+size_t
+IntrusiveHashMap<H>::get_migration_step() const {
+  return _migration_step;
+}
+
+template <typename H>
+bool
+IntrusiveHashMap<H>::is_migrating() const {
+  return !_old_table.empty();
+}
+
 }} // namespace swoc::SWOC_VERSION_NS
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+  Lock-free multi-producer single-consumer intrusive queue.
+
+  Uses the same linkage descriptor convention as IntrusiveDList so existing intrusive node
+  types work unchanged. Producers push without locking; the consumer drains the queue in
+  batches as an IntrusiveDList.
+*/
+
+#pragma once
+
+#include <atomic>
+
+#include "swoc/swoc_version.h"
+#include "swoc/IntrusiveDList.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** A lock-free queue with multiple producers and a single consumer.
+ *
+ * @tparam L Linkage descriptor - identical requirements to @c IntrusiveDList.
+ *
+ * Producers @c push concurrently with a single compare and swap; the consumer drains the
+ * entire queue with @c take_all, which returns the elements in push order as an
+ * @c IntrusiveDList ready to splice in to other lists. There are no locks and no allocation -
+ * elements carry the links.
+ *
+ * Only one thread may consume at a time - multiple concurrent consumers are not supported.
+ * The drain is a single atomic exchange; the per batch cost of putting the elements in push
+ * order is paid outside any shared state, so producers are never delayed by the consumer.
+ */
+template <typename L> class IntrusiveMPSCQueue {
+  using self_type = IntrusiveMPSCQueue; ///< Self reference type.
+
+public:
+  /// The list type for drained batches.
+  using list_type = IntrusiveDList<L>;
+  /// Type of elements in the queue.
+  using value_type = typename list_type::value_type;
+
+  IntrusiveMPSCQueue() = default;
+
+  /** Add @a v to the queue.
+   *
+   * @param v Element to add.
+   *
+   * Safe to call from any number of threads concurrently. @a v must not be in any list.
+   */
+  void
+  push(value_type *v) {
+    L::prev_ptr(v)  = nullptr;
+    value_type *old = _stack.load(std::memory_order_relaxed);
+    do {
+      L::next_ptr(v) = old;
+    } while (!_stack.compare_exchange_weak(old, v, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  /** Remove all queued elements.
+   *
+   * @return The elements in push order.
+   *
+   * Single consumer only. The shared state is touched exactly once (an atomic exchange);
+   * restoring push order and the link invariants is done on the drained chain privately.
+   */
+  list_type
+  take_all() {
+    list_type zret;
+    // The stack is in reverse push order - reverse it, fixing up the back links and counting
+    // as we go, then splice the whole chain in one step.
+    value_type *spot = _stack.exchange(nullptr, std::memory_order_acquire);
+    if (spot) {
+      value_type *tail = spot; // first popped is the last pushed.
+      value_type *head = nullptr;
+      size_t n         = 0;
+      while (spot) {
+        value_type *next = L::next_ptr(spot);
+        L::next_ptr(spot) = head;
+        if (head) {
+          L::prev_ptr(head) = spot;
+        }
+        head = spot;
+        spot = next;
+        ++n;
+      }
+      L::prev_ptr(head) = nullptr;
+      zret.append(head, tail, n);
+    }
+    return zret;
+  }
+
+  /** Check if the queue is empty.
+   *
+   * @return @c true if no elements are queued.
+   *
+   * With active producers this is only a snapshot - an element can be pushed immediately
+   * after the check.
+   */
+  bool
+  empty() const {
+    return nullptr == _stack.load(std::memory_order_acquire);
+  }
+
+protected:
+  /// Pushed elements, linked through @c L::next_ptr in reverse push order.
+  std::atomic<value_type *> _stack{nullptr};
+
+  // noncopyable
+  IntrusiveMPSCQueue(self_type const &)         = delete;
+  self_type &operator=(self_type const &)       = delete;
+};
+
+}} // namespace swoc::SWOC_VERSION_NS
@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+ * Scatter/gather @c BufferWriter.
+ */
+#pragma once
+
+#include <sys/uio.h>
+
+#include <vector>
+
+#include "swoc/swoc_version.h"
+#include "swoc/MemSpan.h"
+#include "swoc/MemArena.h"
+#include "swoc/BufferWriter.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+/** A scatter capable @c BufferWriter.
+ *
+ * Output is accumulated as an array of @c iovec suitable for @c writev rather than in a single
+ * contiguous buffer. Writes are copied in to chunks allocated from an internal arena, with
+ * adjacent writes coalesced in to a single @c iovec. A span written via the @c MemSpan<char const>
+ * overload that is at least the reference size is not copied - it is recorded as an @c iovec
+ * referring to the original memory. This makes assembling output from large pre-existing payloads
+ * (file chunks, body fragments) zero copy, while formatted output (e.g. headers) is still
+ * supported via the @c BufferWriter interface.
+ *
+ * @note Referenced spans must remain live and unmodified until the output is consumed.
+ *
+ * @note The writer is growable and therefore never in an error state - @c extent and @c size are
+ * always the same.
+ */
+class IoVecWriter : public BufferWriter {
+  using self_type  = IoVecWriter;  ///< Self reference type.
+  using super_type = BufferWriter; ///< Parent type.
+
+public:
+  /// Default minimum size for a span to be recorded by reference instead of copied.
+  static constexpr size_t DEFAULT_REF_SIZE = 1024;
+
+  /** Constructor.
+   *
+   * @param ref_size Minimum size for a span to be recorded by reference.
+   */
+  explicit IoVecWriter(size_t ref_size = DEFAULT_REF_SIZE);
+
+  /// Write a single character @a c to the output.
+  self_type &write(char c) override;
+
+  /// Write @a length bytes, starting at @a data, to the output.
+  self_type &write(void const *data, size_t length) override;
+
+  // Bring in non-overridden methods.
+  using super_type::write;
+
+  /** Write @a span to the output.
+   *
+   * @param span Data to write.
+   * @return @a this
+   *
+   * If @a span is at least the reference size it is recorded by reference, otherwise it is
+   * copied. A referenced span must remain live and unmodified until the output is consumed.
+   */
+  self_type &write(MemSpan<char const> span);
+
+  /// @copydoc write(MemSpan<char const>)
+  self_type &write(MemSpan<char> span);
+
+  /// @return The first byte of the first chunk of output, or @c nullptr if there is none.
+  /// @note The output is not contiguous - use @c iovec_span to access all of it.
+  char const *data() const override;
+
+  /// @return @c false - the writer grows as needed and does not discard output.
+  bool error() const override;
+
+  /// @return The start of the unused space in the current chunk.
+  char *aux_data() override;
+
+  /// @return The extent plus the unused space in the current chunk.
+  size_t capacity() const override;
+
+  /// @return Total number of bytes written.
+  size_t extent() const override;
+
+  /// Add @a n bytes written to the current chunk via @c aux_data to the output.
+  bool commit(size_t n) override;
+
+  /// Drop @a n bytes from the end of the output.
+  /// @note Chunk memory for dropped bytes is not reclaimed until @c clear.
+  self_type &discard(size_t n) override;
+
+  /// Reduce the space available in the current chunk by @a n bytes.
+  self_type &restrict(size_t n) override;
+
+  /// Restore @a n bytes of space removed by @c restrict.
+  self_type &restore(size_t n) override;
+
+  /** Copy data in the output.
+   *
+   * @internal Justification for formatted output is done in the nested fixed writers, not the
+   * target writer, therefore this is unused. Supporting it across scattered chunks is not worth
+   * the complexity, so it always throws.
+   */
+  self_type &copy(size_t dst, size_t src, size_t n) override;
+
+  /// Output the contents to the @a stream.
+  std::ostream &operator>>(std::ostream &stream) const override;
+
+  /// @return The accumulated scatter list.
+  MemSpan<struct iovec const> iovec_span() const;
+
+  /** Write the output to @a fd using @c writev.
+   *
+   * @param fd Open file descriptor.
+   * @return The number of bytes written, or -1 with @c errno set if the first write failed.
+   *
+   * Scatter lists longer than @c IOV_MAX are written in batches. A short write terminates the
+   * batches and the number of bytes written so far is returned.
+   */
+  ssize_t writev(int fd) const;
+
+  /// Reset to empty, discarding the scatter list and releasing chunk memory for re-use.
+  self_type &clear();
+
+protected:
+  size_t _ref_size;              ///< Minimum size for recording a span by reference.
+  MemArena _arena;               ///< Chunk storage for copied output.
+  std::vector<struct iovec> _iov; ///< Scatter list.
+  size_t _extent = 0;            ///< Total bytes written.
+  size_t _restricted = 0;        ///< Bytes of chunk space removed by @c restrict.
+
+  /** Add [ @a data, @a n ) to the scatter list.
+   *
+   * If the bytes directly follow the last element it is extended, otherwise a new element is
+   * appended.
+   */
+  void append(void const *data, size_t n);
+};
+
+inline IoVecWriter::IoVecWriter(size_t ref_size) : _ref_size(ref_size) {}
+
+inline IoVecWriter &
+IoVecWriter::write(char c) {
+  return this->write(&c, 1);
+}
+
+inline IoVecWriter &
+IoVecWriter::write(MemSpan<char const> span) {
+  if (span.size() >= _ref_size) {
+    this->append(span.data(), span.size());
+    _extent += span.size();
+    return *this;
+  }
+  return this->write(span.data(), span.size());
+}
+
+inline IoVecWriter &
+IoVecWriter::write(MemSpan<char> span) {
+  return this->write(MemSpan<char const>(span.data(), span.size()));
+}
+
+inline char const *
+IoVecWriter::data() const {
+  return _iov.empty() ? nullptr : static_cast<char const *>(_iov.front().iov_base);
+}
+
+inline bool
+IoVecWriter::error() const {
+  return false;
+}
+
+inline char *
+IoVecWriter::aux_data() {
+  return static_cast<char *>(_arena.remnant().data());
+}
+
+inline size_t
+IoVecWriter::capacity() const {
+  auto avail = _arena.remaining();
+  return _extent + (_restricted < avail ? avail - _restricted : 0);
+}
+
+inline size_t
+IoVecWriter::extent() const {
+  return _extent;
+}
+
+inline auto
+IoVecWriter::restrict(size_t n) -> self_type & {
+  _restricted += n;
+  return *this;
+}
+
+inline auto
+IoVecWriter::restore(size_t n) -> self_type & {
+  _restricted -= std::min(n, _restricted);
+  return *this;
+}
+
+inline MemSpan<struct iovec const>
+IoVecWriter::iovec_span() const {
+  return {_iov.data(), _iov.size()};
+}
+
+inline auto
+IoVecWriter::clear() -> self_type & {
+  _iov.clear();
+  _arena.clear();
+  _extent     = 0;
+  _restricted = 0;
+  return *this;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
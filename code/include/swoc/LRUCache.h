@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   Concurrent LRU cache.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <memory>
+
+#include "swoc/swoc_version.h"
+#include "swoc/IntrusiveDList.h"
+#include "swoc/IntrusiveHashMap.h"
+#include "swoc/MemArena.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** A thread safe, bounded LRU cache.
+ *
+ * The cache is split in to shards, each with its own lock, list, and index so that operations on
+ * distinct keys rarely contend. Entries live in intrusive nodes allocated from a per shard
+ * @c MemArena and recycled through a free list - once the cache has reached steady state no
+ * further allocation is done.
+ *
+ * When a shard exceeds its share of @a max_items the least recently used entries are evicted in a
+ * batch so that the cost of list and index maintenance is amortized over @c EVICT_BATCH insertions
+ * rather than paid on every one.
+ *
+ * @tparam K Key type - must be hashable by @a H and equality comparable.
+ * @tparam V Value type - copied out on retrieval.
+ * @tparam H Hash functor for @a K, used for both the index and shard selection.
+ */
+template <typename K, typename V, typename H = std::hash<K>> class LRUCache {
+  using self_type = LRUCache; ///< Self reference type.
+
+public:
+  /// Number of entries evicted at once when a shard is over full.
+  static constexpr size_t EVICT_BATCH = 16;
+
+  /// Cache usage counters.
+  struct Stats {
+    size_t _hits      = 0; ///< Retrievals that found the key.
+    size_t _misses    = 0; ///< Retrievals that did not.
+    size_t _evictions = 0; ///< Entries removed by capacity eviction.
+  };
+
+  /** Constructor.
+   *
+   * @param max_items Maximum number of cached entries, divided evenly over the shards.
+   * @param n_shards Number of shards - rounded up to a power of 2.
+   */
+  explicit LRUCache(size_t max_items = 1024, unsigned n_shards = 8);
+
+  /// Not copyable - entries are intrusively linked in to per instance storage.
+  LRUCache(self_type const &that)             = delete;
+  self_type &operator=(self_type const &that) = delete;
+
+  /** Insert or update the value for @a key.
+   *
+   * @param key Key for the value.
+   * @param value Value to cache - taken by value, pass an rvalue to avoid the copy.
+   * @return @a this
+   *
+   * The entry becomes the most recently used. If this pushes the shard past its capacity the
+   * least recently used entries in the shard are evicted as a batch.
+   */
+  self_type &insert(K const &key, V value);
+
+  /** Retrieve the value for @a key.
+   *
+   * @param key Key to look up.
+   * @return The cached value, or no value if @a key is not cached.
+   *
+   * A hit makes the entry the most recently used in its shard.
+   */
+  std::optional<V> retrieve(K const &key);
+
+  /** Remove the entry for @a key, if any.
+   *
+   * @param key Key to remove.
+   * @return @c true if an entry was removed.
+   */
+  bool erase(K const &key);
+
+  /// @return The number of cached entries.
+  size_t count() const;
+
+  /// @return Counters summed over the shards.
+  Stats stats() const;
+
+protected:
+  /// A cached entry - linked in to both the LRU list and the shard index.
+  struct Item {
+    using self_type = Item; ///< Self reference type.
+
+    /// Intrusive link pair.
+    struct Links {
+      self_type *_next = nullptr; ///< Forward link.
+      self_type *_prev = nullptr; ///< Backward link.
+    };
+
+    K _key;      ///< Cache key.
+    V _value;    ///< Cached value.
+    Links _list; ///< LRU list links.
+    Links _map;  ///< Index links.
+
+    /// Construct with @a key and @a value.
+    Item(K const &key, V &&value) : _key(key), _value(std::move(value)) {}
+
+    /// @cond INTERNAL_DETAIL
+    struct ListLinkage {
+      static self_type *&
+      next_ptr(self_type *item) {
+        return item->_list._next;
+      }
+      static self_type *&
+      prev_ptr(self_type *item) {
+        return item->_list._prev;
+      }
+    };
+
+    struct MapLinkage {
+      static self_type *&
+      next_ptr(self_type *item) {
+        return item->_map._next;
+      }
+      static self_type *&
+      prev_ptr(self_type *item) {
+        return item->_map._prev;
+      }
+      static K const &
+      key_of(self_type *item) {
+        return item->_key;
+      }
+      static auto
+      hash_of(K const &key) -> decltype(H{}(key)) {
+        return H{}(key);
+      }
+      static bool
+      equal(K const &lhs, K const &rhs) {
+        return lhs == rhs;
+      }
+    };
+    /// @endcond
+  };
+
+  using List  = IntrusiveDList<typename Item::ListLinkage>;
+  using Table = IntrusiveHashMap<typename Item::MapLinkage>;
+
+  /// An independently locked slice of the cache.
+  struct Shard {
+    std::mutex _mutex; ///< Guards all shard state.
+    List _list;        ///< LRU order - head is least recently used.
+    Table _table;      ///< Keyed index of the entries.
+    List _free;        ///< Destroyed entries available for reuse.
+    MemArena _arena;   ///< Entry storage.
+    Stats _stats;      ///< Usage counters.
+  };
+
+  size_t _shard_max;                 ///< Maximum entries per shard.
+  unsigned _shard_mask;              ///< Mask to select a shard from a hash.
+  std::unique_ptr<Shard[]> _shards;  ///< Shard storage.
+
+  /// @return The shard for @a key.
+  Shard &shard_for(K const &key);
+
+  /** Evict the @c EVICT_BATCH least recently used entries in @a shard.
+   *
+   * Must be called with the shard lock held. Evicted entries are destructed and put on the free
+   * list for reuse.
+   */
+  void evict(Shard &shard);
+
+  /** Unlink @a item from @a shard and recycle its node.
+   *
+   * Must be called with the shard lock held.
+   */
+  void retire(Shard &shard, Item *item);
+};
+
+template <typename K, typename V, typename H>
+LRUCache<K, V, H>::LRUCache(size_t max_items, unsigned n_shards) {
+  unsigned n = 1;
+  while (n < n_shards) {
+    n <<= 1;
+  }
+  _shard_mask = n - 1;
+  _shard_max  = std::max<size_t>(1, (max_items + n - 1) / n);
+  _shards.reset(new Shard[n]);
+}
+
+template <typename K, typename V, typename H>
+auto
+LRUCache<K, V, H>::shard_for(K const &key) -> Shard & {
+  return _shards[H{}(key) & _shard_mask];
+}
+
+template <typename K, typename V, typename H>
+void
+LRUCache<K, V, H>::retire(Shard &shard, Item *item) {
+  shard._table.erase(item);
+  shard._list.erase(item);
+  item->~Item();
+  shard._free.append(item);
+}
+
+template <typename K, typename V, typename H>
+void
+LRUCache<K, V, H>::evict(Shard &shard) {
+  size_t n = std::min<size_t>(EVICT_BATCH, shard._list.count());
+  for (size_t idx = 0; idx < n; ++idx) {
+    this->retire(shard, shard._list.head());
+  }
+  shard._stats._evictions += n;
+}
+
+template <typename K, typename V, typename H>
+auto
+LRUCache<K, V, H>::insert(K const &key, V value) -> self_type & {
+  auto &shard = this->shard_for(key);
+  std::lock_guard lock(shard._mutex);
+  auto spot = shard._table.find(key);
+  if (spot != shard._table.end()) {
+    spot->_value = std::move(value);
+    shard._list.erase(spot);
+    shard._list.append(spot);
+  } else {
+    Item *item = shard._free.take_head();
+    if (item != nullptr) {
+      new (item) Item(key, std::move(value));
+    } else {
+      item = shard._arena.template make<Item>(key, std::move(value));
+    }
+    shard._table.insert(item);
+    shard._list.append(item);
+    if (shard._list.count() > _shard_max) {
+      this->evict(shard);
+    }
+  }
+  return *this;
+}
+
+template <typename K, typename V, typename H>
+std::optional<V>
+LRUCache<K, V, H>::retrieve(K const &key) {
+  auto &shard = this->shard_for(key);
+  std::lock_guard lock(shard._mutex);
+  auto spot = shard._table.find(key);
+  if (spot == shard._table.end()) {
+    ++shard._stats._misses;
+    return {};
+  }
+  ++shard._stats._hits;
+  shard._list.erase(spot);
+  shard._list.append(spot);
+  return spot->_value;
+}
+
+template <typename K, typename V, typename H>
+bool
+LRUCache<K, V, H>::erase(K const &key) {
+  auto &shard = this->shard_for(key);
+  std::lock_guard lock(shard._mutex);
+  auto spot = shard._table.find(key);
+  if (spot == shard._table.end()) {
+    return false;
+  }
+  this->retire(shard, spot);
+  return true;
+}
+
+template <typename K, typename V, typename H>
+size_t
+LRUCache<K, V, H>::count() const {
+  size_t n = 0;
+  for (unsigned idx = 0; idx <= _shard_mask; ++idx) {
+    std::lock_guard lock(_shards[idx]._mutex);
+    n += _shards[idx]._table.count();
+  }
+  return n;
+}
+
+template <typename K, typename V, typename H>
+auto
+LRUCache<K, V, H>::stats() const -> Stats {
+  Stats sum;
+  for (unsigned idx = 0; idx <= _shard_mask; ++idx) {
+    std::lock_guard lock(_shards[idx]._mutex);
+    sum._hits += _shards[idx]._stats._hits;
+    sum._misses += _shards[idx]._stats._misses;
+    sum._evictions += _shards[idx]._stats._evictions;
+  }
+  return sum;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
@@ -9,10 +9,13 @@
 
 #include <string_view>
 #include <initializer_list>
+#include <memory>
 #include <tuple>
 #include <functional>
 #include <array>
 #include <variant>
+#include <vector>
+#include <algorithm>
 
 #include "swoc/swoc_version.h"
 #include "swoc/IntrusiveHashMap.h"
@@ -62,6 +65,44 @@ Lexicon_Hash(E e) {
   return hasher(e);
 }
 
+/** Case insensitive name policy for @c Lexicon.
+ *
+ * A name policy provides the hash and equality used for name lookup. The query is hashed in
+ * place, folding case per character - no copy or transform buffer is needed. This is the
+ * default policy.
+ */
+struct LexiconNocase {
+  /// Hash @a name, case folded.
+  static uint32_t
+  hash(std::string_view name) {
+    return Hash32FNV1a().hash_nocase_immediate(name);
+  }
+
+  /// Case insensitive equality.
+  static bool
+  equal(std::string_view const &lhs, std::string_view const &rhs) {
+    return 0 == strcasecmp(lhs, rhs);
+  }
+};
+
+/** Case sensitive name policy for @c Lexicon.
+ *
+ * Names are hashed and compared exactly as provided.
+ */
+struct LexiconExact {
+  /// Hash @a name.
+  static uint32_t
+  hash(std::string_view name) {
+    return Hash32FNV1a().hash_immediate(name);
+  }
+
+  /// Exact equality.
+  static bool
+  equal(std::string_view const &lhs, std::string_view const &rhs) {
+    return lhs == rhs;
+  }
+};
+
 /** A bidirectional mapping between names and enumeration values.
 
     This is intended to be a support class to make interacting with enumerations easier for
@@ -81,10 +122,14 @@ Lexicon_Hash(E e) {
     entirely of calls to @c define and @c set_default, the only difference is these methods can
     be called on a @c const instance from there.
 
-    @note All names and value must be unique across the Lexicon. All name comparisons are case
-    insensitive.
+    @note All names and value must be unique across the Lexicon. By default all name comparisons
+    are case insensitive - this is controlled by @a NAME_POLICY, which provides the hash and
+    equality for name lookup.
+
+    @see LexiconNocase
+    @see LexiconExact
  */
-template <typename E> class Lexicon {
+template <typename E, typename NAME_POLICY = LexiconNocase> class Lexicon {
   using self_type = Lexicon; ///< Self reference type.
 
 protected:
@@ -252,6 +297,26 @@ public:
   /// Get the number of values with definitions.
   size_t count() const;
 
+  /** Freeze the lexicon.
+   *
+   * @return @a this.
+   *
+   * This builds single probe lookup tables over the defined names and values - a multiplicative
+   * hash placement is searched out under which every defined key maps to a distinct slot, so
+   * @c operator[] does exactly one probe with no bucket chain chasing. This is intended for
+   * lexicons that are fully defined at start up and then queried heavily (header names,
+   * configuration keys).
+   *
+   * Once frozen no further definitions are allowed - @c define throws. Default handlers can
+   * still be changed. In the (rare) case that no collision free placement can be found for a
+   * table, lookup for that table quietly remains on the hash map.
+   */
+  self_type &freeze();
+
+  /// @return @c true if @a this has been frozen.
+  /// @see freeze
+  bool is_frozen() const;
+
 protected:
   /// Common features of container iterators.
   class base_iterator {
@@ -509,14 +574,58 @@ protected:
   /// Copy @a name in to local storage.
   TextView localize(TextView const &name);
 
+  /** Single probe lookup table, built by @c freeze.
+   *
+   * The items of one of the hash maps are placed in a power of two slot array by a
+   * multiplicative hash chosen such that the defined keys are collision free - a lookup
+   * probes exactly one slot.
+   */
+  struct FrozenTable {
+    MemSpan<Item const *> _slots; ///< Slot array, a power of two in size.
+    uint64_t _mult{1};            ///< Multiplier for the slot mapping.
+    unsigned _shift{63};          ///< Shift for the slot mapping.
+
+    /// @return The slot index for hash value @a h.
+    size_t
+    slot_of(uint64_t h) const {
+      return (h * _mult) >> _shift;
+    }
+
+    /// @return @c true if the table was successfully built.
+    bool
+    is_valid() const {
+      return !_slots.empty();
+    }
+  };
+
+  /** Build a frozen table over @a items.
+   *
+   * @param items The items to place, each with its key hash.
+   * @return The table, or an empty table if no collision free placement was found.
+   */
+  FrozenTable build_frozen(std::vector<std::pair<uint64_t, Item const *>> const &items);
+
+  /** Compact item storage.
+   *
+   * Definition order interleaves item nodes and name bytes with other arena allocations, so a
+   * lookup can touch a node line and a separate name line. This relocates the items in to a
+   * fresh arena, each node immediately followed by its name bytes and the items laid out in
+   * name bucket order, so a probe touches a single contiguous region and the whole lexicon
+   * occupies a minimal footprint. Called from @c freeze, before the probe tables are built.
+   */
+  void compact();
+
   /// Storage for names.
   MemArena _arena{1024};
   /// Access by name.
   IntrusiveHashMap<typename Item::NameLinkage> _by_name;
   /// Access by value.
   IntrusiveHashMap<typename Item::ValueLinkage> _by_value;
-  NameDefault _name_default;   ///< Name to return if no value not found.
-  ValueDefault _value_default; ///< Value to return if name not found.
+  NameDefault _name_default;    ///< Name to return if no value not found.
+  ValueDefault _value_default;  ///< Value to return if name not found.
+  bool _frozen_p = false;       ///< Whether @c freeze has been done.
+  FrozenTable _frozen_by_name;  ///< Single probe name lookup.
+  FrozenTable _frozen_by_value; ///< Single probe value lookup.
 };
 
 // ==============
@@ -525,66 +634,66 @@ protected:
 // ----
 // Item
 
-template <typename E> Lexicon<E>::Item::Item(E value, TextView name) : _payload{value, name} {}
+template <typename E, typename NAME_POLICY> Lexicon<E, NAME_POLICY>::Item::Item(E value, TextView name) : _payload{value, name} {}
 
 /// @cond INTERNAL_DETAIL
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::Item::NameLinkage::next_ptr(Item *item) -> Item *& {
+Lexicon<E, NAME_POLICY>::Item::NameLinkage::next_ptr(Item *item) -> Item *& {
   return item->_name_link._next;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::Item::NameLinkage::prev_ptr(Item *item) -> Item *& {
+Lexicon<E, NAME_POLICY>::Item::NameLinkage::prev_ptr(Item *item) -> Item *& {
   return item->_name_link._prev;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::Item::ValueLinkage::next_ptr(Item *item) -> Item *& {
+Lexicon<E, NAME_POLICY>::Item::ValueLinkage::next_ptr(Item *item) -> Item *& {
   return item->_value_link._next;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::Item::ValueLinkage::prev_ptr(Item *item) -> Item *& {
+Lexicon<E, NAME_POLICY>::Item::ValueLinkage::prev_ptr(Item *item) -> Item *& {
   return item->_value_link._prev;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 std::string_view
-Lexicon<E>::Item::NameLinkage::key_of(Item *item) {
+Lexicon<E, NAME_POLICY>::Item::NameLinkage::key_of(Item *item) {
   return item->_payload._name;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 E
-Lexicon<E>::Item::ValueLinkage::key_of(Item *item) {
+Lexicon<E, NAME_POLICY>::Item::ValueLinkage::key_of(Item *item) {
   return item->_payload._value;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 uint32_t
-Lexicon<E>::Item::NameLinkage::hash_of(std::string_view s) {
-  return Hash32FNV1a().hash_immediate(transform_view_of(&toupper, s));
+Lexicon<E, NAME_POLICY>::Item::NameLinkage::hash_of(std::string_view s) {
+  return NAME_POLICY::hash(s);
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 size_t
-Lexicon<E>::Item::ValueLinkage::hash_of(E value) {
+Lexicon<E, NAME_POLICY>::Item::ValueLinkage::hash_of(E value) {
   return Lexicon_Hash<E>(value);
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 bool
-Lexicon<E>::Item::NameLinkage::equal(std::string_view const &lhs, std::string_view const &rhs) {
-  return 0 == strcasecmp(lhs, rhs);
+Lexicon<E, NAME_POLICY>::Item::NameLinkage::equal(std::string_view const &lhs, std::string_view const &rhs) {
+  return NAME_POLICY::equal(lhs, rhs);
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 bool
-Lexicon<E>::Item::ValueLinkage::equal(E lhs, E rhs) {
+Lexicon<E, NAME_POLICY>::Item::ValueLinkage::equal(E lhs, E rhs) {
   return lhs == rhs;
 }
 /// @endcond
@@ -592,9 +701,9 @@ Lexicon<E>::Item::ValueLinkage::equal(E lhs, E rhs) {
 // -------
 // Lexicon
 
-template <typename E> Lexicon<E>::Lexicon() {}
+template <typename E, typename NAME_POLICY> Lexicon<E, NAME_POLICY>::Lexicon() {}
 
-template <typename E> Lexicon<E>::Lexicon(with_multi items, Default handler_1, Default handler_2) {
+template <typename E, typename NAME_POLICY> Lexicon<E, NAME_POLICY>::Lexicon(with_multi items, Default handler_1, Default handler_2) {
   for (auto const &item : items) {
     this->define(item.value, item.names);
   }
@@ -604,7 +713,7 @@ template <typename E> Lexicon<E>::Lexicon(with_multi items, Default handler_1, D
   }
 }
 
-template <typename E> Lexicon<E>::Lexicon(with items, Default handler_1, Default handler_2) {
+template <typename E, typename NAME_POLICY> Lexicon<E, NAME_POLICY>::Lexicon(with items, Default handler_1, Default handler_2) {
   for (auto const &item : items) {
     this->define(item);
   }
@@ -614,41 +723,54 @@ template <typename E> Lexicon<E>::Lexicon(with items, Default handler_1, Default
   }
 }
 
-template <typename E> Lexicon<E>::Lexicon(Default handler_1, Default handler_2) {
+template <typename E, typename NAME_POLICY> Lexicon<E, NAME_POLICY>::Lexicon(Default handler_1, Default handler_2) {
   for (auto &&h : {handler_1, handler_2}) {
     this->set_default(h);
   }
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 TextView
-Lexicon<E>::localize(TextView const &name) {
+Lexicon<E, NAME_POLICY>::localize(TextView const &name) {
   auto span = _arena.alloc_span<char>(name.size());
   memcpy(span, name);
   return {span.data(), span.size()};
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 TextView
-Lexicon<E>::operator[](E const &value) const {
-  if (auto spot = _by_value.find(value); spot != _by_value.end()) {
+Lexicon<E, NAME_POLICY>::operator[](E const &value) const {
+  if (_frozen_by_value.is_valid()) {
+    auto *item = _frozen_by_value._slots[_frozen_by_value.slot_of(Item::ValueLinkage::hash_of(value))];
+    if (item && Item::ValueLinkage::equal(item->_payload._value, value)) {
+      return item->_payload._name;
+    }
+  } else if (auto spot = _by_value.find(value); spot != _by_value.end()) {
     return spot->_payload._name;
   }
   return std::visit(NameDefaultVisitor{value}, _name_default);
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 E
-Lexicon<E>::operator[](TextView const &name) const {
-  if (auto spot = _by_name.find(name); spot != _by_name.end()) {
+Lexicon<E, NAME_POLICY>::operator[](TextView const &name) const {
+  if (_frozen_by_name.is_valid()) {
+    auto *item = _frozen_by_name._slots[_frozen_by_name.slot_of(Item::NameLinkage::hash_of(name))];
+    if (item && Item::NameLinkage::equal(item->_payload._name, name)) {
+      return item->_payload._value;
+    }
+  } else if (auto spot = _by_name.find(name); spot != _by_name.end()) {
     return spot->_payload._value;
   }
   return std::visit(ValueDefaultVisitor{name}, _value_default);
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::define(E value, const std::initializer_list<TextView> &names) -> self_type & {
+Lexicon<E, NAME_POLICY>::define(E value, const std::initializer_list<TextView> &names) -> self_type & {
+  if (_frozen_p) {
+    throw std::logic_error("Lexicon: cannot define in a frozen Lexicon");
+  }
   if (names.size() < 1) {
     throw std::invalid_argument("A defined value must have at least a primary name");
   }
@@ -666,29 +788,29 @@ Lexicon<E>::define(E value, const std::initializer_list<TextView> &names) -> sel
   return *this;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 template <typename... Args>
 auto
-Lexicon<E>::define(E value, Args &&...names) -> self_type & {
+Lexicon<E, NAME_POLICY>::define(E value, Args &&...names) -> self_type & {
   static_assert(sizeof...(Args) > 0, "A defined value must have at least a primary name");
   return this->define(value, {std::forward<Args>(names)...});
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::define(const Pair &pair) -> self_type & {
+Lexicon<E, NAME_POLICY>::define(const Pair &pair) -> self_type & {
   return this->define(pair._value, pair._name);
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::define(const Definition &init) -> self_type & {
+Lexicon<E, NAME_POLICY>::define(const Definition &init) -> self_type & {
   return this->define(init.value, init.names);
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::set_default(Default const &handler) -> self_type & {
+Lexicon<E, NAME_POLICY>::set_default(Default const &handler) -> self_type & {
   switch (handler.index()) {
   case 0:
     break;
@@ -708,113 +830,240 @@ Lexicon<E>::set_default(Default const &handler) -> self_type & {
   return *this;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 size_t
-Lexicon<E>::count() const {
+Lexicon<E, NAME_POLICY>::count() const {
   return _by_value.count();
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::begin() const -> const_iterator {
+Lexicon<E, NAME_POLICY>::freeze() -> self_type & {
+  if (!_frozen_p) {
+    this->compact(); // tight item layout first - the probe tables point in to it.
+    std::vector<std::pair<uint64_t, Item const *>> items;
+    for (Item const &item : _by_name) {
+      items.emplace_back(Item::NameLinkage::hash_of(item._payload._name), &item);
+    }
+    _frozen_by_name = this->build_frozen(items);
+    items.clear();
+    for (Item const &item : _by_value) {
+      items.emplace_back(Item::ValueLinkage::hash_of(item._payload._value), &item);
+    }
+    _frozen_by_value = this->build_frozen(items);
+    _frozen_p        = true;
+  }
+  return *this;
+}
+
+template <typename E, typename NAME_POLICY>
+bool
+Lexicon<E, NAME_POLICY>::is_frozen() const {
+  return _frozen_p;
+}
+
+template <typename E, typename NAME_POLICY>
+void
+Lexicon<E, NAME_POLICY>::compact() {
+  if (_by_name.count() == 0) {
+    return;
+  }
+  // Gather the items in name bucket order and size the new storage exactly.
+  std::vector<Item *> olds;
+  olds.reserve(_by_name.count());
+  size_t total = 0;
+  for (Item &item : _by_name) {
+    olds.push_back(&item);
+    total += sizeof(Item) + ((item._payload._name.size() + alignof(Item) - 1) & ~(alignof(Item) - 1));
+  }
+
+  MemArena arena{total};
+  std::vector<Item *> news;
+  std::vector<bool> primary;
+  news.reserve(olds.size());
+  primary.reserve(olds.size());
+  for (Item *old : olds) {
+    TextView name{old->_payload._name};
+    auto span  = arena.alloc(sizeof(Item) + name.size(), alignof(Item)).template rebind<char>();
+    char *text = span.data() + sizeof(Item); // name bytes ride directly behind the node.
+    memcpy(text, name.data(), name.size());
+    news.push_back(new (span.data()) Item(old->_payload._value, TextView{text, name.size()}));
+    auto spot = _by_value.find(old->_payload._value);
+    primary.push_back(spot != _by_value.end() && &*spot == old);
+  }
+
+  _by_name.clear();
+  _by_value.clear();
+  for (size_t idx = 0; idx < news.size(); ++idx) {
+    _by_name.insert(news[idx]);
+    if (primary[idx]) {
+      _by_value.insert(news[idx]);
+    }
+  }
+  for (Item *old : olds) {
+    std::destroy_at(old);
+  }
+  _arena = std::move(arena); // releases the old scattered storage.
+}
+
+template <typename E, typename NAME_POLICY>
+auto
+Lexicon<E, NAME_POLICY>::build_frozen(std::vector<std::pair<uint64_t, Item const *>> const &items) -> FrozenTable {
+  if (items.empty()) {
+    return {};
+  }
+
+  // Distinct keys with identical hash values can never be separated - leave the table empty
+  // so lookup falls back to the hash map.
+  {
+    std::vector<uint64_t> hashes;
+    hashes.reserve(items.size());
+    for (auto const &[h, item] : items) {
+      hashes.push_back(h);
+    }
+    std::sort(hashes.begin(), hashes.end());
+    if (std::adjacent_find(hashes.begin(), hashes.end()) != hashes.end()) {
+      return {};
+    }
+  }
+
+  size_t m   = 2; // slot count, always a power of 2.
+  unsigned k = 1; // log2 of @a m.
+  while (m < items.size()) {
+    m <<= 1;
+    ++k;
+  }
+
+  uint64_t seed = 0x9E3779B97F4A7C15u;
+  std::vector<Item const *> scratch;
+  while (m <= 64 * items.size()) {
+    unsigned shift = 64 - k;
+    for (int attempt = 0; attempt < 64; ++attempt) {
+      seed          = seed * 6364136223846793005u + 1442695040888963407u; // LCG step.
+      uint64_t mult = seed | 1;
+      scratch.assign(m, nullptr);
+      bool ok = true;
+      for (auto const &[h, item] : items) {
+        auto &slot = scratch[(h * mult) >> shift];
+        if (slot) {
+          ok = false;
+          break;
+        }
+        slot = item;
+      }
+      if (ok) {
+        auto span = _arena.alloc_span<Item const *>(m);
+        std::copy(scratch.begin(), scratch.end(), span.begin());
+        return {span, mult, shift};
+      }
+    }
+    m <<= 1; // no luck at this size, grow the table and try again.
+    ++k;
+  }
+  return {}; // no placement found - fall back to the hash map.
+}
+
+template <typename E, typename NAME_POLICY>
+auto
+Lexicon<E, NAME_POLICY>::begin() const -> const_iterator {
   return const_iterator{static_cast<const Item *>(_by_value.begin())};
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::end() const -> const_iterator {
+Lexicon<E, NAME_POLICY>::end() const -> const_iterator {
   return {};
 }
 
 // Iterators
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::base_iterator::operator*() const -> reference {
+Lexicon<E, NAME_POLICY>::base_iterator::operator*() const -> reference {
   return _item->_payload;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::base_iterator::operator->() const -> pointer {
+Lexicon<E, NAME_POLICY>::base_iterator::operator->() const -> pointer {
   return &(_item->_payload);
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 bool
-Lexicon<E>::base_iterator::operator==(self_type const &that) const {
+Lexicon<E, NAME_POLICY>::base_iterator::operator==(self_type const &that) const {
   return _item == that._item;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 bool
-Lexicon<E>::base_iterator::operator!=(self_type const &that) const {
+Lexicon<E, NAME_POLICY>::base_iterator::operator!=(self_type const &that) const {
   return _item != that._item;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::value_iterator::operator++() -> self_type & {
+Lexicon<E, NAME_POLICY>::value_iterator::operator++() -> self_type & {
   super_type::_item = super_type::_item->_value_link._next;
   return *this;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::value_iterator::operator++(int) -> self_type {
+Lexicon<E, NAME_POLICY>::value_iterator::operator++(int) -> self_type {
   self_type tmp{*this};
   ++*this;
   return tmp;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::value_iterator::operator--() -> self_type & {
+Lexicon<E, NAME_POLICY>::value_iterator::operator--() -> self_type & {
   super_type::_item = super_type::_item->_value_link->_prev;
   return *this;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::value_iterator::operator--(int) -> self_type {
+Lexicon<E, NAME_POLICY>::value_iterator::operator--(int) -> self_type {
   self_type tmp;
   ++*this;
   return tmp;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::name_iterator::operator++() -> self_type & {
+Lexicon<E, NAME_POLICY>::name_iterator::operator++() -> self_type & {
   super_type::_item = super_type::_item->_name_link._next;
   return *this;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::name_iterator::operator++(int) -> self_type {
+Lexicon<E, NAME_POLICY>::name_iterator::operator++(int) -> self_type {
   self_type tmp{*this};
   ++*this;
   return tmp;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::name_iterator::operator--() -> self_type & {
+Lexicon<E, NAME_POLICY>::name_iterator::operator--() -> self_type & {
   super_type::_item = super_type::_item->_name_link->_prev;
   return *this;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 auto
-Lexicon<E>::name_iterator::operator--(int) -> self_type {
+Lexicon<E, NAME_POLICY>::name_iterator::operator--(int) -> self_type {
   self_type tmp;
   ++*this;
   return tmp;
 }
 
-template <typename E>
+template <typename E, typename NAME_POLICY>
 BufferWriter &
-bwformat(BufferWriter &w, bwf::Spec const &spec, Lexicon<E> const &lex) {
+bwformat(BufferWriter &w, bwf::Spec const &spec, Lexicon<E, NAME_POLICY> const &lex) {
   bool sep_p = false;
   if (spec._type == 's' || spec._type == 'S') {
     for (auto &&[value, name] : lex) {
@@ -7,19 +7,31 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <memory>
 #include <utility>
 #include <new>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
 #if __has_include(<memory_resource>)
 #include <memory_resource>
 #endif
 
 #include "swoc/MemSpan.h"
+#include "swoc/swoc_stats.h"
 #include "swoc/Scalar.h"
 #include "swoc/IntrusiveDList.h"
 #include "swoc/TextView.h"
 
+#if __has_include(<sys/mman.h>)
+#include <sys/mman.h>
+#define SWOC_MEM_ARENA_HAS_MMAP 1
+#endif
+
 namespace swoc { inline namespace SWOC_VERSION_NS {
 
 /** A memory arena.
@@ -56,6 +68,23 @@ public:
   /// If the unique pointer is to be initialized with an arena, it should probably be a direct member isntead.
   using unique_ptr = std::unique_ptr<self_type, void (*)(self_type *)>;
 
+  /** Block source and sizing options.
+   *
+   * Passed at construction to select how the arena reserves memory from the system. The
+   * default options reproduce the standard malloc based behavior.
+   */
+  struct Options {
+    /// Minimum size of internally reserved blocks - requests are rounded up to this.
+    /// Zero means no minimum beyond the standard sizing.
+    size_t min_block_size = 0;
+    /// Reserve blocks via anonymous @c mmap instead of @c malloc.
+    bool use_mmap = false;
+    /// Back blocks with huge pages - tries @c MAP_HUGETLB first, then falls back to a
+    /// normal mapping with @c MADV_HUGEPAGE so transparent huge pages can be used.
+    /// Implies @c use_mmap.
+    bool huge_pages = false;
+  };
+
   /// Simple internal arena block of memory. Maintains the underlying memory.
   struct Block {
     /// A block must have at least this much free space to not be "full".
@@ -122,7 +151,8 @@ public:
     bool is_full() const;
 
   protected:
-    friend MemArena; ///< Container.
+    friend MemArena;       ///< Container.
+    friend class ArenaPool; ///< Access for block recycling.
 
     /** Override @c operator @c delete.
      *
@@ -159,8 +189,11 @@ public:
      */
     explicit Block(size_t n) noexcept;
 
+    static constexpr uint32_t MMAPPED = 1; ///< Flag - block memory is from @c mmap.
+
     size_t size;         ///< Actual block size.
     size_t allocated{0}; ///< Current allocated (in use) bytes.
+    uint32_t _flags{0};  ///< Block source flags.
 
     struct Linkage {
       /// @cond INTERNAL_DETAIL
@@ -192,6 +225,14 @@ public:
    */
   explicit MemArena(size_t n = DEFAULT_BLOCK_SIZE);
 
+  /** Construct with block source options.
+   *
+   * @param opts Options selecting the block source and sizing.
+   *
+   * As with the size hint constructor, no memory is reserved until needed.
+   */
+  explicit MemArena(Options const &opts);
+
   /** Construct using static block.
    *
    * @param static_block A block of memory that is non-deletable.
@@ -444,6 +485,47 @@ public:
    */
   size_t reserved_size() const;
 
+  /** Allocation telemetry.
+   *
+   * A point in time report of the arena internals, for sizing and leak hunting. The block
+   * data is computed on demand by walking the block lists - there is no tracking overhead.
+   */
+  struct Telemetry {
+    /// Number of block size histogram buckets.
+    static constexpr size_t N_BUCKETS = 24;
+
+    size_t _high_water  = 0; ///< Maximum bytes allocated in a single generation.
+    size_t _block_count = 0; ///< Blocks currently held (active and frozen).
+    size_t _block_total = 0; ///< Blocks allocated over the arena lifetime.
+    /// Held blocks by size - bucket @c i counts blocks of size [2^i, 2^(i+1)), clamped to the last bucket.
+    std::array<size_t, N_BUCKETS> _block_sizes{};
+  };
+
+  /// Callback type for block allocation - invoked with the arena and the usable block size.
+  using BlockHook = std::function<void(self_type &, size_t)>;
+
+  /// @return Telemetry for the current state of the arena.
+  Telemetry telemetry() const;
+
+  /** High water mark for generation size.
+   *
+   * @return The maximum number of bytes allocated in any single generation.
+   *
+   * This spans freeze / thaw and @c clear - use it after a load cycle to compute the
+   * @c reserve size that makes a transaction arena single block.
+   */
+  size_t high_water() const;
+
+  /** Set a callback on internal block allocation.
+   *
+   * @param hook Callback, or an empty function to remove.
+   * @return @a this.
+   *
+   * The hook is invoked after each block allocation - a cold path, a correctly sized arena
+   * never triggers it after start up. The hook must not allocate from this arena.
+   */
+  self_type &set_block_alloc_hook(BlockHook hook);
+
   using const_iterator = BlockList::const_iterator; ///< Constant element iteration.
   using iterator       = const_iterator;            ///< Element iteration.
 
@@ -467,6 +549,9 @@ protected:
    */
   Block *make_block(size_t n);
 
+  /// Release the memory of @a block back to its source (heap or mapping).
+  static void destroy_block(Block *block);
+
   /// Clean up the frozen list.
   void destroy_frozen();
 
@@ -487,6 +572,10 @@ protected:
   size_t _frozen_allocated = 0;
   size_t _frozen_reserved = 0; ///< Total frozen reserved memory.
 
+  size_t _high_water  = 0; ///< Maximum bytes allocated in a completed generation.
+  size_t _block_total = 0; ///< Blocks allocated over the arena lifetime.
+  BlockHook _block_hook;   ///< Invoked on internal block allocation, if set.
+
   /// Minimum free space needed in the next allocated block.
   /// This is not zero iff @c reserve was called.
   size_t _reserve_hint = 0;
@@ -497,10 +586,15 @@ protected:
   /// Static block, if any.
   Block *_static_block = nullptr;
 
+  /// Block source options.
+  Options _opts;
+
   // Note on _active block list - blocks that become full are moved to the end of the list.
   // This means that when searching for a block with space, the first full block encountered
   // marks the last block to check. This keeps the set of blocks to check short.
 
+  friend class ArenaPool; ///< Access to blocks for recycling.
+
 private:
 #if __has_include(<memory_resource>)
   // PMR support methods.
@@ -566,6 +660,367 @@ public:
   MemArena &arena();
 };
 
+/** Standard library allocator that draws from a @c MemArena.
+ *
+ * @tparam T Type to allocate.
+ *
+ * This adapts an arena to the standard allocator interface so standard containers (and
+ * @c Vectray) can use arena memory for their internal storage. Deallocation is a no-op -
+ * as with all arena memory, storage is reclaimed when the arena is cleared or destroyed.
+ * The arena must outlive any container using the allocator.
+ */
+template <typename T> class ArenaAllocator {
+  using self_type = ArenaAllocator; ///< Self reference type.
+
+  template <typename U> friend class ArenaAllocator; // for rebinding construction.
+
+public:
+  using value_type = T; ///< Allocated type.
+
+  /** Construct to allocate from @a arena.
+   *
+   * @param arena The arena for memory.
+   */
+  ArenaAllocator(MemArena &arena) : _arena(&arena) {}
+
+  /// Rebinding conversion - shares the arena of @a that.
+  template <typename U> ArenaAllocator(ArenaAllocator<U> const &that) : _arena(that._arena) {}
+
+  /** Allocate memory for @a n instances of @a T.
+   *
+   * @param n Number of instances.
+   * @return A pointer to suitably sized and aligned memory.
+   *
+   * The instances are not constructed - this is raw memory per the allocator interface.
+   */
+  T *
+  allocate(size_t n) {
+    return _arena->alloc(sizeof(T) * n, alignof(T)).template rebind<T>().data();
+  }
+
+  /// Deallocation is a no-op - the memory is reclaimed by the arena in bulk.
+  void deallocate(T *, size_t) {}
+
+  /// Allocators are equal iff they draw from the same arena.
+  bool
+  operator==(self_type const &that) const {
+    return _arena == that._arena;
+  }
+
+  /// Allocators are unequal iff they draw from different arenas.
+  bool
+  operator!=(self_type const &that) const {
+    return _arena != that._arena;
+  }
+
+protected:
+  MemArena *_arena; ///< Memory source.
+};
+
+#if __has_include(<memory_resource>)
+/** PMR memory resource over a @c MemArena.
+ *
+ * @c MemArena is itself a @c std::pmr::memory_resource and can be passed directly to PMR
+ * containers. This adapter differs in that deallocation is not a no-op - it offers the
+ * released span back to the arena via @c MemArena::discard. For containers that grow by
+ * reallocation (e.g. @c std::pmr::vector) this reclaims the tail allocation and greatly
+ * reduces the space wasted by the doubling churn. Frozen generations are unaffected -
+ * @c discard only ever touches the active generation, so freeze / thaw works as usual.
+ *
+ * The arena must outlive the resource and any container using it.
+ */
+class ArenaResource : public std::pmr::memory_resource {
+  using self_type = ArenaResource; ///< Self reference type.
+
+public:
+  /** Construct a resource drawing from @a arena.
+   *
+   * @param arena The arena for memory.
+   */
+  explicit ArenaResource(MemArena &arena) : _arena(&arena) {}
+
+  /// Access the wrapped arena directly.
+  MemArena &
+  arena() const {
+    return *_arena;
+  }
+
+  /** Convenience to build a PMR allocator on this resource.
+   *
+   * @tparam T Type to allocate - defaults to @c std::byte for untyped use.
+   * @return A polymorphic allocator drawing from the arena.
+   */
+  template <typename T = std::byte>
+  std::pmr::polymorphic_allocator<T>
+  allocator() {
+    return std::pmr::polymorphic_allocator<T>{this};
+  }
+
+protected:
+  /// PMR allocation - forwarded to the arena.
+  void *do_allocate(std::size_t bytes, std::size_t align) override;
+
+  /// PMR deallocation - the span is offered back to the arena.
+  void do_deallocate(void *ptr, size_t bytes, size_t align) override;
+
+  /// PMR comparison of memory resources.
+  /// @return @c true if @a that draws from the same arena, including the arena itself.
+  bool do_is_equal(std::pmr::memory_resource const &that) const noexcept override;
+
+  MemArena *_arena; ///< Memory source.
+};
+#endif
+
+/** Process wide pool of retired @c MemArena blocks.
+ *
+ * Arenas created and destroyed at high rate pay a malloc/free round trip per generation of
+ * blocks. This pool keeps retired blocks in a per thread cache with a lock free global
+ * overflow stack, so an arena can draw its initial reserve from previously retired memory
+ * and return its blocks without touching the system allocator.
+ *
+ * All methods are static - the pool is a process wide facility. The common usage is
+ * @code
+ *   auto arena = ArenaPool::make(); // initial reserve from the pool if available.
+ *   // ... use arena ...
+ *   ArenaPool::retire(std::move(arena)); // blocks go back to the pool.
+ * @endcode
+ *
+ * A thread caches at most a fixed number of blocks - excess blocks are pushed on the global
+ * overflow stack, which a thread with an empty cache claims wholesale. The overflow stack is
+ * a Treiber stack that is only popped in its entirety, which avoids the ABA problem without
+ * tags or hazard pointers.
+ */
+class ArenaPool {
+  using self_type = ArenaPool; ///< Self reference type.
+
+public:
+  ArenaPool() = delete; ///< Static interface only.
+
+  /** Create an arena, drawing the initial reserve from the pool.
+   *
+   * @param n Minimum number of available bytes in the initial block.
+   * @return The arena.
+   *
+   * If no cached block satisfies @a n the arena is constructed as usual and reserves from
+   * the heap on first allocation.
+   */
+  static MemArena make(size_t n = MemArena::DEFAULT_BLOCK_SIZE);
+
+  /** Retire an arena, returning its blocks to the pool.
+   *
+   * @param arena The arena to retire.
+   *
+   * All blocks (active and frozen) are discarded and cached for re-use. A static block, if
+   * any, is not pooled. The arena is left empty and valid.
+   */
+  static void retire(MemArena &&arena);
+
+  /// @return The number of blocks in this thread's cache.
+  static size_t local_count();
+
+  /// Release all cached blocks (this thread's cache and the global overflow) to the heap.
+  static void drain();
+
+protected:
+  /// Per thread block cache.
+  struct Cache {
+    MemArena::Block *_head = nullptr; ///< Singly linked chain of cached blocks.
+    size_t _count          = 0;       ///< Number of blocks in the chain.
+    ~Cache();                         ///< Blocks are freed on thread exit.
+  };
+
+  /// Maximum number of blocks cached per thread - excess goes to the overflow stack.
+  static constexpr size_t THREAD_CACHE_MAX = 8;
+
+  /** Fetch a cached block with at least @a n bytes of space.
+   *
+   * @param n Required available space.
+   * @return A block, or @c nullptr if none cached.
+   */
+  static MemArena::Block *fetch(size_t n);
+
+  /// Cache @a block, overflowing to the global stack if the thread cache is full.
+  static void cache(MemArena::Block *block);
+
+  static thread_local Cache _cache;                ///< This thread's cache.
+  static std::atomic<MemArena::Block *> _overflow; ///< Global overflow stack.
+};
+
+/** Size classed allocation pool on top of a @c MemArena.
+ *
+ * This generalizes @c FixedArena to a small set of power of two size classes. Freed spans are
+ * kept on per class free lists and recycled by subsequent allocations of the same class, so
+ * steady state allocation traffic of recurring sizes never goes back to the underlying arena.
+ *
+ * Requests larger than the largest size class are passed directly to the arena and are not
+ * recycled. Spans passed to @c free must have come from @c alloc on the same instance.
+ *
+ * @note Recycling does not release memory - as with @c FixedArena the storage is reclaimed
+ * only when the underlying arena is cleared or destroyed, at which point the free lists must
+ * be dropped via @c clear.
+ */
+class TieredArena {
+  using self_type = TieredArena; ///< Self reference type.
+
+protected:
+  /// Rebinding type for spans on a free list.
+  struct Item {
+    Item *_next; ///< Next item in the free list.
+  };
+
+public:
+  static constexpr size_t MIN_CLASS = 16;                       ///< Smallest size class.
+  static constexpr size_t N_TIERS   = 9;                        ///< Number of size classes.
+  static constexpr size_t MAX_CLASS = MIN_CLASS << (N_TIERS - 1); ///< Largest size class (4096).
+
+  /** Construct a pool.
+   *
+   * @param arena The arena for memory.
+   */
+  explicit TieredArena(MemArena &arena);
+
+  /** Allocate @a n bytes.
+   *
+   * @param n Number of bytes.
+   * @return A span of at least @a n bytes, recycled from the free lists if possible.
+   */
+  MemSpan<void> alloc(size_t n);
+
+  /** Return a span to the pool.
+   *
+   * @param span A span obtained from @c alloc.
+   *
+   * The span is placed on the free list for its size class for re-use.
+   */
+  void free(MemSpan<void> span);
+
+  /** Create a new instance of @a T.
+   *
+   * @tparam T Type to create.
+   * @tparam Args Constructor argument types.
+   * @param args Constructor arguments.
+   * @return A new instance of @a T.
+   */
+  template <typename T, typename... Args> T *make(Args &&...args);
+
+  /** Destroy an instance created via @c make.
+   *
+   * @param t The instance to destroy.
+   *
+   * The instance is destructed and its storage recycled.
+   */
+  template <typename T> void destroy(T *t);
+
+  /// Drop all free lists - required if the underlying arena is cleared or thawed.
+  void clear();
+
+  /// Access the wrapped arena directly.
+  MemArena &arena();
+
+protected:
+  /// @return The free list index for a request of @a n bytes.
+  static size_t tier_of(size_t n);
+
+  /// @return The size class (rounded up size) for free list index @a tier.
+  static size_t class_size(size_t tier);
+
+  std::array<Item, N_TIERS> _lists; ///< Per size class free lists.
+  MemArena &_arena;                 ///< Memory source.
+};
+
+/** Thread safe arena of a specific type, in the style of @c FixedArena.
+ *
+ * @tparam T Type in the arena.
+ *
+ * @c FixedArena is single threaded - an instance freed on a different thread than it was
+ * allocated corrupts the free list. This class supports that pattern directly: instances can
+ * be created and destroyed concurrently from any thread, with no routing of frees back to the
+ * allocating thread.
+ *
+ * The design is that of a thread caching allocator scoped to one type. Each thread keeps a
+ * private cache of free instances, so in the steady state @c make and @c destroy touch no
+ * shared data. A thread whose cache overflows pushes a batch to a per arena lock free remote
+ * list in a single CAS; a thread whose cache is empty claims that list wholesale. The remote
+ * list is pushed and popped only in bulk, which avoids the ABA problem without tags or hazard
+ * pointers. Only when both the cache and the remote list are empty is the underlying arena
+ * locked to carve a fresh batch of instances.
+ *
+ * As with @c FixedArena memory is reclaimed only in bulk - @c clear drops all free instances
+ * and the arena memory. @c clear requires external quiescence: no concurrent @c make or
+ * @c destroy, and no live instances. Instances cached by a thread when it exits are not lost -
+ * the bytes remain owned by the arena - but are unavailable for re-use until @c clear.
+ */
+template <typename T> class ConcurrentFixedArena {
+  using self_type = ConcurrentFixedArena; ///< Self reference type.
+
+protected:
+  /// Rebinding type for instances on a free list.
+  struct Item {
+    Item *_next; ///< Next item in the free list.
+  };
+
+  /// Per thread cache of free instances for one arena instance.
+  struct Cache {
+    void const *_owner = nullptr; ///< Owning arena instance.
+    uint64_t _id       = 0;       ///< Owner generation - the slot is stale if this is out of date.
+    Item *_head        = nullptr; ///< Free instances.
+    size_t _count      = 0;       ///< Number of free instances.
+  };
+
+public:
+  /// Number of instances carved from the arena, or flushed to the remote list, at a time.
+  static constexpr size_t BATCH = 16;
+  /// Cache size that triggers a flush of a batch to the remote list.
+  static constexpr size_t CACHE_MAX = 2 * BATCH;
+
+  /// Construct an empty arena.
+  ConcurrentFixedArena();
+
+  /** Create a new instance.
+   *
+   * @tparam Args Constructor argument types.
+   * @param args Constructor arguments.
+   * @return A new instance of @a T.
+   *
+   * Thread safe.
+   */
+  template <typename... Args> T *make(Args &&...args);
+
+  /** Destroy an instance.
+   *
+   * @param t The instance to destroy.
+   *
+   * The instance is destructed and cached for re-use. Thread safe - @a t need not have been
+   * created on this thread.
+   */
+  void destroy(T *t);
+
+  /** Drop all free instances and the arena memory.
+   *
+   * Not thread safe - requires external quiescence and no live instances. Thread caches are
+   * invalidated and reclaimed lazily as threads next use this instance.
+   */
+  void clear();
+
+protected:
+  /// @return This thread's cache for @a this, creating or reclaiming a slot as needed.
+  Cache &local_cache();
+
+  /// Refill @a cache from the remote list, or failing that the arena. @a cache must be empty.
+  void refill(Cache &cache);
+
+  /// Flush a batch from @a cache to the remote list.
+  void flush(Cache &cache);
+
+  /// @return A process unique instance generation.
+  static uint64_t next_id();
+
+  uint64_t _id;                       ///< Instance generation - changed by @c clear.
+  std::atomic<Item *> _remote{nullptr}; ///< Remote free list - bulk push / pop only.
+  std::mutex _mutex;                  ///< Guards @a _arena.
+  MemArena _arena;                    ///< Memory source.
+};
+
 // --- Implementation ---
 /// @cond INTERNAL_DETAIL
 
@@ -721,6 +1176,18 @@ MemArena::allocated_size() const {
   return _frozen_allocated + _active_allocated;
 }
 
+inline size_t
+MemArena::high_water() const {
+  // The live generations may already be the largest footprint.
+  return std::max(_high_water, _active_allocated + _frozen_allocated);
+}
+
+inline auto
+MemArena::set_block_alloc_hook(BlockHook hook) -> self_type & {
+  _block_hook = std::move(hook);
+  return *this;
+}
+
 inline size_t
 MemArena::remaining() const {
   return _active.empty() ? 0 : _active.head()->remaining();
@@ -769,6 +1236,8 @@ FixedArena<T>::make(Args... args) {
     _list._next = _list._next->_next;
     return new (t) T(std::forward<Args>(args)...);
   }
+  SWOC_STAT_INC(_fixed_arena_alloc);
+  SWOC_PROBE1(fixed_arena_alloc, sizeof(T));
   return _arena.template make<T>(std::forward<Args>(args)...);
 }
 
@@ -795,6 +1264,189 @@ FixedArena<T>::arena() {
   return _arena;
 }
 
+inline TieredArena::TieredArena(MemArena &arena) : _arena(arena) {
+  for (auto &list : _lists) {
+    list._next = nullptr;
+  }
+}
+
+inline size_t
+TieredArena::tier_of(size_t n) {
+  size_t tier = 0;
+  for (size_t c = MIN_CLASS; c < n; c <<= 1) {
+    ++tier;
+  }
+  return tier;
+}
+
+inline size_t
+TieredArena::class_size(size_t tier) {
+  return MIN_CLASS << tier;
+}
+
+inline MemSpan<void>
+TieredArena::alloc(size_t n) {
+  if (n > MAX_CLASS) { // too big to recycle, pass through.
+    return _arena.alloc(n, alignof(std::max_align_t));
+  }
+  auto tier = tier_of(n);
+  if (auto *item = _lists[tier]._next; item) {
+    _lists[tier]._next = item->_next;
+    return {item, n};
+  }
+  return _arena.alloc(class_size(tier), alignof(std::max_align_t)).prefix(n);
+}
+
+inline void
+TieredArena::free(MemSpan<void> span) {
+  if (span.size() > MAX_CLASS) {
+    return; // not recyclable - memory stays in the arena until it is cleared.
+  }
+  auto tier          = tier_of(span.size());
+  auto *item         = static_cast<Item *>(span.data());
+  item->_next        = _lists[tier]._next;
+  _lists[tier]._next = item;
+}
+
+template <typename T, typename... Args>
+T *
+TieredArena::make(Args &&...args) {
+  static_assert(alignof(T) <= alignof(std::max_align_t));
+  return new (this->alloc(sizeof(T)).data()) T(std::forward<Args>(args)...);
+}
+
+template <typename T>
+void
+TieredArena::destroy(T *t) {
+  if (t) {
+    t->~T();
+    this->free({t, sizeof(T)});
+  }
+}
+
+inline void
+TieredArena::clear() {
+  for (auto &list : _lists) {
+    list._next = nullptr;
+  }
+}
+
+inline MemArena &
+TieredArena::arena() {
+  return _arena;
+}
+
+template <typename T> ConcurrentFixedArena<T>::ConcurrentFixedArena() : _id(next_id()) {
+  static_assert(sizeof(T) >= sizeof(T *));
+}
+
+template <typename T>
+uint64_t
+ConcurrentFixedArena<T>::next_id() {
+  static std::atomic<uint64_t> source{0};
+  return ++source;
+}
+
+template <typename T>
+auto
+ConcurrentFixedArena<T>::local_cache() -> Cache & {
+  static thread_local std::vector<Cache> registry;
+  Cache *stale = nullptr;
+  for (auto &cache : registry) {
+    if (cache._owner == this) {
+      if (cache._id == _id) {
+        return cache;
+      }
+      stale = &cache; // this instance was cleared - the cached chain is dead.
+    }
+  }
+  if (nullptr == stale) {
+    stale = &registry.emplace_back();
+  }
+  *stale        = Cache{};
+  stale->_owner = this;
+  stale->_id    = _id;
+  return *stale;
+}
+
+template <typename T>
+void
+ConcurrentFixedArena<T>::refill(Cache &cache) {
+  // First choice - claim the remote free list wholesale. Pop-all means no ABA hazard.
+  if (Item *head = _remote.exchange(nullptr, std::memory_order_acquire); head != nullptr) {
+    size_t n = 0;
+    for (Item *item = head; item != nullptr; item = item->_next) {
+      ++n;
+    }
+    cache._head  = head;
+    cache._count = n;
+    return;
+  }
+  // Otherwise carve a batch from the arena under the lock.
+  SWOC_STAT_INC(_fixed_arena_alloc);
+  SWOC_PROBE1(fixed_arena_alloc, BATCH * sizeof(T));
+  std::lock_guard<std::mutex> guard{_mutex};
+  for (size_t i = 0; i < BATCH; ++i) {
+    auto item   = static_cast<Item *>(_arena.alloc(sizeof(T), std::max(alignof(T), alignof(Item))).data());
+    item->_next = cache._head;
+    cache._head = item;
+  }
+  cache._count = BATCH;
+}
+
+template <typename T>
+void
+ConcurrentFixedArena<T>::flush(Cache &cache) {
+  Item *head = cache._head;
+  Item *tail = head;
+  for (size_t i = 1; i < BATCH; ++i) {
+    tail = tail->_next;
+  }
+  cache._head = tail->_next;
+  cache._count -= BATCH;
+  // Push the whole batch with a single CAS.
+  tail->_next = _remote.load(std::memory_order_relaxed);
+  while (!_remote.compare_exchange_weak(tail->_next, head, std::memory_order_release, std::memory_order_relaxed)) {
+  }
+}
+
+template <typename T>
+template <typename... Args>
+T *
+ConcurrentFixedArena<T>::make(Args &&...args) {
+  auto &cache = this->local_cache();
+  if (nullptr == cache._head) {
+    this->refill(cache);
+  }
+  void *spot  = cache._head;
+  cache._head = cache._head->_next;
+  --cache._count;
+  return new (spot) T(std::forward<Args>(args)...);
+}
+
+template <typename T>
+void
+ConcurrentFixedArena<T>::destroy(T *t) {
+  if (t) {
+    t->~T(); // destructor.
+    auto item   = reinterpret_cast<Item *>(t);
+    auto &cache = this->local_cache();
+    item->_next = cache._head;
+    cache._head = item;
+    if (++cache._count > CACHE_MAX) {
+      this->flush(cache);
+    }
+  }
+}
+
+template <typename T>
+void
+ConcurrentFixedArena<T>::clear() {
+  _remote.store(nullptr, std::memory_order_relaxed);
+  _arena.clear();
+  _id = next_id(); // invalidate all thread caches.
+}
+
 /// @endcond INTERNAL_DETAIL
 
 }} // namespace swoc::SWOC_VERSION_NS
@@ -1707,6 +1707,125 @@ MemSpan(std::string_view const &) -> MemSpan<char const>;
 MemSpan(std::string &) -> MemSpan<char>;
 MemSpan(std::string const &) -> MemSpan<char const>;
 
+/** Sequential typed carving of a raw span.
+ *
+ * @tparam V Base memory type - @c void or <tt>void const</tt>.
+ *
+ * This supports deserializing a binary layout from a single raw span (e.g. a memory mapped file)
+ * as a short declarative sequence of typed carves instead of manual pointer arithmetic. Each
+ * carve aligns the current position for the target type, takes the requested number of elements,
+ * and advances. All bounds checking is centralized - a carve that does not fit returns an empty
+ * span and latches the overflow flag, every subsequent carve returns an empty span, and the
+ * caller checks once at the end.
+ *
+ * @code
+ * swoc::SpanCarver carver{image}; // MemSpan<void const> for a read only mapping.
+ * auto header = carver.carve<Header>();
+ * auto nodes  = carver.carve<Node>(header[0]._count);
+ * auto names  = carver.carve<char>(header[0]._name_size);
+ * if (!carver) { // some carve ran past the end of the image.
+ * @endcode
+ */
+template <typename V = void> class SpanCarver {
+  using self_type = SpanCarver; ///< Self reference type.
+  static_assert(std::is_void_v<std::remove_const_t<V>>, "SpanCarver requires a void or void const span");
+
+public:
+  /// The span type consumed.
+  using span_type = MemSpan<V>;
+  /// Carved span type for @a T - const qualified if the source memory is.
+  template <typename T> using carved_type = MemSpan<std::conditional_t<std::is_const_v<V>, T const, T>>;
+
+  /// Construct to carve @a span.
+  explicit SpanCarver(span_type const &span) : _span(span) {}
+
+  /** Carve an array of @a T.
+   *
+   * @tparam T Element type.
+   * @param count Number of elements.
+   * @return The carved span, empty if it did not fit.
+   *
+   * The position is first aligned for @a T - the alignment padding is consumed.
+   */
+  template <typename T>
+  carved_type<T>
+  carve(size_t count = 1) {
+    return this->carve_aligned<T>(count, alignof(T));
+  }
+
+  /** Carve an array of @a T with explicit alignment.
+   *
+   * @tparam T Element type.
+   * @param count Number of elements.
+   * @param alignment Required alignment - must be a power of 2.
+   * @return The carved span, empty if it did not fit.
+   *
+   * For layouts with stricter than natural alignment, e.g. cache line aligned arrays.
+   */
+  template <typename T>
+  carved_type<T>
+  carve_aligned(size_t count, size_t alignment) {
+    size_t padding = (alignment - (uintptr_t(_span.data()) & (alignment - 1))) & (alignment - 1);
+    size_t n       = count * sizeof(T);
+    if (_overflow || _span.size() < padding + n) {
+      _overflow = true;
+      return {};
+    }
+    _span.remove_prefix(padding);
+    return _span.clip_prefix(n).template rebind<typename carved_type<T>::value_type>();
+  }
+
+  /** Carve @a n raw bytes.
+   *
+   * @param n Number of bytes.
+   * @return The carved span, empty if it did not fit.
+   *
+   * No alignment is performed.
+   */
+  span_type
+  carve_bytes(size_t n) {
+    if (_overflow || _span.size() < n) {
+      _overflow = true;
+      return {};
+    }
+    return _span.clip_prefix(n);
+  }
+
+  /** Skip @a n bytes.
+   *
+   * @param n Number of bytes to skip.
+   * @return @a this
+   */
+  self_type &
+  skip(size_t n) {
+    this->carve_bytes(n);
+    return *this;
+  }
+
+  /// @return The uncarved remainder of the span.
+  span_type
+  remaining() const {
+    return _span;
+  }
+
+  /// @return @c true if any carve failed to fit.
+  bool
+  overflow() const {
+    return _overflow;
+  }
+
+  /// @return @c true if all carves so far have fit.
+  explicit operator bool() const { return !_overflow; }
+
+protected:
+  span_type _span;        ///< Uncarved memory.
+  bool _overflow = false; ///< Set if a carve did not fit - latched.
+};
+
+/// Deduction guides.
+SpanCarver(MemSpan<void> const &) -> SpanCarver<void>;
+SpanCarver(MemSpan<void const> const &) -> SpanCarver<void const>;
+
 namespace detail {
 struct malloc_liberator {
   void
@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   Host database - name / address mapping with incremental reload.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "swoc/swoc_version.h"
+#include "swoc/TextView.h"
+#include "swoc/swoc_ip.h"
+#include "swoc/FlatIPSpace.h"
+#include "swoc/InternTable.h"
+#include "swoc/Errata.h"
+#include "swoc/swoc_file.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace ip {
+
+/** A host database - bidirectional name / address mapping loaded from host file format text.
+ *
+ * The source format is that of a UNIX host file - an address followed by whitespace separated
+ * names, with blank lines and @c # comments ignored. The first name for an address is its primary
+ * name, used for reverse lookup.
+ *
+ * The database is generational. @c load parses new content, diffs it against the current
+ * generation, applies only the differences to the reverse lookup space, and publishes the result
+ * as an immutable @c Snapshot which readers obtain with @c snapshot. A snapshot remains valid and
+ * unchanged for as long as the reader holds it, so lookups never block a reload and a reload never
+ * blocks lookups. Names are interned - reloading content that is mostly unchanged allocates
+ * almost nothing.
+ *
+ * Loading from a path maps the file rather than copying it and parses the mapped content in
+ * place - only the (deduplicated) names are copied out before the mapping is dropped.
+ */
+class NetDB {
+  using self_type = NetDB; ///< Self reference type.
+
+public:
+  /// Summary of the effect of a @c load.
+  struct Update {
+    size_t _added      = 0; ///< Addresses not in the previous generation.
+    size_t _removed    = 0; ///< Addresses no longer present.
+    size_t _changed    = 0; ///< Addresses whose primary name changed.
+    uint64_t _generation = 0; ///< Generation published by the load.
+  };
+
+  /// Forward index type - name to address.
+  using Forward = std::unordered_map<TextView, IPAddr, std::hash<std::string_view>>;
+
+  /** An immutable published generation of the database.
+   *
+   * Obtained from @c NetDB::snapshot. Safe for concurrent use from any number of threads with no
+   * synchronization.
+   */
+  class Snapshot {
+  public:
+    /** Forward lookup.
+     *
+     * @param name Host name to look up.
+     * @return The address for @a name, or an invalid address if @a name is not in the database.
+     */
+    IPAddr find(TextView const &name) const;
+
+    /** Reverse lookup.
+     *
+     * @param addr Address to look up.
+     * @return The primary name for @a addr, or an empty view if @a addr is not in the database.
+     */
+    TextView find(IPAddr const &addr) const;
+
+    /// @return The number of distinct names.
+    size_t count() const;
+
+    /// @return The generation number of this snapshot.
+    uint64_t generation() const;
+
+  protected:
+    friend class NetDB;
+
+    /// Construct from the master state - called only by @c NetDB::load.
+    Snapshot(std::shared_ptr<Forward const> &&forward, FlatIPSpace<TextView> &&reverse, uint64_t generation);
+
+    std::shared_ptr<Forward const> _forward; ///< Name to address, shared with the master.
+    FlatIPSpace<TextView> _reverse;          ///< Address to primary name.
+    uint64_t _generation;                    ///< Generation number.
+  };
+
+  /// Reader handle for a snapshot.
+  using snapshot_ptr = std::shared_ptr<Snapshot const>;
+
+  NetDB();
+
+  /// Not copyable - readers hold references in to instance storage.
+  NetDB(self_type const &that)                = delete;
+  self_type &operator=(self_type const &that) = delete;
+
+  /** Load @a content as the next generation.
+   *
+   * @param content Host file format text.
+   * @return A summary of the differences from the current generation, with notes for any
+   * malformed lines.
+   *
+   * The content is parsed, diffed against the current generation, and published atomically as a
+   * new snapshot. Malformed lines are skipped and noted, not fatal. Loads are serialized with
+   * respect to each other; readers are unaffected until publication.
+   */
+  Rv<Update> load(TextView content);
+
+  /** Load the file at @a path as the next generation.
+   *
+   * @param path Path of a host file format file.
+   * @return As for loading the content directly, or an error if the file could not be mapped.
+   *
+   * The file is memory mapped and parsed in place.
+   */
+  Rv<Update> load(file::path const &path);
+
+  /** Get the current snapshot.
+   *
+   * @return A handle for the most recently published generation.
+   *
+   * Safe to call from any thread at any time.
+   */
+  snapshot_ptr snapshot() const;
+
+  /// @return The generation number of the most recent publication.
+  uint64_t generation() const;
+
+protected:
+  InternTable _names;                      ///< Name storage - shared across generations.
+  std::map<IPAddr, TextView> _addrs;       ///< Address to primary name, current generation.
+  std::shared_ptr<Forward const> _forward; ///< Current forward index.
+  IPSpace<TextView> _reverse;              ///< Master reverse space - updated by diff.
+  mutable std::mutex _writer_mutex;        ///< Serializes loads.
+  snapshot_ptr _snapshot;                  ///< Current publication, accessed atomically.
+  std::atomic<uint64_t> _generation{0};    ///< Publication counter.
+};
+
+inline NetDB::Snapshot::Snapshot(std::shared_ptr<Forward const> &&forward, FlatIPSpace<TextView> &&reverse,
+                                 uint64_t generation)
+  : _forward(std::move(forward)), _reverse(std::move(reverse)), _generation(generation) {}
+
+inline IPAddr
+NetDB::Snapshot::find(TextView const &name) const {
+  auto spot = _forward->find(name);
+  return spot == _forward->end() ? IPAddr{} : spot->second;
+}
+
+inline TextView
+NetDB::Snapshot::find(IPAddr const &addr) const {
+  auto spot = _reverse.find(addr);
+  return spot == _reverse.end() ? TextView{} : spot->payload();
+}
+
+inline size_t
+NetDB::Snapshot::count() const {
+  return _forward->size();
+}
+
+inline uint64_t
+NetDB::Snapshot::generation() const {
+  return _generation;
+}
+
+inline auto
+NetDB::snapshot() const -> snapshot_ptr {
+  return std::atomic_load_explicit(&_snapshot, std::memory_order_acquire);
+}
+
+inline uint64_t
+NetDB::generation() const {
+  return _generation.load(std::memory_order_acquire);
+}
+
+} // namespace ip
+}} // namespace swoc::SWOC_VERSION_NS
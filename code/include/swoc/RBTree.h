@@ -8,6 +8,7 @@
 #pragma once
 #include "swoc/swoc_version.h"
 #include "swoc/IntrusiveDList.h"
+#include "swoc/MemSpan.h"
 
 namespace swoc { inline namespace SWOC_VERSION_NS { namespace detail {
 /** A node in a red/black tree.
@@ -112,6 +113,38 @@ struct RBNode {
    */
   void clear_child(Direction dir);
 
+  /// Number of nodes in the subtree rooted at @a this, including @a this.
+  size_t subtree_count() const;
+
+  /** The rank of @a this node in its tree.
+   *
+   * @return The number of nodes that precede @a this in order.
+   *
+   * O(log n) - maintained via the subtree counts.
+   */
+  size_t rank() const;
+
+  /** Select a node by rank in the subtree rooted at @a this.
+   *
+   * @param r Rank - the number of nodes that precede the target in order.
+   * @return The node of rank @a r, or @c nullptr if @a r is not less than the subtree count.
+   *
+   * O(log n) - the inverse of @c rank().
+   */
+  self_type *select(size_t r);
+
+  /** Build a tree from @a nodes, which must be sorted in increasing order.
+   *
+   * @param nodes The nodes for the tree.
+   * @return The root of the tree, or @c nullptr if @a nodes is empty.
+   *
+   * The tree is built bottom up in O(n) - no rebalancing is done. Every node is colored black
+   * except the deepest rank, which keeps the tree a valid red/black tree. Any existing tree
+   * structure in the nodes is overwritten. @c structure_fixup is invoked for each node so
+   * subclass augmentation is computed as part of the build.
+   */
+  static self_type *build(MemSpan<self_type *> nodes);
+
   /** @name Subclass hook methods */
   //@{
   /** Structural change notification.
@@ -120,13 +153,15 @@ struct RBNode {
       makes it possible to keep subtree information nodes synchronized with the state of the tree
       efficiently.
 
-      This is intended a hook. The base method is empty so that subclasses are not required to
-      override.
+      This is intended a hook. The base method maintains the subtree node count and subclasses
+      that override must chain to it.
 
       @internal This is the primary reason for this class.
   */
   virtual void
-  structure_fixup() {}
+  structure_fixup() {
+    _count = 1 + (_left ? _left->_count : 0) + (_right ? _right->_count : 0);
+  }
 
   /** Called from @c validate to perform any additional validation checks.
       Clients should chain this if they wish to perform additional checks.
@@ -175,6 +210,7 @@ struct RBNode {
   self_type *ripple_structure_fixup();
 
   Color _color{Color::RED};    ///< node color
+  size_t _count{1};            ///< Number of nodes in the subtree rooted here, including this node.
   self_type *_parent{nullptr}; ///< parent node (needed for rotations)
   self_type *_left{nullptr};   ///< left child
   self_type *_right{nullptr};  ///< right child
@@ -226,4 +262,9 @@ RBNode::structure_validate() {
   return true;
 }
 
+inline size_t
+RBNode::subtree_count() const {
+  return _count;
+}
+
 }}} // namespace swoc::SWOC_VERSION_NS::detail
@@ -10,6 +10,7 @@
 */
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <ratio>
 #include <ostream>
@@ -27,6 +28,10 @@ struct generic;
 
 template <intmax_t N, typename C, typename T> class Scalar;
 
+// Forward declaration - @c MemSpan.h includes this header, so the span operations below are
+// templates that instantiate only where @c MemSpan is complete.
+template <typename T> class MemSpan;
+
 namespace detail {
 /// @cond INTERNAL_DETAIL
 
@@ -1035,6 +1040,83 @@ round_down(C value) {
   return N * detail::scale_conversion_round_down<N, 1>(value);
 }
 
+/** Scale a span of unit values, rounding up.
+ *
+ * @param dst Destination scalars.
+ * @param src Source unit values.
+ * @return The number of values converted - the smaller of the two span counts.
+ *
+ * Each element of @a src is rounded up to the scale of the destination, exactly as with the
+ * single value @c round_up. The loop body is branch free so the compiler can vectorize it -
+ * for a power of two scale it reduces to shifts and masks.
+ */
+template <intmax_t N, typename C, typename T, typename U>
+size_t
+round_up(MemSpan<Scalar<N, C, T>> const &dst, MemSpan<U const> const &src) {
+  size_t n = std::min(dst.count(), src.count());
+  for (size_t idx = 0; idx < n; ++idx) {
+    dst[idx] = Scalar<N, C, T>(detail::scalar_unit_round_up_t<U>{src[idx]});
+  }
+  return n;
+}
+
+/** Scale a span of unit values, rounding down.
+ *
+ * @param dst Destination scalars.
+ * @param src Source unit values.
+ * @return The number of values converted - the smaller of the two span counts.
+ *
+ * @see round_up for performance notes.
+ */
+template <intmax_t N, typename C, typename T, typename U>
+size_t
+round_down(MemSpan<Scalar<N, C, T>> const &dst, MemSpan<U const> const &src) {
+  size_t n = std::min(dst.count(), src.count());
+  for (size_t idx = 0; idx < n; ++idx) {
+    dst[idx] = Scalar<N, C, T>(detail::scalar_unit_round_down_t<U>{src[idx]});
+  }
+  return n;
+}
+
+/** Sum a span of scalars.
+ *
+ * @param span The scalars to sum.
+ * @return The sum, with an @c intmax_t counter.
+ *
+ * The counts are accumulated directly - no per element scaling or branching, so the loop
+ * vectorizes. Overflow is not checked - use @c sum_checked if the sum can plausibly exceed
+ * the counter range.
+ */
+template <intmax_t N, typename C, typename T>
+Scalar<N, intmax_t, T>
+sum(MemSpan<Scalar<N, C, T> const> const &span) {
+  intmax_t total = 0;
+  for (auto const &v : span) {
+    total += v.count();
+  }
+  return Scalar<N, intmax_t, T>(total);
+}
+
+/** Overflow checked sum of a span of scalars.
+ *
+ * @param span The scalars to sum.
+ * @param result [out] The sum - valid only on success.
+ * @return @c true if the sum did not overflow, @c false otherwise.
+ *
+ * The overflow flag is accumulated without branching so the loop stays vectorizable.
+ */
+template <intmax_t N, typename C, typename T>
+bool
+sum_checked(MemSpan<Scalar<N, C, T> const> const &span, Scalar<N, intmax_t, T> &result) {
+  intmax_t total = 0;
+  bool overflow  = false;
+  for (auto const &v : span) {
+    overflow |= __builtin_add_overflow(total, intmax_t(v.count()), &total);
+  }
+  result = Scalar<N, intmax_t, T>(total);
+  return !overflow;
+}
+
 namespace detail {
 template <typename T>
 auto
@@ -0,0 +1,341 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+  Sharded wrapper for IntrusiveHashMap.
+
+  Spreads elements over independently locked IntrusiveHashMap shards so concurrent access
+  contends only when operations land in the same shard, rather than on one table wide lock.
+*/
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <limits>
+#include <type_traits>
+
+#include "swoc/swoc_version.h"
+#include "swoc/IntrusiveHashMap.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** A hash map of @c IntrusiveHashMap shards with per shard locking.
+ *
+ * @tparam H Descriptor class - identical requirements to @c IntrusiveHashMap.
+ * @tparam N Number of shards - must be a power of 2.
+ *
+ * The shard for a key is selected from the high bits of the hash, leaving the low bits to
+ * select the bucket inside the shard. Each shard has its own mutex, so operations on
+ * different shards do not contend. Because the elements are intrusive there is no allocation
+ * on insert and the per operation critical sections are short.
+ *
+ * Elements are never owned by the container - as with @c IntrusiveHashMap the client manages
+ * element lifetime. @c find returns a bare pointer and therefore provides no protection
+ * against a concurrent erase of that element - if elements can be erased concurrently use
+ * @c apply which invokes the functor while holding the shard lock.
+ *
+ * The aggregate iteration (@c begin / @c end) walks the shards in order @b without locking
+ * and is only safe while no other thread is modifying the map - appropriate for startup,
+ * shutdown, and quiesced inspection. For a locked traversal use @c apply.
+ */
+template <typename H, size_t N = 16> class ShardedHashMap {
+  using self_type = ShardedHashMap; ///< Self reference type.
+  using Map       = IntrusiveHashMap<H>; ///< Shard map type.
+
+  static_assert(N > 0 && 0 == (N & (N - 1)), "ShardedHashMap shard count must be a power of 2");
+
+public:
+  using value_type = typename Map::value_type; ///< Element type.
+  using key_type   = typename Map::key_type;   ///< Key type.
+  using hash_id    = typename Map::hash_id;    ///< Hash value type.
+
+  /// Number of shards.
+  static constexpr size_t SHARD_COUNT = N;
+
+protected:
+  /// A shard - a map and the lock that guards it.
+  /// Padded out so shard locks do not share cache lines.
+  struct alignas(64) Shard {
+    mutable std::mutex _mutex; ///< Guard for @a _map.
+    Map _map;                  ///< Elements in this shard.
+  };
+
+  /** Iterator over all shards.
+   *
+   * @tparam S Shard type - @c Shard or @c Shard @c const.
+   * @tparam I Iterator type of the shard map.
+   */
+  template <typename S, typename I> class iterator_impl {
+    using self_type = iterator_impl; ///< Self reference type.
+    friend class ShardedHashMap;
+
+  public:
+    using value_type        = typename std::iterator_traits<I>::value_type;
+    using pointer           = typename std::iterator_traits<I>::pointer;
+    using reference         = typename std::iterator_traits<I>::reference;
+    using difference_type   = ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    iterator_impl() = default;
+
+    reference
+    operator*() const {
+      return *_spot;
+    }
+
+    pointer
+    operator->() const {
+      return _spot.operator->();
+    }
+
+    self_type &
+    operator++() {
+      ++_spot;
+      this->seek();
+      return *this;
+    }
+
+    self_type
+    operator++(int) {
+      self_type zret{*this};
+      ++*this;
+      return zret;
+    }
+
+    bool
+    operator==(self_type const &that) const {
+      return _idx == that._idx && _spot == that._spot;
+    }
+
+    bool
+    operator!=(self_type const &that) const {
+      return !(*this == that);
+    }
+
+  protected:
+    iterator_impl(S *shards, size_t idx, I const &spot) : _shards(shards), _idx(idx), _spot(spot) { this->seek(); }
+
+    /// Skip forward over exhausted shards.
+    void
+    seek() {
+      while (_idx + 1 < N && _spot == _shards[_idx]._map.end()) {
+        ++_idx;
+        _spot = _shards[_idx]._map.begin();
+      }
+    }
+
+    S *_shards = nullptr; ///< The shard array.
+    size_t _idx{0};       ///< Current shard.
+    I _spot;              ///< Position in the current shard.
+  };
+
+public:
+  using iterator       = iterator_impl<Shard, typename Map::iterator>;
+  using const_iterator = iterator_impl<Shard const, typename Map::const_iterator>;
+
+  ShardedHashMap() = default;
+
+  /** Insert @a v.
+   *
+   * @param v Element to insert.
+   *
+   * @a v must @b not already be in a map.
+   */
+  void
+  insert(value_type *v) {
+    auto &shard = this->shard_for(H::key_of(v));
+    std::lock_guard<std::mutex> lock{shard._mutex};
+    shard._map.insert(v);
+  }
+
+  /** Find an element with key equal to @a key.
+   *
+   * @param key Key to search for.
+   * @return A matching element, or @c nullptr if not found.
+   *
+   * The element is not protected against erasure by other threads once returned.
+   */
+  value_type *
+  find(key_type key) {
+    auto &shard = this->shard_for(key);
+    std::lock_guard<std::mutex> lock{shard._mutex};
+    auto spot = shard._map.find(key);
+    return spot == shard._map.end() ? nullptr : &*spot;
+  }
+
+  /** Apply @a f to every element with key equal to @a key, under the shard lock.
+   *
+   * @tparam F A functional object of the form <tt>void F(value_type&)</tt>
+   * @param key Key to search for.
+   * @param f The function to apply.
+   * @return The number of elements to which @a f was applied.
+   */
+  template <typename F>
+  size_t
+  apply(key_type key, F &&f) {
+    size_t zret = 0;
+    auto &shard = this->shard_for(key);
+    std::lock_guard<std::mutex> lock{shard._mutex};
+    for (auto &v : shard._map.equal_range(key)) {
+      f(v);
+      ++zret;
+    }
+    return zret;
+  }
+
+  /** Remove @a v from the map.
+   *
+   * @param v Element to remove.
+   * @return @c true if @a v was in the map and removed, @c false if not.
+   *
+   * @a v is not cleaned up, that is the caller's responsibility.
+   */
+  bool
+  erase(value_type *v) {
+    auto &shard = this->shard_for(H::key_of(v));
+    std::lock_guard<std::mutex> lock{shard._mutex};
+    return shard._map.erase(v);
+  }
+
+  /** Remove and return an element with key equal to @a key.
+   *
+   * @param key Key to search for.
+   * @return The element, now out of the map, or @c nullptr if not found.
+   *
+   * Removal and retrieval are atomic with respect to the shard, making this safe for handing
+   * an element from one thread to another.
+   */
+  value_type *
+  take(key_type key) {
+    auto &shard = this->shard_for(key);
+    std::lock_guard<std::mutex> lock{shard._mutex};
+    auto spot = shard._map.find(key);
+    if (spot == shard._map.end()) {
+      return nullptr;
+    }
+    value_type *zret = &*spot;
+    shard._map.erase(spot);
+    return zret;
+  }
+
+  /** Apply @a F to every element in the map.
+   *
+   * @tparam F A functional object of the form <tt>void F(value_type&)</tt> or <tt>void F(value_type*)</tt>
+   * @param f The function to apply.
+   * @return @a this
+   *
+   * Shards are locked one at a time - the map as a whole is not frozen, elements may move
+   * between already visited and not yet visited shards only via client erase / insert.
+   */
+  template <typename F>
+  self_type &
+  apply(F &&f) {
+    for (auto &shard : _shards) {
+      std::lock_guard<std::mutex> lock{shard._mutex};
+      shard._map.apply(f);
+    }
+    return *this;
+  }
+
+  /** Remove all elements.
+   *
+   * The elements are not cleaned up - as with @c IntrusiveHashMap it is safe to destroy them
+   * first (e.g. via @c apply) and then @c clear.
+   */
+  self_type &
+  clear() {
+    for (auto &shard : _shards) {
+      std::lock_guard<std::mutex> lock{shard._mutex};
+      shard._map.clear();
+    }
+    return *this;
+  }
+
+  /// Number of elements in the map.
+  size_t
+  count() const {
+    size_t zret = 0;
+    for (auto const &shard : _shards) {
+      std::lock_guard<std::mutex> lock{shard._mutex};
+      zret += shard._map.count();
+    }
+    return zret;
+  }
+
+  /// Set the expansion policy for every shard.
+  self_type &
+  set_expansion_policy(typename Map::ExpansionPolicy policy) {
+    for (auto &shard : _shards) {
+      std::lock_guard<std::mutex> lock{shard._mutex};
+      shard._map.set_expansion_policy(policy);
+    }
+    return *this;
+  }
+
+  /// Set the expansion limit for every shard.
+  self_type &
+  set_expansion_limit(size_t n) {
+    for (auto &shard : _shards) {
+      std::lock_guard<std::mutex> lock{shard._mutex};
+      shard._map.set_expansion_limit(n);
+    }
+    return *this;
+  }
+
+  /// First element - aggregate, unlocked. @see class documentation.
+  iterator
+  begin() {
+    return iterator{_shards.data(), 0, _shards[0]._map.begin()};
+  }
+
+  /// Past last element - aggregate, unlocked.
+  iterator
+  end() {
+    return iterator{_shards.data(), N - 1, _shards[N - 1]._map.end()};
+  }
+
+  const_iterator
+  begin() const {
+    return const_iterator{_shards.data(), 0, _shards[0]._map.begin()};
+  }
+
+  const_iterator
+  end() const {
+    return const_iterator{_shards.data(), N - 1, _shards[N - 1]._map.end()};
+  }
+
+protected:
+  /// Number of bits needed to select a shard.
+  static constexpr unsigned
+  bits_for(size_t n) {
+    unsigned zret = 0;
+    while (n > 1) {
+      n >>= 1;
+      ++zret;
+    }
+    return zret;
+  }
+
+  static constexpr unsigned SHARD_BITS = bits_for(N);
+
+  /// The shard for @a key - selected by the high bits of the hash.
+  Shard &
+  shard_for(key_type key) {
+    if constexpr (SHARD_BITS == 0) {
+      return _shards[0];
+    } else {
+      using uh = std::make_unsigned_t<hash_id>;
+      auto h   = static_cast<uh>(H::hash_of(key));
+      return _shards[static_cast<size_t>(h >> (std::numeric_limits<uh>::digits - SHARD_BITS))];
+    }
+  }
+
+  std::array<Shard, N> _shards; ///< The shards.
+
+  // noncopyable, nonmovable - shards hold mutexes.
+  ShardedHashMap(self_type const &)          = delete;
+  self_type &operator=(self_type const &)    = delete;
+};
+
+}} // namespace swoc::SWOC_VERSION_NS
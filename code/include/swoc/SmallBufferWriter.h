@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+ * @c BufferWriter with an inline buffer that spills to allocation on overflow.
+ */
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include "swoc/swoc_version.h"
+#include "swoc/MemSpan.h"
+#include "swoc/BufferWriter.h"
+#include "swoc/MemArena.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+/** A @c BufferWriter that formats in to an inline buffer and grows only on overflow.
+ *
+ * @tparam N Number of bytes in the inline buffer.
+ *
+ * This is the small string optimization for formatted output. As long as the output fits in the
+ * inline buffer no allocation is done. On overflow the output migrates transparently to a heap
+ * buffer, or to a @c MemArena if one was provided to the constructor, and is never truncated.
+ * Growth is geometric so total bytes copied is linear in the output size.
+ *
+ * This is preferable to @c LocalBufferWriter when truncation is not acceptable, and to
+ * @c bwprint on a @c std::string when the common case output is small enough to not need
+ * allocation.
+ *
+ * @note Because the writer grows as needed it is never in an error state.
+ */
+template <size_t N> class SmallBufferWriter : public FixedBufferWriter {
+  using self_type  = SmallBufferWriter; ///< Self reference type.
+  using super_type = FixedBufferWriter; ///< Parent type.
+
+public:
+  /// Construct with the inline buffer and heap spill.
+  SmallBufferWriter() : super_type(_arr, N) {}
+
+  /** Construct with the inline buffer, spilling to @a arena.
+   *
+   * @param arena Arena to use for the spill buffer.
+   *
+   * The spill buffer is taken from the arena remnant, as for @c ArenaWriter, and must be
+   * committed externally if it is to survive other arena use.
+   */
+  explicit SmallBufferWriter(MemArena &arena) : super_type(_arr, N), _arena(&arena) {}
+
+  SmallBufferWriter(self_type const &) = delete;
+  self_type &operator=(self_type const &) = delete;
+
+  /// Write a single character @a c to the buffer.
+  self_type &
+  write(char c) override {
+    if (_attempted >= _capacity) {
+      this->spill(_attempted + 1);
+    }
+    this->super_type::write(c);
+    return *this;
+  }
+
+  /// Write @a length bytes, starting at @a data, to the buffer.
+  self_type &
+  write(void const *data, size_t length) override {
+    if (_attempted + length > _capacity) {
+      this->spill(_attempted + length);
+    }
+    this->super_type::write(data, length);
+    return *this;
+  }
+
+  // Bring in non-overridden methods.
+  using super_type::write;
+
+  /** Mark bytes as in use.
+   *
+   * @param n Number of bytes to include in the used buffer.
+   * @return @c true if successful, @c false if additional buffer space was required.
+   */
+  bool
+  commit(size_t n) override {
+    if (_attempted + n > _capacity) {
+      this->spill(_attempted + n);
+      return false;
+    }
+    return this->super_type::commit(n);
+  }
+
+protected:
+  /** Grow the buffer to hold at least @a n bytes, copying the current output.
+   *
+   * @param n Total size required.
+   */
+  void
+  spill(size_t n) {
+    n         = std::max(n, 2 * _capacity); // geometric growth.
+    auto text = this->view();
+    if (_arena) {
+      auto span = _arena->require(n).remnant().rebind<char>();
+      if (span.data() != _buffer) {
+        memcpy(span.data(), text.data(), text.size());
+      }
+      const_cast<char *&>(_buffer) = span.data();
+      _capacity                    = span.size();
+    } else {
+      std::unique_ptr<char[]> heap{new char[n]};
+      memcpy(heap.get(), text.data(), text.size());
+      _heap                        = std::move(heap);
+      const_cast<char *&>(_buffer) = _heap.get();
+      _capacity                    = n;
+    }
+  }
+
+  MemArena *_arena = nullptr;    ///< Spill arena, if any.
+  std::unique_ptr<char[]> _heap; ///< Heap spill buffer, if allocated.
+  char _arr[N];                  ///< Inline buffer.
+};
+
+}} // namespace swoc::SWOC_VERSION_NS
@@ -35,6 +35,7 @@
 namespace swoc { inline namespace SWOC_VERSION_NS {
 
 class TextView;
+template <typename T> class MemSpan;
 
 /** A set of characters.
  *
@@ -69,6 +70,32 @@ protected:
   std::bitset<std::numeric_limits<unsigned char>::max() + 1> _chars;
 };
 
+namespace detail {
+/** Scan a buffer for the first occurrence of any character in @a delimiters.
+ *
+ * @param data Start of buffer.
+ * @param n Size of buffer.
+ * @param delimiters Characters for which to scan.
+ * @return Offset of the first delimiter found, or @c std::string_view::npos if none found.
+ *
+ * @internal Out of line so the vectorized implementations stay in one translation unit. For small
+ * delimiter sets this classifies a register's width of bytes per iteration instead of scanning
+ * byte at a time; larger sets fall back to a bitset scan.
+ */
+size_t scan_first_of(char const *data, size_t n, std::string_view const &delimiters) noexcept;
+
+/** Scan a buffer for the first occurrence of a character @b not in @a delimiters.
+ *
+ * @param data Start of buffer.
+ * @param n Size of buffer.
+ * @param delimiters Characters to skip.
+ * @return Offset of the first non-delimiter, or @a n if every character is in @a delimiters.
+ *
+ * @see scan_first_of
+ */
+size_t scan_first_not_of(char const *data, size_t n, std::string_view const &delimiters) noexcept;
+} // namespace detail
+
 /** A read only view of a contiguous piece of memory.
 
     A @c TextView does not own the memory to which it refers, it is simply a view of part of some
@@ -646,6 +673,23 @@ public:
    */
   template <typename F> self_type clip_prefix_of(F const &pred);
 
+  /** Split the view into tokens bounded by characters in @a delimiters.
+   *
+   * @param delimiters The delimiter characters.
+   * @param out Caller provided storage for the token views.
+   * @return The number of tokens written to @a out.
+   *
+   * Tokens are split off exactly as by @c take_prefix_at and written to @a out in order,
+   * including empty tokens from adjacent delimiters. This performs the entire split in a
+   * single pass, which is cheaper than a @c take_prefix_at loop for high token counts.
+   *
+   * Splitting stops when @a out is full - on return @a this is the unparsed remnant, so a
+   * non-empty view indicates @a out was too small. Otherwise the view is fully consumed.
+   *
+   * @see take_prefix_at
+   */
+  size_t tokenize(std::string_view const &delimiters, MemSpan<self_type> const &out);
+
   /** Get a view of the last @a n bytes.
    *
    * @param n Number of chars in the suffix.
@@ -1039,6 +1083,69 @@ intmax_t svtoi(TextView src, TextView *parsed = nullptr, int base = 0);
 */
 uintmax_t svtou(TextView src, TextView *parsed = nullptr, int base = 0);
 
+namespace detail {
+/// Load 8 bytes as an unsigned integer such that the first byte is the low order octet.
+inline uint64_t
+swar_load(char const *data) {
+  uint64_t chunk;
+  ::memcpy(&chunk, data, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  chunk = __builtin_bswap64(chunk);
+#endif
+  return chunk;
+}
+
+/// @return @c true if every byte in @a chunk is an ASCII decimal digit.
+inline bool
+swar_all_decimal(uint64_t chunk) {
+  return ((chunk & 0xF0F0F0F0F0F0F0F0u) | (((chunk + 0x0606060606060606u) & 0xF0F0F0F0F0F0F0F0u) >> 4)) ==
+         0x3333333333333333u;
+}
+
+/** Convert 8 ASCII decimal digits in @a chunk to the numeric value.
+ *
+ * The low order byte is the most significant digit, as produced by @c swar_load from text.
+ * Each step folds adjacent values together, tripling the digit count per value.
+ */
+inline uint64_t
+swar_parse_decimal(uint64_t chunk) {
+  chunk = (chunk & 0x0F0F0F0F0F0F0F0Fu) * 2561u >> 8;
+  chunk = (chunk & 0x00FF00FF00FF00FFu) * 6553601u >> 16;
+  return (chunk & 0x0000FFFF0000FFFFu) * 42949672960001u >> 32;
+}
+
+/// @return @c true if every byte in @a chunk is an ASCII hexadecimal digit.
+inline bool
+swar_all_hex(uint64_t chunk) {
+  static constexpr uint64_t ONES = 0x0101010101010101u;
+  static constexpr uint64_t HIGH = 0x8080808080808080u;
+  if (chunk & HIGH) { // the range checks below require ASCII (high bit clear) input.
+    return false;
+  }
+  // With all bytes < 0x80 a per byte add can't carry across bytes, so the high bit of each
+  // byte can be used as a per byte "greater or equal" flag.
+  auto ge = [](uint64_t v, uint8_t n) { return (v + (0x80 - n) * ONES) & HIGH; };
+  uint64_t digit  = ge(chunk, '0') & ~ge(chunk, '9' + 1);
+  uint64_t folded = chunk | 0x2020202020202020u; // case fold the letters.
+  uint64_t letter = ge(folded, 'a') & ~ge(folded, 'f' + 1);
+  return (digit | letter) == HIGH;
+}
+
+/// Convert 8 ASCII hexadecimal digits in @a chunk to the numeric value.
+/// The low order byte is the most significant digit, as produced by @c swar_load from text.
+inline uint64_t
+swar_parse_hex(uint64_t chunk) {
+  // Per byte digit value - low nibble, plus 9 if it's a letter (bit 6 set).
+  uint64_t v = (chunk & 0x0F0F0F0F0F0F0F0Fu) + ((chunk >> 6) & 0x0101010101010101u) * 9;
+  // Fold adjacent values together, doubling the digit count per value.
+  static constexpr uint64_t M16 = 0x00FF00FF00FF00FFu;
+  v = ((v & M16) << 4) | ((v >> 8) & M16);
+  static constexpr uint64_t M32 = 0x0000FFFF0000FFFFu;
+  v = ((v & M32) << 8) | ((v >> 16) & M32);
+  return ((v & 0xFFFFFFFFu) << 16) | (v >> 32);
+}
+} // namespace detail
+
 /** Convert the text in @c src to an unsigned numeric value.
  *
  * @tparam N The radix (must be  1..36)
@@ -1062,6 +1169,32 @@ svto_radix(TextView &src) {
   static constexpr auto OVERFLOW_LIMIT = MAX / RADIX;
   uintmax_t zret                       = 0;
   uintmax_t v;
+
+  // Fast path for the hot radices - parse 8 digits per iteration via SWAR. Overflow can't
+  // happen inside a chunk because of the pre-chunk limit check, and the scalar loop below
+  // picks up the remaining digits (and clamping, if it comes to that).
+  if constexpr (10 == RADIX) {
+    static constexpr uintmax_t CHUNK_LIMIT = (MAX - 99'999'999) / 100'000'000;
+    while (src.size() >= 8 && zret <= CHUNK_LIMIT) {
+      auto chunk = detail::swar_load(src.data());
+      if (!detail::swar_all_decimal(chunk)) {
+        break;
+      }
+      zret = zret * 100'000'000 + detail::swar_parse_decimal(chunk);
+      src.remove_prefix(8);
+    }
+  } else if constexpr (16 == RADIX) {
+    static constexpr uintmax_t CHUNK_LIMIT = (MAX - 0xFFFFFFFFu) >> 32;
+    while (src.size() >= 8 && zret <= CHUNK_LIMIT) {
+      auto chunk = detail::swar_load(src.data());
+      if (!detail::swar_all_hex(chunk)) {
+        break;
+      }
+      zret = (zret << 32) + detail::swar_parse_hex(chunk);
+      src.remove_prefix(8);
+    }
+  }
+
   while (src.size() && (0 <= (v = swoc::svtoi_convert[uint8_t(*src)])) && v < RADIX) {
     // Tweaked for performance - need to check range after @a RADIX multiply.
     ++src; // Update view iff the character is parsed.
@@ -1268,7 +1401,7 @@ TextView::prefix_at(char c) const -> self_type {
 inline TextView
 TextView::prefix_at(std::string_view const &delimiters) const {
   self_type zret; // default to empty return.
-  if (auto n = this->find_first_of(delimiters); n != npos) {
+  if (auto n = detail::scan_first_of(this->data(), this->size(), delimiters); n != npos) {
     zret.assign(this->data(), n);
   }
   return zret;
@@ -1300,7 +1433,7 @@ TextView::remove_prefix_at(char c) {
 
 inline auto
 TextView::remove_prefix_at(std::string_view const &delimiters) -> self_type & {
-  if (auto n = this->find_first_of(delimiters); n != npos) {
+  if (auto n = detail::scan_first_of(this->data(), this->size(), delimiters); n != npos) {
     this->super_type::remove_prefix(n + 1);
   }
   return *this;
@@ -1337,7 +1470,7 @@ TextView::split_prefix_at(char c) {
 
 inline TextView
 TextView::split_prefix_at(std::string_view const &delimiters) {
-  return this->split_prefix(this->find_first_of(delimiters));
+  return this->split_prefix(detail::scan_first_of(this->data(), this->size(), delimiters));
 }
 
 template <typename F>
@@ -1361,7 +1494,7 @@ TextView::take_prefix_at(char c) {
 
 inline TextView
 TextView::take_prefix_at(std::string_view const &delimiters) {
-  return this->take_prefix(this->find_first_of(delimiters));
+  return this->take_prefix(detail::scan_first_of(this->data(), this->size(), delimiters));
 }
 
 template <typename F>
@@ -1554,12 +1687,12 @@ TextView::ltrim(CharSet const &delimiters) {
 
 inline TextView &
 TextView::ltrim(std::string_view const &delimiters) {
-  return this->ltrim(CharSet(delimiters));
+  return this->remove_prefix(detail::scan_first_not_of(this->data(), this->size(), delimiters));
 }
 
 inline TextView &
 TextView::ltrim(const char *delimiters) {
-  return this->ltrim(CharSet(delimiters));
+  return this->ltrim(std::string_view(delimiters));
 }
 
 inline TextView &
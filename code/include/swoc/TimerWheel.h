@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    Hashed hierarchical timer wheel over intrusive lists.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "swoc/swoc_version.h"
+#include "swoc/IntrusiveDList.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** Hashed hierarchical timer wheel.
+ *
+ * @tparam L Linkage descriptor - see @c IntrusiveDList.
+ *
+ * Timeouts are kept in wheel slots that are @c IntrusiveDList chains, so @c schedule and
+ * @c cancel are O(1) pointer splices with no allocation - the list links live in the scheduled
+ * objects. Expiry is batched: @c expire advances the wheel to a tick and hands every timeout
+ * due by then to a callback.
+ *
+ * Time is an abstract unsigned tick - the wheel has no clock, the caller advances it. Each of
+ * the @c N_LEVELS levels spans @c N_SLOTS times the span of the level below, so the wheel
+ * covers 2^30 ticks; a timeout past that is parked in the top level and re-sorted as the wheel
+ * turns. Advancing is O(ticks crossed) plus O(1) amortized per timeout, the standard wheel
+ * trade - ticks should be coarse enough that the wheel is not advanced idly (e.g. milliseconds).
+ *
+ * In addition to the standard linkage members, @a L must provide
+ *
+ * - <tt>uint64_t &expiry_of(value_type *)</tt> - reference to expiry tick storage in the object.
+ *
+ * The wheel owns this field while the object is scheduled; it is how @c cancel locates the
+ * containing slot without any search. A scheduled object must not be scheduled again until it
+ * has expired or been cancelled, and must not be destroyed while scheduled.
+ */
+template <typename L> class TimerWheel {
+  using self_type = TimerWheel; ///< Self reference type.
+
+public:
+  /// Type of elements in the wheel, deduced from the linkage.
+  using value_type = typename IntrusiveDList<L>::value_type;
+
+  static constexpr unsigned SLOT_BITS = 6;                    ///< log2 of slots per level.
+  static constexpr size_t N_SLOTS    = size_t{1} << SLOT_BITS; ///< Slots per level.
+  static constexpr unsigned N_LEVELS = 5;                     ///< Wheel levels.
+  /// Ticks covered by the wheel - timeouts past this are parked in the top level.
+  static constexpr uint64_t SPAN = uint64_t{1} << (SLOT_BITS * N_LEVELS);
+
+  /** Construct an empty wheel.
+   *
+   * @param now The current tick.
+   */
+  explicit TimerWheel(uint64_t now = 0) : _now(now) {}
+
+  // The scheduled objects hold pointers in to the wheel via their slot lists.
+  TimerWheel(self_type const &)            = delete;
+  self_type &operator=(self_type const &)  = delete;
+
+  /** Schedule @a item to expire at tick @a expiry.
+   *
+   * @param item Object to schedule - must not currently be scheduled.
+   * @param expiry Expiration tick.
+   *
+   * An @a expiry at or before the current tick is adjusted to the next tick, so it expires on
+   * the next @c expire call.
+   */
+  void
+  schedule(value_type *item, uint64_t expiry) {
+    if (expiry <= _now) {
+      expiry = _now + 1; // late - expire on the next tick.
+    }
+    L::expiry_of(item) = expiry;
+    this->slot_for(expiry).append(item);
+    ++_count;
+  }
+
+  /** Cancel the timeout for @a item.
+   *
+   * @param item Object to deschedule.
+   * @return @c true if @a item was scheduled and has been removed, @c false if not scheduled.
+   */
+  bool
+  cancel(value_type *item) {
+    List &slot = this->slot_for(L::expiry_of(item));
+    if (nullptr == L::next_ptr(item) && nullptr == L::prev_ptr(item) && slot.head() != item) {
+      return false; // not linked anywhere.
+    }
+    slot.erase(item);
+    --_count;
+    return true;
+  }
+
+  /** Advance the wheel to tick @a now, expiring due timeouts.
+   *
+   * @tparam F A functional object of the form <tt>void F(value_type&)</tt>
+   * @param now Tick to advance to.
+   * @param f Function applied to each expired object.
+   * @return The number of timeouts expired.
+   *
+   * Every object with an expiry at or before @a now is unlinked and passed to @a f, in tick
+   * order. @a f may re-schedule or destroy the object - it is already off the wheel.
+   */
+  template <typename F>
+  size_t
+  expire(uint64_t now, F &&f) {
+    size_t zret = 0;
+    while (_now < now) {
+      ++_now;
+      // Cascade each level whose slot boundary is crossed at this tick.
+      for (unsigned k = 1; k < N_LEVELS; ++k) {
+        if (0 != (_now & ((uint64_t{1} << (SLOT_BITS * k)) - 1))) {
+          break;
+        }
+        this->cascade(_wheel[k][(_now >> (SLOT_BITS * k)) & (N_SLOTS - 1)]);
+      }
+      List &slot = _wheel[0][_now & (N_SLOTS - 1)];
+      while (value_type *item = slot.take_head()) {
+        if (L::expiry_of(item) <= _now) {
+          --_count;
+          ++zret;
+          f(*item);
+        } else { // not due - re-sort. Cannot land back in this slot, that would mean it is due.
+          this->place(item);
+        }
+      }
+    }
+    return zret;
+  }
+
+  /// @return The current tick.
+  uint64_t
+  now() const {
+    return _now;
+  }
+
+  /// @return The number of scheduled timeouts.
+  size_t
+  count() const {
+    return _count;
+  }
+
+protected:
+  using List = IntrusiveDList<L>; ///< A slot chain.
+
+  /** The slot for @a expiry.
+   *
+   * The level is the highest slot-index group in which @a expiry differs from the current
+   * tick. Cascading at group boundaries preserves this placement rule as the wheel turns,
+   * which is what lets @c cancel recompute the slot instead of storing it per object.
+   */
+  List &
+  slot_for(uint64_t expiry) {
+    if (expiry < _now) { // should not happen - schedule clamps and expiry drains on time.
+      return _wheel[0][(_now + 1) & (N_SLOTS - 1)];
+    }
+    // Note @a expiry equal to the current tick yields level 0 slot (_now % N_SLOTS), which is
+    // drained in the same tick - cascading at the due tick still expires on time.
+    uint64_t diff = expiry ^ _now;
+    unsigned k    = 0;
+    while (k + 1 < N_LEVELS && 0 != (diff >> (SLOT_BITS * (k + 1)))) {
+      ++k;
+    }
+    return _wheel[k][(expiry >> (SLOT_BITS * k)) & (N_SLOTS - 1)];
+  }
+
+  /// Put @a item (already counted) in the slot for its expiry.
+  void
+  place(value_type *item) {
+    this->slot_for(L::expiry_of(item)).append(item);
+  }
+
+  /// Re-sort every element of @a slot to its current level.
+  void
+  cascade(List &slot) {
+    List list{std::move(slot)}; // detach first - an element may re-place in to the same slot.
+    while (value_type *item = list.take_head()) {
+      this->place(item);
+    }
+  }
+
+  uint64_t _now;       ///< Current tick.
+  size_t _count{0};    ///< Scheduled timeouts.
+  /// The wheel proper - levels of slot chains.
+  std::array<std::array<List, N_SLOTS>, N_LEVELS> _wheel;
+};
+
+}} // namespace swoc::SWOC_VERSION_NS
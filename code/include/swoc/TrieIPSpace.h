@@ -0,0 +1,327 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   Multibit trie backend for IP address space lookup.
+ */
+
+#pragma once
+
+#include <swoc/FlatIPSpace.h>
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+/** Immutable multibit trie form of @c IPSpace.
+ *
+ * @tparam PAYLOAD The color class.
+ *
+ * This is a read-only variant of @c IPSpace tuned for prefix heavy spaces. Each range in the
+ * source space is decomposed in to its covering networks and the prefixes are stored in a fixed
+ * stride (8 bit) trie with bitmap compressed nodes - a lookup inspects at most one node per
+ * address byte and each node is a single popcount indexed access, with no comparisons against
+ * range boundaries. Prefixes whose width is not a multiple of the stride use controlled prefix
+ * expansion. For CIDR dominated spaces this is several times faster than the range tree or even
+ * the flattened binary search.
+ *
+ * Payloads and iteration order live in an embedded @c FlatIPSpace - @c find returns its iterator
+ * and iteration is identical to the flattened space. Because the source ranges are disjoint the
+ * trie needs no longest-prefix tie breaking.
+ */
+template <typename PAYLOAD> class TrieIPSpace {
+  using self_type = TrieIPSpace;
+
+public:
+  using payload_t  = PAYLOAD;              ///< Export payload type.
+  using flat_type  = FlatIPSpace<PAYLOAD>; ///< Embedded flattened space type.
+  using value_type = typename flat_type::value_type;
+  /// Iterators are always constant - the space is immutable.
+  using const_iterator = typename flat_type::const_iterator;
+  using iterator       = const_iterator;
+
+  /// Construct an empty space.
+  TrieIPSpace() = default;
+
+  TrieIPSpace(self_type const &that)          = delete;
+  TrieIPSpace(self_type &&that)               = default;
+  self_type &operator=(self_type const &that) = delete;
+  self_type &operator=(self_type &&that)      = delete;
+
+  /** Construct from a populated @a space.
+   *
+   * @param space Source space.
+   *
+   * The ranges and payloads in @a space are copied - @a space is not modified and the two
+   * instances are subsequently independent.
+   */
+  explicit TrieIPSpace(IPSpace<PAYLOAD> const &space);
+
+  /** Find the payload for an @a addr.
+   *
+   * @param addr Address to find.
+   * @return An iterator for the range containing @a addr, or the @c end iterator if not found.
+   */
+  const_iterator find(IPAddr const &addr) const;
+
+  /// @overload
+  const_iterator find(IP4Addr const &addr) const;
+
+  /// @overload
+  const_iterator find(IP6Addr const &addr) const;
+
+  /// @return The number of distinct ranges.
+  size_t count() const;
+
+  /// @return @c true if there are no ranges in the space, @c false otherwise.
+  bool empty() const;
+
+  /// @return Iterator for the first range.
+  const_iterator begin() const;
+
+  /// @return Iterator past the last range.
+  const_iterator end() const;
+
+  /// @return The embedded flattened space.
+  flat_type const &flat() const;
+
+protected:
+  static constexpr unsigned STRIDE = 8;   ///< Bits consumed per trie level.
+  static constexpr unsigned FAN    = 256; ///< Slots per node.
+
+  /// A trie node - bitmaps over the slots with popcount indexing in to shared arrays.
+  struct Node {
+    uint64_t _child_bits[4] = {0, 0, 0, 0}; ///< Slots with a child node.
+    uint64_t _leaf_bits[4]  = {0, 0, 0, 0}; ///< Slots with a terminal payload.
+    uint32_t _child_base    = 0;            ///< Index of the first child in the node array.
+    uint32_t _leaf_base     = 0;            ///< Index of the first leaf in the leaf array.
+  };
+
+  /// @return Whether bit @a i is set in @a bits.
+  static bool
+  bit(uint64_t const (&bits)[4], unsigned i) {
+    return 1 & (bits[i >> 6] >> (i & 63));
+  }
+
+  /// @return The number of set bits in @a bits before bit @a i.
+  static unsigned
+  rank(uint64_t const (&bits)[4], unsigned i) {
+    unsigned w    = i >> 6;
+    unsigned zret = __builtin_popcountll(bits[w] & ((uint64_t{1} << (i & 63)) - 1));
+    for (unsigned k = 0; k < w; ++k) {
+      zret += __builtin_popcountll(bits[k]);
+    }
+    return zret;
+  }
+
+  /** Search a per-family trie.
+   *
+   * @param nodes Node array - empty if the family has no ranges.
+   * @param leaves Leaf array - indices in to the flattened space.
+   * @param bytes Address bytes, most significant first.
+   * @param n_bytes Number of address bytes.
+   * @return The flattened space index for the containing range, or negative if not found.
+   */
+  static int32_t search(std::vector<Node> const &nodes, std::vector<uint32_t> const &leaves, uint8_t const *bytes, unsigned n_bytes);
+
+  /// Build helper - a sparse node with direct slot values.
+  struct TempNode {
+    static constexpr int32_t EMPTY = -1;         ///< No entry for the slot.
+    static constexpr int32_t LEAF  = 0x40000000; ///< Flag for a leaf value.
+    std::array<int32_t, FAN> _slot;              ///< Child temp index, or @c LEAF | flat index.
+    TempNode() { _slot.fill(EMPTY); }
+  };
+
+  /** Insert a prefix in to a temporary trie.
+   *
+   * @param temp Temporary trie.
+   * @param bytes Prefix address bytes, most significant first.
+   * @param width Prefix width in bits.
+   * @param flat_idx Flattened space index for the prefix payload.
+   *
+   * A width that is not a multiple of the stride is expanded over the covered slots. The source
+   * ranges are disjoint so an expanded slot can never also need a subtree.
+   */
+  static void insert(std::vector<TempNode> &temp, uint8_t const *bytes, unsigned width, uint32_t flat_idx);
+
+  /** Compact a temporary trie to the bitmap form.
+   *
+   * @param temp Temporary trie.
+   * @param nodes Node array output.
+   * @param leaves Leaf array output.
+   *
+   * Nodes are laid out in breadth first order so the children of a node are contiguous and a
+   * single base index locates them.
+   */
+  static void compact(std::vector<TempNode> const &temp, std::vector<Node> &nodes, std::vector<uint32_t> &leaves);
+
+  flat_type _flat;                ///< Ranges and payloads in address order.
+  std::vector<Node> _nodes4;      ///< IPv4 trie nodes.
+  std::vector<Node> _nodes6;      ///< IPv6 trie nodes.
+  std::vector<uint32_t> _leaves4; ///< IPv4 leaf values.
+  std::vector<uint32_t> _leaves6; ///< IPv6 leaf values.
+};
+
+// --- Implementation
+
+template <typename PAYLOAD> TrieIPSpace<PAYLOAD>::TrieIPSpace(IPSpace<PAYLOAD> const &space) : _flat(space) {
+  std::vector<TempNode> temp4{1};
+  std::vector<TempNode> temp6{1};
+
+  uint32_t flat_idx = 0;
+  for (auto spot = _flat.begin(), limit = _flat.end(); spot != limit; ++spot, ++flat_idx) {
+    auto rv = spot->range_view();
+    if (rv.is_ip4()) {
+      for (auto const &net : rv.ip4().networks()) {
+        auto v          = net.min().host_order();
+        uint8_t bytes[] = {uint8_t(v >> 24), uint8_t(v >> 16), uint8_t(v >> 8), uint8_t(v)};
+        self_type::insert(temp4, bytes, net.mask().width(), flat_idx);
+      }
+    } else {
+      for (auto const &net : rv.ip6().networks()) {
+        in6_addr raw;
+        net.min().network_order(raw);
+        self_type::insert(temp6, raw.s6_addr, net.mask().width(), flat_idx);
+      }
+    }
+  }
+
+  if (_flat.count_ip4() > 0) {
+    self_type::compact(temp4, _nodes4, _leaves4);
+  }
+  if (_flat.count_ip6() > 0) {
+    self_type::compact(temp6, _nodes6, _leaves6);
+  }
+}
+
+template <typename PAYLOAD>
+void
+TrieIPSpace<PAYLOAD>::insert(std::vector<TempNode> &temp, uint8_t const *bytes, unsigned width, uint32_t flat_idx) {
+  uint32_t cur      = 0;
+  unsigned consumed = 0;
+  while (width - consumed > STRIDE) {
+    uint8_t b = bytes[consumed / STRIDE];
+    auto &s   = temp[cur]._slot[b];
+    if (TempNode::EMPTY == s) {
+      s = int32_t(temp.size());
+      temp.emplace_back(); // invalidates @a s - reload below.
+    }
+    cur = temp[cur]._slot[b];
+    consumed += STRIDE;
+  }
+  // Expand the remaining bits (possibly none) over the covered slots.
+  unsigned residue = width - consumed;
+  unsigned base    = residue ? bytes[consumed / STRIDE] & ~((1u << (STRIDE - residue)) - 1) : 0;
+  for (unsigned s = base, limit = base + (1u << (STRIDE - residue)); s < limit; ++s) {
+    temp[cur]._slot[s] = TempNode::LEAF | int32_t(flat_idx);
+  }
+}
+
+template <typename PAYLOAD>
+void
+TrieIPSpace<PAYLOAD>::compact(std::vector<TempNode> const &temp, std::vector<Node> &nodes, std::vector<uint32_t> &leaves) {
+  std::vector<uint32_t> order;
+  order.reserve(temp.size());
+  order.push_back(0);
+  nodes.reserve(temp.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    auto const &t = temp[order[i]];
+    Node n;
+    n._child_base = uint32_t(order.size());
+    n._leaf_base  = uint32_t(leaves.size());
+    for (unsigned b = 0; b < FAN; ++b) {
+      auto s = t._slot[b];
+      if (TempNode::EMPTY == s) {
+        continue;
+      }
+      if (s & TempNode::LEAF) {
+        n._leaf_bits[b >> 6] |= uint64_t{1} << (b & 63);
+        leaves.push_back(uint32_t(s & ~TempNode::LEAF));
+      } else {
+        n._child_bits[b >> 6] |= uint64_t{1} << (b & 63);
+        order.push_back(uint32_t(s)); // BFS order makes the children contiguous at @a _child_base.
+      }
+    }
+    nodes.push_back(n);
+  }
+}
+
+template <typename PAYLOAD>
+int32_t
+TrieIPSpace<PAYLOAD>::search(std::vector<Node> const &nodes, std::vector<uint32_t> const &leaves, uint8_t const *bytes,
+                             unsigned n_bytes) {
+  if (nodes.empty()) {
+    return -1;
+  }
+  uint32_t idx = 0;
+  for (unsigned i = 0; i < n_bytes; ++i) {
+    Node const &n = nodes[idx];
+    uint8_t b     = bytes[i];
+    if (bit(n._leaf_bits, b)) {
+      return int32_t(leaves[n._leaf_base + rank(n._leaf_bits, b)]);
+    }
+    if (!bit(n._child_bits, b)) {
+      return -1;
+    }
+    idx = n._child_base + rank(n._child_bits, b);
+  }
+  return -1;
+}
+
+template <typename PAYLOAD>
+auto
+TrieIPSpace<PAYLOAD>::find(IP4Addr const &addr) const -> const_iterator {
+  auto v          = addr.host_order();
+  uint8_t bytes[] = {uint8_t(v >> 24), uint8_t(v >> 16), uint8_t(v >> 8), uint8_t(v)};
+  auto idx        = self_type::search(_nodes4, _leaves4, bytes, sizeof(bytes));
+  return idx < 0 ? _flat.end() : const_iterator{&_flat, size_t(idx)};
+}
+
+template <typename PAYLOAD>
+auto
+TrieIPSpace<PAYLOAD>::find(IP6Addr const &addr) const -> const_iterator {
+  in6_addr raw;
+  addr.network_order(raw);
+  auto idx = self_type::search(_nodes6, _leaves6, raw.s6_addr, sizeof(raw.s6_addr));
+  return idx < 0 ? _flat.end() : const_iterator{&_flat, size_t(idx)};
+}
+
+template <typename PAYLOAD>
+auto
+TrieIPSpace<PAYLOAD>::find(IPAddr const &addr) const -> const_iterator {
+  if (addr.is_ip4()) {
+    return this->find(addr.ip4());
+  } else if (addr.is_ip6()) {
+    return this->find(addr.ip6());
+  }
+  return _flat.end();
+}
+
+template <typename PAYLOAD>
+size_t
+TrieIPSpace<PAYLOAD>::count() const {
+  return _flat.count();
+}
+
+template <typename PAYLOAD>
+bool
+TrieIPSpace<PAYLOAD>::empty() const {
+  return _flat.empty();
+}
+
+template <typename PAYLOAD>
+auto
+TrieIPSpace<PAYLOAD>::begin() const -> const_iterator {
+  return _flat.begin();
+}
+
+template <typename PAYLOAD>
+auto
+TrieIPSpace<PAYLOAD>::end() const -> const_iterator {
+  return _flat.end();
+}
+
+template <typename PAYLOAD>
+auto
+TrieIPSpace<PAYLOAD>::flat() const -> flat_type const & {
+  return _flat;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
@@ -13,12 +13,17 @@
 #include <variant>
 #include <new>
 #include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
 
 #include <swoc/MemSpan.h>
 #include <swoc/swoc_meta.h>
 
 namespace swoc { inline namespace SWOC_VERSION_NS {
 
+class MemArena; // Used only via the allocator - see @c ArenaAllocator in "swoc/MemArena.h".
+
 /** Vectray provides a combination of static and dynamic storage modeled as an array.
  *
  * @tparam T Type of elements in the array.
@@ -32,11 +37,20 @@ namespace swoc { inline namespace SWOC_VERSION_NS {
  * value case.
  *
  * The interface is designed to mimic that of @c std::vector.
+ *
+ * The overflow storage is controlled by the allocator @a A. In particular @c ArenaAllocator
+ * (see "swoc/MemArena.h") makes the overflow draw from a @c MemArena so even the exceptional
+ * case avoids a trip to the heap - construct with the arena, e.g.
+ * @code
+ *   swoc::Vectray<Thing, 1, swoc::ArenaAllocator<Thing>> va{arena};
+ * @endcode
  */
 template <typename T, size_t N, class A = std::allocator<T>> class Vectray {
   using self_type   = Vectray;           ///< Self reference type.
   using vector_type = std::vector<T, A>; ///< Internal dynamic storage type.
 
+  template <typename U, size_t M, class B> friend class Vectray; // cross size move construction.
+
 public:                                                              // STL compliance types.
   using value_type      = T;                                         ///< Element type for container.
   using reference       = std::remove_reference<T> &;                ///< Reference to element.
@@ -69,6 +83,9 @@ public:                                                              // STL comp
     /// @return A span containing the valid elements.
     MemSpan<T> span();
 
+    /// @return A span containing the valid elements.
+    MemSpan<T const> span() const;
+
     /// @return A pointer to the data.
     T *data();
 
@@ -93,6 +110,16 @@ public:
   /// Construct empty instance with allocator.
   constexpr explicit Vectray(allocator_type const &a) : _store(std::in_place_type_t<FixedStore>{}, a) {}
 
+  /** Construct empty instance with overflow storage drawn from @a arena.
+   *
+   * @param arena Arena for overflow storage.
+   *
+   * Available only if the allocator is constructible from an arena, e.g. @c ArenaAllocator.
+   * The arena must outlive this instance.
+   */
+  template <typename U = A, typename = std::enable_if_t<std::is_constructible_v<U, MemArena &>>>
+  explicit Vectray(MemArena &arena) : Vectray(allocator_type{arena}) {}
+
   /** Construct with @a n default constructed elements.
    *
    * @param n Number of elements.
@@ -203,6 +230,12 @@ public:
   /// Force at internal storage to hold at least @a n items.
   void reserve(size_type n);
 
+  /// @return The number of elements that can be held without further allocation.
+  size_type capacity() const;
+
+  /// @return A copy of the allocator.
+  allocator_type get_allocator() const;
+
 protected:
   /// Content storage.
   /// @note This is constructed as fixed but can change to dynamic. It can never change back.
@@ -232,24 +265,38 @@ protected:
 
 template <typename T, size_t N, typename A> Vectray<T, N, A>::Vectray() {}
 
-template <typename T, size_t N, class A> Vectray<T, N, A>::Vectray(Vectray::size_type n, allocator_type const &alloc) : Vectray() {
+template <typename T, size_t N, class A>
+Vectray<T, N, A>::Vectray(Vectray::size_type n, allocator_type const &alloc) : Vectray(alloc) {
   this->reserve(n);
   while (n-- > 0) {
     this->emplace_back();
   }
 }
 
-template <typename T, size_t N, class A> template <size_t M> Vectray<T, N, A>::Vectray(Vectray<T, M, A> &&that) {
+template <typename T, size_t N, class A>
+template <size_t M>
+Vectray<T, N, A>::Vectray(Vectray<T, M, A> &&that) : Vectray(that.get_allocator()) {
   // If @a that is already a vector, always move that here.
   if (DYNAMIC == that._store.index()) {
     _store = std::move(std::get<DYNAMIC>(that._store));
   } else {
     auto span = std::get<FIXED>(that._store).span();
     if (span.size() > N) {
-    } else {
-      for (auto &&item : span) {
-        this->template emplace_back(std::move(item));
-      }
+      this->transfer(span.size()); // won't fit in fixed storage - go dynamic up front.
+    }
+    for (auto &&item : span) {
+      this->emplace_back(std::move(item));
+    }
+  }
+}
+
+template <typename T, size_t N, class A> Vectray<T, N, A>::Vectray(self_type &&that, allocator_type const &a) : Vectray(a) {
+  if (DYNAMIC == that._store.index() && a == that.get_allocator()) {
+    _store = std::move(std::get<DYNAMIC>(that._store));
+  } else {
+    this->reserve(that.size());
+    for (auto &&item : that.items()) {
+      this->emplace_back(std::move(item));
     }
   }
 }
@@ -263,7 +310,13 @@ template <typename T, size_t N, class A> Vectray<T, N, A>::FixedStore::~FixedSto
 template <typename T, size_t N, class A>
 MemSpan<T>
 Vectray<T, N, A>::FixedStore::span() {
-  return MemSpan<std::byte>(_raw).template rebind<T>();
+  return {this->data(), _count};
+}
+
+template <typename T, size_t N, class A>
+MemSpan<T const>
+Vectray<T, N, A>::FixedStore::span() const {
+  return {this->data(), _count};
 }
 
 template <typename T, size_t N, class A>
@@ -275,7 +328,7 @@ Vectray<T, N, A>::FixedStore::data() {
 template <typename T, size_t N, class A>
 T const *
 Vectray<T, N, A>::FixedStore::data() const {
-  return reinterpret_cast<T *>(_raw.data());
+  return reinterpret_cast<T const *>(_raw.data());
 }
 
 template <typename T, size_t N, typename A>
@@ -287,7 +340,7 @@ Vectray<T, N, A>::operator[](size_type idx) {
 template <typename T, size_t N, typename A>
 T const &
 Vectray<T, N, A>::operator[](size_type idx) const {
-  return this->items[idx];
+  return this->items()[idx];
 }
 
 template <typename T, size_t N, typename A>
@@ -341,7 +394,7 @@ Vectray<T, N, A>::emplace_back(Args &&...args) {
 template <typename T, size_t N, class A>
 auto
 Vectray<T, N, A>::pop_back() -> self_type & {
-  std::visit(swoc::meta::vary{[&](FixedStore &fs) -> void { std::destroy_at(fs.span()[--fs._count]); },
+  std::visit(swoc::meta::vary{[&](FixedStore &fs) -> void { std::destroy_at(fs.data() + --fs._count); },
                               [&](DynamicStore &ds) -> void { ds.pop_back(); }},
              _store);
   return *this;
@@ -391,11 +444,21 @@ Vectray<T, N, A>::end() -> iterator {
 template <typename T, size_t N, class A>
 void
 Vectray<T, N, A>::transfer(size_type rN) {
-  DynamicStore tmp{std::get<FIXED>(_store)._a};
-  tmp.reserve(rN);
-
-  for (auto &&item : this->items()) {
-    tmp.emplace_back(std::move(item)); // move if supported, copy if not.
+  auto &fs{std::get<FIXED>(_store)};
+  DynamicStore tmp{fs._a};
+  tmp.reserve(std::max<size_type>(rN, fs._count));
+
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    // Trivially relocatable - blit the elements instead of moving one at a time. No cleanup
+    // needed in the fixed storage, such types have trivial destructors.
+    tmp.resize(fs._count);
+    if (fs._count > 0) {
+      std::memcpy(static_cast<void *>(tmp.data()), fs.data(), sizeof(T) * fs._count);
+    }
+  } else {
+    for (auto &&item : fs.span()) {
+      tmp.emplace_back(std::move(item)); // move if supported, copy if not.
+    }
   }
   // Fixed elements destroyed here, by variant.
   _store = std::move(tmp);
@@ -404,7 +467,7 @@ Vectray<T, N, A>::transfer(size_type rN) {
 template <typename T, size_t N, class A>
 auto
 Vectray<T, N, A>::items() const -> const_span {
-  return std::visit(swoc::meta::vary{[](FixedStore const &fs) { fs.span(); },
+  return std::visit(swoc::meta::vary{[](FixedStore const &fs) { return fs.span(); },
                                      [](DynamicStore const &ds) { return const_span(ds.data(), ds.size()); }},
                     _store);
 }
@@ -412,14 +475,13 @@ Vectray<T, N, A>::items() const -> const_span {
 template <typename T, size_t N, class A>
 T *
 Vectray<T, N, A>::data() {
-  return std::visit(swoc::meta::vary{[](FixedStore const &fs) { fs.data(); }, [](DynamicStore const &ds) { return ds.data(); }},
-                    _store);
+  return std::visit(swoc::meta::vary{[](FixedStore &fs) { return fs.data(); }, [](DynamicStore &ds) { return ds.data(); }}, _store);
 }
 
 template <typename T, size_t N, class A>
 T const *
 Vectray<T, N, A>::data() const {
-  return std::visit(swoc::meta::vary{[](FixedStore const &fs) { fs.data(); }, [](DynamicStore const &ds) { return ds.data(); }},
+  return std::visit(swoc::meta::vary{[](FixedStore const &fs) { return fs.data(); }, [](DynamicStore const &ds) { return ds.data(); }},
                     _store);
 }
 
@@ -441,4 +503,19 @@ Vectray<T, N, A>::reserve(Vectray::size_type n) {
   }
 }
 
+template <typename T, size_t N, class A>
+auto
+Vectray<T, N, A>::capacity() const -> size_type {
+  return std::visit(
+    swoc::meta::vary{[](FixedStore const &) -> size_type { return N; }, [](DynamicStore const &ds) -> size_type { return ds.capacity(); }},
+    _store);
+}
+
+template <typename T, size_t N, class A>
+auto
+Vectray<T, N, A>::get_allocator() const -> allocator_type {
+  return std::visit(
+    swoc::meta::vary{[](FixedStore const &fs) { return fs._a; }, [](DynamicStore const &ds) { return ds.get_allocator(); }}, _store);
+}
+
 }} // namespace swoc::SWOC_VERSION_NS
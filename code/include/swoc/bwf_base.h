@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdlib>
 #include <utility>
 #include <cstring>
@@ -19,6 +20,7 @@
 #include <tuple>
 #include <any>
 #include <array>
+#include <stdexcept>
 
 #include "swoc/swoc_version.h"
 #include "swoc/TextView.h"
@@ -29,6 +31,58 @@
 
 namespace swoc { inline namespace SWOC_VERSION_NS {
 namespace bwf {
+
+/// Flag for how to align the output inside a limited width field.
+/// @internal At namespace scope so @c SpecProperty can be fully defined before @c Spec.
+enum class Align : char {
+  NONE,  ///< No alignment.
+  LEFT,  ///< Left alignment '<'.
+  RIGHT, ///< Right alignment '>'.
+  CENTER, ///< Center alignment '^'.
+  SIGN    ///< Align plus/minus sign before numeric fill. '='
+};
+
+/** Character syntactic property data for format specifier parsing.
+ *
+ * @internal This is at namespace scope, not nested in @c Spec, so the constexpr constructor is
+ * fully defined before @c Spec builds its property table - required for compile time parsing.
+ */
+struct SpecProperty {
+  /// Flag mask values.
+  static constexpr uint8_t ALIGN_MASK        = 0x0F; ///< Alignment type.
+  static constexpr uint8_t TYPE_CHAR         = 0x10; ///< A valid type character.
+  static constexpr uint8_t UPPER_TYPE_CHAR   = 0x20; ///< Upper case flag.
+  static constexpr uint8_t NUMERIC_TYPE_CHAR = 0x40; ///< Numeric output.
+  static constexpr uint8_t SIGN_CHAR         = 0x80; ///< Is sign character.
+
+  /// Handrolled initialization of the character syntactic property data.
+  constexpr SpecProperty() {
+    _data[unsigned('b')] = TYPE_CHAR | NUMERIC_TYPE_CHAR;
+    _data[unsigned('B')] = TYPE_CHAR | NUMERIC_TYPE_CHAR | UPPER_TYPE_CHAR;
+    _data[unsigned('d')] = TYPE_CHAR | NUMERIC_TYPE_CHAR;
+    _data[unsigned('g')] = TYPE_CHAR;
+    _data[unsigned('o')] = TYPE_CHAR | NUMERIC_TYPE_CHAR;
+    _data[unsigned('p')] = TYPE_CHAR;
+    _data[unsigned('P')] = TYPE_CHAR | UPPER_TYPE_CHAR;
+    _data[unsigned('s')] = TYPE_CHAR;
+    _data[unsigned('S')] = TYPE_CHAR | UPPER_TYPE_CHAR;
+    _data[unsigned('x')] = TYPE_CHAR | NUMERIC_TYPE_CHAR;
+    _data[unsigned('X')] = TYPE_CHAR | NUMERIC_TYPE_CHAR | UPPER_TYPE_CHAR;
+
+    _data[unsigned(' ')] = SIGN_CHAR; // SIGN_NEVER
+    _data[unsigned('-')] = SIGN_CHAR; // SIGN_NEG
+    _data[unsigned('+')] = SIGN_CHAR; // SIGN_ALWAYS
+
+    _data[unsigned('<')] = static_cast<uint8_t>(Align::LEFT);
+    _data[unsigned('>')] = static_cast<uint8_t>(Align::RIGHT);
+    _data[unsigned('^')] = static_cast<uint8_t>(Align::CENTER);
+    _data[unsigned('=')] = static_cast<uint8_t>(Align::SIGN);
+  }
+
+  /// Flag storage, indexed by character value.
+  uint8_t _data[0x100]{};
+};
+
 /** Parsed version of a format specifier.
  *
  * Literals are represented as an instance of this class, with the type set to
@@ -56,16 +110,12 @@ struct Spec {
   /// State is not reset, @a this should be default constructed before calling.
   bool parse(TextView fmt);
 
-  char _fill = ' ';      ///< Fill character.
-  char _sign = SIGN_NEG; ///< Numeric sign style.
   /// Flag for how to align the output inside a limited width field.
-  enum class Align : char {
-    NONE,                            ///< No alignment.
-    LEFT,                            ///< Left alignment '<'.
-    RIGHT,                           ///< Right alignment '>'.
-    CENTER,                          ///< Center alignment '^'.
-    SIGN                             ///< Align plus/minus sign before numeric fill. '='
-  } _align           = Align::NONE;  ///< Output field alignment.
+  using Align = bwf::Align;
+
+  char _fill         = ' ';          ///< Fill character.
+  char _sign         = SIGN_NEG;     ///< Numeric sign style.
+  Align _align       = Align::NONE;  ///< Output field alignment.
   char _type         = DEFAULT_TYPE; ///< Type / radix indicator.
   bool _radix_lead_p = false;        ///< Print leading radix indication.
   // @a _min is unsigned because there's no point in an invalid default, 0 works fine.
@@ -80,45 +130,40 @@ struct Spec {
   static const self_type DEFAULT;
 
   /// Validate @a c is a specifier type indicator.
-  static bool is_type(char c);
+  static constexpr bool is_type(char c);
 
   /// Check if the type flag is numeric.
-  static bool is_numeric_type(char c);
+  static constexpr bool is_numeric_type(char c);
 
   /// Check if the type is an upper case variant.
-  static bool is_upper_case_type(char c);
+  static constexpr bool is_upper_case_type(char c);
 
   /// Check if the type @a in @a this is numeric.
-  bool has_numeric_type() const;
+  constexpr bool has_numeric_type() const;
 
   /// Check if the type in @a this is an upper case variant.
-  bool has_upper_case_type() const;
+  constexpr bool has_upper_case_type() const;
 
   /// Check if the type is a raw pointer.
-  bool has_pointer_type() const;
+  constexpr bool has_pointer_type() const;
 
   /// Check if the type is valid.
-  bool has_valid_type() const;
+  constexpr bool has_valid_type() const;
 
 protected:
   /// Validate character is alignment character and return the appropriate enum value.
-  Align align_of(char c);
+  static constexpr Align align_of(char c);
 
   /// Validate is sign indicator.
-  bool is_sign(char c);
-
-  /// Handrolled initialization the character syntactic property data.
-  static const struct Property {
-    Property(); ///< Default constructor, creates initialized flag set.
-    /// Flag storage, indexed by character value.
-    uint8_t _data[0x100]{};
-    /// Flag mask values.
-    static constexpr uint8_t ALIGN_MASK        = 0x0F; ///< Alignment type.
-    static constexpr uint8_t TYPE_CHAR         = 0x10; ///< A valid type character.
-    static constexpr uint8_t UPPER_TYPE_CHAR   = 0x20; ///< Upper case flag.
-    static constexpr uint8_t NUMERIC_TYPE_CHAR = 0x40; ///< Numeric output.
-    static constexpr uint8_t SIGN_CHAR         = 0x80; ///< Is sign character.
-  } _prop;                                             ///< Character property map.
+  static constexpr bool is_sign(char c);
+
+  /// Character syntactic property data.
+  using Property = SpecProperty;
+  /// Character property map, built at compile time.
+  static constexpr Property _prop{};
+
+  /// Compile time parsed formats need access to the parsing primitives.
+  template <size_t N> friend class FixedFormat;
 };
 
 /** Format string support.
@@ -177,10 +222,22 @@ struct Format {
   /// Wrap the format string in an extractor.
   static TextViewExtractor bind(TextView fmt);
 
+  /** Format specifier with provenance.
+   *
+   * The extractor for pre-parsed format strings passes this subclass of @c Spec to the name
+   * binding so that a binding which supports it can use the name resolution cache in the source
+   * format instance. Bindings that take a plain @c Spec are unaffected.
+   */
+  struct CacheSpec : public Spec {
+    Format const *_cache_format = nullptr; ///< Source format instance, if cacheable.
+    unsigned _cache_idx = 0;               ///< Index of this specifier among the format items.
+  };
+
   /// Extraction support for pre-parsed format strings.
   struct FormatExtractor {
-    MemSpan<Spec const> _fmt; ///< Parsed format string.
-    int _idx = 0;             ///< Element index.
+    MemSpan<Spec const> _fmt;           ///< Parsed format string.
+    int _idx = 0;                       ///< Element index.
+    Format const *_format = nullptr;    ///< Source format instance, if any, for name caching.
     /// @return @c true if more format string, @c false if none.
     explicit operator bool() const;
 
@@ -190,7 +247,7 @@ struct Format {
      * @param spec [out] The next format specifier.
      * @return @c true if @a spec was filled out, @c false if no specifier was found.
      */
-    bool operator()(std::string_view &literal_v, Spec &spec);
+    bool operator()(std::string_view &literal_v, CacheSpec &spec);
   };
 
   /// Wrap the format instance in an extractor.
@@ -221,6 +278,94 @@ struct Format {
   end() const {
     return _items.end();
   }
+
+  /** Cache of resolved name generators.
+   *
+   * The cache is claimed by the first name set the format is used against and is inert for any
+   * other. Each slot holds the type erased generator resolved for the corresponding format item.
+   * The generation of the name set is recorded so the resolutions are dropped if the name set is
+   * updated after they were cached.
+   *
+   * @internal Generators are never removed from a name set, therefore a resolved generator
+   * pointer remains valid for the life of the name set. The atomics make concurrent use of a
+   * shared format safe - at worst a resolution is recomputed.
+   */
+  class NameCache {
+    using self_type = NameCache; ///< Self reference type.
+
+  public:
+    NameCache() = default;                  ///< Default constructor.
+    NameCache(self_type &&that);            ///< Move constructor.
+    self_type &operator=(self_type &&that); ///< Move assignment.
+
+    /** Find the cached generator for the item at @a idx.
+     *
+     * @param names Identity of the name set being used.
+     * @param generation Current generation of the name set.
+     * @param idx Format item index.
+     * @return The cached generator, or @c nullptr if not cached.
+     */
+    void const *find(void const *names, size_t generation, unsigned idx);
+
+    /// Cache @a g as the generator for the item at @a idx as resolved in @a names.
+    void store(void const *names, size_t generation, unsigned idx, void const *g);
+
+  protected:
+    std::atomic<void const *> _owner{nullptr};     ///< Name set for the cached resolutions.
+    std::atomic<size_t> _generation{0};            ///< Generation of the name set when resolved.
+    std::vector<std::atomic<void const *>> _slots; ///< Resolved generators, indexed by item.
+
+    friend struct Format;
+  };
+
+  /// Name resolution cache, populated by use against a name set. @see NameCache
+  mutable NameCache _cache;
+};
+
+/** A format string parsed at compile time.
+ *
+ * @tparam N Item capacity, deduced from the format string literal.
+ *
+ * This is the compile time counterpart of @c Format. When constructed from a string literal in a
+ * constant expression the parse is done entirely at compile time, so a malformed format string
+ * fails to compile. Printing is then a straight walk of the pre-parsed items - no parsing or
+ * specifier validation is done per call.
+ *
+ * @code
+ * static constexpr bwf::FixedFormat fmt{"{} bytes in {} chunks"};
+ * w.print(fmt, n_bytes, n_chunks);
+ * @endcode
+ *
+ * @note As with @c Format, the items hold views in to the format string, which must therefore
+ * outlive the instance. A string literal, as in the example, is always safe.
+ */
+template <size_t N> class FixedFormat {
+  using self_type = FixedFormat; ///< Self reference type.
+
+public:
+  /// Construct from the format string @a fmt, parsing it in the process.
+  constexpr FixedFormat(char const (&fmt)[N]);
+
+  /// @return The number of parsed items (literals and specifiers).
+  constexpr size_t count() const;
+
+  /// Wrap the parsed items in an extractor for printing.
+  Format::FormatExtractor bind() const;
+
+protected:
+  /// Parse decimal digits from the front of @a src, which is updated in place.
+  static constexpr uintmax_t parse_number(std::string_view &src);
+
+  /// Parse the specifier text @a fmt (less enclosing braces) in to @a spec.
+  /// @internal This mirrors @c Spec::parse, which cannot itself be @c constexpr because its
+  /// parsing primitives are tuned for run time performance.
+  static constexpr void parse_spec(std::string_view fmt, Spec &spec);
+
+  /// Append a literal item for @a lit.
+  constexpr void push_literal(std::string_view lit);
+
+  std::array<Spec, N> _items{}; ///< Parsed items.
+  size_t _count = 0;            ///< Number of valid items.
 };
 
 // Name binding - support for having format specifier names.
@@ -321,6 +466,19 @@ public:
    */
   bool contains(std::string_view name);
 
+  /** Find the generator for @a name.
+   *
+   * @param name Name to resolve.
+   * @return A pointer to the generator, or @c nullptr if @a name has no generator.
+   *
+   * Names are never removed, therefore the returned pointer is stable for the life of this
+   * instance, even if the generator for @a name is re-assigned.
+   */
+  Generator const *resolve(std::string_view name) const;
+
+  /// @return The generation of the name set, which is advanced by each assignment.
+  size_t generation() const;
+
 protected:
   /// Copy @a name in to local storage and return a view of it.
   std::string_view localize(std::string_view const &name);
@@ -328,6 +486,7 @@ protected:
   /// Name to name generator.
   Map _map;              ///< Defined generators.
   MemArena _arena{1024}; ///< Local name storage.
+  size_t _generation = 0; ///< Update count, to invalidate cached resolutions.
 };
 
 /** A class to hold external / context-free name bindings.
@@ -345,11 +504,23 @@ public:
   using super_type::super_type; // import constructors.
 
   /// The bound accessor is this class.
-  NameBinding const &bind() const;
+  self_type const &bind() const;
 
   /// Bound name access.
   BufferWriter &operator()(BufferWriter &w, const Spec &spec) const override;
 
+  /** Bound name access for pre-parsed formats.
+   *
+   * @param w Output.
+   * @param spec Format specifier with provenance.
+   * @return @a w
+   *
+   * This resolves @a spec through the name cache in the source format when possible, so that
+   * repeated use of the format against this name set does no name lookups. Unresolved names fall
+   * back to generic dispatch.
+   */
+  BufferWriter &operator()(BufferWriter &w, Format::CacheSpec const &spec) const;
+
   /// @copydoc NameMap::assign(std::string_view const &name, Generator const &generator)
 };
 
@@ -405,6 +576,32 @@ public:
       return _names(w, spec, _ctx);
     }
 
+    /** Bound name access for pre-parsed formats.
+     *
+     * @param w Output.
+     * @param spec Format specifier with provenance.
+     * @return @a w
+     *
+     * This resolves @a spec through the name cache in the source format when possible. Names not
+     * in the map fall back to the dispatch method, preserving subclass handling of structured or
+     * computed names.
+     */
+    BufferWriter &
+    operator()(BufferWriter &w, Format::CacheSpec const &spec) const {
+      if (spec._cache_format && !spec._name.empty()) {
+        auto &cache         = spec._cache_format->_cache;
+        auto map_generation = _names.generation();
+        auto g              = static_cast<Generator const *>(cache.find(&_names, map_generation, spec._cache_idx));
+        if (nullptr == g && nullptr != (g = _names.resolve(spec._name))) {
+          cache.store(&_names, map_generation, spec._cache_idx, g);
+        }
+        if (g) {
+          return (*g)(w, spec, _ctx);
+        }
+      }
+      return _names(w, spec, _ctx);
+    }
+
   protected:
     /** Constructor.
      *
@@ -472,47 +669,47 @@ extern ExternalNames Global_Names;
 // --------------- Implementation --------------------
 /// --- Spec ---
 
-inline Spec::Align
+inline constexpr Spec::Align
 Spec::align_of(char c) {
   return static_cast<Align>(_prop._data[static_cast<unsigned>(c)] & Property::ALIGN_MASK);
 }
 
-inline bool
+inline constexpr bool
 Spec::is_sign(char c) {
   return _prop._data[static_cast<unsigned>(c)] & Property::SIGN_CHAR;
 }
 
-inline bool
+inline constexpr bool
 Spec::is_type(char c) {
   return _prop._data[static_cast<unsigned>(c)] & Property::TYPE_CHAR;
 }
 
-inline bool
+inline constexpr bool
 Spec::is_upper_case_type(char c) {
   return _prop._data[static_cast<unsigned>(c)] & Property::UPPER_TYPE_CHAR;
 }
 
-inline bool
+inline constexpr bool
 Spec::is_numeric_type(char c) {
   return _prop._data[static_cast<unsigned>(c)] & Property::NUMERIC_TYPE_CHAR;
 }
 
-inline bool
+inline constexpr bool
 Spec::has_numeric_type() const {
   return _prop._data[static_cast<unsigned>(_type)] & Property::NUMERIC_TYPE_CHAR;
 }
 
-inline bool
+inline constexpr bool
 Spec::has_upper_case_type() const {
   return _prop._data[static_cast<unsigned>(_type)] & Property::UPPER_TYPE_CHAR;
 }
 
-inline bool
+inline constexpr bool
 Spec::has_pointer_type() const {
   return _type == 'p' || _type == 'P';
 }
 
-inline bool
+inline constexpr bool
 Spec::has_valid_type() const {
   return _type != INVALID_TYPE;
 }
@@ -522,9 +719,222 @@ Format::bind(swoc::TextView fmt) -> TextViewExtractor {
   return {fmt};
 }
 
+/// --- FixedFormat ---
+
+template <size_t N>
+constexpr uintmax_t
+FixedFormat<N>::parse_number(std::string_view &src) {
+  uintmax_t zret = 0;
+  while (!src.empty() && '0' <= src.front() && src.front() <= '9') {
+    zret = zret * 10 + uintmax_t(src.front() - '0');
+    src.remove_prefix(1);
+  }
+  return zret;
+}
+
+template <size_t N>
+constexpr void
+FixedFormat<N>::parse_spec(std::string_view fmt, Spec &spec) {
+  constexpr auto npos = std::string_view::npos;
+  // Decode a hex digit, or -1 if @a c is not one.
+  constexpr auto hex_value = [](char c) -> int {
+    return ('0' <= c && c <= '9') ? c - '0' :
+           ('a' <= c && c <= 'f') ? c - 'a' + 10 :
+           ('A' <= c && c <= 'F') ? c - 'A' + 10 :
+                                    -1;
+  };
+
+  auto idx   = fmt.find(':');
+  spec._name = fmt.substr(0, idx);
+  fmt        = (npos == idx) ? std::string_view{} : fmt.substr(idx + 1);
+  // if it's parsable as a number, treat it as an index.
+  {
+    auto num = spec._name;
+    auto n   = parse_number(num);
+    if (num.empty()) {
+      spec._idx = static_cast<int>(n);
+    }
+  }
+
+  if (!fmt.empty()) {
+    idx       = fmt.find(':');
+    auto sz   = fmt.substr(0, idx); // the format specifier.
+    spec._ext = (npos == idx) ? std::string_view{} : fmt.substr(idx + 1);
+    if (!sz.empty()) {
+      // fill and alignment
+      if ('%' == sz.front()) { // URI encoded fill character.
+        if (sz.size() < 4) {
+          throw std::invalid_argument("Fill URI encoding without 2 hex characters and align mark");
+        }
+        if (Spec::Align::NONE == (spec._align = Spec::align_of(sz[3]))) {
+          throw std::invalid_argument("Fill URI without alignment mark");
+        }
+        int d1 = hex_value(sz[1]), d0 = hex_value(sz[2]);
+        if (d0 < 0 || d1 < 0) {
+          throw std::invalid_argument("URI encoding with non-hex characters");
+        }
+        spec._fill = static_cast<char>(d0 + (d1 << 4));
+        sz.remove_prefix(4);
+      } else if (sz.size() > 1 && Spec::Align::NONE != (spec._align = Spec::align_of(sz[1]))) {
+        spec._fill = sz.front();
+        sz.remove_prefix(2);
+      } else if (Spec::Align::NONE != (spec._align = Spec::align_of(sz.front()))) {
+        sz.remove_prefix(1);
+      }
+      if (sz.empty()) {
+        return;
+      }
+      // sign
+      if (Spec::is_sign(sz.front())) {
+        spec._sign = sz.front();
+        sz.remove_prefix(1);
+        if (sz.empty()) {
+          return;
+        }
+      }
+      // radix prefix
+      if ('#' == sz.front()) {
+        spec._radix_lead_p = true;
+        sz.remove_prefix(1);
+        if (sz.empty()) {
+          return;
+        }
+      }
+      // 0 fill for integers
+      if ('0' == sz.front()) {
+        if (Spec::Align::NONE == spec._align) {
+          spec._align = Spec::Align::SIGN;
+        }
+        spec._fill = '0';
+        sz.remove_prefix(1);
+      }
+      auto num = sz;
+      auto n   = parse_number(num);
+      if (num.size() < sz.size()) {
+        spec._min = static_cast<unsigned int>(n);
+        sz        = num;
+        if (sz.empty()) {
+          return;
+        }
+      }
+      // precision
+      if ('.' == sz.front()) {
+        sz.remove_prefix(1);
+        num = sz;
+        n   = parse_number(num);
+        if (num.size() < sz.size()) {
+          spec._prec = static_cast<int>(n);
+          sz         = num;
+          if (sz.empty()) {
+            return;
+          }
+        } else {
+          throw std::invalid_argument("Precision mark without precision");
+        }
+      }
+      // style (type). Hex, octal, etc.
+      if (Spec::is_type(sz.front())) {
+        spec._type = sz.front();
+        sz.remove_prefix(1);
+        if (sz.empty()) {
+          return;
+        }
+      }
+      // maximum width
+      if (',' == sz.front()) {
+        sz.remove_prefix(1);
+        num = sz;
+        n   = parse_number(num);
+        if (num.size() < sz.size()) {
+          spec._max = static_cast<unsigned int>(n);
+          sz        = num;
+          if (sz.empty()) {
+            return;
+          }
+        } else {
+          throw std::invalid_argument("Maximum width mark without width");
+        }
+        // Can only have a type indicator here if there was a max width.
+        if (Spec::is_type(sz.front())) {
+          spec._type = sz.front();
+          sz.remove_prefix(1);
+        }
+      }
+    }
+  }
+}
+
+template <size_t N>
+constexpr void
+FixedFormat<N>::push_literal(std::string_view lit) {
+  Spec spec;
+  spec._type       = Spec::LITERAL_TYPE;
+  spec._ext        = lit;
+  _items[_count++] = spec;
+}
+
+template <size_t N> constexpr FixedFormat<N>::FixedFormat(char const (&fmt)[N]) {
+  constexpr auto npos = std::string_view::npos;
+  std::string_view src{fmt, fmt[N - 1] ? N : N - 1}; // drop a terminal nul, as for @c TextView.
+  int arg_idx = 0;
+
+  while (!src.empty()) {
+    // Check for brace delimiters.
+    size_t off = 0;
+    while (off < src.size() && '{' != src[off] && '}' != src[off]) {
+      ++off;
+    }
+    if (off == src.size()) { // not found, it's all literal.
+      this->push_literal(src);
+      break;
+    }
+    if (off + 1 >= src.size()) {
+      throw std::invalid_argument("Invalid trailing character in format string.");
+    }
+    if (src[off] == src[off + 1]) { // double braces count as literals, output only 1 brace.
+      this->push_literal(src.substr(0, off + 1));
+      src.remove_prefix(off + 2);
+      continue;
+    }
+    if ('}' == src[off]) {
+      throw std::invalid_argument("Unopened } in format string.");
+    }
+    if (off > 0) {
+      this->push_literal(src.substr(0, off));
+    }
+    src.remove_prefix(off + 1);
+    auto close = src.find('}');
+    if (npos == close) {
+      throw std::invalid_argument("BWFormat: Unclosed { in format string");
+    }
+    Spec spec;
+    parse_spec(src.substr(0, close), spec);
+    src.remove_prefix(close + 1);
+    if (spec._name.empty()) { // no name provided, use implicit index.
+      spec._idx = arg_idx++;
+    }
+    if (spec._idx >= 0) {
+      ++arg_idx;
+    }
+    _items[_count++] = spec;
+  }
+}
+
+template <size_t N>
+constexpr size_t
+FixedFormat<N>::count() const {
+  return _count;
+}
+
+template <size_t N>
+auto
+FixedFormat<N>::bind() const -> Format::FormatExtractor {
+  return {MemSpan<Spec const>{_items.data(), _count}, 0};
+}
+
 inline auto
 Format::bind() const -> FormatExtractor {
-  return {_items};
+  return {_items, 0, this};
 }
 
 inline Format::TextViewExtractor::operator bool() const {
@@ -535,6 +945,50 @@ inline Format::FormatExtractor::operator bool() const {
   return _idx < static_cast<int>(_fmt.size());
 }
 
+inline Format::NameCache::NameCache(self_type &&that)
+  : _owner(that._owner.load(std::memory_order_relaxed)),
+    _generation(that._generation.load(std::memory_order_relaxed)),
+    _slots(std::move(that._slots)) {}
+
+inline auto
+Format::NameCache::operator=(self_type &&that) -> self_type & {
+  _owner.store(that._owner.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  _generation.store(that._generation.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  _slots = std::move(that._slots);
+  return *this;
+}
+
+inline void const *
+Format::NameCache::find(void const *names, size_t generation, unsigned idx) {
+  auto owner = _owner.load(std::memory_order_acquire);
+  if (owner != names) {
+    // The first name set used claims the cache, any other name set bypasses it.
+    if (owner != nullptr || !_owner.compare_exchange_strong(owner, names, std::memory_order_acq_rel)) {
+      if (owner != names) {
+        return nullptr;
+      }
+    }
+    _generation.store(generation, std::memory_order_relaxed);
+  }
+  if (_generation.load(std::memory_order_relaxed) != generation) {
+    // The name set has been updated - drop the stale resolutions.
+    _generation.store(generation, std::memory_order_relaxed);
+    for (auto &slot : _slots) {
+      slot.store(nullptr, std::memory_order_relaxed);
+    }
+    return nullptr;
+  }
+  return idx < _slots.size() ? _slots[idx].load(std::memory_order_acquire) : nullptr;
+}
+
+inline void
+Format::NameCache::store(void const *names, size_t generation, unsigned idx, void const *g) {
+  if (idx < _slots.size() && names == _owner.load(std::memory_order_acquire) &&
+      generation == _generation.load(std::memory_order_relaxed)) {
+    _slots[idx].store(g, std::memory_order_release);
+  }
+}
+
 /// --- Names / Generators ---
 
 inline BufferWriter &
@@ -580,6 +1034,19 @@ NameMap<F>::contains(std::string_view name) {
   return _map.end() != _map.find(name);
 }
 
+template <typename F>
+auto
+NameMap<F>::resolve(std::string_view name) const -> Generator const * {
+  auto spot = _map.find(name);
+  return spot == _map.end() ? nullptr : &spot->second;
+}
+
+template <typename F>
+size_t
+NameMap<F>::generation() const {
+  return _generation;
+}
+
 template <typename F>
 std::string_view
 NameMap<F>::localize(std::string_view const &name) {
@@ -592,6 +1059,7 @@ template <typename F>
 auto
 NameMap<F>::assign(std::string_view const &name, Generator const &generator) -> self_type & {
   _map[this->localize(name)] = generator;
+  ++_generation;
   return *this;
 }
 
@@ -607,8 +1075,24 @@ ExternalNames::operator()(BufferWriter &w, const Spec &spec) const {
   return w;
 }
 
-inline NameBinding const &
-ExternalNames::bind() const {
+inline BufferWriter &
+ExternalNames::operator()(BufferWriter &w, Format::CacheSpec const &spec) const {
+  if (spec._cache_format && !spec._name.empty()) {
+    auto &cache         = spec._cache_format->_cache;
+    auto map_generation = this->generation();
+    auto g              = static_cast<Generator const *>(cache.find(this, map_generation, spec._cache_idx));
+    if (nullptr == g && nullptr != (g = this->resolve(spec._name))) {
+      cache.store(this, map_generation, spec._cache_idx, g);
+    }
+    if (g) {
+      return (*g)(w, spec);
+    }
+  }
+  return (*this)(w, static_cast<Spec const &>(spec)); // generic dispatch - error reporting, subclasses.
+}
+
+inline auto
+ExternalNames::bind() const -> self_type const & {
   return *this;
 }
 
@@ -686,9 +1170,16 @@ BufferWriter &Format_Integer(BufferWriter &w, Spec const &spec, uintmax_t n, boo
  * @return @a w
  *
  * A leading sign character will be output based on @a spec and @a negative_p.
+ *
+ * Without a precision in @a spec the output is the shortest text that parses back to exactly
+ * @a f. With a precision the output is fixed point at that precision.
  */
 BufferWriter &Format_Float(BufferWriter &w, Spec const &spec, double f, bool negative_p);
 
+/// Overload for @c float, which formats as the shortest text that round trips to the
+/// @c float value rather than the wider @c double.
+BufferWriter &Format_Float(BufferWriter &w, Spec const &spec, float f, bool negative_p);
+
 /** Format output as a hexadecimal dump.
  *
  * @param w Output buffer.
@@ -940,6 +1431,18 @@ BufferWriter::print_v(const bwf::Format &fmt, const std::tuple<Args...> &args) {
   return this->print_nfv(bwf::Global_Names.bind(), fmt.bind(), bwf::ArgTuple{args});
 }
 
+template <size_t N, typename... Args>
+BufferWriter &
+BufferWriter::print(bwf::FixedFormat<N> const &fmt, Args &&...args) {
+  return this->print_nfv(bwf::Global_Names.bind(), fmt.bind(), bwf::ArgTuple{std::forward_as_tuple(args...)});
+}
+
+template <size_t N, typename... Args>
+BufferWriter &
+BufferWriter::print_v(bwf::FixedFormat<N> const &fmt, std::tuple<Args...> const &args) {
+  return this->print_nfv(bwf::Global_Names.bind(), fmt.bind(), bwf::ArgTuple{args});
+}
+
 template <typename Binding, typename Extractor>
 BufferWriter &
 BufferWriter::print_nfv(Binding const &names, Extractor &&f) {
@@ -952,6 +1455,12 @@ BufferWriter::print_n(Binding const &names, TextView const &fmt) {
   return print_nfv(names, bwf::Format::bind(fmt), bwf::ArgTuple{std::make_tuple()});
 }
 
+template <typename Binding>
+BufferWriter &
+BufferWriter::print_n(Binding const &names, bwf::Format const &fmt) {
+  return print_nfv(names, fmt.bind(), bwf::ArgTuple{std::make_tuple()});
+}
+
 inline MemSpan<char>
 BufferWriter::aux_span() {
   return {this->aux_data(), this->remaining()};
@@ -1128,6 +1637,61 @@ bwformat(BufferWriter &w, bwf::Spec const &spec, bool f) {
   return w;
 }
 
+namespace bwf {
+namespace detail {
+/// @cond INTERNAL_DETAIL
+// Estimated output size for a single format argument, by decreasing specificity. These are
+// heuristics to size a destination string before formatting - an under estimate costs a second
+// format pass, never correctness.
+template <typename T>
+constexpr size_t
+arg_size_hint(T const &, meta::CaseTag<0>) {
+  return 32; // opaque type - enough for the common scalar wrappers.
+}
+
+template <typename T>
+constexpr auto
+arg_size_hint(T const &, meta::CaseTag<1>) -> std::enable_if_t<std::is_arithmetic_v<std::decay_t<T>>, size_t> {
+  return 24; // covers the widest integer and shortest round trip float output.
+}
+
+template <typename T>
+auto
+arg_size_hint(T const &t, meta::CaseTag<2>) -> decltype(size_t{std::string_view(t).size()}) {
+  return std::string_view(t).size(); // string like - exact.
+}
+
+inline size_t
+arg_size_hint(char const *s, meta::CaseTag<3>) {
+  return s ? std::char_traits<char>::length(s) : 0; // C string - may be @c nullptr.
+}
+
+inline constexpr size_t
+arg_size_hint(std::nullptr_t, meta::CaseTag<3>) {
+  return 24; // formatted as a pointer.
+}
+/// @endcond
+} // namespace detail
+
+/** Estimate the formatted output size for @a fmt with arguments @a args.
+ *
+ * @tparam Args Format argument types.
+ * @param fmt Format string.
+ * @param args A tuple of the format arguments.
+ * @return An estimate of the output size in bytes.
+ *
+ * String like arguments contribute their exact length, other types a per-type heuristic. The
+ * estimate is used to reserve destination capacity for a single format pass - it is not a bound.
+ */
+template <typename... Args>
+size_t
+size_hint(TextView fmt, std::tuple<Args...> const &args) {
+  size_t zret = fmt.size();
+  std::apply([&](auto &&...arg) { ((zret += detail::arg_size_hint(arg, meta::CaseArg)), ...); }, args);
+  return zret;
+}
+} // namespace bwf
+
 // std::string support
 /** Generate formatted output to a @c std::string @a s using format @a fmt with arguments @a args.
  *
@@ -1137,9 +1701,10 @@ bwformat(BufferWriter &w, bwf::Spec const &spec, bool f) {
  * @param args A tuple of the format arguments.
  * @return @a s
  *
- * The output is generated to @a s as is. If @a s does not have sufficient space for the output
- * it is resized to be sufficient and the output formatted again. The result is that @a s will
- * containing exactly the formatted output.
+ * The output is generated to @a s as is. The capacity of @a s is first raised to an estimate of
+ * the output size (see @c bwf::size_hint) so that in the common case the output is formatted
+ * exactly once. If the estimate is short the output is formatted again in to the (now
+ * sufficient) capacity. The result is that @a s will contain exactly the formatted output.
  *
  * @note This function is intended for use by other formatting front ends, such as in classes that
  * need to generate formatted output. For direct use there is an overload that takes an argument
@@ -1148,11 +1713,17 @@ bwformat(BufferWriter &w, bwf::Spec const &spec, bool f) {
 template <typename... Args>
 std::string &
 bwprint_v(std::string &s, TextView fmt, std::tuple<Args...> const &args) {
-  auto const len = s.size(); // remember initial size
-  auto printer   = [&]() { return FixedBufferWriter(s.data(), s.capacity()).print_v(fmt, args).extent(); };
-  size_t n       = printer();
-  s.resize(n);   // always need to resize - if shorter, must clip pre-existing text.
-  if (n > len) { // dropped data, try again.
+  if (auto hint = bwf::size_hint(fmt, args); hint > s.capacity()) {
+    s.reserve(hint); // one resize up front instead of a second format pass.
+  }
+  auto const capacity = s.capacity();
+  auto printer        = [&]() { return FixedBufferWriter(s.data(), s.capacity()).print_v(fmt, args).extent(); };
+  // Extend to the full capacity first - @c resize after the fact value initializes the added
+  // characters, which would clobber output written past the current size.
+  s.resize(capacity);
+  size_t n = printer();
+  s.resize(n);        // adjust to the actual output length.
+  if (n > capacity) { // dropped data, try again.
     printer();
   }
   return s;
@@ -1188,14 +1759,19 @@ bwprint(std::string &s, TextView fmt, Args &&...args) {
  * @param args Arguments for format string.
  * @return @a s
  *
- * The output is appended to @a s without resizing. If @a s does not have sufficient space for the output
- * it is resized to be sufficient and the output formatted again. The result is that @a s will
- * contain any previous text and the formatted output.
+ * The output is appended to @a s, reusing existing capacity past the current text when there is
+ * any. If @a s does not have sufficient space for the output its capacity is first raised to an
+ * estimate of the final size (see @c bwf::size_hint) so that in the common case the output is
+ * formatted exactly once. The result is that @a s will contain any previous text and the
+ * formatted output.
  */
 template <typename... Args>
 std::string &
 bwappend(std::string &s, TextView fmt, Args &&...args) {
-  auto const len      = s.length();   // Text to preserve.
+  auto const len = s.length(); // Text to preserve.
+  if (auto hint = len + bwf::size_hint(fmt, std::forward_as_tuple(args...)); hint > s.capacity()) {
+    s.reserve(hint); // one resize up front instead of a second format pass.
+  }
   auto const capacity = s.capacity(); // Working space.
   auto printer        = [&]() { return FixedBufferWriter(s.data() + len, s.capacity() - len).print(fmt, args...).extent(); };
   // Resize first, otherwise capacity past @a len is cleared on @c resize.
@@ -1232,6 +1808,18 @@ auto
 FixedBufferWriter::print_v(bwf::Format const &fmt, std::tuple<Args...> const &args) -> self_type & {
   return static_cast<self_type &>(this->super_type::print_v(fmt, args));
 }
+
+template <size_t N, typename... Args>
+auto
+FixedBufferWriter::print(bwf::FixedFormat<N> const &fmt, Args &&...args) -> self_type & {
+  return static_cast<self_type &>(this->super_type::print_v(fmt, std::forward_as_tuple(args...)));
+}
+
+template <size_t N, typename... Args>
+auto
+FixedBufferWriter::print_v(bwf::FixedFormat<N> const &fmt, std::tuple<Args...> const &args) -> self_type & {
+  return static_cast<self_type &>(this->super_type::print_v(fmt, args));
+}
 /// @endcond
 
 // Special case support for @c Scalar, because @c Scalar is a base utility for some other utilities
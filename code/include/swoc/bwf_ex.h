@@ -223,6 +223,20 @@ struct UnHex {
   UnHex(MemSpan<void const> const &span) : _span(span) {}
   MemSpan<void const> _span; ///< Source span.
 };
+
+/** Output raw bytes as base64 text.
+ *
+ * Standard alphabet with padding. Any @c MemSpan compatible class can be used as the source,
+ * including @c std::string and @c std::string_view.
+ *
+ * @code
+ *   w.print("{}", bwf::B64(span));
+ * @endcode
+ */
+struct B64 {
+  B64(MemSpan<void const> const &span) : _span(span) {}
+  MemSpan<void const> _span; ///< Source span.
+};
 } // namespace bwf
 
 /** Repeatedly output a pattern.
@@ -256,6 +270,8 @@ BufferWriter &bwformat(BufferWriter &w, bwf::Spec const &spec, bwf::Date const &
 
 BufferWriter &bwformat(BufferWriter &w, bwf::Spec const &spec, bwf::UnHex const &obj);
 
+BufferWriter &bwformat(BufferWriter &w, bwf::Spec const &spec, bwf::B64 const &obj);
+
 /** Output a nested formatted string.
  *
  * @tparam Args Argument pack for @a subtext.
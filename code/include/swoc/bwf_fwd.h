@@ -24,6 +24,7 @@ template <typename... Args> std::string &bwprint(std::string &s, TextView fmt, A
 namespace bwf {
 struct Spec;
 struct Format;
+template <std::size_t N> class FixedFormat;
 class NameBinding;
 class ArgPack;
 } // namespace bwf
@@ -71,6 +71,59 @@ bwformat(BufferWriter &w, bwf::Spec const &spec, IPEndpoint const &addr) {
   return bwformat(w, spec, &addr.sa);
 }
 
+namespace ip {
+
+/// @{
+/// Buffer sizes sufficient for the default format of the corresponding value.
+static constexpr size_t IP4_TXT_SIZE          = 15;                ///< "255.255.255.255"
+static constexpr size_t IP6_TXT_SIZE          = 39;                ///< Full form IPv6 address.
+static constexpr size_t IP4_ENDPOINT_TXT_SIZE = IP4_TXT_SIZE + 6;  ///< Address with ":port".
+static constexpr size_t IP6_ENDPOINT_TXT_SIZE = IP6_TXT_SIZE + 8;  ///< Bracketed address with ":port".
+/// @}
+
+/** Format @a addr directly in to @a buf.
+ *
+ * @param addr Address to format.
+ * @param buf Output buffer.
+ * @return A view of the formatted text in @a buf, empty if @a buf is too small.
+ *
+ * This generates the same text as the default BWF format but skips the spec machinery, which
+ * makes it noticeably faster for the common "just print the address" case. @a buf must be at
+ * least @c IP4_TXT_SIZE.
+ */
+TextView to_buffer(IP4Addr const &addr, MemSpan<char> buf);
+
+/** Format @a addr directly in to @a buf.
+ *
+ * @param addr Address to format.
+ * @param buf Output buffer.
+ * @return A view of the formatted text in @a buf, empty if @a buf is too small.
+ *
+ * The address is formatted in compressed form, identical to the default BWF format. @a buf must
+ * be at least @c IP6_TXT_SIZE.
+ */
+TextView to_buffer(IP6Addr const &addr, MemSpan<char> buf);
+
+/** Format @a addr with its port directly in to @a buf.
+ *
+ * @param addr Socket address to format.
+ * @param buf Output buffer.
+ * @return A view of the formatted text in @a buf, empty if @a buf is too small or the family is
+ * not IP.
+ *
+ * The output is "addr:port" for IPv4 and "[addr]:port" for IPv6, identical to the default BWF
+ * format. @a buf must be at least @c IP6_ENDPOINT_TXT_SIZE to cover both families.
+ */
+TextView to_buffer(sockaddr const *addr, MemSpan<char> buf);
+
+/// Format @a ep with its port directly in to @a buf.
+inline TextView
+to_buffer(IPEndpoint const &ep, MemSpan<char> buf) {
+  return to_buffer(&ep.sa, buf);
+}
+
+} // namespace ip
+
 /// Buffer space sufficient for printing any basic IP address type.
 static const size_t IP_STREAM_SIZE = 80;
 
@@ -92,6 +92,25 @@ public:
    */
   template <typename X, typename V> value_type hash_immediate(TransformView<X, V> const &view);
 
+  /** Update the hash value with case folded data.
+   *
+   * @param data Input data to hash.
+   * @return @a this
+   *
+   * Each character is folded to ASCII upper case as it is hashed - the input is not copied
+   * or modified. The result matches hashing the upper cased input.
+   */
+  self_type &update_nocase(std::string_view const &data);
+
+  /** Update and finalize with case folding.
+   *
+   * @param data Input data to hash.
+   * @return The final hash value.
+   *
+   * Convenience method to compute a case insensitive hash in one step.
+   */
+  value_type hash_nocase_immediate(std::string_view const &data);
+
 private:
   value_type hval{INIT};
 };
@@ -158,6 +177,25 @@ public:
    */
   template <typename X, typename V> value_type hash_immediate(TransformView<X, V> const &view);
 
+  /** Update the hash value with case folded data.
+   *
+   * @param data Input data to hash.
+   * @return @a this
+   *
+   * Each character is folded to ASCII upper case as it is hashed - the input is not copied
+   * or modified. The result matches hashing the upper cased input.
+   */
+  self_type &update_nocase(std::string_view const &data);
+
+  /** Update and finalize with case folding.
+   *
+   * @param data Input data to hash.
+   * @return The final hash value.
+   *
+   * Convenience method to compute a case insensitive hash in one step.
+   */
+  value_type hash_nocase_immediate(std::string_view const &data);
+
 private:
   value_type hval{INIT};
 };
@@ -209,6 +247,24 @@ Hash32FNV1a::hash_immediate(std::string_view const &data) -> value_type {
   return this->update(data).final().get();
 }
 
+inline auto
+Hash32FNV1a::update_nocase(std::string_view const &data) -> self_type & {
+  for (char ch : data) {
+    auto c = static_cast<value_type>(static_cast<unsigned char>(ch));
+    if (c >= 'a' && c <= 'z') {
+      c -= 0x20; // fold to ASCII upper case.
+    }
+    hval ^= c;
+    hval += (hval << 1) + (hval << 4) + (hval << 7) + (hval << 8) + (hval << 24);
+  }
+  return *this;
+}
+
+inline auto
+Hash32FNV1a::hash_nocase_immediate(std::string_view const &data) -> value_type {
+  return this->update_nocase(data).final().get();
+}
+
 // -- 64 --
 
 inline auto
@@ -253,4 +309,22 @@ Hash64FNV1a::hash_immediate(std::string_view const &data) -> value_type {
   return this->update(data).final().get();
 }
 
+inline auto
+Hash64FNV1a::update_nocase(std::string_view const &data) -> self_type & {
+  for (char ch : data) {
+    auto c = static_cast<value_type>(static_cast<unsigned char>(ch));
+    if (c >= 'a' && c <= 'z') {
+      c -= 0x20; // fold to ASCII upper case.
+    }
+    hval ^= c;
+    hval += (hval << 1) + (hval << 4) + (hval << 5) + (hval << 7) + (hval << 8) + (hval << 40);
+  }
+  return *this;
+}
+
+inline auto
+Hash64FNV1a::hash_nocase_immediate(std::string_view const &data) -> value_type {
+  return this->update_nocase(data).final().get();
+}
+
 }} // namespace swoc::SWOC_VERSION_NS
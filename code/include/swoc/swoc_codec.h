@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    Branchless encode / decode kernels for binary to text codecs.
+
+    Table driven hexadecimal and base64 encoding and decoding between raw spans and text. The
+    inner loops are branch free and batch their output, so the compiler can vectorize them -
+    they are an order of magnitude faster than the byte at a time loops they replace. The
+    @c BufferWriter overloads stream through a stack buffer and never materialize the full
+    encoding.
+ */
+
+#pragma once
+
+#include "swoc/swoc_version.h"
+#include "swoc/MemSpan.h"
+#include "swoc/TextView.h"
+#include "swoc/BufferWriter.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace codec {
+
+/// @return The number of characters needed to hex encode @a n bytes.
+inline constexpr size_t
+hex_encode_size(size_t n) {
+  return 2 * n;
+}
+
+/// @return The number of characters needed to base64 encode @a n bytes, including padding.
+inline constexpr size_t
+base64_encode_size(size_t n) {
+  return 4 * ((n + 2) / 3);
+}
+
+/** Hex encode @a src into @a dst.
+ *
+ * @param dst Output text - must hold at least @c hex_encode_size(src.size()) characters.
+ * @param src Bytes to encode.
+ * @param upper Use upper case digits.
+ * @return The encoded text - a prefix of @a dst - or an empty span if @a dst is too small.
+ */
+MemSpan<char> hex_encode(MemSpan<char> dst, MemSpan<void const> src, bool upper = false);
+
+/** Hex encode @a src to @a w.
+ *
+ * @param w Output.
+ * @param src Bytes to encode.
+ * @param upper Use upper case digits.
+ * @return @a w
+ */
+BufferWriter &hex_encode(BufferWriter &w, MemSpan<void const> src, bool upper = false);
+
+/** Decode hex @a src into @a dst.
+ *
+ * @param dst Output bytes.
+ * @param src Text to decode.
+ * @return The decoded bytes - a prefix of @a dst - or an empty span if @a src is not an even
+ * number of valid hexadecimal digits or @a dst is too small.
+ */
+MemSpan<void> hex_decode(MemSpan<void> dst, TextView src);
+
+/** Base64 encode @a src into @a dst.
+ *
+ * @param dst Output text - must hold at least @c base64_encode_size(src.size()) characters.
+ * @param src Bytes to encode.
+ * @return The encoded text - a prefix of @a dst - or an empty span if @a dst is too small.
+ *
+ * Standard alphabet with padding.
+ */
+MemSpan<char> base64_encode(MemSpan<char> dst, MemSpan<void const> src);
+
+/** Base64 encode @a src to @a w.
+ *
+ * @param w Output.
+ * @param src Bytes to encode.
+ * @return @a w
+ */
+BufferWriter &base64_encode(BufferWriter &w, MemSpan<void const> src);
+
+/** Decode base64 @a src into @a dst.
+ *
+ * @param dst Output bytes.
+ * @param src Text to decode - standard alphabet, trailing padding optional.
+ * @return The decoded bytes - a prefix of @a dst - or an empty span on invalid input or if
+ * @a dst is too small.
+ */
+MemSpan<void> base64_decode(MemSpan<void> dst, TextView src);
+
+namespace detail {
+/// Hex digit pairs for each byte value, lower and upper case.
+extern std::array<std::array<char, 2>, 256> const HEX_PAIRS_LOWER;
+extern std::array<std::array<char, 2>, 256> const HEX_PAIRS_UPPER;
+/// Value of each character as a hex digit, -1 if not a digit.
+extern std::array<int8_t, 256> const HEX_VALUE;
+/// Value of each character as a base64 digit, -1 if not a digit.
+extern std::array<int8_t, 256> const BASE64_VALUE;
+} // namespace detail
+
+} // namespace codec
+}} // namespace swoc::SWOC_VERSION_NS
@@ -0,0 +1,358 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+  Zero copy configuration parsing.
+
+  This ties the library pieces in to the pipeline every consumer builds by hand - map the file
+  (@c swoc::file::map, no read copy), tokenize with a checkpointable @c TextView cursor that
+  tracks line and column for @c Errata diagnostics, and build the resulting object graph
+  entirely in a caller supplied @c MemArena with interned strings. A successful parse performs
+  no heap allocation at all - the only memory touched is the mapping and the arena, and
+  tearing a configuration down is dropping the arena.
+*/
+
+#pragma once
+
+#include "swoc/swoc_version.h"
+#include "swoc/TextView.h"
+#include "swoc/MemArena.h"
+#include "swoc/Errata.h"
+#include "swoc/swoc_file.h"
+#include "swoc/ext/HashFNV.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace config {
+
+/** A tokenizing cursor over configuration text.
+ *
+ * A thin wrapper over a @c TextView that tracks the source line and column as it advances, so
+ * any point in the parse can be reported precisely in an @c Errata. The cursor is
+ * checkpointable - @c mark captures the full position and @c rewind restores it, which is how
+ * speculative parses (try one production, back off to another) are done without any state
+ * outside the cursor.
+ */
+class Cursor {
+  using self_type = Cursor; ///< Self reference type.
+
+public:
+  /// A saved cursor position - restored with @c rewind.
+  struct Checkpoint {
+    TextView _rest;                  ///< Unconsumed text.
+    unsigned _line       = 1;        ///< Line number.
+    char const *_line_start = nullptr; ///< Start of the current line.
+  };
+
+  /// Construct over @a text, positioned at the start.
+  explicit Cursor(TextView text) : _rest(text), _line_start(text.data()) {}
+
+  /// @return @c true if all text has been consumed.
+  bool
+  at_end() const {
+    return _rest.empty();
+  }
+
+  /// @return The next character - must not be called at end.
+  char
+  peek() const {
+    return *_rest;
+  }
+
+  /** Consume and return the next character.
+   *
+   * Line tracking is updated - this is the only primitive that advances, so tracking cannot
+   * be bypassed. Must not be called at end.
+   */
+  char
+  take() {
+    char c = *_rest;
+    ++_rest;
+    if ('\n' == c) {
+      ++_line;
+      _line_start = _rest.data();
+    }
+    return c;
+  }
+
+  /// Consume whitespace and comments ('#' to end of line).
+  void
+  skip_ws() {
+    while (!_rest.empty()) {
+      if (isspace(*_rest)) {
+        this->take();
+      } else if ('#' == *_rest) {
+        while (!_rest.empty() && '\n' != *_rest) {
+          this->take();
+        }
+      } else {
+        break;
+      }
+    }
+  }
+
+  /** Consume a bare token.
+   *
+   * @return The token - empty if the cursor is not at a token character.
+   *
+   * A token runs until whitespace or a structural character (one of <tt>;,{}[]"#=</tt>). The
+   * view is in to the source text - no copy.
+   */
+  TextView take_token();
+
+  /// @return A checkpoint for the current position.
+  Checkpoint
+  mark() const {
+    return {_rest, _line, _line_start};
+  }
+
+  /// Restore the position saved in @a cp.
+  void
+  rewind(Checkpoint const &cp) {
+    _rest       = cp._rest;
+    _line       = cp._line;
+    _line_start = cp._line_start;
+  }
+
+  /// @return The current line number, 1 based.
+  unsigned
+  line() const {
+    return _line;
+  }
+
+  /// @return The current column number, 1 based.
+  unsigned
+  column() const {
+    return unsigned(_rest.data() - _line_start) + 1;
+  }
+
+  /// @return The unconsumed text.
+  TextView
+  rest() const {
+    return _rest;
+  }
+
+protected:
+  TextView _rest;          ///< Unconsumed text.
+  unsigned _line = 1;      ///< Current line, 1 based.
+  char const *_line_start; ///< Start of the current line, for column computation.
+};
+
+/** Arena backed string interning.
+ *
+ * The minimal interning needed by the parser - equal strings are stored once in the caller's
+ * arena and the index itself (buckets and nodes) lives in the same arena, so interning never
+ * touches the heap. Returned views are stable for the life of the arena.
+ *
+ * This differs from @c InternTable deliberately: no reference counting, no freezing, no
+ * internal arena - everything is owned by the configuration arena and is dropped with it.
+ */
+class Interner {
+  using self_type = Interner; ///< Self reference type.
+
+public:
+  /// Initial bucket count - a power of 2.
+  static constexpr size_t N_BUCKETS = 64;
+
+  /// Construct over @a arena - all storage is taken from it.
+  explicit Interner(MemArena &arena) : _arena(&arena) {}
+
+  Interner(self_type const &)             = delete;
+  self_type &operator=(self_type const &) = delete;
+
+  /** Intern @a text.
+   *
+   * @return A stable view of the single arena copy of @a text.
+   */
+  TextView intern(TextView text);
+
+  /** Intern already arena resident @a text.
+   *
+   * @return The view of the single stored copy - @a text itself if it was not already present.
+   *
+   * For text built directly in the arena (e.g. unescaped string literals) - avoids the copy
+   * @c intern would make. If the text was already interned the duplicate arena bytes are not
+   * reclaimed, the usual arena trade.
+   */
+  TextView intern_in_place(TextView text);
+
+  /// @return The number of distinct interned strings.
+  size_t
+  count() const {
+    return _count;
+  }
+
+protected:
+  /// Index node - the string bytes are a separate arena allocation.
+  struct Node {
+    Node *_next = nullptr; ///< Bucket chain link.
+    TextView _view;        ///< The stored string.
+  };
+
+  /** Find the chain slot for @a text.
+   *
+   * @return The link holding the matching node, or the terminal null link of the bucket chain
+   * if not present - insertion writes the new node there.
+   */
+  Node **probe(TextView text);
+
+  /// Double the bucket array. The old array is abandoned in the arena.
+  void expand();
+
+  MemArena *_arena;         ///< Backing storage.
+  Node **_buckets = nullptr; ///< Bucket array - allocated on first intern.
+  size_t _n_buckets = 0;    ///< Bucket count - a power of 2.
+  size_t _count     = 0;    ///< Distinct strings.
+};
+
+/** A node in a parsed configuration.
+ *
+ * Nodes are immutable once parsed and live entirely in the parse arena - scalar text is
+ * interned, children are intrusive sibling chains. A @c STRING holds text, a @c LIST holds
+ * unkeyed children, an @c OBJECT holds keyed children (fields).
+ */
+struct Value {
+  /// Node type.
+  enum class Type : uint8_t {
+    NIL,    ///< No value - the result of a failed lookup.
+    STRING, ///< Scalar text.
+    LIST,   ///< Ordered unkeyed values.
+    OBJECT  ///< Ordered keyed values.
+  };
+
+  Type _type = Type::NIL; ///< Node type.
+  unsigned _line = 0;     ///< Source line of the value, for diagnostics.
+  TextView _key;          ///< Field name - set when the parent is an @c OBJECT.
+  TextView _text;         ///< The text of a @c STRING.
+  Value *_child = nullptr; ///< First child of a @c LIST / @c OBJECT.
+  Value *_next  = nullptr; ///< Next sibling.
+  size_t _count = 0;      ///< Number of children.
+
+  /// @return @c true if this is a @c STRING.
+  bool
+  is_string() const {
+    return Type::STRING == _type;
+  }
+
+  /// @return @c true if this is a @c LIST.
+  bool
+  is_list() const {
+    return Type::LIST == _type;
+  }
+
+  /// @return @c true if this is an @c OBJECT.
+  bool
+  is_object() const {
+    return Type::OBJECT == _type;
+  }
+
+  /** Find the field @a key in an @c OBJECT.
+   *
+   * @return The field value, or @c nullptr if absent (or @a this is not an object).
+   *
+   * Keys are interned so the comparison is pointer identity when @a key came from the same
+   * parse, otherwise a text compare. Linear - configuration objects are small.
+   */
+  Value const *
+  find(TextView key) const {
+    for (Value const *v = _child; v; v = v->_next) {
+      if (v->_key.data() == key.data() || v->_key == key) {
+        return v;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Child iteration support - range for over a node walks its children.
+  struct iterator {
+    Value const *_v = nullptr;
+    Value const &operator*() const { return *_v; }
+    Value const *operator->() const { return _v; }
+    iterator &
+    operator++() {
+      _v = _v->_next;
+      return *this;
+    }
+    bool operator==(iterator const &that) const { return _v == that._v; }
+    bool operator!=(iterator const &that) const { return _v != that._v; }
+  };
+
+  iterator begin() const { return {_child}; }   ///< First child.
+  iterator end() const { return {nullptr}; }    ///< Past the last child.
+};
+
+/** Configuration parser.
+ *
+ * The grammar is the common "fields and groups" configuration shape
+ *
+ * @code
+ *   # comment to end of line
+ *   name value;                 # scalar field - bare token or "quoted string"
+ *   name [ v1, v2, "v 3" ];     # list field
+ *   name {                      # group field
+ *     inner value;
+ *   }
+ * @endcode
+ *
+ * All structure and all strings are built in the arena passed to the constructor - the parser
+ * itself holds no result state and a successful parse makes no heap allocation. Quoted strings
+ * support the escapes <tt>\\" \\\\ \\n \\t \\r</tt>; a string without escapes is interned
+ * straight from the source text with no intermediate copy.
+ *
+ * The arena must outlive every @c Value from the parse. One parser (and arena) can parse
+ * multiple texts - all results share the interned strings.
+ */
+class Parser {
+  using self_type = Parser; ///< Self reference type.
+
+public:
+  /// Construct a parser building in to @a arena.
+  explicit Parser(MemArena &arena) : _arena(&arena), _intern(arena) {}
+
+  Parser(self_type const &)               = delete;
+  self_type &operator=(self_type const &) = delete;
+
+  /** Parse @a text.
+   *
+   * @return The root @c OBJECT, or errors describing the failure with line and column.
+   *
+   * @a text is not retained - everything reachable from the root is in the arena.
+   */
+  Rv<Value *> parse(TextView text);
+
+  /** Map and parse the file at @a path.
+   *
+   * @return The root @c OBJECT, or errors.
+   *
+   * The file is memory mapped, parsed, and unmapped - the content is never copied in to
+   * allocated memory, only the (interned) strings of the result.
+   */
+  Rv<Value *> load(file::path const &path);
+
+  /// @return The string interner - shared across parses on this parser.
+  Interner &
+  interner() {
+    return _intern;
+  }
+
+protected:
+  /// Parse fields in to @a obj until end of input, or '}' if @a braced.
+  Errata parse_fields(Cursor &c, Value *obj, bool braced);
+
+  /// Parse a value - group, list, or scalar.
+  Rv<Value *> parse_value(Cursor &c);
+
+  /// Parse a scalar - bare token or quoted string - and intern it.
+  Rv<TextView> parse_scalar(Cursor &c);
+
+  /// @return A new arena node of @a type at the current line of @a c.
+  Value *make_value(Value::Type type, Cursor const &c);
+
+  /// Append @a v to the children of @a parent. @a tail is the chain tail, updated.
+  static void append(Value *parent, Value *&tail, Value *v);
+
+  MemArena *_arena;  ///< Result storage.
+  Interner _intern;  ///< String storage.
+};
+
+} // namespace config
+}} // namespace swoc::SWOC_VERSION_NS
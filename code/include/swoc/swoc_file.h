@@ -10,12 +10,16 @@
 #include <unistd.h>
 #include <sys/stat.h>
 
+#include <memory>
 #include <string>
 #include <string_view>
 #include <system_error>
 #include <chrono>
+#include <vector>
+#include <functional>
 
 #include "swoc/swoc_version.h"
+#include "swoc/MemSpan.h"
 #include "swoc/TextView.h"
 
 namespace swoc { inline namespace SWOC_VERSION_NS {
@@ -361,6 +365,234 @@ file_time_type status_time(file_status const &fs);
  */
 std::string load(const path &p, std::error_code &ec);
 
+/** Memory mapped file contents.
+ *
+ * An immutable view of a file's contents backed by a memory mapping rather than a copy in
+ * allocated memory. In contrast to @c load this requires no allocation or copying of the
+ * content, and processes mapping the same file share the pages. The mapping is dropped on
+ * destruction - any views in to it must not outlive the instance.
+ *
+ * Instances are created with @c swoc::file::map.
+ */
+class mapping {
+  using self_type = mapping; ///< Self reference type.
+
+public:
+  /// Access pattern hints, passed to the kernel to tune read ahead.
+  enum class advice : int8_t {
+    NORMAL,     ///< No special access pattern.
+    SEQUENTIAL, ///< Content will be read front to back - aggressive read ahead.
+    RANDOM      ///< Content will be accessed randomly - suppress read ahead.
+  };
+
+  /// Default construct - no mapping.
+  mapping() = default;
+
+  /// Not copyable - the mapping is owned.
+  mapping(self_type const &) = delete;
+
+  /// Not copyable - the mapping is owned.
+  self_type &operator=(self_type const &) = delete;
+
+  /** Move construction.
+   *
+   * @param that Source instance.
+   *
+   * Ownership moves from @a that to @a this, leaving @a that unmapped.
+   */
+  mapping(self_type &&that) : _span(that._span) { that._span = {}; }
+
+  /// Move assignment - any current mapping in @a this is dropped.
+  self_type &operator=(self_type &&that);
+
+  /// Drop the mapping.
+  ~mapping();
+
+  /// @return The file contents.
+  MemSpan<char const>
+  span() const {
+    return _span;
+  }
+
+  /// @return A view of the file contents.
+  TextView
+  view() const {
+    return {_span.data(), _span.size()};
+  }
+
+  /// Implicit conversion so parsers taking a @c TextView can consume the mapping directly.
+  operator TextView() const { return this->view(); }
+
+  /// @return A pointer to the content.
+  char const *
+  data() const {
+    return _span.data();
+  }
+
+  /// @return Size of the content in bytes.
+  size_t
+  size() const {
+    return _span.size();
+  }
+
+  /// @return @c true if there is a mapping (an empty file yields a valid, empty mapping).
+  explicit operator bool() const { return nullptr != _span.data(); }
+
+  /** Apply an access pattern hint to the mapping.
+   *
+   * @param hint Expected access pattern.
+   * @return The error code - default (empty) on success.
+   *
+   * The hint is advisory - failure does not affect the validity of the mapping.
+   */
+  std::error_code advise(advice hint);
+
+  /// Drop the mapping explicitly. The instance is left empty.
+  void unmap();
+
+protected:
+  MemSpan<char const> _span; ///< The mapped content.
+
+  /// Internal constructor for @c map.
+  explicit mapping(MemSpan<char const> span) : _span(span) {}
+
+  friend self_type map(path const &p, std::error_code &ec, advice hint);
+};
+
+/** Map the file at @a p into memory.
+ *
+ * @param p Path to file.
+ * @param ec Error code result of the file operation.
+ * @param hint Expected access pattern.
+ * @return The mapping - unmapped (operator bool is @c false) on error.
+ *
+ * The mapping is read only and shared - the content is not copied and the pages are shared
+ * with any other process mapping the same file. The underlying descriptor is closed before
+ * returning; the mapping keeps the content available.
+ */
+mapping map(path const &p, std::error_code &ec, mapping::advice hint = mapping::advice::NORMAL);
+
+/** Pull based reader yielding lines from a file or span of text.
+ *
+ * Lines are delivered as @c TextView instances with the terminating newline removed. Over a span
+ * (or a @c mapping) the views point directly in to the source - no copying at all. Over a file
+ * descriptor the views point in to an internal buffer of configurable size, refilled as lines are
+ * consumed - a line that spans a refill boundary costs a single bounded copy to the front of the
+ * buffer. This provides bounded memory line parsing regardless of file size, in contrast to
+ * @c load which must hold the entire content.
+ *
+ * A line longer than the buffer is delivered in buffer sized pieces, all but the last without a
+ * newline having been seen - this keeps memory bounded for degenerate input.
+ *
+ * A returned view is valid only until the next call to @c next.
+ */
+class LineReader {
+  using self_type = LineReader; ///< Self reference type.
+
+public:
+  /// Default internal buffer size for file descriptor sources.
+  static constexpr size_t DEFAULT_BUFFER_SIZE = 0x10000;
+
+  /** Construct over @a content.
+   *
+   * @param content Text to read - must outlive the reader.
+   *
+   * Lines are views directly in to @a content.
+   */
+  LineReader(TextView content);
+
+  /** Construct over the file descriptor @a fd.
+   *
+   * @param fd Open descriptor - the reader takes ownership.
+   * @param buffer_size Internal buffer size.
+   *
+   * The descriptor is advised for sequential access and read to the end, then closed on
+   * destruction.
+   */
+  explicit LineReader(unique_fd &&fd, size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+  /// Not copyable - lines reference the internal buffer.
+  LineReader(self_type const &that)           = delete;
+  self_type &operator=(self_type const &that) = delete;
+
+  /// Movable - outstanding views remain valid, the buffer moves with the reader.
+  LineReader(self_type &&that) = default;
+
+  /** Get the next line.
+   *
+   * @param line [out] The line content, without the newline.
+   * @return @c true if a line was produced, @c false at end of input or on error.
+   *
+   * An empty line is a valid line - check the return value, not @a line.
+   */
+  bool next(TextView &line);
+
+  /// @return @c true if more lines may be available.
+  explicit operator bool() const;
+
+  /// @return The number of lines returned so far - after @c next, the 1 based line number.
+  size_t line_no() const;
+
+  /// @return The error code for the first read failure - default (empty) if none.
+  std::error_code error() const;
+
+protected:
+  unique_fd _fd{NO_FD};             ///< Source descriptor - @c NO_FD in span mode.
+  std::unique_ptr<char[]> _buffer;  ///< Refill buffer - null in span mode.
+  size_t _capacity = 0;             ///< Buffer capacity.
+  TextView _avail;                  ///< Unconsumed content.
+  size_t _line_no = 0;              ///< Lines returned.
+  bool _eof_p = false;              ///< Whether the source is exhausted.
+  std::error_code _ec;              ///< First read error.
+
+  /** Refill the buffer, preserving the unconsumed tail.
+   *
+   * @return @c true if more content was obtained.
+   */
+  bool refill();
+};
+
+/** Open the file at @a p for line reading.
+ *
+ * @param p Path to file.
+ * @param ec Error code result of the open.
+ * @param buffer_size Internal buffer size.
+ * @return A reader for the file - exhausted (operator bool is @c false) on error.
+ */
+LineReader lines(path const &p, std::error_code &ec, size_t buffer_size = LineReader::DEFAULT_BUFFER_SIZE);
+
+/// Result of loading one file in a batch - see @c load_many.
+struct load_result {
+  path _path;           ///< Path to the file.
+  std::string _content; ///< Content of the file - empty on error.
+  std::error_code _ec;  ///< Result of the file operations.
+};
+
+/** Load a batch of files, overlapping the reads.
+ *
+ * @param paths Paths of the files to load.
+ * @param n_threads Maximum number of concurrent reads - 0 means hardware concurrency.
+ * @return One result per path, in the same order as @a paths.
+ *
+ * Each file is loaded as by @c load. The reads are spread over a temporary set of threads so
+ * the per file latencies overlap instead of accumulating - for a batch of cold files this
+ * reduces the total time to roughly that of the slowest file. A failed file is reported in
+ * its result, it does not affect the other loads.
+ */
+std::vector<load_result> load_many(MemSpan<path const> paths, unsigned n_threads = 0);
+
+/** Load a batch of files, delivering each result as it completes.
+ *
+ * @param paths Paths of the files to load.
+ * @param cb Callback invoked once per file.
+ * @param n_threads Maximum number of concurrent reads - 0 means hardware concurrency.
+ *
+ * As the overload returning a vector, except results are passed to @a cb in completion order
+ * so processing can start before the whole batch has finished. Invocations of @a cb are
+ * serialized - it does not need to be thread safe - but occur on the loading threads.
+ */
+void load_many(MemSpan<path const> paths, std::function<void(load_result &&)> const &cb, unsigned n_threads = 0);
+
 /* ------------------------------------------------------------------- */
 
 inline path::path(char const *src) : _path(src) {}
@@ -530,6 +762,22 @@ inline file_time_type
 modify_time(file_status const &fs) {
   return last_write_time(fs);
 }
+
+inline LineReader::LineReader(TextView content) : _avail(content), _eof_p(true) {}
+
+inline LineReader::operator bool() const {
+  return !_avail.empty() || !_eof_p;
+}
+
+inline size_t
+LineReader::line_no() const {
+  return _line_no;
+}
+
+inline std::error_code
+LineReader::error() const {
+  return _ec;
+}
 } // namespace file
 
 class BufferWriter;
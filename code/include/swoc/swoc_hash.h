@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+  Fast hashing support.
+
+  This complements the FNV-1a hashers in "swoc/ext/HashFNV.h" with wider and hardware
+  accelerated hashes - CRC32C using the SSE4.2 instructions when the CPU supports them, and a
+  64 bit hash that consumes 8 bytes per iteration. The hashers here use the same register
+  style interface (@c update / @c final / @c get) as the FNV hashers so they can be dropped in
+  to the same policy hooks - @c Lexicon name policies, @c FlatHashOps, and hash map
+  descriptors.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include "swoc/swoc_version.h"
+#include "swoc/TextView.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace hash {
+
+/** Compute the CRC32C of @a data.
+ *
+ * @param data Input data.
+ * @param n Size of input data in bytes.
+ * @param seed Initial value, to chain over multiple buffers.
+ * @return The CRC value.
+ *
+ * This is the Castagnoli polynomial (iSCSI, ext4). The implementation is selected at process
+ * start - the SSE4.2 CRC instructions if the CPU has them, otherwise a table driven software
+ * computation. To chain, pass the CRC of the previous data as @a seed.
+ */
+uint32_t crc32c(void const *data, size_t n, uint32_t seed = 0);
+
+/// @return @c true if the hardware CRC32C implementation is in use.
+bool crc32c_hardware_p();
+
+namespace detail {
+/// CRC32C over @a data on raw internal state - no pre / post conditioning.
+/// Used to implement incremental hashing - use @c crc32c for normal computation.
+uint32_t crc32c_update(uint32_t state, void const *data, size_t n);
+} // namespace detail
+
+/** Compute a 64 bit hash of @a data.
+ *
+ * @param data Input data.
+ * @param n Size of input data in bytes.
+ * @param seed Seed to vary the hash.
+ * @return The hash value.
+ *
+ * The core loop consumes 8 bytes per iteration with a multiply / rotate mix and a final
+ * avalanche, in the style of the xx family - an order of magnitude fewer iterations than the
+ * byte at a time FNV for long keys. This is a fixed, stable function - values can be stored -
+ * but it is not cryptographic and not compatible with any external hash.
+ */
+inline uint64_t
+hash_64(void const *data, size_t n, uint64_t seed = 0) {
+  static constexpr uint64_t P1 = 0x9E3779B185EBCA87ull;
+  static constexpr uint64_t P2 = 0xC2B2AE3D27D4EB4Full;
+  static constexpr uint64_t P3 = 0x165667B19E3779F9ull;
+
+  auto rotl = [](uint64_t x, int r) -> uint64_t { return (x << r) | (x >> (64 - r)); };
+
+  auto p     = static_cast<unsigned char const *>(data);
+  auto limit = p + n;
+  uint64_t h = seed ^ (P3 + n); // length keyed so prefixes of zero don't collide.
+
+  while (limit - p >= 8) {
+    uint64_t w;
+    std::memcpy(&w, p, sizeof(w)); // unaligned safe load.
+    h  = rotl(h ^ (w * P2), 31) * P1;
+    p += 8;
+  }
+  if (limit - p >= 4) {
+    uint32_t w;
+    std::memcpy(&w, p, sizeof(w));
+    h  = rotl(h ^ (w * P1), 23) * P2;
+    p += 4;
+  }
+  while (p < limit) {
+    h = rotl(h ^ (*p++ * P3), 11) * P1;
+  }
+
+  h ^= h >> 33;
+  h *= P2;
+  h ^= h >> 29;
+  h *= P3;
+  h ^= h >> 32;
+  return h;
+}
+
+/** CRC32C hasher with the register style interface of the FNV hashers.
+ *
+ * Incremental - @c update can be called repeatedly, the result is the CRC of the
+ * concatenated data.
+ */
+struct HashCRC32C {
+protected:
+  using self_type                = HashCRC32C;
+  static constexpr uint32_t INIT = 0xFFFFFFFFu; ///< Raw initial state.
+
+public:
+  using value_type = uint32_t;
+
+  HashCRC32C() = default;
+
+  /** Update the hash value.
+   *
+   * @param data Input data to hash.
+   * @return @a this
+   */
+  self_type &
+  update(std::string_view const &data) {
+    _state = detail::crc32c_update(_state, data.data(), data.size());
+    return *this;
+  }
+
+  /** Update the hash value with case folded data.
+   *
+   * @param data Input data to hash.
+   * @return @a this
+   *
+   * Each character is folded to ASCII upper case as it is hashed - the input is not copied
+   * or modified. The result matches hashing the upper cased input.
+   */
+  self_type &
+  update_nocase(std::string_view data) {
+    char buff[256];
+    while (!data.empty()) {
+      size_t n = std::min(data.size(), sizeof(buff));
+      for (size_t idx = 0; idx < n; ++idx) {
+        char c    = data[idx];
+        buff[idx] = (c >= 'a' && c <= 'z') ? char(c - 0x20) : c;
+      }
+      _state = detail::crc32c_update(_state, buff, n);
+      data.remove_prefix(n);
+    }
+    return *this;
+  }
+
+  /// Finalize the hash value - no further updates are valid.
+  self_type &
+  final() {
+    return *this;
+  }
+
+  /// Return the hash value.
+  value_type
+  get() const {
+    return ~_state;
+  }
+
+  /// Re-initialize to default state.
+  self_type &
+  clear() {
+    _state = INIT;
+    return *this;
+  }
+
+  /// Update and finalize in one step.
+  value_type
+  hash_immediate(std::string_view const &data) {
+    return this->update(data).final().get();
+  }
+
+  /// Update and finalize with case folding in one step.
+  value_type
+  hash_nocase_immediate(std::string_view const &data) {
+    return this->update_nocase(data).final().get();
+  }
+
+private:
+  value_type _state{INIT}; ///< Raw (inverted) CRC state.
+};
+
+/** 64 bit wide block hasher.
+ *
+ * A thin functor over @c hash_64 for use in policy hooks. One shot only - the wide block
+ * mixing does not support incremental byte streams.
+ */
+struct Hash64Wide {
+  using value_type = uint64_t;
+
+  /// @return The hash of @a data.
+  value_type
+  hash_immediate(std::string_view const &data) const {
+    return hash_64(data.data(), data.size());
+  }
+
+  /// Functor form for allocator / container hash policies.
+  value_type
+  operator()(std::string_view const &data) const {
+    return hash_64(data.data(), data.size());
+  }
+};
+
+} // namespace hash
+}} // namespace swoc::SWOC_VERSION_NS
@@ -19,6 +19,10 @@
 #include "swoc/IPAddr.h"
 #include "swoc/IPSrv.h"
 #include "swoc/IPRange.h"
+#include "swoc/FlatIPSpace.h"
+#include "swoc/TrieIPSpace.h"
+#include "swoc/EpochIPSpace.h"
+#include "swoc/ColumnIPSpace.h"
 
 namespace swoc { inline namespace SWOC_VERSION_NS {
 
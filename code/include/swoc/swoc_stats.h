@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+  Internal instrumentation - event counters and USDT probe points.
+
+  This is a zero cost surface by default - all hooks compile to nothing unless
+  @c SWOC_ENABLE_INSTRUMENTATION is defined non-zero for the entire build (the CMake option
+  @c LIBSWOC_INSTRUMENT does this). When enabled, hot path events (arena block allocation,
+  hash table expansion, fixed arena element allocation, buffer writer truncation) bump process
+  wide relaxed atomic counters which can be scraped with @c swoc::stats::snapshot, and emit
+  SystemTap / USDT probes (provider "libswoc") when <sys/sdt.h> is available.
+
+  @note The macro must agree across every translation unit, including the library itself -
+  enable it for the whole build, not per file.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstdint>
+
+#include "swoc/swoc_version.h"
+#include "swoc/bwf_fwd.h"
+
+#if !defined(SWOC_ENABLE_INSTRUMENTATION)
+#define SWOC_ENABLE_INSTRUMENTATION 0
+#endif
+
+// USDT probes - available only with instrumentation on and the SDT header present.
+#if SWOC_ENABLE_INSTRUMENTATION && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define SWOC_HAS_SDT 1
+#endif
+#endif
+#if !defined(SWOC_HAS_SDT)
+#define SWOC_HAS_SDT 0
+#endif
+
+#if SWOC_HAS_SDT
+#define SWOC_PROBE(name)          DTRACE_PROBE(libswoc, name)
+#define SWOC_PROBE1(name, a1)     DTRACE_PROBE1(libswoc, name, a1)
+#define SWOC_PROBE2(name, a1, a2) DTRACE_PROBE2(libswoc, name, a1, a2)
+#else
+// Arguments are not evaluated - probe call sites must be side effect free.
+#define SWOC_PROBE(name)          ((void)0)
+#define SWOC_PROBE1(name, a1)     ((void)0)
+#define SWOC_PROBE2(name, a1, a2) ((void)0)
+#endif
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace stats {
+
+/// Cache line size assumed for cell padding.
+static constexpr size_t CACHE_LINE_SIZE = 64;
+
+/** Stable small index for the calling thread.
+ *
+ * @return An index assigned on first call from each thread, in creation order.
+ *
+ * This is used to stripe threads over statistic cells. It approximates a core index - with
+ * pinned or long lived threads each active thread gets a private cell (modulo the cell count)
+ * without any platform specific core query on the hot path.
+ */
+inline unsigned
+thread_index() {
+  static std::atomic<unsigned> source{0};
+  thread_local unsigned idx = source.fetch_add(1, std::memory_order_relaxed);
+  return idx;
+}
+
+/** Wait free event counter.
+ *
+ * The count is striped over cache line padded cells, one atomic per line, with each thread
+ * incrementing its own cell with a relaxed add - no line ever bounces between cores on the
+ * write path. Reading folds the cells, making reads the expensive operation, which is the
+ * correct trade for a counter incremented millions of times per second and scraped every few
+ * seconds.
+ *
+ * The folded value is exact for quiesced threads and at worst momentarily stale for active
+ * ones - the usual semantics for statistics.
+ */
+class Counter {
+  using self_type = Counter; ///< Self reference type.
+
+public:
+  /// Number of count cells - a power of 2.
+  static constexpr unsigned N_CELLS = 16;
+
+  Counter() = default;
+  Counter(self_type const &)              = delete;
+  self_type &operator=(self_type const &) = delete;
+
+  /// Add @a n to the count.
+  void
+  inc(uint64_t n = 1) {
+    _cells[thread_index() & (N_CELLS - 1)]._value.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  /// Increment the count.
+  self_type &
+  operator++() {
+    this->inc();
+    return *this;
+  }
+
+  /// Add @a n to the count.
+  self_type &
+  operator+=(uint64_t n) {
+    this->inc(n);
+    return *this;
+  }
+
+  /// @return The folded count over all cells.
+  uint64_t
+  load() const {
+    uint64_t zret = 0;
+    for (auto const &cell : _cells) {
+      zret += cell._value.load(std::memory_order_relaxed);
+    }
+    return zret;
+  }
+
+protected:
+  /// A count cell - padded so adjacent cells never share a line.
+  struct alignas(CACHE_LINE_SIZE) Cell {
+    std::atomic<uint64_t> _value{0}; ///< Cell count.
+  };
+
+  std::array<Cell, N_CELLS> _cells; ///< The striped count.
+};
+
+/** Wait free log-linear histogram.
+ *
+ * Samples are recorded by bucket, each power of 2 range ("octave") being split in to
+ * @c N_LINEAR linear sub buckets - the classic log-linear layout, giving a relative value
+ * error bounded by 1/N_LINEAR across the full @c uint64_t range in a fixed 252 buckets.
+ * Recording is a relaxed add in a per thread cell, as with @c Counter - no contention and
+ * no allocation.
+ *
+ * Reading folds the cells in to a @c Data which provides totals and approximate quantiles,
+ * and can be formatted directly via @c bwformat.
+ */
+class Histogram {
+  using self_type = Histogram; ///< Self reference type.
+
+public:
+  static constexpr unsigned SUB_BITS = 2;              ///< log2 of linear sub buckets per octave.
+  static constexpr unsigned N_LINEAR = 1 << SUB_BITS;  ///< Linear sub buckets per octave.
+  /// Total bucket count covering all of @c uint64_t.
+  static constexpr unsigned N_BUCKETS = N_LINEAR * (64 - SUB_BITS + 1);
+  /// Number of bucket array cells - a power of 2, fewer than @c Counter as each cell is large.
+  static constexpr unsigned N_CELLS = 8;
+
+  /// Folded histogram contents.
+  struct Data {
+    std::array<uint64_t, N_BUCKETS> _count{}; ///< Samples per bucket.
+
+    /// @return The total number of samples.
+    uint64_t
+    count() const {
+      uint64_t zret = 0;
+      for (auto n : _count) {
+        zret += n;
+      }
+      return zret;
+    }
+
+    /** Approximate quantile.
+     *
+     * @param q Quantile in [0, 1].
+     * @return The lower bound of the bucket containing the @a q quantile sample.
+     */
+    uint64_t
+    quantile(double q) const {
+      uint64_t total = this->count();
+      if (0 == total) {
+        return 0;
+      }
+      auto target  = uint64_t(q * double(total));
+      uint64_t cum = 0;
+      for (unsigned idx = 0; idx < N_BUCKETS; ++idx) {
+        cum += _count[idx];
+        if (cum > target) {
+          return bucket_min(idx);
+        }
+      }
+      return bucket_min(N_BUCKETS - 1);
+    }
+  };
+
+  Histogram() = default;
+  Histogram(self_type const &)            = delete;
+  self_type &operator=(self_type const &) = delete;
+
+  /// Record @a n samples of @a value.
+  void
+  record(uint64_t value, uint64_t n = 1) {
+    _cells[thread_index() & (N_CELLS - 1)]._count[bucket_of(value)].fetch_add(n, std::memory_order_relaxed);
+  }
+
+  /// @return The folded contents of all cells.
+  Data
+  fold() const {
+    Data zret;
+    for (auto const &cell : _cells) {
+      for (unsigned idx = 0; idx < N_BUCKETS; ++idx) {
+        zret._count[idx] += cell._count[idx].load(std::memory_order_relaxed);
+      }
+    }
+    return zret;
+  }
+
+  /// @return The bucket index for @a value.
+  static unsigned
+  bucket_of(uint64_t value) {
+    if (value < N_LINEAR) {
+      return unsigned(value);
+    }
+    unsigned g = (63 - __builtin_clzll(value)) - SUB_BITS; // octave, offset by the linear prefix.
+    return N_LINEAR + g * N_LINEAR + unsigned((value >> g) & (N_LINEAR - 1));
+  }
+
+  /// @return The smallest value recorded in bucket @a idx.
+  static uint64_t
+  bucket_min(unsigned idx) {
+    if (idx < N_LINEAR) {
+      return idx;
+    }
+    unsigned g   = (idx - N_LINEAR) / N_LINEAR;
+    unsigned sub = (idx - N_LINEAR) % N_LINEAR;
+    return uint64_t(N_LINEAR + sub) << g;
+  }
+
+protected:
+  /// A bucket array cell - padded so cells never share a line.
+  struct alignas(CACHE_LINE_SIZE) Cell {
+    std::array<std::atomic<uint64_t>, N_BUCKETS> _count{}; ///< Samples per bucket.
+  };
+
+  std::array<Cell, N_CELLS> _cells; ///< The striped buckets.
+};
+
+} // namespace stats
+
+/** Format @a h - each non-empty bucket as "min-max: count", space separated.
+ *
+ * The folded data is formatted; an empty histogram produces no output.
+ */
+BufferWriter &bwformat(BufferWriter &w, bwf::Spec const &spec, stats::Histogram const &h);
+
+namespace stats {
+
+/** Snapshot of the library event counters.
+ *
+ * All counters are process wide and monotonic - rates are computed by differencing
+ * snapshots. All values are zero if instrumentation is compiled out.
+ */
+struct Snapshot {
+  uint64_t _arena_block_alloc = 0; ///< @c MemArena blocks allocated from the system.
+  uint64_t _hash_map_expand   = 0; ///< @c IntrusiveHashMap bucket table expansions.
+  uint64_t _fixed_arena_alloc = 0; ///< @c FixedArena elements allocated fresh (not free list reuse) - DiscreteSpace nodes flow through this.
+  uint64_t _buffer_truncate   = 0; ///< @c BufferWriter writes that discarded data (excluding sizing writers).
+};
+
+#if SWOC_ENABLE_INSTRUMENTATION
+
+namespace detail {
+/// The live counters. Striped relaxed increments - the counters are statistics, not synchronization.
+struct Counters {
+  Counter _arena_block_alloc;
+  Counter _hash_map_expand;
+  Counter _fixed_arena_alloc;
+  Counter _buffer_truncate;
+};
+
+/// Process wide counter instance.
+inline Counters Instance;
+} // namespace detail
+
+#endif // SWOC_ENABLE_INSTRUMENTATION
+
+/** Scrape the current counter values.
+ *
+ * @return A snapshot of the counters - all zero if instrumentation is compiled out.
+ */
+inline Snapshot
+snapshot() {
+#if SWOC_ENABLE_INSTRUMENTATION
+  Snapshot s;
+  s._arena_block_alloc = detail::Instance._arena_block_alloc.load();
+  s._hash_map_expand   = detail::Instance._hash_map_expand.load();
+  s._fixed_arena_alloc = detail::Instance._fixed_arena_alloc.load();
+  s._buffer_truncate   = detail::Instance._buffer_truncate.load();
+  return s;
+#else
+  return {};
+#endif
+}
+
+} // namespace stats
+}} // namespace swoc::SWOC_VERSION_NS
+
+/// Bump a counter - @a member is a member of @c stats::detail::Counters.
+#if SWOC_ENABLE_INSTRUMENTATION
+#define SWOC_STAT_INC(member) (swoc::stats::detail::Instance.member.inc())
+#else
+#define SWOC_STAT_INC(member) ((void)0)
+#endif
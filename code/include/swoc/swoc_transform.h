@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    Composable lazy text transforms.
+
+    These provide transformed views of a @c TextView - lower cased, percent decoded, trimmed -
+    without materializing the transformed text. Each transform is a small wrapper that streams
+    the transformed text in chunks to a sink callable. Overloads of @c bwformat consume the
+    transforms directly so they can be used as formatting arguments, and @c hash_update feeds
+    them to any incremental hasher, in both cases without a scratch copy of the full text.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <string_view>
+
+#include "swoc/swoc_version.h"
+#include "swoc/TextView.h"
+#include "swoc/bwf_base.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace transforms {
+
+namespace detail {
+/// Numeric value of a hexadecimal digit - the caller must have verified @c isxdigit.
+inline unsigned
+hex_value(char c) {
+  return isdigit(uint8_t(c)) ? c - '0' : tolower(uint8_t(c)) - 'a' + 10;
+}
+} // namespace detail
+
+/** Lazily lower cased view.
+ *
+ * The source text is streamed through a small stack buffer - the full text is never copied.
+ */
+struct Lower {
+  TextView _src; ///< Source text.
+
+  /** Stream the transformed text to @a sink.
+   *
+   * @param sink Callable taking a @c TextView chunk.
+   */
+  template <typename SINK>
+  void
+  operator()(SINK &&sink) const {
+    char buff[256];
+    TextView src{_src};
+    while (!src.empty()) {
+      size_t n = std::min(src.size(), sizeof(buff));
+      for (size_t idx = 0; idx < n; ++idx) {
+        buff[idx] = char(tolower(uint8_t(src[idx])));
+      }
+      sink(TextView{buff, n});
+      src.remove_prefix(n);
+    }
+  }
+};
+
+/** Lazily percent decoded view.
+ *
+ * Literal runs between escapes are passed through zero copy - only the escape bytes are
+ * synthesized. An invalid escape (not followed by two hexadecimal digits) is passed through
+ * literally.
+ */
+struct PercentDecode {
+  TextView _src; ///< Source text.
+
+  /** Stream the transformed text to @a sink.
+   *
+   * @param sink Callable taking a @c TextView chunk.
+   */
+  template <typename SINK>
+  void
+  operator()(SINK &&sink) const {
+    TextView src{_src};
+    while (!src.empty()) {
+      if ('%' == src[0] && src.size() >= 3 && isxdigit(uint8_t(src[1])) && isxdigit(uint8_t(src[2]))) {
+        char c = char(detail::hex_value(src[1]) * 16 + detail::hex_value(src[2]));
+        sink(TextView{&c, 1});
+        src.remove_prefix(3);
+      } else { // literal run up to the next escape candidate.
+        auto idx = src.find('%', 1);
+        auto n   = (idx == TextView::npos) ? src.size() : idx;
+        sink(src.prefix(n));
+        src.remove_prefix(n);
+      }
+    }
+  }
+};
+
+/// @return A lazily lower cased view of @a tv.
+inline Lower
+lower(TextView tv) {
+  return {tv};
+}
+
+/// @return A lazily percent decoded view of @a tv.
+inline PercentDecode
+percent_decode(TextView tv) {
+  return {tv};
+}
+
+/** Trim whitespace from both ends of @a tv.
+ *
+ * @return The trimmed view.
+ *
+ * Trimming is pure view arithmetic and therefore already zero copy - this returns a plain
+ * @c TextView usable anywhere.
+ */
+inline TextView
+trim(TextView tv) {
+  return tv.trim_if([](char c) { return 0 != isspace(uint8_t(c)); });
+}
+
+/** Feed a lazy transform to an incremental hasher.
+ *
+ * @param hasher Hasher with an <tt>update(std::string_view)</tt> method.
+ * @param xf The transform to hash.
+ * @return @a hasher
+ *
+ * The transformed text is hashed chunk wise - it is never materialized.
+ */
+template <typename HASH, typename XF>
+HASH &
+hash_update(HASH &hasher, XF const &xf) {
+  xf([&hasher](TextView chunk) { hasher.update(std::string_view(chunk)); });
+  return hasher;
+}
+
+} // namespace transforms
+
+/** Stream a lower cased view to @a w.
+ *
+ * @param w Output.
+ * @param item Transform wrapper.
+ * @return @a w
+ *
+ * @note The format specifier is ignored - the transformed length is not known in advance.
+ */
+inline BufferWriter &
+bwformat(BufferWriter &w, bwf::Spec const &, transforms::Lower const &item) {
+  item([&w](TextView chunk) { w.write(chunk); });
+  return w;
+}
+
+/** Stream a percent decoded view to @a w.
+ *
+ * @param w Output.
+ * @param item Transform wrapper.
+ * @return @a w
+ *
+ * @note The format specifier is ignored - the transformed length is not known in advance.
+ */
+inline BufferWriter &
+bwformat(BufferWriter &w, bwf::Spec const &, transforms::PercentDecode const &item) {
+  item([&w](TextView chunk) { w.write(chunk); });
+  return w;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
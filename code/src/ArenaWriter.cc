@@ -4,6 +4,10 @@
  * @c BufferWriter for a @c MemArena.
  */
 
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+
 #include "swoc/ArenaWriter.h"
 
 namespace swoc { inline namespace SWOC_VERSION_NS {
@@ -37,11 +41,109 @@ ArenaWriter::commit(size_t n) {
 
 void
 ArenaWriter::realloc(size_t n) {
-  auto text                    = this->view(); // Current data.
-  auto span                    = _arena.require(n).remnant().rebind<char>();
+  auto text = this->view(); // Current data.
+  // Grow geometrically - the accumulated output is copied on every overflow, so growing by only
+  // the requested amount makes repeated overflow quadratic in bytes copied.
+  auto span                    = _arena.require(std::max(n, 2 * _capacity)).remnant().rebind<char>();
   const_cast<char *&>(_buffer) = span.data();
   _capacity                    = span.size();
   memcpy(_buffer, text.data(), text.size());
 }
 
+// --- ChunkedArenaWriter ---
+
+void
+ChunkedArenaWriter::append(char const *data, size_t n) {
+  if (!_chunks.empty()) {
+    auto &last = _chunks.back();
+    if (last.data_end() == data) {
+      last = {last.data(), last.size() + n};
+      return;
+    }
+  }
+  _chunks.push_back({data, n});
+}
+
+void
+ChunkedArenaWriter::expand(size_t n) {
+  _arena.require(std::max(n, _next_reserve));
+  _next_reserve *= 2;
+}
+
+auto
+ChunkedArenaWriter::write(void const *data, size_t length) -> self_type & {
+  if (0 == length) {
+    return *this;
+  }
+  if (length > _arena.remaining()) {
+    this->expand(length);
+  }
+  auto span = _arena.remnant().rebind<char>();
+  memcpy(span.data(), data, length);
+  _arena.alloc(length);
+  this->append(span.data(), length);
+  _extent += length;
+  return *this;
+}
+
+bool
+ChunkedArenaWriter::commit(size_t n) {
+  if (0 == n) {
+    return true;
+  }
+  if (n <= _arena.remaining()) {
+    auto span = _arena.alloc(n).rebind<char>();
+    this->append(span.data(), n);
+    _extent += n;
+    return true;
+  }
+  this->expand(n); // increase capacity and have the caller retry.
+  return false;
+}
+
+auto
+ChunkedArenaWriter::discard(size_t n) -> self_type & {
+  n = std::min(n, _extent);
+  _extent -= n;
+  while (n > 0 && !_chunks.empty()) {
+    auto &last = _chunks.back();
+    if (last.size() > n) {
+      last = {last.data(), last.size() - n};
+      n    = 0;
+    } else {
+      n -= last.size();
+      _chunks.pop_back();
+    }
+  }
+  return *this;
+}
+
+auto
+ChunkedArenaWriter::copy(size_t, size_t, size_t) -> self_type & {
+  throw std::runtime_error("ChunkedArenaWriter does not support copy");
+}
+
+std::ostream &
+ChunkedArenaWriter::operator>>(std::ostream &stream) const {
+  for (auto const &chunk : _chunks) {
+    stream.write(chunk.data(), chunk.size());
+  }
+  return stream;
+}
+
+MemSpan<char const>
+ChunkedArenaWriter::assemble() {
+  if (_chunks.size() <= 1) {
+    return _chunks.empty() ? MemSpan<char const>{} : _chunks.front();
+  }
+  auto span = _arena.alloc(_extent).rebind<char>();
+  char *out = span.data();
+  for (auto const &chunk : _chunks) {
+    memcpy(out, chunk.data(), chunk.size());
+    out += chunk.size();
+  }
+  _chunks.assign(1, {span.data(), span.size()});
+  return _chunks.front();
+}
+
 }} // namespace swoc::SWOC_VERSION_NS
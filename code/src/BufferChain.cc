@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+ * Buffer chain (rope) @c BufferWriter.
+ */
+
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+
+#include "swoc/BufferChain.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+BufferChain::BufferChain(size_t block_size)
+  : _block_size(block_size), _arena(ArenaPool::make(block_size + sizeof(Block))) {}
+
+BufferChain::~BufferChain() {
+  _blocks.clear(); // blocks live in the arenas.
+  for (auto &arena : _donors) {
+    ArenaPool::retire(std::move(arena));
+  }
+  ArenaPool::retire(std::move(_arena));
+}
+
+auto
+BufferChain::writable_block() -> Block * {
+  Block *b = _blocks.tail();
+  if (nullptr == b || 0 == b->remaining()) {
+    b         = _arena.make<Block>();
+    b->_space = _arena.alloc_span<char>(_block_size);
+    _blocks.append(b);
+  }
+  return b;
+}
+
+auto
+BufferChain::write(void const *data, size_t length) -> self_type & {
+  auto src = static_cast<char const *>(data);
+  while (length > 0) {
+    Block *b = this->writable_block();
+    size_t n = std::min(length, b->remaining());
+    memcpy(b->_space.data() + b->_size, src, n);
+    b->_size += n;
+    src      += n;
+    length   -= n;
+    _extent  += n;
+  }
+  return *this;
+}
+
+char *
+BufferChain::aux_data() {
+  // No allocation here - callers pair this with @c remaining, which must agree. A full (or
+  // absent) tail block reports no space; @c commit opens a fresh block and requests a retry.
+  Block *b = _blocks.tail();
+  return (b && b->remaining() > 0) ? b->_space.data() + b->_size : nullptr;
+}
+
+size_t
+BufferChain::capacity() const {
+  Block const *b = _blocks.tail();
+  size_t avail   = b ? b->remaining() : 0;
+  return _extent + (avail > _restricted ? avail - _restricted : 0);
+}
+
+bool
+BufferChain::commit(size_t n) {
+  if (0 == n) {
+    return true;
+  }
+  Block *b = _blocks.tail();
+  if (b && b->remaining() >= n) {
+    b->_size += n;
+    _extent  += n;
+    return true;
+  }
+  this->writable_block(); // open a fresh block and have the caller retry.
+  return false;
+}
+
+auto
+BufferChain::discard(size_t n) -> self_type & {
+  n        = std::min(n, _extent);
+  _extent -= n;
+  while (n > 0) {
+    Block *b = _blocks.tail(); // must exist - @a n is clipped to the extent.
+    if (b->_size > n) {
+      b->_size -= n;
+      n         = 0;
+    } else {
+      n -= b->_size;
+      _blocks.erase(b);
+    }
+  }
+  return *this;
+}
+
+auto
+BufferChain::copy(size_t, size_t, size_t) -> self_type & {
+  throw std::runtime_error("BufferChain does not support copy");
+}
+
+std::ostream &
+BufferChain::operator>>(std::ostream &stream) const {
+  for (auto const &b : _blocks) {
+    stream.write(b._space.data(), b._size);
+  }
+  return stream;
+}
+
+size_t
+BufferChain::fill_iov(MemSpan<struct iovec> iov) const {
+  size_t idx = 0;
+  for (auto const &b : _blocks) {
+    if (idx >= iov.count()) {
+      break;
+    }
+    iov[idx].iov_base = const_cast<char *>(b._space.data());
+    iov[idx].iov_len  = b._size;
+    ++idx;
+  }
+  return idx;
+}
+
+auto
+BufferChain::append(self_type &&that) -> self_type & {
+  if (&that != this) {
+    _extent += that._extent;
+    _blocks.append(std::move(that._blocks));
+    _donors.push_back(std::move(that._arena));
+    for (auto &arena : that._donors) {
+      _donors.push_back(std::move(arena));
+    }
+    that._donors.clear();
+    that._extent     = 0;
+    that._restricted = 0;
+  }
+  return *this;
+}
+
+void
+BufferChain::clear() {
+  _blocks.clear();
+  for (auto &arena : _donors) {
+    ArenaPool::retire(std::move(arena));
+  }
+  _donors.clear();
+  _arena.clear();
+  _extent     = 0;
+  _restricted = 0;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
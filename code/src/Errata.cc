@@ -8,8 +8,14 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <memory.h>
 #include "swoc/Errata.h"
+#include "swoc/IntrusiveMPSCQueue.h"
 #include "swoc/bwf_ex.h"
 #include "swoc/bwf_std.h"
 
@@ -23,7 +29,50 @@ namespace swoc { inline namespace SWOC_VERSION_NS {
  */
 namespace {
 std::vector<Errata::Sink::Handle> Sink_List;
+
+/// Queue node for asynchronous sink delivery.
+struct AsyncErrata {
+  AsyncErrata *_next = nullptr; ///< Forward link.
+  AsyncErrata *_prev = nullptr; ///< Backward link.
+  Errata _errata;               ///< The payload.
+
+  AsyncErrata(Errata &&e) : _errata(std::move(e)) {}
+
+  /// Linkage for the queue.
+  using Linkage = swoc::IntrusiveLinkage<AsyncErrata>;
+};
+
+IntrusiveMPSCQueue<AsyncErrata::Linkage> Async_Queue; ///< Erratum awaiting delivery.
+std::atomic<bool> Async_Enabled{false};               ///< Queue erratum instead of sinking in thread?
+Errata::Severity Async_Bypass{0};                     ///< Severity at which to bypass the queue.
+std::thread Async_Thread;                             ///< Background drain thread.
+std::mutex Async_Mutex;                               ///< Guards thread start / stop and the wait.
+std::condition_variable Async_CV;                     ///< Wakes the drain thread.
+bool Async_Shutdown = false;                          ///< Drain thread exit flag.
+thread_local bool Async_Drain_P = false;              ///< Set in the drain thread so its sinking is direct.
+
+/// Drain thread - deliver queued erratum to the sinks until shut down.
+void
+async_drain() {
+  Async_Drain_P = true; // sink() in this thread delivers directly.
+  auto deliver  = []() {
+    auto batch = Async_Queue.take_all();
+    while (AsyncErrata *n = batch.take_head()) {
+      n->_errata.sink();
+      delete n;
+    }
+  };
+  std::unique_lock<std::mutex> lock(Async_Mutex);
+  while (!Async_Shutdown) {
+    Async_CV.wait_for(lock, std::chrono::milliseconds(100));
+    lock.unlock();
+    deliver();
+    lock.lock();
+  }
+  lock.unlock();
+  deliver(); // final drain - producers are synchronous again by now.
 }
+} // namespace
 
 string_view
 Errata::Data::localize(string_view src) {
@@ -38,6 +87,10 @@ Errata::Data::localize(string_view src) {
 Errata::Severity Errata::DEFAULT_SEVERITY(2);
 Errata::Severity Errata::FAILURE_SEVERITY(2);
 Errata::Severity Errata::FILTER_SEVERITY(0);
+Errata::Severity Errata::SINK_SEVERITY(0);
+
+// The success / empty representation must stay allocation free and cheap to move.
+static_assert(sizeof(Errata) <= 2 * sizeof(void *), "Errata must fit in two machine words.");
 
 /// Default set of severity names.
 std::array<swoc::TextView, 3> Severity_Names{
@@ -52,7 +105,13 @@ Errata::~Errata() {
 
 Errata &
 Errata::sink() {
-  if (_data) {
+  if (_data || _severity.has_value()) {
+    if (Async_Enabled.load(std::memory_order_acquire) && !Async_Drain_P && this->severity() < Async_Bypass) {
+      Async_Queue.push(new AsyncErrata(std::move(*this))); // move leaves @a this empty.
+      Async_CV.notify_one();
+      return *this;
+    }
+    this->materialize();
     for (auto &f : Sink_List) {
       (*f)(*this);
     }
@@ -61,11 +120,40 @@ Errata::sink() {
   return *this;
 }
 
+Errata const &
+Errata::materialize() const {
+  if (_data && _data->_deferred_p && this->severity() >= SINK_SEVERITY) {
+    for (auto &note : _data->_notes) {
+      if (note._fmt) {
+        auto span = _data->remnant();
+        FixedBufferWriter bw{span};
+        if (!note._formatter(bw, *note._fmt, note._args.data()).error()) {
+          span = span.prefix(bw.extent());
+          _data->alloc(bw.extent()); // require the part of the remnant actually used.
+        } else {
+          // Not enough space, get a big enough chunk and do it again.
+          span = _data->alloc(bw.extent());
+          FixedBufferWriter fbw{span};
+          note._formatter(fbw, *note._fmt, note._args.data());
+        }
+        note._text      = TextView(span);
+        note._fmt       = nullptr;
+        note._formatter = nullptr;
+        note._args      = MemSpan<void const>{};
+      }
+    }
+    _data->_deferred_p = false;
+  }
+  return *this;
+}
+
 Errata::Data *
 Errata::data() {
   if (!_data) {
-    MemArena arena{512}; // POOMA value, seems reasonable.
-    _data = arena.make<Data>(std::move(arena));
+    // Draw from the block pool - at high error rates the annotation storage is recycled
+    // rather than round tripping through the system allocator.
+    auto arena = ArenaPool::make(512); // POOMA value, seems reasonable.
+    _data      = arena.make<Data>(std::move(arena));
   }
   return _data;
 }
@@ -98,13 +186,22 @@ Errata::note_localized(std::string_view const &text, std::optional<Severity> sev
 
 Errata &
 Errata::note(const self_type &that) {
+  if (that.has_severity()) {
+    this->update(that.severity());
+  }
   if (that._data) {
     auto d = this->data();
-    if (that.has_severity()) {
-      this->update(that.severity());
-    }
     for (auto const &annotation : that) {
-      d->_notes.append(d->_arena.make<Annotation>(d->localize(annotation._text), annotation._severity, annotation._level + 1));
+      auto *n = d->_arena.make<Annotation>(d->localize(annotation._text), annotation._severity, annotation._level + 1);
+      if (annotation._fmt) { // deferred - the format is external and stable, localize the arguments.
+        auto span = d->_arena.alloc(annotation._args.size(), alignof(std::max_align_t));
+        memcpy(span.data(), annotation._args.data(), annotation._args.size());
+        n->_fmt        = annotation._fmt;
+        n->_formatter  = annotation._formatter;
+        n->_args       = span;
+        d->_deferred_p = true;
+      }
+      d->_notes.append(n);
     }
   }
   return *this;
@@ -112,8 +209,8 @@ Errata::note(const self_type &that) {
 
 auto
 Errata::update(Severity severity) -> self_type & {
-  if (!_data || !_data->_severity.has_value() || _data->_severity.value() < severity) {
-    this->assign(severity);
+  if (!_severity.has_value() || _severity.value() < severity) {
+    _severity = severity;
   }
   return *this;
 }
@@ -123,6 +220,32 @@ Errata::register_sink(Sink::Handle const &s) {
   Sink_List.push_back(s);
 }
 
+void
+Errata::enable_async_sink(Severity bypass) {
+  std::lock_guard<std::mutex> lock(Async_Mutex);
+  Async_Bypass = bypass;
+  if (!Async_Enabled.load(std::memory_order_relaxed)) {
+    Async_Shutdown = false;
+    Async_Thread   = std::thread(&async_drain);
+    Async_Enabled.store(true, std::memory_order_release);
+  }
+}
+
+void
+Errata::disable_async_sink() {
+  std::thread drainer;
+  {
+    std::lock_guard<std::mutex> lock(Async_Mutex);
+    if (!Async_Enabled.exchange(false, std::memory_order_acq_rel)) {
+      return;
+    }
+    Async_Shutdown = true;
+    drainer        = std::move(Async_Thread);
+  }
+  Async_CV.notify_one();
+  drainer.join(); // final drain happens on the way out.
+}
+
 BufferWriter &
 bwformat(BufferWriter &bw, bwf::Spec const &spec, Errata::Severity level) {
   if (level < Errata::SEVERITY_NAMES.size()) {
@@ -137,6 +260,8 @@ BufferWriter &
 bwformat(BufferWriter &bw, bwf::Spec const &, Errata const &errata) {
   bwf::Format const code_fmt{"[{0:s} {0:d}] "};
 
+  errata.materialize();
+
   if (errata.has_severity()) {
     bw.print("{}{}", errata.severity(), errata.severity_glue_text());
   }
@@ -162,6 +287,146 @@ bwformat(BufferWriter &bw, bwf::Spec const &, Errata const &errata) {
   return bw;
 }
 
+namespace errata {
+namespace {
+
+/// Write @a text to @a w with JSON string escaping, no intermediate buffer.
+void
+json_escape(BufferWriter &w, TextView text) {
+  static constexpr char HEX[] = "0123456789abcdef";
+  while (text) {
+    size_t idx = 0; // find the literal run - written as a single chunk.
+    while (idx < text.size() && '"' != text[idx] && '\\' != text[idx] && uint8_t(text[idx]) >= 0x20) {
+      ++idx;
+    }
+    w.write(text.data(), idx);
+    text.remove_prefix(idx);
+    if (text) {
+      char c = text.front();
+      text.remove_prefix(1);
+      switch (c) {
+      case '"':
+        w.write("\\\"");
+        break;
+      case '\\':
+        w.write("\\\\");
+        break;
+      case '\n':
+        w.write("\\n");
+        break;
+      case '\t':
+        w.write("\\t");
+        break;
+      case '\r':
+        w.write("\\r");
+        break;
+      case '\b':
+        w.write("\\b");
+        break;
+      case '\f':
+        w.write("\\f");
+        break;
+      default:
+        w.write("\\u00");
+        w.write(HEX[(c >> 4) & 0xF]);
+        w.write(HEX[c & 0xF]);
+        break;
+      }
+    }
+  }
+}
+
+/// @return @c true if @a note should be serialized.
+bool
+note_included(Errata::Annotation const &note, Errata::Severity note_min) {
+  return note.text() && (!note.has_severity() || note.severity() >= note_min);
+}
+
+} // namespace
+
+BufferWriter &
+to_json(BufferWriter &w, Errata const &errata, Errata::Severity note_min) {
+  errata.materialize();
+  w.write('{');
+  bool comma = false;
+  if (errata.has_severity()) {
+    w.write(R"("severity":")");
+    bwformat(w, bwf::Spec::DEFAULT, errata.severity());
+    w.write('"');
+    comma = true;
+  }
+  if (errata.code()) {
+    if (comma) {
+      w.write(',');
+    }
+    w.print(R"("code":{},"code_text":")", errata.code().value());
+    json_escape(w, errata.code().message());
+    w.write('"');
+    comma = true;
+  }
+  if (comma) {
+    w.write(',');
+  }
+  w.write(R"("notes":[)");
+  bool first = true;
+  for (auto const &note : errata) {
+    if (!note_included(note, note_min)) {
+      continue;
+    }
+    if (!first) {
+      w.write(',');
+    }
+    first = false;
+    w.print(R"({{"level":{})", note.level());
+    if (note.has_severity()) {
+      w.write(R"(,"severity":")");
+      bwformat(w, bwf::Spec::DEFAULT, note.severity());
+      w.write('"');
+    }
+    w.write(R"(,"text":")");
+    json_escape(w, note.text());
+    w.write(R"("})");
+  }
+  w.write("]}");
+  return w;
+}
+
+BufferWriter &
+to_logfmt(BufferWriter &w, Errata const &errata, Errata::Severity note_min) {
+  errata.materialize();
+  bool space = false;
+  if (errata.has_severity()) {
+    w.write("severity=");
+    bwformat(w, bwf::Spec::DEFAULT, errata.severity());
+    space = true;
+  }
+  if (errata.code()) {
+    if (space) {
+      w.write(' ');
+    }
+    w.print(R"(code={} code_text=")", errata.code().value());
+    json_escape(w, errata.code().message());
+    w.write('"');
+    space = true;
+  }
+  unsigned idx = 0;
+  for (auto const &note : errata) {
+    if (!note_included(note, note_min)) {
+      continue;
+    }
+    if (space) {
+      w.write(' ');
+    }
+    space = true;
+    w.print("note{}=\"", idx++);
+    json_escape(w, note.text());
+    w.write('"');
+  }
+  return w;
+}
+
+} // namespace errata
+
 std::ostream &
 Errata::write(std::ostream &out) const {
   std::string tmp;
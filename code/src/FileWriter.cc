@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   File descriptor sink implementation.
+ */
+
+#include <sys/uio.h>
+
+#include "swoc/FileWriter.h"
+#include "swoc/bwf_ex.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+FileWriter::FileWriter(file::unique_fd &&fd, size_t flush_size, size_t block_size)
+  : _fd(std::move(fd)), _chain(block_size), _flush_size(std::max<size_t>(flush_size, 1)) {}
+
+FileWriter::~FileWriter() {
+  this->flush();
+}
+
+auto
+FileWriter::write(void const *data, size_t length) -> self_type & {
+  _chain.write(data, length);
+  if (_chain.extent() >= _flush_size) {
+    this->flush();
+  }
+  return *this;
+}
+
+bool
+FileWriter::flush() {
+  if (0 == _chain.extent()) {
+    return true;
+  }
+  std::vector<struct iovec> iov(_chain.block_count());
+  size_t n   = _chain.fill_iov({iov.data(), iov.size()});
+  size_t idx = 0;
+  while (idx < n) {
+    auto rc = ::writev(_fd, &iov[idx], int(std::min<size_t>(n - idx, MAX_IOV)));
+    if (rc < 0) {
+      if (EINTR == errno) {
+        continue;
+      }
+      size_t remaining = 0;
+      for (size_t i = idx; i < n; ++i) {
+        remaining += iov[i].iov_len;
+      }
+      _errata.note("Flush of {} bytes failed - {}.", remaining, bwf::Errno{errno});
+      _error_p = true;
+      _chain.clear(); // drop what could not be written - keep memory bounded.
+      return false;
+    }
+    _flushed += rc;
+    // Advance past fully written elements, adjust a partially written one.
+    size_t written = size_t(rc);
+    while (idx < n && written >= iov[idx].iov_len) {
+      written -= iov[idx].iov_len;
+      ++idx;
+    }
+    if (idx < n && written > 0) {
+      iov[idx].iov_base = static_cast<char *>(iov[idx].iov_base) + written;
+      iov[idx].iov_len -= written;
+    }
+  }
+  _chain.clear();
+  return true;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   String interning table.
+ */
+
+#include <cstring>
+#include <stdexcept>
+
+#include "swoc/InternTable.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+InternTable::InternTable(size_t reserve) : _arena(reserve) {}
+
+TextView
+InternTable::intern(TextView const &text) {
+  if (_frozen_p) {
+    throw std::logic_error("InternTable: cannot intern in a frozen table");
+  }
+  if (auto spot = _table.find(std::string_view(text)); spot != _table.end()) {
+    ++spot->_refs;
+    return spot->view();
+  }
+  auto span  = _arena.alloc(sizeof(Item) + text.size(), alignof(Item)).rebind<char>();
+  auto *item = new (span.data()) Item;
+  item->_size = uint32_t(text.size());
+  item->_refs = 1;
+  memcpy(span.data() + sizeof(Item), text.data(), text.size());
+  _table.insert(item);
+  return item->view();
+}
+
+size_t
+InternTable::intern(MemSpan<TextView const> const &texts, MemSpan<TextView> const &views) {
+  size_t zret = 0;
+  size_t n    = std::min(texts.count(), views.count());
+  for (size_t idx = 0; idx < n; ++idx) {
+    size_t mark = _table.count();
+    views[idx]  = this->intern(texts[idx]);
+    zret += _table.count() - mark;
+  }
+  return zret;
+}
+
+TextView
+InternTable::find(TextView const &text) const {
+  if (auto spot = _table.find(std::string_view(text)); spot != _table.end()) {
+    return spot->view();
+  }
+  return {};
+}
+
+unsigned
+InternTable::release(TextView const &text) {
+  if (_frozen_p) {
+    throw std::logic_error("InternTable: cannot release in a frozen table");
+  }
+  if (auto spot = _table.find(std::string_view(text)); spot != _table.end()) {
+    if (--spot->_refs > 0) {
+      return spot->_refs;
+    }
+    _table.erase(spot); // arena storage is reclaimed only by @c clear.
+  }
+  return 0;
+}
+
+unsigned
+InternTable::ref_count(TextView const &text) const {
+  auto spot = _table.find(std::string_view(text));
+  return spot != _table.end() ? spot->_refs : 0;
+}
+
+void
+InternTable::clear() {
+  _table.clear();
+  _arena.clear();
+  _frozen_p = false;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
+
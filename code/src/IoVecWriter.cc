@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+ * Scatter/gather @c BufferWriter.
+ */
+
+#include <limits.h>
+
+#include <ostream>
+
+#include "swoc/IoVecWriter.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+void
+IoVecWriter::append(void const *data, size_t n) {
+  if (!_iov.empty()) {
+    auto &last = _iov.back();
+    if (static_cast<char *>(last.iov_base) + last.iov_len == data) {
+      last.iov_len += n;
+      return;
+    }
+  }
+  _iov.push_back(iovec{const_cast<void *>(data), n});
+}
+
+IoVecWriter &
+IoVecWriter::write(void const *data, size_t length) {
+  if (0 == length) {
+    return *this;
+  }
+  auto span = _arena.require(length).remnant().rebind<char>();
+  memcpy(span.data(), data, length);
+  _arena.alloc(length);
+  this->append(span.data(), length);
+  _extent += length;
+  return *this;
+}
+
+bool
+IoVecWriter::commit(size_t n) {
+  if (0 == n) {
+    return true;
+  }
+  if (n <= _arena.remaining()) {
+    auto span = _arena.alloc(n);
+    this->append(span.data(), n);
+    _extent += n;
+    return true;
+  }
+  _arena.require(n); // increase capacity and have the caller retry.
+  return false;
+}
+
+auto
+IoVecWriter::discard(size_t n) -> self_type & {
+  n = std::min(n, _extent);
+  _extent -= n;
+  while (n > 0 && !_iov.empty()) {
+    auto &last = _iov.back();
+    if (last.iov_len > n) {
+      last.iov_len -= n;
+      n = 0;
+    } else {
+      n -= last.iov_len;
+      _iov.pop_back();
+    }
+  }
+  return *this;
+}
+
+auto
+IoVecWriter::copy(size_t, size_t, size_t) -> self_type & {
+  throw std::runtime_error("IoVecWriter does not support copy");
+}
+
+std::ostream &
+IoVecWriter::operator>>(std::ostream &stream) const {
+  for (auto const &iov : _iov) {
+    stream.write(static_cast<char const *>(iov.iov_base), iov.iov_len);
+  }
+  return stream;
+}
+
+ssize_t
+IoVecWriter::writev(int fd) const {
+  ssize_t total = 0;
+  size_t idx    = 0;
+  while (idx < _iov.size()) {
+    auto n           = std::min<size_t>(_iov.size() - idx, IOV_MAX);
+    size_t batch_len = 0;
+    for (size_t k = idx; k < idx + n; ++k) {
+      batch_len += _iov[k].iov_len;
+    }
+    auto zret = ::writev(fd, _iov.data() + idx, int(n));
+    if (zret < 0) {
+      return total > 0 ? total : zret;
+    }
+    total += zret;
+    if (size_t(zret) < batch_len) { // short write - don't break output ordering.
+      break;
+    }
+    idx += n;
+  }
+  return total;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
@@ -6,6 +6,7 @@
     away when unused.
  */
 #include "swoc/MemArena.h"
+#include "swoc/swoc_stats.h"
 #include <algorithm>
 
 namespace swoc { inline namespace SWOC_VERSION_NS {
@@ -39,15 +40,27 @@ MemArena::MemArena(swoc::MemArena::self_type &&that) noexcept
     _active_reserved(that._active_reserved),
     _frozen_allocated(that._frozen_allocated),
     _frozen_reserved(that._frozen_reserved),
+    _high_water(that._high_water),
+    _block_total(that._block_total),
+    _block_hook(std::move(that._block_hook)),
     _reserve_hint(that._reserve_hint),
     _frozen(std::move(that._frozen)),
     _active(std::move(that._active)),
-    _static_block(that._static_block) {
+    _static_block(that._static_block),
+    _opts(that._opts) {
   // Clear data in @a that to indicate all of the memory has been moved.
   that._active_allocated = that._active_reserved = 0;
   that._frozen_allocated = that._frozen_reserved = 0;
-  that._reserve_hint                             = 0;
-  that._static_block                             = nullptr;
+  that._high_water = that._block_total = 0;
+  that._block_hook                     = nullptr;
+  that._reserve_hint                   = 0;
+  that._static_block                   = nullptr;
+}
+
+MemArena::MemArena(Options const &opts) : _reserve_hint(opts.min_block_size ? opts.min_block_size : DEFAULT_BLOCK_SIZE), _opts(opts) {
+  if (_opts.huge_pages) {
+    _opts.use_mmap = true;
+  }
 }
 
 MemArena *
@@ -63,7 +76,11 @@ MemArena::operator=(swoc::MemArena::self_type &&that) noexcept {
   std::swap(_active_reserved, that._active_reserved);
   std::swap(_frozen_allocated, that._frozen_allocated);
   std::swap(_frozen_reserved, that._frozen_reserved);
+  std::swap(_high_water, that._high_water);
+  std::swap(_block_total, that._block_total);
+  std::swap(_block_hook, that._block_hook);
   std::swap(_reserve_hint, that._reserve_hint);
+  std::swap(_opts, that._opts);
   _active = std::move(that._active);
   _frozen = std::move(that._frozen);
   return *this;
@@ -71,6 +88,9 @@ MemArena::operator=(swoc::MemArena::self_type &&that) noexcept {
 
 MemArena::Block *
 MemArena::make_block(size_t n) {
+  SWOC_STAT_INC(_arena_block_alloc);
+  SWOC_PROBE2(arena_block_alloc, this, n);
+  ++_block_total;
   // If there's no reservation hint, use the extent. This is transient because the hint is cleared.
   if (_reserve_hint == 0) {
     if (_active_reserved) {
@@ -80,6 +100,7 @@ MemArena::make_block(size_t n) {
     }
   }
   n             = std::max<size_t>(n, _reserve_hint);
+  n             = std::max<size_t>(n, _opts.min_block_size);
   _reserve_hint = 0; // did this, clear for next time.
   // Add in overhead and round up to paragraph units.
   n = Paragraph{round_up(n + ALLOC_HEADER_SIZE + sizeof(Block))};
@@ -91,12 +112,84 @@ MemArena::make_block(size_t n) {
     n = QuarterPage{round_up(n)};
   }
 
+#if SWOC_MEM_ARENA_HAS_MMAP
+  if (_opts.use_mmap) {
+    static constexpr size_t HUGE_PAGE = size_t(2) << 20; // x86-64 / aarch64 huge page unit.
+    void *mem    = MAP_FAILED;
+    size_t total = size_t(n) + sizeof(Block);
+#if defined(MAP_HUGETLB)
+    if (_opts.huge_pages) {
+      auto huge_total = (total + HUGE_PAGE - 1) & ~(HUGE_PAGE - 1);
+      mem = ::mmap(nullptr, huge_total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (MAP_FAILED != mem) {
+        total = huge_total;
+      } // else fall back to a normal mapping - explicit huge pages are often not provisioned.
+    }
+#endif
+    if (MAP_FAILED == mem) {
+      total = Page{round_up(total)};
+      mem   = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#if defined(MADV_HUGEPAGE)
+      if (MAP_FAILED != mem && _opts.huge_pages) {
+        ::madvise(mem, total, MADV_HUGEPAGE); // best effort - THP does the rest.
+      }
+#endif
+    }
+    if (MAP_FAILED != mem) {
+      auto free_space   = total - sizeof(Block);
+      _active_reserved += free_space;
+      auto block        = new (mem) Block(free_space);
+      block->_flags    |= Block::MMAPPED;
+      if (_block_hook) {
+        _block_hook(*this, free_space);
+      }
+      return block;
+    }
+    // On mmap failure fall through to the malloc path.
+  }
+#endif
   // Allocate space for the Block instance and the request memory and construct a Block at the front.
   // In theory this could use ::operator new(n) but this causes a size mismatch during ::operator delete.
   // Easier to use malloc and override @c delete.
   auto free_space   = n - sizeof(Block);
   _active_reserved += free_space;
-  return new (::malloc(n)) Block(free_space);
+  auto block        = new (::malloc(n)) Block(free_space);
+  if (_block_hook) {
+    _block_hook(*this, free_space);
+  }
+  return block;
+}
+
+MemArena::Telemetry
+MemArena::telemetry() const {
+  Telemetry zret;
+  zret._high_water  = this->high_water();
+  zret._block_total = _block_total;
+  auto scan         = [&zret](BlockList const &list) {
+    for (auto const &block : list) {
+      ++zret._block_count;
+      // log2 bucket, clamped to the last bucket.
+      size_t idx = 0;
+      for (size_t w = block.size; w > 1 && idx < Telemetry::N_BUCKETS - 1; w >>= 1) {
+        ++idx;
+      }
+      ++zret._block_sizes[idx];
+    }
+  };
+  scan(_active);
+  scan(_frozen);
+  return zret;
+}
+
+void
+MemArena::destroy_block(Block *block) {
+#if SWOC_MEM_ARENA_HAS_MMAP
+  if (block->_flags & Block::MMAPPED) {
+    ::munmap(block, block->size + sizeof(Block));
+    return;
+  }
+#endif
+  delete block;
 }
 
 MemSpan<void>
@@ -116,6 +209,8 @@ MemArena::alloc(size_t n, size_t align) {
 
 MemArena &
 MemArena::freeze(size_t n) {
+  // Capture the footprint while both generations are still live.
+  _high_water = std::max(_high_water, _frozen_allocated + _active_allocated);
   this->destroy_frozen();
   _frozen = std::move(_active);
   // Update the meta data.
@@ -131,6 +226,7 @@ MemArena::freeze(size_t n) {
 
 MemArena &
 MemArena::thaw() {
+  _high_water = std::max(_high_water, _frozen_allocated + _active_allocated);
   this->destroy_frozen();
   _frozen_reserved = _frozen_allocated = 0;
   if (_static_block) {
@@ -180,7 +276,7 @@ MemArena::destroy_active() {
   _active
     .apply([=](Block *b) {
       if (b != sb) {
-        delete b;
+        destroy_block(b);
       }
     })
     .clear();
@@ -192,7 +288,7 @@ MemArena::destroy_frozen() {
   _frozen
     .apply([=](Block *b) {
       if (b != sb) {
-        delete b;
+        destroy_block(b);
       }
     })
     .clear();
@@ -201,6 +297,7 @@ MemArena::destroy_frozen() {
 MemArena &
 MemArena::clear(size_t hint) {
   _reserve_hint    = hint ? hint : _frozen_allocated + _active_allocated;
+  _high_water      = std::max(_high_water, _frozen_allocated + _active_allocated);
   _frozen_reserved = _frozen_allocated = 0;
   _active_reserved = _active_allocated = 0;
   this->destroy_frozen();
@@ -266,16 +363,110 @@ MemArena::~MemArena() {
     Block *b = bf;
     bf       = bf->_link._next;
     if (b != sb) {
-      delete b;
+      destroy_block(b);
     }
   }
   while (ba) {
     Block *b = ba;
     ba       = ba->_link._next;
     if (b != sb) {
-      delete b;
+      destroy_block(b);
+    }
+  }
+}
+
+thread_local ArenaPool::Cache ArenaPool::_cache;
+std::atomic<MemArena::Block *> ArenaPool::_overflow{nullptr};
+
+ArenaPool::Cache::~Cache() {
+  while (_head) {
+    MemArena::Block *b = _head;
+    _head    = b->_link._next;
+    MemArena::destroy_block(b);
+  }
+}
+
+MemArena::Block *
+ArenaPool::fetch(size_t n) {
+  if (nullptr == _cache._head) { // local cache empty - claim the entire overflow stack.
+    _cache._head = _overflow.exchange(nullptr, std::memory_order_acquire);
+    for (MemArena::Block *b = _cache._head; b; b = b->_link._next) {
+      ++_cache._count;
     }
   }
+  // Find a block with sufficient space, unlinking it from the chain.
+  for (MemArena::Block **link = &_cache._head; *link; link = &(*link)->_link._next) {
+    if ((*link)->size >= n) {
+      MemArena::Block *b = *link;
+      *link    = b->_link._next;
+      --_cache._count;
+      b->_link._next = b->_link._prev = nullptr;
+      return b;
+    }
+  }
+  return nullptr;
+}
+
+void
+ArenaPool::cache(MemArena::Block *block) {
+  block->discard();
+  block->_link._prev = nullptr;
+  if (_cache._count < THREAD_CACHE_MAX) {
+    block->_link._next = _cache._head;
+    _cache._head       = block;
+    ++_cache._count;
+  } else { // push on the global overflow stack.
+    MemArena::Block *top = _overflow.load(std::memory_order_relaxed);
+    do {
+      block->_link._next = top;
+    } while (!_overflow.compare_exchange_weak(top, block, std::memory_order_release, std::memory_order_relaxed));
+  }
+}
+
+MemArena
+ArenaPool::make(size_t n) {
+  MemArena arena{n};
+  if (MemArena::Block *b = fetch(n); b != nullptr) {
+    arena._active.prepend(b);
+    arena._active_reserved += b->remaining();
+  }
+  return arena;
+}
+
+void
+ArenaPool::retire(MemArena &&arena) {
+  auto sb       = arena._static_block;
+  auto transfer = [&](MemArena::BlockList &list) {
+    while (MemArena::Block *b = list.take_head()) {
+      if (b != sb) {
+        cache(b);
+      }
+    }
+  };
+  transfer(arena._active);
+  transfer(arena._frozen);
+  arena._active_allocated = arena._active_reserved = 0;
+  arena._frozen_allocated = arena._frozen_reserved = 0;
+}
+
+size_t
+ArenaPool::local_count() {
+  return _cache._count;
+}
+
+void
+ArenaPool::drain() {
+  while (MemArena::Block *b = _cache._head) {
+    _cache._head = b->_link._next;
+    MemArena::destroy_block(b);
+  }
+  _cache._count = 0;
+  MemArena::Block *chain  = _overflow.exchange(nullptr, std::memory_order_acquire);
+  while (chain) {
+    MemArena::Block *b = chain;
+    chain    = b->_link._next;
+    MemArena::destroy_block(b);
+  }
 }
 
 #if __has_include(<memory_resource>)
@@ -291,6 +482,26 @@ bool
 MemArena::do_is_equal(std::pmr::memory_resource const &that) const noexcept {
   return this == &that;
 }
+
+void *
+ArenaResource::do_allocate(std::size_t bytes, std::size_t align) {
+  return _arena->alloc(bytes, align).data();
+}
+
+void
+ArenaResource::do_deallocate(void *ptr, size_t bytes, size_t) {
+  // Best effort - reclaimed only if this is the most recent allocation in its block.
+  _arena->discard(MemSpan<void const>(ptr, bytes));
+}
+
+bool
+ArenaResource::do_is_equal(std::pmr::memory_resource const &that) const noexcept {
+  if (this == &that || _arena == &that) { // the arena is itself a resource.
+    return true;
+  }
+  auto other = dynamic_cast<self_type const *>(&that);
+  return other != nullptr && other->_arena == _arena;
+}
 #endif
 
 }} // namespace swoc::SWOC_VERSION_NS
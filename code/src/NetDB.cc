@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+   Host database implementation.
+ */
+
+#include "swoc/NetDB.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace ip {
+
+NetDB::NetDB() : _forward(std::make_shared<Forward>()) {
+  _snapshot = std::make_shared<Snapshot const>(Snapshot{std::shared_ptr<Forward const>{_forward}, _reverse.freeze(), 0});
+}
+
+auto
+NetDB::load(TextView content) -> Rv<Update> {
+  std::lock_guard<std::mutex> lock{_writer_mutex};
+  Update update;
+  Errata errata;
+
+  // Parse in to the next generation indices. Names are interned so text already in the table is
+  // not copied again - the parse holds one reference per forward entry.
+  auto forward = std::make_shared<Forward>();
+  std::map<IPAddr, TextView> addrs;
+  unsigned line_no = 0;
+  while (!content.empty()) {
+    auto line = content.take_prefix_at('\n');
+    ++line_no;
+    line.trim_if(&isspace);
+    if (line.empty() || '#' == *line) {
+      continue;
+    }
+    auto addr_token = line.take_prefix_if(&isspace);
+    IPAddr addr;
+    if (!addr.load(addr_token)) {
+      errata.note("Invalid address '{}' on line {}.", addr_token, line_no);
+      continue;
+    }
+    bool primary_p = addrs.find(addr) == addrs.end();
+    while (!line.ltrim_if(&isspace).empty()) {
+      auto name = _names.intern(line.take_prefix_if(&isspace));
+      if (primary_p) {
+        addrs[addr] = name;
+        primary_p   = false;
+      }
+      if (!forward->emplace(name, addr).second) {
+        _names.release(name); // duplicate in this load - drop the extra reference.
+      }
+    }
+  }
+
+  // Diff the address index against the current generation and apply only the differences to the
+  // reverse space - a merge walk, both maps are address ordered.
+  auto n_spot = addrs.begin();
+  auto o_spot = _addrs.begin();
+  while (n_spot != addrs.end() || o_spot != _addrs.end()) {
+    if (o_spot == _addrs.end() || (n_spot != addrs.end() && n_spot->first < o_spot->first)) {
+      _reverse.mark(IPRange{n_spot->first}, n_spot->second);
+      ++update._added;
+      ++n_spot;
+    } else if (n_spot == addrs.end() || o_spot->first < n_spot->first) {
+      _reverse.erase(IPRange{o_spot->first});
+      ++update._removed;
+      ++o_spot;
+    } else {
+      if (n_spot->second != o_spot->second) {
+        _reverse.mark(IPRange{n_spot->first}, n_spot->second);
+        ++update._changed;
+      }
+      ++n_spot;
+      ++o_spot;
+    }
+  }
+
+  // Release the previous generation's name references. Views held by outstanding snapshots stay
+  // valid - interned storage is never reclaimed while the table lives.
+  for (auto const &[name, addr] : *_forward) {
+    _names.release(name);
+  }
+
+  // Publish.
+  _addrs               = std::move(addrs);
+  _forward             = std::move(forward);
+  update._generation   = _generation + 1;
+  auto snap            = std::make_shared<Snapshot const>(
+    Snapshot{std::shared_ptr<Forward const>{_forward}, _reverse.freeze(), update._generation});
+  std::atomic_store_explicit(&_snapshot, snapshot_ptr{std::move(snap)}, std::memory_order_release);
+  _generation.store(update._generation, std::memory_order_release);
+  return {update, std::move(errata)};
+}
+
+auto
+NetDB::load(file::path const &path) -> Rv<Update> {
+  std::error_code ec;
+  auto content = file::map(path, ec, file::mapping::advice::SEQUENTIAL);
+  if (ec) {
+    return {Update{}, Errata{ec, "Failed to map '{}'.", path}};
+  }
+  return this->load(TextView{content});
+}
+
+} // namespace ip
+}} // namespace swoc::SWOC_VERSION_NS
@@ -44,8 +44,9 @@ RBNode::rotate(Direction dir) {
     this->set_child(child->child_at(dir), other_dir);
     child->clear_child(dir);
     child->set_child(this, dir);
-    child->structure_fixup();
+    // Fix up the demoted node first - the promoted node's aggregate depends on it.
     this->structure_fixup();
+    child->structure_fixup();
     if (parent) {
       parent->clear_child(child_dir);
       parent->set_child(child, child_dir);
@@ -338,6 +339,74 @@ RBNode::validate() {
 #endif
 }
 
+size_t
+RBNode::rank() const {
+  size_t zret        = _left ? _left->_count : 0;
+  self_type const *n = this;
+  while (n->_parent) {
+    if (n->_parent->_right == n) {
+      zret += 1 + (n->_parent->_left ? n->_parent->_left->_count : 0);
+    }
+    n = n->_parent;
+  }
+  return zret;
+}
+
+auto
+RBNode::select(size_t r) -> self_type * {
+  self_type *n = this;
+  while (n) {
+    size_t left_count = n->_left ? n->_left->_count : 0;
+    if (r < left_count) {
+      n = n->_left;
+    } else if (r == left_count) {
+      return n;
+    } else {
+      r -= left_count + 1;
+      n = n->_right;
+    }
+  }
+  return nullptr;
+}
+
+namespace {
+/// Recursive worker for @c RBNode::build - nodes at @a red_depth are colored red, the rest black.
+RBNode *
+build_subtree(RBNode *const *nodes, size_t n, unsigned depth, unsigned red_depth) {
+  if (0 == n) {
+    return nullptr;
+  }
+  size_t mid    = n / 2;
+  RBNode *root  = nodes[mid];
+  root->_parent = nullptr;
+  root->_left = root->_right = nullptr;
+  root->_color               = (depth == red_depth) ? RBNode::Color::RED : RBNode::Color::BLACK;
+  if (auto *left = build_subtree(nodes, mid, depth + 1, red_depth); left) {
+    root->set_child(left, RBNode::Direction::LEFT);
+  }
+  if (auto *right = build_subtree(nodes + mid + 1, n - mid - 1, depth + 1, red_depth); right) {
+    root->set_child(right, RBNode::Direction::RIGHT);
+  }
+  root->structure_fixup(); // children are done, update the augmentation.
+  return root;
+}
+} // namespace
+
+auto
+RBNode::build(MemSpan<self_type *> nodes) -> self_type * {
+  // Midpoint splitting yields a tree with every level full except the deepest, so coloring
+  // only the deepest level red leaves the black height uniform - a valid red/black tree.
+  unsigned red_depth = 0;
+  for (size_t n = nodes.count(); n > 1; n >>= 1) {
+    ++red_depth;
+  }
+  auto *root = build_subtree(nodes.data(), nodes.count(), 0, red_depth);
+  if (root) {
+    root->_color = Color::BLACK; // when there's a single node the root is also the deepest level.
+  }
+  return root;
+}
+
 auto
 RBNode::left_most_descendant() const -> self_type * {
   const self_type *n = this;
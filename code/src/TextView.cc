@@ -10,13 +10,153 @@
 */
 
 #include "swoc/TextView.h"
+#include "swoc/MemSpan.h"
 #include <cctype>
 #include <sstream>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 using namespace swoc::literals;
 
 namespace swoc { inline namespace SWOC_VERSION_NS {
 
+namespace detail {
+
+namespace {
+// Past this set size the per-delimiter vector compare loses to a bitset scan.
+constexpr size_t SCAN_DELIMITER_LIMIT = 8;
+
+/// Bitset classification scan for large delimiter sets.
+size_t
+scan_first_of_slow(char const *data, size_t n, std::string_view const &delimiters) noexcept {
+  CharSet set{delimiters};
+  for (size_t idx = 0; idx < n; ++idx) {
+    if (set(data[idx])) {
+      return idx;
+    }
+  }
+  return std::string_view::npos;
+}
+
+/// Bitset classification scan for large delimiter sets - first character not in the set.
+size_t
+scan_first_not_of_slow(char const *data, size_t n, std::string_view const &delimiters) noexcept {
+  CharSet set{delimiters};
+  size_t idx = 0;
+  while (idx < n && set(data[idx])) {
+    ++idx;
+  }
+  return idx;
+}
+
+} // namespace
+
+size_t
+scan_first_of(char const *data, size_t n, std::string_view const &delimiters) noexcept {
+  static constexpr auto npos = std::string_view::npos;
+  if (0 == n || delimiters.empty()) {
+    return npos;
+  }
+  if (1 == delimiters.size()) { // memchr is already vectorized in every libc that matters.
+    auto spot = static_cast<char const *>(::memchr(data, delimiters.front(), n));
+    return spot ? size_t(spot - data) : npos;
+  }
+  if (delimiters.size() > SCAN_DELIMITER_LIMIT) {
+    return scan_first_of_slow(data, n, delimiters);
+  }
+
+  size_t idx = 0;
+#if defined(__SSE2__)
+  for (; idx + 16 <= n; idx += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + idx));
+    __m128i hits  = _mm_setzero_si128();
+    for (char d : delimiters) {
+      hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(d)));
+    }
+    if (auto mask = _mm_movemask_epi8(hits); mask) {
+      return idx + __builtin_ctz(mask);
+    }
+  }
+#elif defined(__ARM_NEON)
+  for (; idx + 16 <= n; idx += 16) {
+    uint8x16_t chunk = vld1q_u8(reinterpret_cast<uint8_t const *>(data + idx));
+    uint8x16_t hits  = vdupq_n_u8(0);
+    for (char d : delimiters) {
+      hits = vorrq_u8(hits, vceqq_u8(chunk, vdupq_n_u8(uint8_t(d))));
+    }
+    // Narrow each byte of the compare result to a nibble, yielding a 64 bit mask.
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hits), 4)), 0);
+    if (mask) {
+      return idx + (__builtin_ctzll(mask) >> 2);
+    }
+  }
+#endif
+  for (; idx < n; ++idx) {
+    for (char d : delimiters) {
+      if (data[idx] == d) {
+        return idx;
+      }
+    }
+  }
+  return npos;
+}
+
+size_t
+scan_first_not_of(char const *data, size_t n, std::string_view const &delimiters) noexcept {
+  if (0 == n || delimiters.empty()) {
+    return 0;
+  }
+  if (delimiters.size() > SCAN_DELIMITER_LIMIT) {
+    return scan_first_not_of_slow(data, n, delimiters);
+  }
+
+  size_t idx = 0;
+#if defined(__SSE2__)
+  for (; idx + 16 <= n; idx += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + idx));
+    __m128i hits  = _mm_setzero_si128();
+    for (char d : delimiters) {
+      hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(d)));
+    }
+    if (auto miss = 0xFFFFu & ~unsigned(_mm_movemask_epi8(hits)); miss) {
+      return idx + __builtin_ctz(miss);
+    }
+  }
+#elif defined(__ARM_NEON)
+  for (; idx + 16 <= n; idx += 16) {
+    uint8x16_t chunk = vld1q_u8(reinterpret_cast<uint8_t const *>(data + idx));
+    uint8x16_t hits  = vdupq_n_u8(0);
+    for (char d : delimiters) {
+      hits = vorrq_u8(hits, vceqq_u8(chunk, vdupq_n_u8(uint8_t(d))));
+    }
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hits), 4)), 0);
+    if (auto miss = ~mask; miss) {
+      return idx + (__builtin_ctzll(miss) >> 2);
+    }
+  }
+#endif
+  while (idx < n) {
+    bool hit = false;
+    for (char d : delimiters) {
+      if (data[idx] == d) {
+        hit = true;
+        break;
+      }
+    }
+    if (!hit) {
+      return idx;
+    }
+    ++idx;
+  }
+  return n;
+}
+
+} // namespace detail
+
 /// @cond INTERNAL_DETAIL
 const int8_t svtoi_convert[256] = {
   /* [can't do this nicely because clang format won't allow exdented comments]
@@ -41,6 +181,21 @@ const int8_t svtoi_convert[256] = {
 };
 /// @endcond
 
+size_t
+TextView::tokenize(std::string_view const &delimiters, MemSpan<self_type> const &out) {
+  size_t count = 0;
+  char const *spot  = this->data();
+  char const *limit = this->data_end();
+  while (count < out.count() && spot < limit) {
+    auto n      = detail::scan_first_of(spot, limit - spot, delimiters);
+    auto tail   = (npos == n) ? size_t(limit - spot) : n;
+    out[count++] = self_type{spot, tail};
+    spot        += tail + 1; // skip the delimiter - past @a limit terminates the loop.
+  }
+  this->assign(std::min(spot, limit), limit);
+  return count;
+}
+
 intmax_t
 svtoi(TextView src, TextView *out, int base) {
   static constexpr uintmax_t ABS_MAX = std::numeric_limits<intmax_t>::max();
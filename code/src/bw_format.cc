@@ -6,12 +6,13 @@
     Formatted output for BufferWriter.
  */
 
+#include <algorithm>
 #include <array>
 #include <cctype>
+#include <charconv>
 #include <chrono>
 #include <cmath>
 #include <ctime>
-#include <cmath>
 #include <sys/param.h>
 #include <unistd.h>
 
@@ -19,6 +20,7 @@
 #include "swoc/bwf_base.h"
 #include "swoc/bwf_ex.h"
 #include "swoc/swoc_meta.h"
+#include "swoc/swoc_codec.h"
 #include "swoc/DiscreteRange.h"
 
 using namespace std::literals;
@@ -33,34 +35,6 @@ namespace bwf {
 
 const Spec Spec::DEFAULT;
 
-const Spec::Property Spec::_prop;
-
-#pragma GCC diagnostic ignored "-Wchar-subscripts"
-
-Spec::Property::Property() {
-  memset(_data, 0, sizeof(_data));
-  _data['b'] = TYPE_CHAR | NUMERIC_TYPE_CHAR;
-  _data['B'] = TYPE_CHAR | NUMERIC_TYPE_CHAR | UPPER_TYPE_CHAR;
-  _data['d'] = TYPE_CHAR | NUMERIC_TYPE_CHAR;
-  _data['g'] = TYPE_CHAR;
-  _data['o'] = TYPE_CHAR | NUMERIC_TYPE_CHAR;
-  _data['p'] = TYPE_CHAR;
-  _data['P'] = TYPE_CHAR | UPPER_TYPE_CHAR;
-  _data['s'] = TYPE_CHAR;
-  _data['S'] = TYPE_CHAR | UPPER_TYPE_CHAR;
-  _data['x'] = TYPE_CHAR | NUMERIC_TYPE_CHAR;
-  _data['X'] = TYPE_CHAR | NUMERIC_TYPE_CHAR | UPPER_TYPE_CHAR;
-
-  _data[SIGN_NEVER]  = SIGN_CHAR;
-  _data[SIGN_NEG]    = SIGN_CHAR;
-  _data[SIGN_ALWAYS] = SIGN_CHAR;
-
-  _data['<'] = static_cast<uint8_t>(Spec::Align::LEFT);
-  _data['>'] = static_cast<uint8_t>(Spec::Align::RIGHT);
-  _data['^'] = static_cast<uint8_t>(Spec::Align::CENTER);
-  _data['='] = static_cast<uint8_t>(Spec::Align::SIGN);
-}
-
 Spec::Spec(const TextView &fmt) {
   this->parse(fmt);
 }
@@ -246,13 +220,16 @@ Format::TextViewExtractor::operator()(std::string_view &literal_v, Spec &spec) {
 }
 
 bool
-Format::FormatExtractor::operator()(std::string_view &literal_v, swoc::bwf::Spec &spec) {
+Format::FormatExtractor::operator()(std::string_view &literal_v, Format::CacheSpec &spec) {
   literal_v = {};
   if (_idx < int(_fmt.size()) && _fmt[_idx]._type == Spec::LITERAL_TYPE) {
     literal_v = _fmt[_idx++]._ext;
   }
   if (_idx < int(_fmt.size()) && _fmt[_idx]._type != Spec::LITERAL_TYPE) {
-    spec = _fmt[_idx++];
+    static_cast<Spec &>(spec) = _fmt[_idx];
+    spec._cache_format        = _format;
+    spec._cache_idx           = unsigned(_idx);
+    ++_idx;
     return true;
   }
   return false;
@@ -485,6 +462,80 @@ Format_Integer(BufferWriter &w, Spec const &spec, uintmax_t i, bool neg_p) {
   return w;
 }
 
+#if defined(__cpp_lib_to_chars)
+
+namespace {
+
+/** Shared engine for @c Format_Float - @a f must be non-negative.
+ *
+ * Without a precision the output is the shortest text that parses back to exactly @a f, via the
+ * Ryu style engine in @c std::to_chars. With a precision the output is fixed point at that
+ * precision. Type @a F is preserved so a @c float formats as the shortest text that round trips
+ * to the @c float value, not to the wider @c double.
+ */
+template <typename F>
+BufferWriter &
+Format_Float_Shortest(BufferWriter &w, Spec const &spec, F f, bool negative_p) {
+  // Handle values that don't have digits to format.
+  switch (std::fpclassify(f)) {
+  case FP_INFINITE:
+    w.write("Inf");
+    return w;
+  case FP_NAN:
+    w.write("NaN");
+    return w;
+  case FP_ZERO:
+    w.write("0");
+    return w;
+  }
+
+  // Integral values format as integers, which also supports the radix types.
+  if (f < F(std::numeric_limits<uintmax_t>::max())) {
+    auto whole_part = static_cast<uintmax_t>(f);
+    if (whole_part == f || spec._prec == 0) {
+      return Format_Integer(w, spec, whole_part, negative_p);
+    }
+  }
+
+  // Room for the largest whole part (roughly 310 digits), the '.', and a capped precision.
+  char buff[512];
+  std::to_chars_result res{};
+  if (Spec::DEFAULT._prec == spec._prec) { // no precision - shortest round trip text.
+    res = std::to_chars(buff, buff + sizeof(buff), f);
+  } else {
+    int precision = std::min(spec._prec, 192);
+    res           = std::to_chars(buff, buff + sizeof(buff), f, std::chars_format::fixed, precision);
+    if (std::errc{} != res.ec) { // didn't fit - fall back to scientific style at the same precision.
+      res = std::to_chars(buff, buff + sizeof(buff), f, std::chars_format::general, precision);
+    }
+  }
+
+  char neg = 0;
+  if (negative_p) {
+    neg = '-';
+  } else if (spec._sign != '-') {
+    neg = spec._sign;
+  }
+  std::string_view digits{buff, size_t(res.ptr - buff)};
+  int width = static_cast<int>(spec._min) - static_cast<int>(digits.size()) - (neg ? 1 : 0);
+  Write_Aligned(w, [&]() { w.write(digits); }, spec._align, width, spec._fill, neg);
+  return w;
+}
+
+} // namespace
+
+BufferWriter &
+Format_Float(BufferWriter &w, Spec const &spec, double f, bool negative_p) {
+  return Format_Float_Shortest(w, spec, f, negative_p);
+}
+
+BufferWriter &
+Format_Float(BufferWriter &w, Spec const &spec, float f, bool negative_p) {
+  return Format_Float_Shortest(w, spec, f, negative_p);
+}
+
+#else
+
 /// Format for floating point values. Seperates floating point into a whole
 /// number and a fraction. The fraction is converted into an unsigned integer
 /// based on the specified precision, spec._prec. ie. 3.1415 with precision two
@@ -589,13 +640,28 @@ Format_Float(BufferWriter &w, Spec const &spec, double f, bool negative_p) {
   return w;
 }
 
+BufferWriter &
+Format_Float(BufferWriter &w, Spec const &spec, float f, bool negative_p) {
+  return Format_Float(w, spec, double(f), negative_p);
+}
+
+#endif // __cpp_lib_to_chars
+
 void
 Format_As_Hex(BufferWriter &w, std::string_view view, const char *digits) {
-  const char *ptr = view.data();
-  for (auto n = view.size(); n > 0; --n) {
-    char c = *ptr++;
-    w.write(digits[(c >> 4) & 0xF]);
-    w.write(digits[c & 0xf]);
+  // Batch through a stack buffer - the table loop is branch free and the output lands in the
+  // writer one chunk at a time rather than two virtual calls per input byte.
+  auto const &pairs = ('A' == digits[10]) ? codec::detail::HEX_PAIRS_UPPER : codec::detail::HEX_PAIRS_LOWER;
+  char buff[512];
+  while (!view.empty()) {
+    size_t n  = std::min(view.size(), sizeof(buff) / 2);
+    char *out = buff;
+    for (size_t idx = 0; idx < n; ++idx) {
+      memcpy(out, pairs[uint8_t(view[idx])].data(), 2);
+      out += 2;
+    }
+    w.write(buff, 2 * n);
+    view.remove_prefix(n);
   }
 }
 
@@ -627,6 +693,12 @@ Format::Format(TextView fmt) {
       _items.emplace_back(spec);
     }
   }
+
+  // Size the name cache only if there is a named specifier that could be resolved.
+  if (std::any_of(_items.begin(), _items.end(),
+                  [](Spec const &spec) { return Spec::LITERAL_TYPE != spec._type && !spec._name.empty(); })) {
+    _cache._slots = std::vector<std::atomic<void const *>>(_items.size());
+  }
 }
 
 bool
@@ -924,13 +996,28 @@ BufferWriter &
 bwformat(BufferWriter &w, bwf::Spec const &spec, bwf::UnHex const &obj) {
   auto span{obj._span};
   size_t limit = spec._max;
-  while (span.size() >= 2 && limit--) {
-    auto b = svto_radix<16>(span.clip_prefix(2).rebind<char const>());
-    w.write(b);
+  char buff[256];
+  while (span.size() >= 2 && limit > 0) {
+    size_t idx = 0;
+    while (span.size() >= 2 && limit > 0 && idx < sizeof(buff)) {
+      auto pair = span.clip_prefix(2).rebind<char const>();
+      int hi    = codec::detail::HEX_VALUE[uint8_t(pair[0])];
+      int lo    = codec::detail::HEX_VALUE[uint8_t(pair[1])];
+      // Fast path for valid digit pairs, otherwise the (partial parse) semantics of svto_radix.
+      buff[idx] = ((hi | lo) >= 0) ? char((hi << 4) | lo) : char(svto_radix<16>(pair));
+      ++idx;
+      --limit;
+    }
+    w.write(buff, idx);
   }
   return w;
 }
 
+BufferWriter &
+bwformat(BufferWriter &w, bwf::Spec const &, bwf::B64 const &obj) {
+  return codec::base64_encode(w, obj._span);
+}
+
 }} // namespace swoc::SWOC_VERSION_NS
 
 namespace std {
@@ -5,6 +5,9 @@
   BufferWriter formatting for IP address data.
  */
 
+#include <array>
+#include <cstring>
+
 #include "swoc/swoc_ip.h"
 #include "swoc/bwf_ip.h"
 
@@ -13,6 +16,166 @@ using namespace swoc::literals;
 namespace swoc { inline namespace SWOC_VERSION_NS {
 using bwf::Spec;
 
+namespace {
+
+/// Pairs of decimal digits "00" through "99" for two digit at a time emission.
+constexpr auto DEC_PAIRS = []() {
+  std::array<char, 200> pairs{};
+  for (unsigned n = 0; n < 100; ++n) {
+    pairs[2 * n]     = char('0' + n / 10);
+    pairs[2 * n + 1] = char('0' + n % 10);
+  }
+  return pairs;
+}();
+
+/** Emit @a octet as decimal text at @a out.
+ *
+ * @return One past the last character written.
+ *
+ * All three digits are computed unconditionally and the significant ones copied, so there is no
+ * per digit branching.
+ */
+inline char *
+write_octet(char *out, unsigned octet) {
+  unsigned len  = 1 + (octet > 9) + (octet > 99);
+  char digits[] = {char('0' + octet / 100), DEC_PAIRS[2 * (octet % 100)], DEC_PAIRS[2 * (octet % 100) + 1]};
+  std::memcpy(out, digits + 3 - len, len);
+  return out + len;
+}
+
+/// Emit @a port as decimal text at @a out, in the same style as @c write_octet.
+/// @return One past the last character written.
+inline char *
+write_port(char *out, unsigned port) {
+  unsigned len  = 1 + (port > 9) + (port > 99) + (port > 999) + (port > 9999);
+  unsigned hi   = port / 100;
+  char digits[] = {char('0' + hi / 100), DEC_PAIRS[2 * (hi % 100)], DEC_PAIRS[2 * (hi % 100) + 1], DEC_PAIRS[2 * (port % 100)],
+                   DEC_PAIRS[2 * (port % 100) + 1]};
+  std::memcpy(out, digits + 5 - len, len);
+  return out + len;
+}
+
+/// Emit @a quad as lower case hexadecimal text at @a out, without leading zeros.
+/// @return One past the last character written.
+inline char *
+write_hex_quad(char *out, unsigned quad) {
+  static constexpr char HEX[] = "0123456789abcdef";
+  unsigned len  = 1 + (quad > 0xF) + (quad > 0xFF) + (quad > 0xFFF);
+  char digits[] = {HEX[quad >> 12], HEX[quad >> 8 & 0xF], HEX[quad >> 4 & 0xF], HEX[quad & 0xF]};
+  std::memcpy(out, digits + 4 - len, len);
+  return out + len;
+}
+
+/// @return @c true if @a spec requests only the default formatting for an address.
+inline bool
+default_spec_p(Spec const &spec) {
+  return spec._ext.empty() && Spec::DEFAULT_TYPE == spec._type && 0 == spec._min && Spec::Align::NONE == spec._align &&
+         std::numeric_limits<unsigned int>::max() == spec._max;
+}
+
+} // namespace
+
+namespace ip {
+
+TextView
+to_buffer(IP4Addr const &addr, MemSpan<char> buf) {
+  if (buf.size() < IP4_TXT_SIZE) {
+    return {};
+  }
+  in_addr_t host = addr.host_order();
+  char *out      = buf.data();
+  out    = write_octet(out, host >> 24 & 0xFF);
+  *out++ = '.';
+  out    = write_octet(out, host >> 16 & 0xFF);
+  *out++ = '.';
+  out    = write_octet(out, host >> 8 & 0xFF);
+  *out++ = '.';
+  out = write_octet(out, host & 0xFF);
+  return {buf.data(), size_t(out - buf.data())};
+}
+
+TextView
+to_buffer(IP6Addr const &addr, MemSpan<char> buf) {
+  static constexpr int N_QUADS = 8;
+  if (buf.size() < IP6_TXT_SIZE) {
+    return {};
+  }
+  in6_addr net = addr.network_order();
+  uint16_t quads[N_QUADS];
+  for (int i = 0; i < N_QUADS; ++i) {
+    quads[i] = uint16_t((net.s6_addr[2 * i] << 8) | net.s6_addr[2 * i + 1]);
+  }
+  // Find the longest zero run of at least two quads, leftmost on ties, to match the BWF output.
+  int best_idx = -1, best_len = 1;
+  for (int i = 0, idx = -1, len = 0; i < N_QUADS; ++i) {
+    if (0 == quads[i]) {
+      if (0 == len++) {
+        idx = i;
+      }
+      if (len > best_len) {
+        best_len = len;
+        best_idx = idx;
+      }
+    } else {
+      len = 0;
+    }
+  }
+  char *out = buf.data();
+  if (best_idx >= 0) {
+    for (int i = 0; i < best_idx; ++i) {
+      out    = write_hex_quad(out, quads[i]);
+      *out++ = ':';
+    }
+    if (0 == best_idx) {
+      *out++ = ':'; // no leading quad - the run supplies only one colon itself.
+    }
+    *out++ = ':';
+    for (int i = best_idx + best_len; i < N_QUADS; ++i) {
+      out = write_hex_quad(out, quads[i]);
+      if (i + 1 < N_QUADS) {
+        *out++ = ':';
+      }
+    }
+  } else {
+    for (int i = 0; i < N_QUADS; ++i) {
+      out = write_hex_quad(out, quads[i]);
+      if (i + 1 < N_QUADS) {
+        *out++ = ':';
+      }
+    }
+  }
+  return {buf.data(), size_t(out - buf.data())};
+}
+
+TextView
+to_buffer(sockaddr const *addr, MemSpan<char> buf) {
+  char *out = buf.data();
+  if (AF_INET == addr->sa_family) {
+    if (buf.size() < IP4_ENDPOINT_TXT_SIZE) {
+      return {};
+    }
+    auto text = to_buffer(IP4Addr{IP4Addr::reorder(reinterpret_cast<sockaddr_in const *>(addr)->sin_addr.s_addr)}, buf);
+    out += text.size();
+    *out++ = ':';
+    out    = write_port(out, IPEndpoint::host_order_port(addr));
+    return {buf.data(), size_t(out - buf.data())};
+  } else if (AF_INET6 == addr->sa_family) {
+    if (buf.size() < IP6_ENDPOINT_TXT_SIZE) {
+      return {};
+    }
+    *out++    = '[';
+    auto text = to_buffer(IP6Addr{reinterpret_cast<sockaddr_in6 const *>(addr)->sin6_addr}, MemSpan<char>{out, IP6_TXT_SIZE});
+    out += text.size();
+    *out++ = ']';
+    *out++ = ':';
+    out    = write_port(out, IPEndpoint::host_order_port(addr));
+    return {buf.data(), size_t(out - buf.data())};
+  }
+  return {};
+}
+
+} // namespace ip
+
 BufferWriter &
 bwformat(BufferWriter &w, Spec const &spec, in6_addr const &addr) {
   using QUAD = uint16_t const;
@@ -82,6 +245,15 @@ bwformat(BufferWriter &w, Spec const &spec, in6_addr const &addr) {
 
 BufferWriter &
 bwformat(BufferWriter &w, Spec const &spec, sockaddr const *addr) {
+  // Plain "addr:port" is the overwhelmingly common case - format it directly if possible. If the
+  // remaining buffer is too small fall through so the generic path does the per element clipping.
+  if (default_spec_p(spec) && (AF_INET == addr->sa_family || AF_INET6 == addr->sa_family)) {
+    if (auto text = ip::to_buffer(addr, w.aux_span()); !text.empty()) {
+      w.commit(text.size());
+      return w;
+    }
+  }
+
   Spec local_spec{spec}; // Format for address elements and port.
   bool port_p{true};
   bool addr_p{true};
@@ -174,6 +346,13 @@ bwformat(BufferWriter &w, Spec const &spec, sockaddr const *addr) {
 
 BufferWriter &
 bwformat(BufferWriter &w, Spec const &spec, IP4Addr const &addr) {
+  if (default_spec_p(spec)) {
+    if (auto text = ip::to_buffer(addr, w.aux_span()); !text.empty()) {
+      w.commit(text.size());
+      return w;
+    }
+  }
+
   in_addr_t host = addr.host_order();
   Spec local_spec{spec}; // Format for address elements.
   bool align_p = false;
@@ -207,6 +386,12 @@ bwformat(BufferWriter &w, Spec const &spec, IP4Addr const &addr) {
 
 BufferWriter &
 bwformat(BufferWriter &w, Spec const &spec, IP6Addr const &addr) {
+  if (default_spec_p(spec)) {
+    if (auto text = ip::to_buffer(addr, w.aux_span()); !text.empty()) {
+      w.commit(text.size());
+      return w;
+    }
+  }
   return bwformat(w, spec, addr.network_order());
 }
 
@@ -7,6 +7,70 @@
 
 #include "swoc/string_view_util.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+/// Case fold a single ASCII character.
+inline int
+fold(char c) {
+  return ('A' <= c && c <= 'Z') ? c + 0x20 : static_cast<unsigned char>(c);
+}
+
+/** Compare @a n bytes at @a ls and @a rs without regard to ASCII case.
+ *
+ * Folds and compares a register's width of bytes per iteration where vector support is
+ * available - only the upper case alphabetics are folded so punctuation in the 0x40/0x60
+ * columns compares correctly. The scalar loop finishes the tail and localizes a mismatch.
+ */
+int
+case_folded_cmp(char const *ls, char const *rs, size_t n) {
+  size_t idx = 0;
+#if defined(__SSE2__)
+  const __m128i LOWER = _mm_set1_epi8('A' - 1);
+  const __m128i UPPER = _mm_set1_epi8('Z' + 1);
+  const __m128i CASE  = _mm_set1_epi8(0x20);
+  auto vfold          = [&](__m128i c) {
+    __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(c, LOWER), _mm_cmplt_epi8(c, UPPER));
+    return _mm_add_epi8(c, _mm_and_si128(alpha, CASE));
+  };
+  for (; idx + 16 <= n; idx += 16) {
+    __m128i lf = vfold(_mm_loadu_si128(reinterpret_cast<__m128i const *>(ls + idx)));
+    __m128i rf = vfold(_mm_loadu_si128(reinterpret_cast<__m128i const *>(rs + idx)));
+    if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(lf, rf))) {
+      break; // drop to the scalar loop to localize the mismatch.
+    }
+  }
+#elif defined(__ARM_NEON)
+  auto vfold = [](uint8x16_t c) {
+    uint8x16_t alpha = vandq_u8(vcgeq_s8(vreinterpretq_s8_u8(c), vdupq_n_s8('A')), //
+                                vcleq_s8(vreinterpretq_s8_u8(c), vdupq_n_s8('Z')));
+    return vaddq_u8(c, vandq_u8(alpha, vdupq_n_u8(0x20)));
+  };
+  for (; idx + 16 <= n; idx += 16) {
+    uint8x16_t lf = vfold(vld1q_u8(reinterpret_cast<uint8_t const *>(ls + idx)));
+    uint8x16_t rf = vfold(vld1q_u8(reinterpret_cast<uint8_t const *>(rs + idx)));
+    uint8x16_t eq = vceqq_u8(lf, rf);
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+    if (~mask) {
+      break;
+    }
+  }
+#endif
+  for (; idx < n; ++idx) {
+    if (int delta = fold(ls[idx]) - fold(rs[idx]); delta) {
+      return delta < 0 ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+} // namespace
+
 int
 memcmp(std::string_view const &lhs, std::string_view const &rhs) {
   int zret = 0;
@@ -41,7 +105,7 @@ strcasecmp(const std::string_view &lhs, const std::string_view &rhs) {
     return 0;
   }
 
-  int r = ::strncasecmp(lhs.data(), rhs.data(), n);
+  int r = case_folded_cmp(lhs.data(), rhs.data(), n);
 
   return r ? r : zret;
 }
@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+ * Branchless encode / decode kernels for binary to text codecs.
+ */
+
+#include <cstring>
+
+#include "swoc/swoc_codec.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace codec {
+namespace detail {
+namespace {
+
+constexpr char B64_DIGITS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+constexpr std::array<std::array<char, 2>, 256>
+make_hex_pairs(char const *digits) {
+  std::array<std::array<char, 2>, 256> zret{};
+  for (unsigned v = 0; v < 256; ++v) {
+    zret[v][0] = digits[v >> 4];
+    zret[v][1] = digits[v & 0xF];
+  }
+  return zret;
+}
+
+constexpr std::array<int8_t, 256>
+make_hex_values() {
+  std::array<int8_t, 256> zret{};
+  for (unsigned c = 0; c < 256; ++c) {
+    zret[c] = -1;
+  }
+  for (int8_t v = 0; v < 10; ++v) {
+    zret['0' + v] = v;
+  }
+  for (int8_t v = 0; v < 6; ++v) {
+    zret['a' + v] = int8_t(10 + v);
+    zret['A' + v] = int8_t(10 + v);
+  }
+  return zret;
+}
+
+constexpr std::array<int8_t, 256>
+make_base64_values() {
+  std::array<int8_t, 256> zret{};
+  for (unsigned c = 0; c < 256; ++c) {
+    zret[c] = -1;
+  }
+  for (int8_t v = 0; v < 64; ++v) {
+    zret[uint8_t(B64_DIGITS[v])] = v;
+  }
+  return zret;
+}
+
+} // namespace
+
+std::array<std::array<char, 2>, 256> const HEX_PAIRS_LOWER = make_hex_pairs("0123456789abcdef");
+std::array<std::array<char, 2>, 256> const HEX_PAIRS_UPPER = make_hex_pairs("0123456789ABCDEF");
+std::array<int8_t, 256> const HEX_VALUE                    = make_hex_values();
+std::array<int8_t, 256> const BASE64_VALUE                 = make_base64_values();
+
+} // namespace detail
+
+MemSpan<char>
+hex_encode(MemSpan<char> dst, MemSpan<void const> src, bool upper) {
+  auto bytes = src.rebind<uint8_t const>();
+  size_t n   = hex_encode_size(bytes.size());
+  if (dst.size() < n) {
+    return {};
+  }
+  auto const &pairs = upper ? detail::HEX_PAIRS_UPPER : detail::HEX_PAIRS_LOWER;
+  char *out         = dst.data();
+  for (uint8_t b : bytes) { // branch free - two table bytes per input byte.
+    memcpy(out, pairs[b].data(), 2);
+    out += 2;
+  }
+  return dst.prefix(n);
+}
+
+BufferWriter &
+hex_encode(BufferWriter &w, MemSpan<void const> src, bool upper) {
+  char buff[512]; // stream in chunks to avoid materializing the full encoding.
+  auto bytes = src.rebind<uint8_t const>();
+  while (!bytes.empty()) {
+    auto chunk = bytes.prefix(std::min(bytes.size(), sizeof(buff) / 2));
+    w.write(hex_encode(MemSpan<char>{buff, sizeof(buff)}, chunk, upper));
+    bytes.remove_prefix(chunk.size());
+  }
+  return w;
+}
+
+MemSpan<void>
+hex_decode(MemSpan<void> dst, TextView src) {
+  size_t n = src.size() / 2;
+  if ((src.size() & 1) || dst.size() < n) {
+    return {};
+  }
+  auto out     = dst.rebind<uint8_t>().data();
+  int accum    = 0; // any invalid digit forces the sign bit, checked once at the end.
+  for (size_t idx = 0; idx < n; ++idx) {
+    int hi  = detail::HEX_VALUE[uint8_t(src[2 * idx])];
+    int lo  = detail::HEX_VALUE[uint8_t(src[2 * idx + 1])];
+    accum  |= hi | lo;
+    out[idx] = uint8_t((hi << 4) | (lo & 0xF));
+  }
+  return accum < 0 ? MemSpan<void>{} : dst.prefix(n);
+}
+
+MemSpan<char>
+base64_encode(MemSpan<char> dst, MemSpan<void const> src) {
+  auto bytes = src.rebind<uint8_t const>();
+  size_t n   = base64_encode_size(bytes.size());
+  if (dst.size() < n) {
+    return {};
+  }
+  char *out = dst.data();
+  while (bytes.size() >= 3) {
+    uint32_t v = (uint32_t(bytes[0]) << 16) | (uint32_t(bytes[1]) << 8) | bytes[2];
+    *out++     = detail::B64_DIGITS[(v >> 18) & 0x3F];
+    *out++     = detail::B64_DIGITS[(v >> 12) & 0x3F];
+    *out++     = detail::B64_DIGITS[(v >> 6) & 0x3F];
+    *out++     = detail::B64_DIGITS[v & 0x3F];
+    bytes.remove_prefix(3);
+  }
+  if (bytes.size() == 2) {
+    uint32_t v = (uint32_t(bytes[0]) << 16) | (uint32_t(bytes[1]) << 8);
+    *out++     = detail::B64_DIGITS[(v >> 18) & 0x3F];
+    *out++     = detail::B64_DIGITS[(v >> 12) & 0x3F];
+    *out++     = detail::B64_DIGITS[(v >> 6) & 0x3F];
+    *out++     = '=';
+  } else if (bytes.size() == 1) {
+    uint32_t v = uint32_t(bytes[0]) << 16;
+    *out++     = detail::B64_DIGITS[(v >> 18) & 0x3F];
+    *out++     = detail::B64_DIGITS[(v >> 12) & 0x3F];
+    *out++     = '=';
+    *out++     = '=';
+  }
+  return dst.prefix(n);
+}
+
+BufferWriter &
+base64_encode(BufferWriter &w, MemSpan<void const> src) {
+  char buff[512]; // multiple of 4 - chunks of 384 input bytes encode without padding.
+  auto bytes = src.rebind<uint8_t const>();
+  while (!bytes.empty()) {
+    auto chunk = bytes.prefix(std::min<size_t>(bytes.size(), (sizeof(buff) / 4) * 3));
+    w.write(base64_encode(MemSpan<char>{buff, sizeof(buff)}, chunk));
+    bytes.remove_prefix(chunk.size());
+  }
+  return w;
+}
+
+MemSpan<void>
+base64_decode(MemSpan<void> dst, TextView src) {
+  while (!src.empty() && src.back() == '=') {
+    src.remove_suffix(1);
+  }
+  size_t tail = src.size() % 4;
+  if (1 == tail) { // a lone trailing digit holds at most 6 bits - never valid.
+    return {};
+  }
+  size_t n = (src.size() / 4) * 3 + (tail ? tail - 1 : 0);
+  if (dst.size() < n) {
+    return {};
+  }
+  auto out  = dst.rebind<uint8_t>().data();
+  int accum = 0;
+  while (src.size() >= 4) {
+    int d0      = detail::BASE64_VALUE[uint8_t(src[0])];
+    int d1      = detail::BASE64_VALUE[uint8_t(src[1])];
+    int d2      = detail::BASE64_VALUE[uint8_t(src[2])];
+    int d3      = detail::BASE64_VALUE[uint8_t(src[3])];
+    accum      |= d0 | d1 | d2 | d3;
+    uint32_t v  = (uint32_t(d0 & 0x3F) << 18) | (uint32_t(d1 & 0x3F) << 12) | (uint32_t(d2 & 0x3F) << 6) | uint32_t(d3 & 0x3F);
+    *out++      = uint8_t(v >> 16);
+    *out++      = uint8_t(v >> 8);
+    *out++      = uint8_t(v);
+    src.remove_prefix(4);
+  }
+  if (!src.empty()) {
+    uint32_t v = 0;
+    for (size_t idx = 0; idx < src.size(); ++idx) {
+      int d  = detail::BASE64_VALUE[uint8_t(src[idx])];
+      accum |= d;
+      v      = (v << 6) | uint32_t(d & 0x3F);
+    }
+    v <<= 6 * (4 - src.size());
+    *out++ = uint8_t(v >> 16);
+    if (3 == src.size()) {
+      *out++ = uint8_t(v >> 8);
+    }
+  }
+  return accum < 0 ? MemSpan<void>{} : dst.prefix(n);
+}
+
+} // namespace codec
+}} // namespace swoc::SWOC_VERSION_NS
@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+  Zero copy configuration parsing implementation.
+*/
+
+#include <cstring>
+
+#include "swoc/swoc_config.h"
+#include "swoc/bwf_base.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace config {
+
+namespace {
+/// Characters that end a bare token.
+bool
+is_structural(char c) {
+  return nullptr != std::strchr(";,{}[]\"#=", c);
+}
+} // namespace
+
+// --- Cursor ---
+
+TextView
+Cursor::take_token() {
+  char const *start = _rest.data();
+  while (!_rest.empty() && !isspace(*_rest) && !is_structural(*_rest)) {
+    this->take();
+  }
+  return {start, size_t(_rest.data() - start)};
+}
+
+// --- Interner ---
+
+auto
+Interner::probe(TextView text) -> Node ** {
+  size_t h    = Hash64FNV1a().hash_immediate(std::string_view(text));
+  Node **link = &_buckets[h & (_n_buckets - 1)];
+  while (*link && (*link)->_view != text) {
+    link = &(*link)->_next;
+  }
+  return link;
+}
+
+void
+Interner::expand() {
+  Node **old    = _buckets;
+  size_t old_n  = _n_buckets;
+  _n_buckets    = old_n ? 2 * old_n : N_BUCKETS;
+  auto span     = _arena->alloc(_n_buckets * sizeof(Node *), alignof(Node *)).rebind<Node *>();
+  _buckets      = span.data();
+  memset(_buckets, 0, _n_buckets * sizeof(Node *));
+  for (size_t idx = 0; idx < old_n; ++idx) {
+    Node *node = old[idx];
+    while (node) {
+      Node *next  = node->_next;
+      size_t h    = Hash64FNV1a().hash_immediate(std::string_view(node->_view));
+      Node *&slot = _buckets[h & (_n_buckets - 1)];
+      node->_next = slot;
+      slot        = node;
+      node        = next;
+    }
+  }
+}
+
+TextView
+Interner::intern(TextView text) {
+  if (_count >= _n_buckets) {
+    this->expand();
+  }
+  Node **link = this->probe(text);
+  if (*link) {
+    return (*link)->_view;
+  }
+  auto *node  = _arena->make<Node>();
+  auto span   = _arena->localize(MemSpan<char const>{text.data(), text.size()});
+  node->_view = TextView{span.data(), span.size()};
+  *link       = node;
+  ++_count;
+  return node->_view;
+}
+
+TextView
+Interner::intern_in_place(TextView text) {
+  if (_count >= _n_buckets) {
+    this->expand();
+  }
+  Node **link = this->probe(text);
+  if (*link) {
+    return (*link)->_view;
+  }
+  auto *node  = _arena->make<Node>();
+  node->_view = text;
+  *link       = node;
+  ++_count;
+  return node->_view;
+}
+
+// --- Parser ---
+
+Value *
+Parser::make_value(Value::Type type, Cursor const &c) {
+  auto *v  = _arena->make<Value>();
+  v->_type = type;
+  v->_line = c.line();
+  return v;
+}
+
+void
+Parser::append(Value *parent, Value *&tail, Value *v) {
+  if (tail) {
+    tail->_next = v;
+  } else {
+    parent->_child = v;
+  }
+  tail = v;
+  ++parent->_count;
+}
+
+Rv<TextView>
+Parser::parse_scalar(Cursor &c) {
+  if ('"' != c.peek()) {
+    auto token = c.take_token();
+    if (token.empty()) {
+      return Errata("Expected a value at line {} column {}.", c.line(), c.column());
+    }
+    return _intern.intern(token);
+  }
+
+  unsigned line = c.line(), col = c.column();
+  c.take(); // opening quote.
+  auto cp = c.mark();
+  // Common case first - scan for a clean literal and intern straight from the source.
+  char const *start = c.rest().data();
+  while (!c.at_end() && '"' != c.peek() && '\\' != c.peek()) {
+    c.take();
+  }
+  if (!c.at_end() && '"' == c.peek()) {
+    TextView literal{start, size_t(c.rest().data() - start)};
+    c.take(); // closing quote.
+    return _intern.intern(literal);
+  }
+  // Escapes present - unescape in to the arena, then dedup in place.
+  c.rewind(cp);
+  size_t n = 0; // measure the unescaped length.
+  while (!c.at_end() && '"' != c.peek()) {
+    if ('\\' == c.take()) {
+      if (c.at_end()) {
+        break;
+      }
+      c.take();
+    }
+    ++n;
+  }
+  if (c.at_end()) {
+    return Errata("Unterminated string opened at line {} column {}.", line, col);
+  }
+  c.take(); // closing quote.
+  c.rewind(cp);
+  auto span = _arena->alloc(n).rebind<char>();
+  char *dst = span.data();
+  while ('"' != c.peek()) {
+    char ch = c.take();
+    if ('\\' == ch) {
+      ch = c.take();
+      switch (ch) {
+      case 'n':
+        ch = '\n';
+        break;
+      case 't':
+        ch = '\t';
+        break;
+      case 'r':
+        ch = '\r';
+        break;
+      default: // includes '"' and '\\' - the character itself.
+        break;
+      }
+    }
+    *dst++ = ch;
+  }
+  c.take(); // closing quote.
+  return _intern.intern_in_place(TextView{span.data(), n});
+}
+
+Rv<Value *>
+Parser::parse_value(Cursor &c) {
+  if (c.at_end()) {
+    return Errata("Expected a value at line {} column {}.", c.line(), c.column());
+  }
+  if ('{' == c.peek()) {
+    auto *v = this->make_value(Value::Type::OBJECT, c);
+    c.take();
+    if (Errata errata = this->parse_fields(c, v, true); !errata.is_ok()) {
+      return errata;
+    }
+    return v;
+  }
+  if ('[' == c.peek()) {
+    auto *v = this->make_value(Value::Type::LIST, c);
+    c.take();
+    Value *tail = nullptr;
+    while (true) {
+      c.skip_ws();
+      if (c.at_end()) {
+        return Errata("Unterminated list opened at line {}.", v->_line);
+      }
+      if (']' == c.peek()) {
+        c.take();
+        break;
+      }
+      auto *elt              = this->make_value(Value::Type::STRING, c);
+      auto &&[text, errata] = this->parse_scalar(c);
+      if (!errata.is_ok()) {
+        return std::move(errata);
+      }
+      elt->_text = text;
+      this->append(v, tail, elt);
+      c.skip_ws();
+      if (!c.at_end() && ',' == c.peek()) {
+        c.take();
+      } else if (c.at_end() || ']' != c.peek()) {
+        return Errata("Expected ',' or ']' in list at line {} column {}.", c.line(), c.column());
+      }
+    }
+    return v;
+  }
+  auto *v               = this->make_value(Value::Type::STRING, c);
+  auto &&[text, errata] = this->parse_scalar(c);
+  if (!errata.is_ok()) {
+    return std::move(errata);
+  }
+  v->_text = text;
+  return v;
+}
+
+Errata
+Parser::parse_fields(Cursor &c, Value *obj, bool braced) {
+  Value *tail = nullptr;
+  while (true) {
+    c.skip_ws();
+    if (c.at_end()) {
+      if (braced) {
+        return Errata("Unterminated group opened at line {}.", obj->_line);
+      }
+      return {};
+    }
+    if ('}' == c.peek()) {
+      if (!braced) {
+        return Errata("Unmatched '}}' at line {} column {}.", c.line(), c.column());
+      }
+      c.take();
+      return {};
+    }
+    unsigned line = c.line(), col = c.column();
+    auto &&[key, key_errata] = this->parse_scalar(c);
+    if (!key_errata.is_ok()) {
+      key_errata.note("Expected a field name at line {} column {}.", line, col);
+      return std::move(key_errata);
+    }
+    c.skip_ws();
+    if (!c.at_end() && '=' == c.peek()) { // optional "name = value" style.
+      c.take();
+      c.skip_ws();
+    }
+    auto &&[value, errata] = this->parse_value(c);
+    if (!errata.is_ok()) {
+      errata.note("In field '{}' at line {}.", key, line);
+      return std::move(errata);
+    }
+    value->_key = key;
+    this->append(obj, tail, value);
+    // A terminating ';' is required after a scalar or list, optional after a group.
+    c.skip_ws();
+    if (!c.at_end() && ';' == c.peek()) {
+      c.take();
+    } else if (!value->is_object()) {
+      return Errata("Expected ';' after field '{}' at line {} column {}.", key, c.line(), c.column());
+    }
+  }
+}
+
+Rv<Value *>
+Parser::parse(TextView text) {
+  Cursor c{text};
+  auto *root = this->make_value(Value::Type::OBJECT, c);
+  if (Errata errata = this->parse_fields(c, root, false); !errata.is_ok()) {
+    return errata;
+  }
+  return root;
+}
+
+Rv<Value *>
+Parser::load(file::path const &path) {
+  std::error_code ec;
+  auto content = file::map(path, ec, file::mapping::advice::SEQUENTIAL);
+  if (ec) {
+    return Errata{ec, "Failed to map '{}'.", path};
+  }
+  return this->parse(TextView{content}); // mapping dropped on return - all results are in the arena.
+}
+
+} // namespace config
+}} // namespace swoc::SWOC_VERSION_NS
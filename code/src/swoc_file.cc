@@ -7,10 +7,16 @@
  */
 
 #include <variant>
+#include <algorithm>
+#include <cstring>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 #include <fcntl.h>
 #include <unistd.h>
 #include <dirent.h>
+#include <sys/mman.h>
 #include "swoc/swoc_file.h"
 #include "swoc/bwf_base.h"
 
@@ -472,6 +478,228 @@ load(const path &p, std::error_code &ec) {
   return zret;
 }
 
+namespace {
+
+/// Compute the number of loader threads for a batch of @a n_files given the requested @a n_threads.
+unsigned
+loader_count(size_t n_files, unsigned n_threads) {
+  if (0 == n_threads) {
+    n_threads = std::thread::hardware_concurrency();
+    if (0 == n_threads) {
+      n_threads = 1; // implementation can't say - don't guess high.
+    }
+  }
+  return std::min<size_t>(n_threads, n_files);
+}
+
+} // namespace
+
+std::vector<load_result>
+load_many(MemSpan<path const> paths, unsigned n_threads) {
+  std::vector<load_result> zret(paths.count());
+  for (size_t idx = 0; idx < paths.count(); ++idx) {
+    zret[idx]._path = paths[idx];
+  }
+
+  n_threads = loader_count(paths.count(), n_threads);
+  if (n_threads <= 1) { // nothing to overlap, load in place.
+    for (auto &r : zret) {
+      r._content = load(r._path, r._ec);
+    }
+    return zret;
+  }
+
+  std::atomic<size_t> next{0}; // index of the next file to load.
+  auto work = [&]() {
+    size_t idx;
+    while ((idx = next.fetch_add(1, std::memory_order_relaxed)) < zret.size()) {
+      zret[idx]._content = load(zret[idx]._path, zret[idx]._ec);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(n_threads);
+  for (unsigned t = 0; t < n_threads; ++t) {
+    threads.emplace_back(work);
+  }
+  for (auto &th : threads) {
+    th.join();
+  }
+  return zret;
+}
+
+void
+load_many(MemSpan<path const> paths, std::function<void(load_result &&)> const &cb, unsigned n_threads) {
+  n_threads = loader_count(paths.count(), n_threads);
+  if (n_threads <= 1) {
+    for (auto const &p : paths) {
+      load_result r{p, {}, {}};
+      r._content = load(r._path, r._ec);
+      cb(std::move(r));
+    }
+    return;
+  }
+
+  std::atomic<size_t> next{0}; // index of the next file to load.
+  std::mutex cb_mutex;         // serialize delivery so the callback need not be thread safe.
+  auto work = [&]() {
+    size_t idx;
+    while ((idx = next.fetch_add(1, std::memory_order_relaxed)) < paths.count()) {
+      load_result r{paths[idx], {}, {}};
+      r._content = load(r._path, r._ec);
+      std::lock_guard<std::mutex> lock{cb_mutex};
+      cb(std::move(r));
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(n_threads);
+  for (unsigned t = 0; t < n_threads; ++t) {
+    threads.emplace_back(work);
+  }
+  for (auto &th : threads) {
+    th.join();
+  }
+}
+
+mapping::~mapping() {
+  this->unmap();
+}
+
+auto
+mapping::operator=(self_type &&that) -> self_type & {
+  if (this != &that) {
+    this->unmap();
+    _span      = that._span;
+    that._span = {};
+  }
+  return *this;
+}
+
+void
+mapping::unmap() {
+  if (nullptr != _span.data()) {
+    // An empty file is mapped with length 1 - see @c map - so unmap at least that much.
+    ::munmap(const_cast<char *>(_span.data()), std::max<size_t>(_span.size(), 1));
+    _span = {};
+  }
+}
+
+std::error_code
+mapping::advise(advice hint) {
+  if (nullptr != _span.data()) {
+    int flag = MADV_NORMAL;
+    switch (hint) {
+    case advice::SEQUENTIAL:
+      flag = MADV_SEQUENTIAL;
+      break;
+    case advice::RANDOM:
+      flag = MADV_RANDOM;
+      break;
+    default:
+      break;
+    }
+    if (0 != ::madvise(const_cast<char *>(_span.data()), std::max<size_t>(_span.size(), 1), flag)) {
+      return std::error_code(errno, std::system_category());
+    }
+  }
+  return {};
+}
+
+mapping
+map(const path &p, std::error_code &ec, mapping::advice hint) {
+  ec.clear();
+  unique_fd fd(::open(p.c_str(), O_RDONLY));
+  if (fd < 0) {
+    ec = std::error_code(errno, std::system_category());
+    return {};
+  }
+  struct stat info {};
+  if (0 != ::fstat(fd, &info)) {
+    ec = std::error_code(errno, std::system_category());
+    return {};
+  }
+  size_t n = info.st_size;
+  // A zero length mapping is invalid - map at least one byte so an empty file still yields
+  // a valid (non null) mapping. The extra page is never accessed because the size is zero.
+  void *addr = ::mmap(nullptr, std::max<size_t>(n, 1), PROT_READ, MAP_SHARED, fd, 0);
+  if (MAP_FAILED == addr) {
+    ec = std::error_code(errno, std::system_category());
+    return {};
+  }
+  // The descriptor can be closed now - the mapping keeps the content live.
+  mapping zret{{static_cast<char const *>(addr), n}};
+  if (mapping::advice::NORMAL != hint) {
+    zret.advise(hint); // best effort - a failed hint doesn't invalidate the mapping.
+  }
+  return zret;
+}
+
+LineReader::LineReader(unique_fd &&fd, size_t buffer_size)
+  : _fd(std::move(fd)), _buffer(new char[std::max<size_t>(buffer_size, 2)]), _capacity(std::max<size_t>(buffer_size, 2)) {
+#if defined(POSIX_FADV_SEQUENTIAL)
+  ::posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL); // best effort read ahead hint.
+#endif
+}
+
+bool
+LineReader::refill() {
+  // Preserve the unconsumed tail at the front of the buffer - the single bounded copy for a
+  // line that spans a refill boundary.
+  if (!_avail.empty() && _avail.data() != _buffer.get()) {
+    std::memmove(_buffer.get(), _avail.data(), _avail.size());
+  }
+  _avail.assign(_buffer.get(), _avail.size());
+  while (_avail.size() < _capacity) {
+    auto n = ::read(_fd, _buffer.get() + _avail.size(), _capacity - _avail.size());
+    if (n > 0) {
+      _avail.assign(_buffer.get(), _avail.size() + n);
+      return true;
+    } else if (n == 0) {
+      _eof_p = true;
+      return false;
+    } else if (EINTR != errno) {
+      _ec    = std::error_code(errno, std::system_category());
+      _eof_p = true;
+      return false;
+    }
+  }
+  return false; // buffer is full - an over long line.
+}
+
+bool
+LineReader::next(TextView &line) {
+  while (true) {
+    if (auto nl = _avail.find('\n'); nl != TextView::npos) {
+      line = _avail.take_prefix(nl);
+      ++_line_no;
+      return true;
+    }
+    if (_eof_p || _avail.size() == _capacity) {
+      // End of input, or a line larger than the buffer - deliver what there is.
+      if (_avail.empty()) {
+        return false;
+      }
+      line = _avail;
+      _avail.remove_prefix(_avail.size());
+      ++_line_no;
+      return true;
+    }
+    this->refill();
+  }
+}
+
+LineReader
+lines(path const &p, std::error_code &ec, size_t buffer_size) {
+  ec.clear();
+  unique_fd fd(::open(p.c_str(), O_RDONLY));
+  if (fd < 0) {
+    ec = std::error_code(errno, std::system_category());
+    return LineReader{TextView{}};
+  }
+  return LineReader{std::move(fd), buffer_size};
+}
+
 } // namespace file
 
 BufferWriter &
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    CRC32C implementations and CPU feature dispatch.
+ */
+
+#include <array>
+
+#include "swoc/swoc_hash.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SWOC_CRC32C_HW 1
+#include <nmmintrin.h>
+#endif
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+namespace hash {
+
+namespace {
+
+/// Reflected CRC-32C (Castagnoli) polynomial.
+constexpr uint32_t POLY = 0x82F63B78u;
+
+/// Build the byte lookup table for the software implementation.
+std::array<uint32_t, 256>
+make_table() {
+  std::array<uint32_t, 256> table{};
+  for (uint32_t idx = 0; idx < 256; ++idx) {
+    uint32_t crc = idx;
+    for (int k = 0; k < 8; ++k) {
+      crc = (crc >> 1) ^ ((crc & 1) ? POLY : 0);
+    }
+    table[idx] = crc;
+  }
+  return table;
+}
+
+std::array<uint32_t, 256> const TABLE = make_table();
+
+/// Table driven implementation - always available.
+uint32_t
+crc32c_sw(uint32_t state, void const *data, size_t n) {
+  auto p = static_cast<unsigned char const *>(data);
+  while (n-- > 0) {
+    state = (state >> 8) ^ TABLE[(state ^ *p++) & 0xFF];
+  }
+  return state;
+}
+
+#if SWOC_CRC32C_HW
+
+/// SSE4.2 implementation - 8 bytes per instruction.
+__attribute__((target("sse4.2"))) uint32_t
+crc32c_hw(uint32_t state, void const *data, size_t n) {
+  auto p = static_cast<unsigned char const *>(data);
+#if defined(__x86_64__)
+  uint64_t crc = state;
+  while (n >= 8) {
+    uint64_t w;
+    std::memcpy(&w, p, sizeof(w));
+    crc  = _mm_crc32_u64(crc, w);
+    p   += 8;
+    n   -= 8;
+  }
+  state = static_cast<uint32_t>(crc);
+#endif
+  while (n-- > 0) {
+    state = _mm_crc32_u8(state, *p++);
+  }
+  return state;
+}
+
+#endif // SWOC_CRC32C_HW
+
+using crc_impl = uint32_t (*)(uint32_t, void const *, size_t);
+
+/// Pick the implementation once, at static initialization.
+crc_impl
+resolve_crc32c() {
+#if SWOC_CRC32C_HW
+  if (__builtin_cpu_supports("sse4.2")) {
+    return &crc32c_hw;
+  }
+#endif
+  return &crc32c_sw;
+}
+
+crc_impl const CRC32C_IMPL = resolve_crc32c();
+
+} // namespace
+
+uint32_t
+crc32c(void const *data, size_t n, uint32_t seed) {
+  return ~CRC32C_IMPL(~seed, data, n);
+}
+
+bool
+crc32c_hardware_p() {
+#if SWOC_CRC32C_HW
+  return CRC32C_IMPL == &crc32c_hw;
+#else
+  return false;
+#endif
+}
+
+namespace detail {
+
+uint32_t
+crc32c_update(uint32_t state, void const *data, size_t n) {
+  return CRC32C_IMPL(state, data, n);
+}
+
+} // namespace detail
+
+} // namespace hash
+}} // namespace swoc::SWOC_VERSION_NS
@@ -31,6 +31,60 @@ Set_Sockaddr_Len(T *addr) {
   Set_Sockaddr_Len_Case(addr, swoc::meta::CaseArg);
 }
 
+/// Hex digit value table - 0xFF marks a non-hex character.
+constexpr auto HEX_VALUE = []() {
+  std::array<uint8_t, 256> table{};
+  for (auto &v : table) {
+    v = 0xFF;
+  }
+  for (int i = 0; i < 10; ++i) {
+    table['0' + i] = uint8_t(i);
+  }
+  for (int i = 0; i < 6; ++i) {
+    table['a' + i] = uint8_t(10 + i);
+    table['A' + i] = uint8_t(10 + i);
+  }
+  return table;
+}();
+
+/** Fast path for plain dotted quad text.
+ *
+ * @param src Whitespace trimmed text.
+ * @param addr [out] Parsed address, host order.
+ * @return @c true if @a src parsed, @c false to fall back to the general parser.
+ *
+ * Single pass octet accumulation for the dominant "a.b.c.d" log form. Brackets, partial quads,
+ * and octal (leading zero) octets are left to the general parser.
+ */
+bool
+parse_dotted_quad(TextView src, in_addr_t &addr) {
+  if (src.size() < 7 || src.size() > 15) { // "0.0.0.0" .. "255.255.255.255"
+    return false;
+  }
+  uint32_t acc = 0, octet = 0;
+  unsigned n_digits = 0, n_octets = 0;
+  for (char c : src) {
+    if (c >= '0' && c <= '9') {
+      octet = octet * 10 + unsigned(c - '0');
+      if (++n_digits > 3 || octet > 255 || (2 == n_digits && octet < 10)) {
+        return false; // too wide, too big, or leading zero (octal to the general parser).
+      }
+    } else if ('.' == c && n_digits > 0 && n_octets < 3) {
+      acc = (acc << 8) | octet;
+      ++n_octets;
+      octet    = 0;
+      n_digits = 0;
+    } else {
+      return false;
+    }
+  }
+  if (3 != n_octets || 0 == n_digits) {
+    return false;
+  }
+  addr = (acc << 8) | octet;
+  return true;
+}
+
 } // namespace
 
 namespace swoc { inline namespace SWOC_VERSION_NS {
@@ -304,6 +358,9 @@ IP4Addr::load(std::string_view const &text) {
 
   // empty or trailing dot or empty brackets or unmatched brackets.
   src.trim_if(&isspace);
+  if (parse_dotted_quad(src, _addr)) {
+    return true;
+  }
   if (src.empty() || src.back() == '.' || ('[' == *src && ((++src).empty() || src.back() != ']'))) {
     return false;
   }
@@ -339,6 +396,16 @@ IP4Addr::load(std::string_view const &text) {
   return true;
 }
 
+size_t
+IP4Addr::parse_many(MemSpan<string_view const> const &texts, MemSpan<self_type> const &addrs) {
+  size_t zret = 0;
+  auto n      = std::min(texts.count(), addrs.count());
+  for (size_t idx = 0; idx < n; ++idx) {
+    zret += addrs[idx].load(texts[idx]);
+  }
+  return zret;
+}
+
 IP4Addr::IP4Addr(sockaddr_in const *sa) : _addr(reorder(sa->sin_addr.s_addr)) {}
 
 auto
@@ -414,6 +481,54 @@ IP6Addr::operator|=(self_type const &that) {
   return *this;
 }
 
+bool
+IP6Addr::parse_full_form(string_view const &src) {
+  if (src.size() < 15 || src.size() > 39) { // "0:0:0:0:0:0:0:0" .. full width quads.
+    return false;
+  }
+  quad_store_type quads;
+  char const *spot  = src.data();
+  char const *limit = spot + src.size();
+  for (unsigned n = 0; n < N_QUADS; ++n) {
+    uint32_t q        = 0;
+    unsigned n_digits = 0;
+    while (spot < limit) {
+      auto v = HEX_VALUE[uint8_t(*spot)];
+      if (0xFF == v) {
+        break;
+      }
+      q = (q << 4) | v;
+      ++n_digits;
+      ++spot;
+    }
+    if (0 == n_digits || n_digits > 4) {
+      return false;
+    }
+    quads[QUAD_IDX[n]] = quad_type(q);
+    if (n < N_QUADS - 1) {
+      if (spot >= limit || ':' != *spot) {
+        return false;
+      }
+      ++spot;
+    }
+  }
+  if (spot != limit) {
+    return false;
+  }
+  _addr._quad = quads;
+  return true;
+}
+
+size_t
+IP6Addr::parse_many(MemSpan<string_view const> const &texts, MemSpan<self_type> const &addrs) {
+  size_t zret = 0;
+  auto n      = std::min(texts.count(), addrs.count());
+  for (size_t idx = 0; idx < n; ++idx) {
+    zret += addrs[idx].load(texts[idx]);
+  }
+  return zret;
+}
+
 bool
 IP6Addr::load(std::string_view const &str) {
   TextView src{str};
@@ -422,6 +537,9 @@ IP6Addr::load(std::string_view const &str) {
   auto quad     = _addr._quad.data();
 
   src.trim_if(&isspace);
+  if (this->parse_full_form(src)) {
+    return true;
+  }
   if (src && '[' == *src) {
     ++src;
     if (src.empty() || src.back() != ']') {
@@ -558,6 +676,16 @@ IPAddr::load(const std::string_view &text) {
   return this->is_valid();
 }
 
+size_t
+IPAddr::parse_many(MemSpan<string_view const> const &texts, MemSpan<self_type> const &addrs) {
+  size_t zret = 0;
+  auto n      = std::min(texts.count(), addrs.count());
+  for (size_t idx = 0; idx < n; ++idx) {
+    zret += addrs[idx].load(texts[idx]);
+  }
+  return zret;
+}
+
 IPAddr &
 IPAddr::assign(sockaddr const *addr) {
   if (addr) {
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    Statistics support - histogram formatting.
+*/
+
+#include "swoc/swoc_stats.h"
+#include "swoc/bwf_base.h"
+
+namespace swoc { inline namespace SWOC_VERSION_NS {
+
+BufferWriter &
+bwformat(BufferWriter &w, bwf::Spec const &, stats::Histogram const &h) {
+  auto data  = h.fold();
+  bool first = true;
+  for (unsigned idx = 0; idx < stats::Histogram::N_BUCKETS; ++idx) {
+    if (auto n = data._count[idx]; n > 0) {
+      if (!first) {
+        w.write(' ');
+      }
+      uint64_t lo = stats::Histogram::bucket_min(idx);
+      uint64_t hi =
+        (idx + 1 < stats::Histogram::N_BUCKETS) ? stats::Histogram::bucket_min(idx + 1) - 1 : std::numeric_limits<uint64_t>::max();
+      if (lo == hi) {
+        w.print("{}: {}", lo, n);
+      } else {
+        w.print("{}-{}: {}", lo, hi, n);
+      }
+      first = false;
+    }
+  }
+  return w;
+}
+
+}} // namespace swoc::SWOC_VERSION_NS
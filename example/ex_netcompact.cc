@@ -81,7 +81,8 @@ main(int argc, char *argv[]) {
   // Load the file.
   swoc::file::path path{argv[1]};
   std::error_code ec;
-  std::string content = swoc::file::load(path, ec);
+  // Map rather than load - no copy, and the pages are shared with other processes using the file.
+  auto content = swoc::file::map(path, ec, swoc::file::mapping::advice::SEQUENTIAL);
   if (ec) {
     std::cerr << W().print(R"(Failed to open file "{}" - {}\n)", path, ec);
     exit(1);
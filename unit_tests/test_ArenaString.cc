@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    ArenaString unit tests.
+*/
+
+#include <string>
+
+#include "swoc/ArenaString.h"
+#include "catch.hpp"
+
+using swoc::ArenaString;
+using swoc::MemArena;
+using swoc::TextView;
+using namespace swoc::literals;
+
+TEST_CASE("ArenaString", "[libswoc][ArenaString]") {
+  MemArena arena;
+  ArenaString s{arena};
+
+  REQUIRE(s.empty());
+  REQUIRE(s.capacity() == 0); // nothing allocated for an empty string.
+
+  s.append("Evil "_tv);
+  s += "Dave"_tv;
+  s += ' ';
+  s.append("Rulz"_tv);
+  REQUIRE(s == "Evil Dave Rulz");
+  REQUIRE(s.size() == 14);
+  REQUIRE(arena.contains(s.data()));
+
+  // While the string is the most recent allocation it grows in place - no relocation.
+  char const *spot = s.data();
+  s.append(TextView{std::string(200, 'x')});
+  REQUIRE(s.data() == spot);
+  REQUIRE(s.size() == 214);
+  REQUIRE(s.capacity() >= 214);
+
+  // An intervening allocation forces relocation, preserving the content.
+  arena.alloc(8);
+  s.append(TextView{std::string(s.capacity(), 'y')});
+  REQUIRE(s.data() != spot);
+  REQUIRE(s.view().starts_with("Evil Dave Rulz"));
+  REQUIRE(s.view().suffix(1) == "y");
+
+  // assign resets, retaining storage.
+  auto cap = s.capacity();
+  s.assign("delain"_tv);
+  REQUIRE(s == "delain");
+  REQUIRE(s.capacity() == cap);
+  s.clear();
+  REQUIRE(s.empty());
+
+  // Conversion to view types.
+  ArenaString t{arena, "Persephone"_tv};
+  TextView tv = t;
+  std::string_view sv = t;
+  REQUIRE(tv == sv);
+  REQUIRE(tv == "Persephone");
+
+  // Move takes the storage.
+  ArenaString u{std::move(t)};
+  REQUIRE(u == "Persephone");
+  REQUIRE(t.empty());
+}
+
+TEST_CASE("ArenaString bwprint", "[libswoc][ArenaString][bwformat]") {
+  MemArena arena;
+  ArenaString s{arena};
+
+  swoc::bwprint(s, "{} purple {}", 56, "cows"_tv);
+  REQUIRE(s == "56 purple cows");
+
+  // Output past the current capacity - the retry path.
+  std::string big(3 * s.capacity(), 'z');
+  swoc::bwprint(s, "[{}]", big);
+  REQUIRE(s.size() == big.size() + 2);
+  REQUIRE(s.view().prefix(2) == "[z");
+  REQUIRE(s.view().suffix(2) == "z]");
+
+  // Reformat in to retained storage.
+  auto cap = s.capacity();
+  swoc::bwprint(s, "{}", "short"_tv);
+  REQUIRE(s == "short");
+  REQUIRE(s.capacity() == cap);
+}
@@ -19,11 +19,19 @@
  */
 
 #include <cstring>
+#include <sstream>
+
+#include <unistd.h>
+#include <cstdlib>
+
 #include "swoc/MemSpan.h"
 #include "swoc/TextView.h"
 #include "swoc/MemArena.h"
 #include "swoc/BufferWriter.h"
 #include "swoc/ArenaWriter.h"
+#include "swoc/BufferChain.h"
+#include "swoc/IoVecWriter.h"
+#include "swoc/SmallBufferWriter.h"
 #include "catch.hpp"
 
 using swoc::TextView;
@@ -402,6 +410,160 @@ TEST_CASE("ArenaWriter print", "[BW][ArenaWriter]") {
   REQUIRE(valid_p == true);
 }
 
+TEST_CASE("SmallBufferWriter", "[BW][SmallBufferWriter]") {
+  swoc::SmallBufferWriter<32> w;
+
+  // Fits inline - no allocation, no change in capacity.
+  w.print("{} bytes", 956);
+  REQUIRE(w.view() == "956 bytes");
+  REQUIRE(w.capacity() == 32);
+
+  // Overflow spills to the heap without truncation or error.
+  std::string expected{w.view()};
+  for (int i = 0; i < 64; ++i) {
+    w.print(" {}", i);
+    expected += " " + std::to_string(i);
+  }
+  REQUIRE(w.error() == false);
+  REQUIRE(w.extent() == w.size());
+  REQUIRE(w.view() == expected);
+  REQUIRE(w.capacity() > 32);
+
+  // A single write larger than the buffer must also spill.
+  swoc::SmallBufferWriter<16> w2;
+  std::string big(100, 'x');
+  w2.write(big.data(), big.size());
+  REQUIRE(w2.view() == big);
+
+  // Arena backed spill.
+  swoc::MemArena arena{1024};
+  swoc::SmallBufferWriter<16> aw{arena};
+  auto mark = arena.size();
+  aw.print("tiny");
+  REQUIRE(arena.size() == mark); // inline, nothing reserved in the arena.
+  for (int i = 0; i < 32; ++i) {
+    aw.print(" {:x}", i);
+  }
+  std::string a_expected{"tiny"};
+  for (int i = 0; i < 32; ++i) {
+    char buf[8];
+    snprintf(buf, sizeof(buf), " %x", i);
+    a_expected += buf;
+  }
+  REQUIRE(aw.view() == a_expected);
+  REQUIRE(arena.remaining() >= aw.size()); // output is in the remnant.
+}
+
+TEST_CASE("ChunkedArenaWriter", "[BW][ArenaWriter]") {
+  swoc::MemArena arena{64};
+  swoc::ChunkedArenaWriter cw{arena, 64}; // small chunks to force chaining.
+  std::string expected;
+
+  // Push enough output to span several chunks - no output may be lost or reordered.
+  for (int i = 0; i < 100; ++i) {
+    cw.print("item {} |{:>6}|\n", i, i * i);
+    expected += "item " + std::to_string(i) + " |" + std::string(6 - std::to_string(i * i).size(), ' ') +
+                std::to_string(i * i) + "|\n";
+  }
+  REQUIRE(cw.extent() == expected.size());
+  REQUIRE(cw.chunks().size() > 1);
+
+  std::ostringstream os;
+  cw >> os;
+  REQUIRE(os.str() == expected);
+
+  // Assembly copies each byte once, after which the output is a single chunk.
+  auto span = cw.assemble();
+  REQUIRE(span.size() == expected.size());
+  REQUIRE(TextView(span.data(), span.size()) == expected);
+  REQUIRE(cw.chunks().size() == 1);
+  REQUIRE(cw.assemble().data() == span.data()); // no further copying.
+
+  // Pre-reservation keeps the output in one chunk.
+  swoc::MemArena arena2{64};
+  swoc::ChunkedArenaWriter cw2{arena2, 64};
+  cw2.reserve(expected.size());
+  for (int i = 0; i < 100; ++i) {
+    cw2.print("item {} |{:>6}|\n", i, i * i);
+  }
+  REQUIRE(cw2.extent() == expected.size());
+  REQUIRE(cw2.chunks().size() == 1);
+
+  // Discard across chunk boundaries.
+  swoc::MemArena arena3{16};
+  swoc::ChunkedArenaWriter cw3{arena3, 16};
+  cw3.write("0123456789", 10).write("abcdefghijklmnopqrst", 20);
+  auto pre_discard = cw3.chunks().size();
+  cw3.discard(25);
+  REQUIRE(cw3.extent() == 5);
+  REQUIRE(cw3.chunks().size() <= pre_discard);
+  std::ostringstream os3;
+  cw3 >> os3;
+  REQUIRE(os3.str() == "01234");
+}
+
+TEST_CASE("IoVecWriter", "[BW][IoVecWriter]") {
+  swoc::IoVecWriter w{64}; // small reference threshold, to keep test data small.
+
+  // Small writes coalesce in to a single chunk.
+  w.write("alpha ", 6).write("bravo ", 6).write('x');
+  REQUIRE(w.extent() == 13);
+  REQUIRE(w.size() == 13);
+  REQUIRE(w.iovec_span().size() == 1);
+
+  // A span of at least the reference size is recorded by reference, not copied.
+  static constexpr TextView BODY{"0123456789012345678901234567890123456789012345678901234567890123456789"};
+  w.write(MemSpan<char const>{BODY.data(), BODY.size()});
+  auto iov = w.iovec_span();
+  REQUIRE(w.extent() == 13 + BODY.size());
+  REQUIRE(iov.size() == 2);
+  REQUIRE(iov[1].iov_base == static_cast<void const *>(BODY.data())); // zero copy.
+  REQUIRE(iov[1].iov_len == BODY.size());
+
+  // A small span is copied, starting a new chunk after the referenced span.
+  w.write(MemSpan<char const>{"tail", 4});
+  iov = w.iovec_span();
+  REQUIRE(iov.size() == 3);
+  REQUIRE(iov[2].iov_len == 4);
+
+  std::ostringstream os;
+  w >> os;
+  REQUIRE(os.str() == std::string("alpha bravo x").append(BODY).append("tail"));
+
+  // Formatted output works through the standard interface, including alignment via aux / commit.
+  w.clear();
+  REQUIRE(w.iovec_span().size() == 0);
+  w.print("{} scatter |{:>10}|", 956, "out");
+  std::ostringstream os2;
+  w >> os2;
+  REQUIRE(os2.str() == "956 scatter |       out|");
+  REQUIRE(w.extent() == os2.str().size());
+
+  // Discard drops from the end, across scatter elements.
+  w.clear().write("abcdef", 6);
+  w.write(MemSpan<char const>{BODY.data(), BODY.size()});
+  w.discard(BODY.size() + 2);
+  REQUIRE(w.extent() == 4);
+  REQUIRE(w.iovec_span().size() == 1);
+  REQUIRE(w.iovec_span()[0].iov_len == 4);
+
+  // Hand the scatter list to writev and verify the bytes land in order.
+  w.clear().print("header: {}\r\n\r\n", 956);
+  auto header_len = w.extent();
+  w.write(MemSpan<char const>{BODY.data(), BODY.size()});
+  char path[] = "/tmp/swoc_iovec_XXXXXX";
+  int fd      = ::mkstemp(path);
+  REQUIRE(fd >= 0);
+  auto n = w.writev(fd);
+  REQUIRE(n == ssize_t(w.extent()));
+  std::string content(w.extent(), '\0');
+  REQUIRE(::pread(fd, content.data(), content.size(), 0) == ssize_t(content.size()));
+  REQUIRE(TextView(content).prefix(header_len) == "header: 956\r\n\r\n");
+  REQUIRE(TextView(content).remove_prefix(header_len) == BODY);
+  ::close(fd);
+  ::unlink(path);
+}
+
 #if 0
 // Need Endpoint or some other IP address parsing support to load the test values.
 TEST_CASE("BufferWriter IP", "[libswoc][ip][bwf]") {
@@ -504,3 +666,85 @@ TEST_CASE("BufferWriter IP", "[libswoc][ip][bwf]") {
   REQUIRE(w.view() == "0x1337beef");
 }
 #endif
+
+TEST_CASE("BufferChain", "[BufferChain]") {
+  swoc::BufferChain chain{64}; // small blocks to force chaining.
+  REQUIRE(chain.extent() == 0);
+  REQUIRE(chain.block_count() == 0);
+  REQUIRE(chain.data() == nullptr);
+
+  // Build up output that crosses several blocks.
+  std::string expected;
+  for (int i = 0; i < 20; ++i) {
+    chain.print("chunk {} of the response body|", i);
+    expected += "chunk " + std::to_string(i) + " of the response body|";
+  }
+  REQUIRE(chain.extent() == expected.size());
+  REQUIRE(chain.block_count() > 1);
+  REQUIRE_FALSE(chain.error());
+
+  // Every block except the last must be full.
+  auto assemble = [](swoc::BufferChain const &c) {
+    std::string zret;
+    for (auto const &b : c) {
+      zret.append(b.view().data(), b.view().size());
+    }
+    return zret;
+  };
+  size_t idx = 0;
+  for (auto const &b : chain) {
+    if (++idx < chain.block_count()) {
+      REQUIRE(b.remaining() == 0);
+    }
+  }
+  REQUIRE(assemble(chain) == expected);
+
+  // iovec export for writev.
+  std::array<struct iovec, 40> iov;
+  auto n_iov = chain.fill_iov(swoc::MemSpan<struct iovec>{iov.data(), iov.size()});
+  REQUIRE(n_iov == chain.block_count());
+  size_t iov_total = 0;
+  for (size_t i = 0; i < n_iov; ++i) {
+    iov_total += iov[i].iov_len;
+  }
+  REQUIRE(iov_total == chain.extent());
+  // A short array fills only its own length.
+  REQUIRE(chain.fill_iov(swoc::MemSpan<struct iovec>{iov.data(), 2}) == 2);
+
+  // O(1) append of another chain.
+  swoc::BufferChain tail_chain{64};
+  tail_chain.write("-- trailer --");
+  expected += "-- trailer --";
+  chain.append(std::move(tail_chain));
+  REQUIRE(chain.extent() == expected.size());
+  REQUIRE(assemble(chain) == expected);
+  REQUIRE(tail_chain.extent() == 0);
+  tail_chain.write("reused"); // donor remains usable.
+  REQUIRE(tail_chain.extent() == 6);
+
+  // Discard across a block boundary.
+  chain.discard(20);
+  expected.resize(expected.size() - 20);
+  REQUIRE(chain.extent() == expected.size());
+  REQUIRE(assemble(chain) == expected);
+
+  // Clear and reuse.
+  chain.clear();
+  REQUIRE(chain.extent() == 0);
+  REQUIRE(chain.block_count() == 0);
+  chain.write("fresh start");
+  REQUIRE(assemble(chain) == "fresh start");
+
+  // Single write larger than a block spans blocks.
+  swoc::BufferChain big{16};
+  std::string large(100, 'x');
+  big.write(large.data(), large.size());
+  REQUIRE(big.extent() == large.size());
+  REQUIRE(big.block_count() == (100 + 15) / 16);
+  REQUIRE(assemble(big) == large);
+
+  // Stream output.
+  std::ostringstream os;
+  big >> os;
+  REQUIRE(os.str() == large);
+}
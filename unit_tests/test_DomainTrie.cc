@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    DomainTrie unit tests.
+*/
+
+#include <string>
+
+#include "swoc/DomainTrie.h"
+#include "swoc/bwf_base.h"
+#include "catch.hpp"
+
+using swoc::DomainTrie;
+using swoc::TextView;
+using namespace swoc::literals;
+
+TEST_CASE("DomainTrie", "[libswoc][DomainTrie]") {
+  DomainTrie<int> trie;
+
+  REQUIRE(trie.count() == 0);
+  REQUIRE(trie.match("example.com"_tv) == nullptr);
+
+  trie.mark("example.com"_tv, 1);
+  trie.mark("*.example.com"_tv, 2);
+  trie.mark("ns1.example.com"_tv, 3);
+  trie.mark("*.cdn.example.com"_tv, 4);
+  trie.mark("swoc.io"_tv, 5);
+  REQUIRE(trie.count() == 5);
+
+  // Exact beats wildcard, deeper wildcard beats shallower.
+  REQUIRE(*trie.match("example.com"_tv) == 1);
+  REQUIRE(*trie.match("www.example.com"_tv) == 2);
+  REQUIRE(*trie.match("ns1.example.com"_tv) == 3);
+  REQUIRE(*trie.match("a.b.example.com"_tv) == 2);
+  REQUIRE(*trie.match("edge.cdn.example.com"_tv) == 4);
+  REQUIRE(*trie.match("a.edge.cdn.example.com"_tv) == 4);
+  REQUIRE(*trie.match("cdn.example.com"_tv) == 2); // wildcard needs a label to its left.
+
+  // Non-matches - wrong domain, bare suffix of a wildcard.
+  REQUIRE(trie.match("example.org"_tv) == nullptr);
+  REQUIRE(trie.match("com"_tv) == nullptr);
+  REQUIRE(trie.match("badexample.com"_tv) == nullptr);
+  REQUIRE(trie.match("io"_tv) == nullptr);
+  REQUIRE(*trie.match("swoc.io"_tv) == 5);
+  REQUIRE(trie.match("x.swoc.io"_tv) == nullptr);
+
+  // DNS names are case insensitive, trailing dots are ignored.
+  REQUIRE(*trie.match("WWW.Example.COM"_tv) == 2);
+  REQUIRE(*trie.match("ns1.example.com."_tv) == 3);
+  trie.mark("NS2.Example.Com"_tv, 6);
+  REQUIRE(*trie.match("ns2.example.com"_tv) == 6);
+
+  // Re-marking replaces the payload without a new pattern.
+  trie.mark("example.com"_tv, 10);
+  REQUIRE(trie.count() == 6);
+  REQUIRE(*trie.match("example.com"_tv) == 10);
+
+  // Bare "*" matches anything not better matched.
+  trie.mark("*"_tv, 99);
+  REQUIRE(*trie.match("anything.at.all"_tv) == 99);
+  REQUIRE(*trie.match("www.example.com"_tv) == 2);
+  REQUIRE(trie.match(""_tv) == nullptr);
+}
+
+TEST_CASE("DomainTrie scale", "[libswoc][DomainTrie]") {
+  DomainTrie<unsigned> trie;
+  std::string name;
+
+  // A wildcard per "customer" - the linear scan case this replaces.
+  for (unsigned idx = 0; idx < 1000; ++idx) {
+    trie.mark(swoc::bwprint(name, "*.customer-{}.example.com", idx), idx);
+  }
+  REQUIRE(trie.count() == 1000);
+
+  for (unsigned idx = 0; idx < 1000; ++idx) {
+    auto spot = trie.match(swoc::bwprint(name, "origin.customer-{}.example.com", idx));
+    REQUIRE(spot != nullptr);
+    REQUIRE(*spot == idx);
+  }
+  REQUIRE(trie.match("origin.customer-1000.example.com"_tv) == nullptr);
+}
@@ -4,7 +4,9 @@
     Errata unit tests.
 */
 
+#include <atomic>
 #include <memory>
+#include <thread>
 #include <errno.h>
 #include "swoc/Errata.h"
 #include "swoc/bwf_std.h"
@@ -428,3 +430,151 @@ TEST_CASE("Errata Autotext", "[libswoc][errata]") {
   swoc::meta::let g2(Errata::FAILURE_SEVERITY, ERRATA_ERROR);
   REQUIRE(f.is_ok());
 }
+
+TEST_CASE("Errata arena pool", "[libswoc][Errata]") {
+  swoc::ArenaPool::drain();
+  {
+    Errata errata{ERRATA_ERROR, "pool seed"};
+    errata.note("annotation {}", 1);
+  }
+  // Destruction retires the annotation storage to the pool.
+  auto pooled = swoc::ArenaPool::local_count();
+  REQUIRE(pooled > 0);
+  {
+    Errata errata{ERRATA_ERROR, "pool reuse"};
+    // The storage came from the pool, not the heap.
+    REQUIRE(swoc::ArenaPool::local_count() == pooled - 1);
+  }
+  REQUIRE(swoc::ArenaPool::local_count() == pooled);
+}
+
+TEST_CASE("Errata lazy", "[libswoc][Errata]") {
+  static const swoc::bwf::Format fmt{"Deferred {} - {}"};
+  std::string s;
+  swoc::meta::let guard(Errata::SINK_SEVERITY, ERRATA_WARN);
+
+  // The success representation must not allocate - severity only instances are just the handle.
+  REQUIRE(sizeof(Errata) <= 2 * sizeof(void *));
+  Errata ok{ERRATA_INFO};
+  REQUIRE(ok.is_ok());
+  REQUIRE(ok.length() == 0);
+  Errata moved{std::move(ok)};
+  REQUIRE(moved.severity() == ERRATA_INFO);
+
+  {
+    Errata errata{ERRATA_INFO};
+    errata.note(fmt, 1, "alpha"sv);
+    REQUIRE(errata.length() == 1);
+    REQUIRE(errata.front().is_deferred());
+    REQUIRE(errata.front().text().empty());
+
+    // Below the sink threshold - printing must not materialize.
+    swoc::bwprint(s, "{}", errata);
+    REQUIRE(errata.front().is_deferred());
+    REQUIRE(std::string::npos == s.find("Deferred"));
+
+    // Cross the threshold - now printing formats the captured arguments.
+    errata.note(ERRATA_ERROR, fmt, 2, "bravo"sv);
+    swoc::bwprint(s, "{}", errata);
+    REQUIRE_FALSE(errata.front().is_deferred());
+    REQUIRE(errata.front().text() == "Deferred 1 - alpha");
+    REQUIRE(std::string::npos != s.find("Deferred 2 - bravo"));
+  }
+
+  // Deferred annotations must survive being copied between instances.
+  {
+    Errata src{ERRATA_INFO};
+    src.note(fmt, 3, "charlie"sv);
+    Errata dst{ERRATA_ERROR, "Nominal failure"};
+    dst.note(src);
+    REQUIRE(dst.back().is_deferred());
+    dst.materialize();
+    REQUIRE(dst.back().text() == "Deferred 3 - charlie");
+  }
+
+  // Sink path - materialized only on failure.
+  auto &sink_text = ErrataSinkText;
+  sink_text.clear();
+  {
+    Errata errata{ERRATA_ERROR, "Nominal failure"};
+    errata.note(fmt, 42, "delta"sv);
+  }
+  REQUIRE(std::string::npos != sink_text.find("Deferred 42 - delta"));
+  sink_text.clear();
+  {
+    Errata errata{ERRATA_INFO};
+    errata.note(fmt, 7, "echo"sv);
+  }
+  REQUIRE(std::string::npos == sink_text.find("Deferred 7"));
+}
+
+TEST_CASE("Errata async sink", "[libswoc][Errata]") {
+  static std::thread::id const Main_Id = std::this_thread::get_id();
+  static std::atomic<int> Count{0};
+  static std::atomic<int> Off_Thread{0};
+  swoc::Errata::register_sink([](Errata const &) -> void {
+    ++Count;
+    if (std::this_thread::get_id() != Main_Id) {
+      ++Off_Thread;
+    }
+  });
+
+  // Severity at or above ERROR stays synchronous, below is queued.
+  swoc::Errata::enable_async_sink(ERRATA_ERROR);
+  int base = Count;
+  for (int i = 0; i < 10; ++i) {
+    Errata errata{ERRATA_INFO, "queued"};
+  }
+  {
+    Errata errata{ERRATA_ERROR, "bypass"};
+  }
+  swoc::Errata::disable_async_sink(); // drains the queue and joins the thread.
+  REQUIRE(Count == base + 11);
+  // The queued erratum were delivered off thread, the bypass in this thread.
+  REQUIRE(Off_Thread == 10);
+
+  // Disabled - everything is synchronous again.
+  base = Count;
+  {
+    Errata errata{ERRATA_INFO, "direct"};
+  }
+  REQUIRE(Count == base + 1);
+  REQUIRE(Off_Thread == 10);
+}
+
+TEST_CASE("Errata serialization", "[libswoc][Errata][serialize]") {
+  swoc::LocalBufferWriter<1024> w;
+  Errata::FILTER_SEVERITY = ERRATA_DBG; // keep all annotations - other tests may have raised this.
+
+  Errata errata{ERRATA_ERROR, "base failure"};
+  errata.note(ERRATA_INFO, R"(path "/tmp/x" not found)");
+  errata.note(ERRATA_DBG, "retry\ncount 3");
+
+  swoc::errata::to_json(w, errata);
+  REQUIRE(w.view() == R"({"severity":"Error","notes":[)"
+                      R"({"level":0,"text":"base failure"},)"
+                      R"({"level":0,"severity":"Info","text":"path \"/tmp/x\" not found"},)"
+                      R"({"level":0,"severity":"Debug","text":"retry\ncount 3"}]})");
+
+  // Severity filtering during the walk.
+  w.clear();
+  swoc::errata::to_json(w, errata, ERRATA_INFO);
+  REQUIRE(TextView(w.view()).find("retry") == TextView::npos);
+  REQUIRE(TextView(w.view()).find("not found") != TextView::npos);
+
+  // Error code serialization.
+  w.clear();
+  Errata coded{std::error_code(EPERM, std::generic_category()), ERRATA_WARN, "denied"};
+  swoc::errata::to_json(w, coded);
+  REQUIRE(TextView(w.view()).starts_with(R"({"severity":"Warn","code":1,"code_text":")"));
+
+  // logfmt - same single pass walk.
+  w.clear();
+  swoc::errata::to_logfmt(w, errata, ERRATA_INFO);
+  REQUIRE(w.view() == R"(severity=Error note0="base failure" note1="path \"/tmp/x\" not found")");
+
+  // Empty errata serializes to a valid empty object.
+  w.clear();
+  swoc::errata::to_json(w, Errata{});
+  REQUIRE(w.view() == R"({"notes":[]})");
+}
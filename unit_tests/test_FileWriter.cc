@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    FileWriter unit tests.
+*/
+
+#include <fcntl.h>
+
+#include <string>
+
+#include "swoc/FileWriter.h"
+#include "swoc/bwf_base.h"
+#include "catch.hpp"
+
+using swoc::FileWriter;
+using swoc::TextView;
+using namespace swoc::literals;
+
+TEST_CASE("FileWriter", "[libswoc][FileWriter]") {
+  swoc::file::path path{"/tmp/swoc_file_writer_test.txt"};
+  std::error_code ec;
+
+  {
+    swoc::file::unique_fd fd{::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)};
+    REQUIRE(fd >= 0);
+    FileWriter w{std::move(fd), FileWriter::DEFAULT_FLUSH_SIZE, 32}; // small blocks - multi element writev.
+
+    w.print("Delain for {}!\n", 956);
+    w.write("A line that is longer than a single block of the chain.\n"_tv);
+    REQUIRE(w.flushed() == 0); // under the threshold - still buffered.
+    REQUIRE(w.extent() > 0);
+    REQUIRE_FALSE(w.error());
+
+    REQUIRE(w.flush());
+    REQUIRE(w.flushed() == w.extent());
+    // Destructor flushes the epilogue.
+    w.print("bye {}", "now"_tv);
+  }
+
+  auto content = swoc::file::load(path, ec);
+  REQUIRE_FALSE(ec);
+  REQUIRE(content == "Delain for 956!\nA line that is longer than a single block of the chain.\nbye now");
+
+  // Automatic flush once the threshold is reached.
+  {
+    swoc::file::unique_fd fd{::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)};
+    REQUIRE(fd >= 0);
+    FileWriter w{std::move(fd), 64, 32};
+    std::string line(100, 'z');
+    w.write(TextView{line});
+    REQUIRE(w.flushed() == 100); // over the threshold - drained without an explicit flush.
+  }
+  content = swoc::file::load(path, ec);
+  REQUIRE(content == std::string(100, 'z'));
+  swoc::file::remove(path, ec);
+
+  // I/O failure - captured in the errata, buffered data dropped, state clearable.
+  {
+    swoc::file::unique_fd fd{::open("/dev/null", O_RDONLY)};
+    REQUIRE(fd >= 0);
+    FileWriter w{std::move(fd)};
+    w.write("doomed"_tv);
+    REQUIRE_FALSE(w.flush());
+    REQUIRE(w.error());
+    REQUIRE(w.errata().length() == 1);
+    REQUIRE(w.extent() == w.flushed() + 0); // the buffered bytes were dropped.
+    w.clear_error();
+    REQUIRE_FALSE(w.error());
+    REQUIRE(w.errata().length() == 0);
+  }
+}
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    FixedFunction unit tests.
+*/
+
+#include <memory>
+#include <string>
+
+#include "swoc/FixedFunction.h"
+#include "swoc/TextView.h"
+#include "catch.hpp"
+
+using swoc::FixedFunction;
+using swoc::TextView;
+using namespace swoc::literals;
+
+TEST_CASE("FixedFunction", "[libswoc][FixedFunction]") {
+  FixedFunction<int(int)> f;
+  REQUIRE_FALSE(f);
+
+  f = [](int x) { return x + 1; };
+  REQUIRE(f);
+  REQUIRE(f(955) == 956);
+  REQUIRE(f.is_trivial()); // capture free - relocatable.
+
+  // Captures of views and scalars stay trivial.
+  TextView tag{"delain"_tv};
+  int n = 2;
+  FixedFunction<size_t(size_t)> g{[tag, n](size_t x) { return x + n * tag.size(); }};
+  REQUIRE(g(1) == 13);
+  REQUIRE(g.is_trivial());
+
+  // Move transfers the target and empties the source.
+  auto g2{std::move(g)};
+  REQUIRE(g2(1) == 13);
+  REQUIRE_FALSE(g);
+
+  f.reset();
+  REQUIRE_FALSE(f);
+}
+
+TEST_CASE("FixedFunction non-trivial", "[libswoc][FixedFunction]") {
+  // A capture with a real destructor - dispatched through the operations table.
+  auto sp    = std::make_shared<std::string>("bravo");
+  auto wp    = std::weak_ptr<std::string>(sp);
+  using FF   = FixedFunction<std::string()>;
+  auto ff_up = std::make_unique<FF>([sp]() { return *sp; });
+  sp.reset();
+
+  REQUIRE_FALSE(ff_up->is_trivial());
+  REQUIRE((*ff_up)() == "bravo");
+  REQUIRE(wp.use_count() == 1); // the capture holds the only reference.
+
+  // Move must hand off ownership, not duplicate or drop it.
+  FF ff2{std::move(*ff_up)};
+  REQUIRE(wp.use_count() == 1);
+  REQUIRE(ff2() == "bravo");
+
+  ff_up.reset();                // destroying the moved-from instance is harmless.
+  REQUIRE(wp.use_count() == 1); // and doesn't touch the capture.
+
+  ff2.reset();
+  REQUIRE(wp.use_count() == 0); // capture destructed with the target.
+
+  // Assignment over an existing target destructs the old target.
+  auto s1 = std::make_shared<std::string>("old");
+  auto s2 = std::make_shared<std::string>("new");
+  FF ff3{[s1]() { return *s1; }};
+  ff3 = [s2]() { return *s2; };
+  REQUIRE(s1.use_count() == 1); // only the local reference remains.
+  REQUIRE(ff3() == "new");
+}
@@ -0,0 +1,153 @@
+/** @file
+
+    FlatHashMap unit tests.
+
+    @section license License
+
+    Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+    agreements.  See the NOTICE file distributed with this work for additional information regarding
+    copyright ownership.  The ASF licenses this file to you under the Apache License, Version 2.0
+    (the "License"); you may not use this file except in compliance with the License.  You may
+    obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software distributed under the
+    License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+    either express or implied. See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <string>
+#include <unordered_set>
+
+#include "swoc/FlatHashMap.h"
+#include "swoc/MemArena.h"
+#include "catch.hpp"
+
+using swoc::FlatHashMap;
+using swoc::TextView;
+
+TEST_CASE("FlatHashMap basic", "[libswoc][FlatHashMap]") {
+  FlatHashMap<int, std::string> map;
+
+  REQUIRE(map.count() == 0);
+  REQUIRE(map.begin() == map.end());
+  REQUIRE(map.find(56) == map.end());
+
+  auto result = map.insert({1, "one"});
+  REQUIRE(result.second == true);
+  REQUIRE(result.first->second == "one");
+  result = map.insert({1, "uno"});
+  REQUIRE(result.second == false);
+  REQUIRE(result.first->second == "one"); // first insert wins.
+
+  map[2] = "two";
+  map[3] = "three";
+  REQUIRE(map.count() == 3);
+
+  auto spot = map.find(2);
+  REQUIRE(spot != map.end());
+  REQUIRE(spot->second == "two");
+  REQUIRE(map.find(17) == map.end());
+
+  REQUIRE(map.erase(2) == true);
+  REQUIRE(map.erase(2) == false);
+  REQUIRE(map.count() == 2);
+  REQUIRE(map.find(2) == map.end());
+  map[2] = "dos"; // key can be reused after erase.
+  REQUIRE(map.find(2)->second == "dos");
+
+  map.clear();
+  REQUIRE(map.count() == 0);
+  REQUIRE(map.find(1) == map.end());
+}
+
+TEST_CASE("FlatHashMap expansion", "[libswoc][FlatHashMap]") {
+  static constexpr unsigned N = 4000;
+  FlatHashMap<unsigned, unsigned> map;
+
+  for (unsigned i = 0; i < N; ++i) {
+    map[i] = i * i;
+  }
+  REQUIRE(map.count() == N);
+  // Occupancy limit must hold after growth.
+  REQUIRE(map.count() * 100 <= map.capacity() * map.get_expansion_limit());
+  bool miss_p = false;
+  for (unsigned i = 0; i < N; ++i) {
+    auto spot = map.find(i);
+    if (spot == map.end() || spot->second != i * i) {
+      miss_p = true;
+    }
+  }
+  REQUIRE(miss_p == false);
+
+  // Erase the odd keys, verify the rest survive the tombstones and a forced expansion.
+  for (unsigned i = 1; i < N; i += 2) {
+    map.erase(i);
+  }
+  REQUIRE(map.count() == N / 2);
+  map.expand();
+  miss_p        = false;
+  bool stray_p  = false;
+  for (unsigned i = 0; i < N; ++i) {
+    auto spot = map.find(i);
+    if (i % 2) {
+      stray_p = stray_p || spot != map.end();
+    } else {
+      miss_p = miss_p || spot == map.end() || spot->second != i * i;
+    }
+  }
+  REQUIRE(miss_p == false);
+  REQUIRE(stray_p == false);
+
+  // Iteration covers exactly the live elements.
+  std::unordered_set<unsigned> seen;
+  for (auto const &[key, value] : map) {
+    REQUIRE(value == key * key);
+    seen.insert(key);
+  }
+  REQUIRE(seen.size() == map.count());
+
+  // Iterator based erase returns the next element.
+  auto spot  = map.begin();
+  auto total = map.count();
+  while (spot != map.end()) {
+    spot = map.erase(spot);
+    --total;
+    REQUIRE(map.count() == total);
+  }
+  REQUIRE(map.count() == 0);
+}
+
+TEST_CASE("FlatHashMap policies", "[libswoc][FlatHashMap]") {
+  FlatHashMap<unsigned, unsigned> map;
+  map.set_expansion_policy(decltype(map)::MANUAL);
+  map.reserve(100);
+  auto cap = map.capacity();
+  REQUIRE(cap >= 100);
+  for (unsigned i = 0; i < 100; ++i) {
+    map[i] = i;
+  }
+  REQUIRE(map.capacity() == cap); // MANUAL - no growth while slots remain.
+  map.expand();
+  REQUIRE(map.capacity() == 2 * cap);
+  REQUIRE(map.find(73) != map.end());
+
+  // Arena backed map with view keys.
+  swoc::MemArena arena;
+  FlatHashMap<TextView, unsigned> views{arena};
+  views.reserve(50);
+  REQUIRE(arena.size() > 0);
+  views[TextView{"alpha"}]   = 1;
+  views[TextView{"bravo"}]   = 2;
+  views[TextView{"charlie"}] = 3;
+  REQUIRE(views.find("bravo")->second == 2);
+  REQUIRE(views.find("delta") == views.end());
+
+  // Move transfers the table.
+  auto moved{std::move(views)};
+  REQUIRE(moved.count() == 3);
+  REQUIRE(moved.find("charlie")->second == 3);
+  REQUIRE(views.count() == 0);
+}
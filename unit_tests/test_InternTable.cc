@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    InternTable unit tests.
+*/
+
+#include <array>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "swoc/InternTable.h"
+#include "swoc/bwf_base.h"
+#include "catch.hpp"
+
+using swoc::InternTable;
+using swoc::TextView;
+using namespace swoc::literals;
+
+TEST_CASE("InternTable", "[libswoc][InternTable]") {
+  InternTable table;
+  REQUIRE(table.count() == 0);
+
+  // Interning the same text yields the identical view - pointer equality.
+  auto v1 = table.intern("Comcast"_tv);
+  auto v2 = table.intern("Comcast"_tv);
+  REQUIRE(v1 == "Comcast");
+  REQUIRE(v1.data() == v2.data());
+  REQUIRE(table.count() == 1);
+  REQUIRE(table.ref_count(v1) == 2);
+
+  // Equal content from different storage still dedupes.
+  std::string s{"Comcast"};
+  REQUIRE(table.intern(TextView{s}).data() == v1.data());
+  REQUIRE(table.ref_count(v1) == 3);
+
+  // Distinct strings are distinct entries.
+  auto v3 = table.intern("US"_tv);
+  REQUIRE(v3.data() != v1.data());
+  REQUIRE(table.count() == 2);
+
+  // find does not change counts.
+  REQUIRE(table.find("US"_tv).data() == v3.data());
+  REQUIRE(table.find("DE"_tv).empty());
+  REQUIRE(table.ref_count(v3) == 1);
+
+  // Release removes at zero, entry can be interned afresh.
+  REQUIRE(table.release("Comcast"_tv) == 2);
+  REQUIRE(table.release("Comcast"_tv) == 1);
+  REQUIRE(table.release("Comcast"_tv) == 0);
+  REQUIRE(table.find("Comcast"_tv).empty());
+  REQUIRE(table.count() == 1);
+  table.intern("Comcast"_tv);
+  REQUIRE(table.count() == 2);
+
+  // Views remain stable across growth.
+  std::string name;
+  for (unsigned idx = 0; idx < 2000; ++idx) {
+    table.intern(swoc::bwprint(name, "entry-{}", idx));
+  }
+  REQUIRE(table.find("US"_tv).data() == v3.data());
+  REQUIRE(table.count() == 2002);
+
+  table.clear();
+  REQUIRE(table.count() == 0);
+  REQUIRE(table.size() == 0);
+}
+
+TEST_CASE("InternTable bulk and freeze", "[libswoc][InternTable]") {
+  InternTable table;
+
+  // Bulk intern - repeated values collapse, return counts the new entries.
+  std::array<TextView, 6> texts{"alpha"_tv, "bravo"_tv, "alpha"_tv, "charlie"_tv, "bravo"_tv, "alpha"_tv};
+  std::array<TextView, 6> views;
+  REQUIRE(table.intern(swoc::MemSpan<TextView const>{texts.data(), texts.size()},
+                       swoc::MemSpan<TextView>{views.data(), views.size()}) == 3);
+  REQUIRE(table.count() == 3);
+  REQUIRE(views[0].data() == views[2].data());
+  REQUIRE(views[0].data() == views[5].data());
+  REQUIRE(views[1].data() == views[4].data());
+  REQUIRE(table.ref_count("alpha"_tv) == 3);
+
+  // Frozen - reads work concurrently, mutation throws.
+  table.freeze();
+  REQUIRE(table.is_frozen());
+  REQUIRE_THROWS_AS(table.intern("delta"_tv), std::logic_error);
+  REQUIRE_THROWS_AS(table.release("alpha"_tv), std::logic_error);
+
+  std::array<std::thread, 4> threads;
+  std::array<size_t, 4> hits{};
+  for (unsigned t = 0; t < threads.size(); ++t) {
+    threads[t] = std::thread([&, t]() {
+      for (unsigned i = 0; i < 10000; ++i) {
+        if (table.find("charlie"_tv) == "charlie" && !table.find("alpha"_tv).empty()) {
+          ++hits[t];
+        }
+      }
+    });
+  }
+  for (auto &th : threads) {
+    th.join();
+  }
+  for (auto h : hits) {
+    REQUIRE(h == 10000);
+  }
+}
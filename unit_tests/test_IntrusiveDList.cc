@@ -22,8 +22,13 @@
 #include <string_view>
 #include <string>
 #include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
 
 #include "swoc/IntrusiveDList.h"
+#include "swoc/IntrusiveMPSCQueue.h"
+#include "swoc/TextView.h"
 #include "swoc/bwf_base.h"
 
 #include "catch.hpp"
@@ -270,3 +275,138 @@ TEST_CASE("IntrusiveDList Extra", "[libswoc][IntrusiveDList]") {
     REQUIRE(spot->_payload == tmp);
   }
 }
+
+TEST_CASE("IntrusiveDList splice", "[libswoc][IntrusiveDList]") {
+  ThingList list;
+  std::string tmp;
+  for (unsigned idx = 1; idx <= 10; ++idx) {
+    list.append(new Thing(bwprint(tmp, "{}", idx)));
+  }
+
+  // take_all transfers the entire chain in one step.
+  auto drained = list.take_all();
+  REQUIRE(drained.count() == 10);
+  REQUIRE(list.count() == 0);
+  REQUIRE(list.head() == nullptr);
+  REQUIRE(list.tail() == nullptr);
+  REQUIRE(drained.head()->_payload == "1");
+  REQUIRE(drained.tail()->_payload == "10");
+
+  // rvalue append - the usual pairing with take_all.
+  ThingList dst;
+  dst.append(new Thing("0"));
+  dst.append(drained.take_all());
+  REQUIRE(dst.count() == 11);
+  REQUIRE(drained.count() == 0);
+  REQUIRE(dst.head()->_payload == "0");
+  REQUIRE(dst.tail()->_payload == "10");
+
+  // rvalue prepend.
+  ThingList front;
+  front.append(new Thing("-1"));
+  dst.prepend(front.take_all());
+  REQUIRE(dst.count() == 12);
+  REQUIRE(front.count() == 0);
+  REQUIRE(dst.head()->_payload == "-1");
+
+  // Chain splice with a known count - no walking.
+  Thing *a = new Thing("a");
+  Thing *b = new Thing("b");
+  Thing *c = new Thing("c");
+  Thing::Linkage::next_ptr(a) = b;
+  Thing::Linkage::prev_ptr(b) = a;
+  Thing::Linkage::next_ptr(b) = c;
+  Thing::Linkage::prev_ptr(c) = b;
+
+  dst.append(a, c, 3);
+  REQUIRE(dst.count() == 15);
+  REQUIRE(dst.tail()->_payload == "c");
+  REQUIRE(dst.nth(12)->_payload == "a");
+
+  // Chain splice in to an empty list sets both ends.
+  ThingList fresh;
+  Thing *d = new Thing("d");
+  fresh.prepend(d, d, 1);
+  REQUIRE(fresh.count() == 1);
+  REQUIRE(fresh.head() == d);
+  REQUIRE(fresh.tail() == d);
+
+  // Validate integrity by walking the big list both ways.
+  size_t n = 0;
+  for ([[maybe_unused]] auto &thing : dst) {
+    ++n;
+  }
+  REQUIRE(n == dst.count());
+  n = 0;
+  for (auto *spot = dst.tail(); spot; spot = Thing::Linkage::prev_ptr(spot)) {
+    ++n;
+  }
+  REQUIRE(n == dst.count());
+
+  dst.apply([](Thing *thing) { delete thing; });
+  fresh.apply([](Thing *thing) { delete thing; });
+}
+
+TEST_CASE("IntrusiveMPSCQueue", "[libswoc][IntrusiveDList]") {
+  swoc::IntrusiveMPSCQueue<Thing::Linkage> queue;
+  std::string tmp;
+
+  REQUIRE(queue.empty() == true);
+
+  // Single threaded - drained batch is in push order.
+  for (unsigned idx = 1; idx <= 5; ++idx) {
+    queue.push(new Thing(bwprint(tmp, "{}", idx)));
+  }
+  REQUIRE(queue.empty() == false);
+  auto batch = queue.take_all();
+  REQUIRE(queue.empty() == true);
+  REQUIRE(batch.count() == 5);
+  REQUIRE(batch.head()->_payload == "1");
+  REQUIRE(batch.tail()->_payload == "5");
+  unsigned idx = 1;
+  for (auto &thing : batch) {
+    REQUIRE(thing._payload == bwprint(tmp, "{}", idx++));
+  }
+  batch.apply([](Thing *thing) { delete thing; });
+
+  // Multiple producers, consumer drains concurrently and splices batches.
+  static constexpr int N_PRODUCER = 3;
+  static constexpr int N_PER      = 2000;
+  std::vector<std::thread> producers;
+  for (int t = 0; t < N_PRODUCER; ++t) {
+    producers.emplace_back([&queue, t]() {
+      std::string text;
+      for (int i = 0; i < N_PER; ++i) {
+        queue.push(new Thing(swoc::bwprint(text, "{}-{}", t, i)));
+      }
+    });
+  }
+
+  ThingList all;
+  while (all.count() < N_PRODUCER * N_PER) {
+    all.append(queue.take_all());
+  }
+  for (auto &th : producers) {
+    th.join();
+  }
+  REQUIRE(queue.empty() == true);
+  REQUIRE(all.count() == N_PRODUCER * N_PER);
+
+  // Per producer order must be preserved in the aggregate.
+  std::array<int, N_PRODUCER> expected;
+  expected.fill(0);
+  bool order_p = true;
+  for (auto &thing : all) {
+    swoc::TextView text{thing._payload};
+    auto t = swoc::svtoi(text.take_prefix_at('-'));
+    auto i = swoc::svtoi(text);
+    order_p = order_p && i == expected[t];
+    ++expected[t];
+  }
+  REQUIRE(order_p == true);
+  for (int t = 0; t < N_PRODUCER; ++t) {
+    REQUIRE(expected[t] == N_PER);
+  }
+
+  all.apply([](Thing *thing) { delete thing; });
+}
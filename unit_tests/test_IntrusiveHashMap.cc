@@ -227,4 +227,143 @@ TEST_CASE("IntrusiveHashMapManyStrings", "[IntrusiveHashMap]") {
   REQUIRE(miss_p == false);
 };
 
+TEST_CASE("IntrusiveHashMap Incremental", "[IntrusiveHashMap]") {
+  std::uniform_int_distribution<short> char_gen{'a', 'z'};
+  std::uniform_int_distribution<short> length_gen{20, 40};
+  std::minstd_rand randu;
+  constexpr int N = 997;
+
+  std::vector<std::string> strings;
+  strings.reserve(N);
+  for (int i = 0; i < N; ++i) {
+    std::string s;
+    auto len = length_gen(randu);
+    for (decltype(len) j = 0; j < len; ++j) {
+      s.push_back(char(char_gen(randu)));
+    }
+    strings.push_back(std::move(s));
+  }
+
+  Map map;
+  map.set_incremental_expansion(true).set_migration_step(2);
+  for (int i = 0; i < N; ++i) {
+    map.insert(new Thing{strings[i], i});
+  }
+  REQUIRE(map.count() == N);
+
+  // Expansions have happened, some almost certainly still in progress - every element must be
+  // findable regardless of which table it is in.
+  bool miss_p = false;
+  for (int idx = 0; idx < N; ++idx) {
+    if (auto spot = map.find(std::string_view(strings[idx])); spot == map.end() || spot->_n != idx) {
+      miss_p = true;
+    }
+  }
+  REQUIRE(miss_p == false);
+
+  // Force a migration and check mid-flight behavior explicitly.
+  map.expand();
+  REQUIRE(map.is_migrating() == true);
+
+  // Duplicates inserted mid migration must stay adjacent for equal_range.
+  miss_p = false;
+  for (int idx = 13; idx < N; idx += 13) {
+    map.insert(new Thing(strings[idx], 2000 + idx));
+  }
+  for (int idx = 13; idx < N; idx += 13) {
+    auto r = map.equal_range(std::string_view(strings[idx]));
+    if (2 != std::distance(r.begin(), r.end())) {
+      miss_p = true;
+    }
+  }
+  REQUIRE(miss_p == false);
+
+  // Erase works on both migrated and unmigrated elements.
+  map.expand();
+  miss_p = false;
+  for (int idx = 13; idx < N; idx += 13) {
+    auto spot = map.find(std::string_view(strings[idx]));
+    while (spot != map.end() && spot->_payload == strings[idx]) {
+      Thing *thing = spot;
+      spot         = map.erase(spot);
+      delete thing;
+    }
+    if (map.find(std::string_view(strings[idx])) != map.end()) {
+      miss_p = true;
+    }
+  }
+  REQUIRE(miss_p == false);
+
+  // Lookups make progress - the migration must eventually drain with no inserts.
+  while (map.is_migrating()) {
+    map.find(std::string_view(strings[1]));
+  }
+  miss_p = false;
+  int n  = 0;
+  for (int idx = 0; idx < N; ++idx) {
+    if (idx % 13 == 0 && idx > 0) {
+      continue; // erased above.
+    }
+    auto spot = map.find(std::string_view(strings[idx]));
+    if (spot == map.end() || spot->_n != idx) {
+      miss_p = true;
+    }
+    ++n;
+  }
+  REQUIRE(miss_p == false);
+  REQUIRE(map.count() == size_t(n));
+
+  map.apply([](Thing *thing) { delete thing; });
+  map.clear();
+}
+
 TEST_CASE("IntrusiveHashMap Utilities", "[IntrusiveHashMap]") {}
+
+TEST_CASE("IntrusiveHashMap Bucket Cursor", "[IntrusiveHashMap]") {
+  Map map;
+  static constexpr int N = 269;
+  std::string tmp;
+
+  auto g0 = map.generation();
+  for (int idx = 0; idx < N; ++idx) {
+    swoc::bwprint(tmp, "key-{}", idx);
+    map.insert(new Thing{tmp, idx});
+  }
+  REQUIRE(map.generation() > g0); // every insert (and any expansion) bumps.
+
+  // A full cursor walk visits every element exactly once.
+  std::bitset<N> visited;
+  size_t n_buckets = 0;
+  auto cursor      = map.bucket_cursor();
+  while (map.for_each_bucket(cursor, [&](Thing &thing) { visited.set(thing._n); })) {
+    ++n_buckets;
+    REQUIRE(map.is_valid(cursor)); // nothing changed between steps.
+  }
+  REQUIRE(visited.count() == N);
+  REQUIRE(n_buckets <= map.bucket_count());
+
+  // Structural change while a walk is suspended is detected cheaply.
+  cursor = map.bucket_cursor();
+  map.for_each_bucket(cursor, [](Thing &) {});
+  REQUIRE(map.is_valid(cursor));
+  map.insert(new Thing{"interloper", N});
+  REQUIRE_FALSE(map.is_valid(cursor));
+  auto spot      = map.find("interloper"sv);
+  Thing *t_interloper = spot;
+  map.erase(spot);
+  delete t_interloper;
+
+  // Mutation from inside the callback does not invalidate the cursor - drain one bucket
+  // per "lock acquisition" in the style of a metrics export.
+  size_t n_drained = 0;
+  cursor           = map.bucket_cursor();
+  while (map.for_each_bucket(cursor, [&](Thing &thing) {
+    ++n_drained;
+    map.erase(map.iterator_for(&thing));
+    delete &thing;
+  })) {
+    REQUIRE(map.is_valid(cursor));
+  }
+  REQUIRE(n_drained == N);
+  REQUIRE(map.count() == 0);
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    LRUCache unit tests.
+*/
+
+#include <string>
+#include <thread>
+#include <array>
+
+#include "swoc/LRUCache.h"
+#include "swoc/bwf_base.h"
+#include "catch.hpp"
+
+using swoc::LRUCache;
+
+TEST_CASE("LRUCache", "[libswoc][LRUCache]") {
+  LRUCache<int, std::string> cache{64, 1}; // single shard - deterministic eviction order.
+
+  REQUIRE(cache.count() == 0);
+  REQUIRE_FALSE(cache.retrieve(1).has_value());
+
+  cache.insert(1, "one");
+  cache.insert(2, "two");
+  REQUIRE(cache.count() == 2);
+  REQUIRE(cache.retrieve(1).value() == "one");
+  REQUIRE(cache.retrieve(2).value() == "two");
+
+  // Update in place.
+  cache.insert(1, "uno");
+  REQUIRE(cache.retrieve(1).value() == "uno");
+  REQUIRE(cache.count() == 2);
+
+  // Explicit removal.
+  REQUIRE(cache.erase(2));
+  REQUIRE_FALSE(cache.erase(2));
+  REQUIRE_FALSE(cache.retrieve(2).has_value());
+  REQUIRE(cache.count() == 1);
+
+  auto stats = cache.stats();
+  REQUIRE(stats._hits == 3);
+  REQUIRE(stats._misses == 2);
+  REQUIRE(stats._evictions == 0);
+}
+
+TEST_CASE("LRUCache eviction", "[libswoc][LRUCache]") {
+  using Cache = LRUCache<int, int>;
+  Cache cache{64, 1};
+
+  for (int k = 0; k < 64; ++k) {
+    cache.insert(k, k * 10);
+  }
+  REQUIRE(cache.count() == 64);
+
+  // Touch the oldest entries so they survive the batch eviction.
+  for (int k = 0; k < 8; ++k) {
+    REQUIRE(cache.retrieve(k).has_value());
+  }
+
+  // One insert past capacity evicts a batch of the least recently used.
+  cache.insert(100, 1000);
+  REQUIRE(cache.count() == 64 + 1 - Cache::EVICT_BATCH);
+  REQUIRE(cache.stats()._evictions == Cache::EVICT_BATCH);
+
+  // The touched entries and the new entry survived, the LRU batch did not.
+  for (int k = 0; k < 8; ++k) {
+    REQUIRE(cache.retrieve(k).has_value());
+  }
+  REQUIRE(cache.retrieve(100).value() == 1000);
+  for (int k = 8; k < 8 + int(Cache::EVICT_BATCH); ++k) {
+    REQUIRE_FALSE(cache.retrieve(k).has_value());
+  }
+
+  // Freed nodes are recycled - capacity cycling works indefinitely.
+  for (int k = 200; k < 1200; ++k) {
+    cache.insert(k, k);
+  }
+  REQUIRE(cache.count() <= 64);
+}
+
+TEST_CASE("LRUCache threading", "[libswoc][LRUCache]") {
+  static constexpr unsigned N_THREAD = 4;
+  static constexpr unsigned N_ITER   = 5000;
+
+  LRUCache<unsigned, unsigned> cache{256, 8};
+  std::array<std::thread, N_THREAD> threads;
+  std::array<unsigned, N_THREAD> bad{}; // catch isn't thread safe - check after the join.
+
+  for (unsigned t = 0; t < N_THREAD; ++t) {
+    threads[t] = std::thread([&, t]() {
+      for (unsigned i = 0; i < N_ITER; ++i) {
+        unsigned key = (t * N_ITER + i) % 512;
+        cache.insert(key, key + 1);
+        if (auto v = cache.retrieve(key); v.has_value() && *v != key + 1) {
+          ++bad[t];
+        }
+        cache.erase(key + 7);
+      }
+    });
+  }
+  for (auto &th : threads) {
+    th.join();
+  }
+
+  for (auto n : bad) {
+    REQUIRE(n == 0);
+  }
+  REQUIRE(cache.count() <= 256);
+  auto stats = cache.stats();
+  REQUIRE(stats._hits + stats._misses == N_THREAD * N_ITER);
+}
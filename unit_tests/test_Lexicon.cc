@@ -272,3 +272,88 @@ TEST_CASE("Lexicon Constructor 2", "[libts][Lexicon]") {
   [[maybe_unused]] swoc::Lexicon<unsigned> _locations1{INVALID_LOCATION};
   [[maybe_unused]] swoc::Lexicon<unsigned> _locations2{{INVALID_LOCATION}};
 }
+
+TEST_CASE("Lexicon freeze", "[libts][Lexicon]") {
+  ExampleNames names{
+    ExampleNames::with_multi{{Example::Value_0, {"zero", "0"}},
+                             {Example::Value_1, {"one", "1"}},
+                             {Example::Value_2, {"two", "2"}},
+                             {Example::Value_3, {"three", "3"}}},
+    Example::INVALID, "INVALID"
+  };
+
+  names.freeze();
+  REQUIRE(names.is_frozen());
+  // Primary, secondary, and case insensitive lookups through the frozen tables.
+  REQUIRE(names["one"] == Example::Value_1);
+  REQUIRE(names["TWO"] == Example::Value_2);
+  REQUIRE(names["3"] == Example::Value_3);
+  REQUIRE(names["forty-two"] == Example::INVALID);
+  REQUIRE(names[Example::Value_0] == "zero");
+  REQUIRE(names[Example::Value_2] == "two");
+  REQUIRE(names[static_cast<Example>(57)] == "INVALID");
+  // Frozen lexicons are immutable.
+  REQUIRE_THROWS_AS(names.define(Example::INVALID, "bogus"), std::logic_error);
+  // Iteration is unaffected.
+  size_t n = 0;
+  for ([[maybe_unused]] auto const &pair : names) {
+    ++n;
+  }
+  REQUIRE(n == 4);
+
+  // A larger lexicon - exercises reseeding / table growth in the placement search.
+  swoc::Lexicon<unsigned> big{[](swoc::TextView) -> unsigned { return 9999; }};
+  std::string name;
+  for (unsigned i = 0; i < 500; ++i) {
+    big.define(i, swoc::bwprint(name, "name-{}", i));
+  }
+  big.freeze();
+  bool match_p = true;
+  for (unsigned i = 0; i < 500; ++i) {
+    swoc::bwprint(name, "name-{}", i);
+    if (big[swoc::TextView{name}] != i) {
+      match_p = false;
+      break;
+    }
+  }
+  REQUIRE(match_p);
+  REQUIRE(big["no-such-name"] == 9999);
+
+  // Freezing compacts the storage - names are relocated in to a contiguous block where each
+  // node is followed by its name bytes. Verify relocation and that the whole lexicon spans a
+  // footprint close to the raw data size rather than scattered allocations.
+  char const *min_p = nullptr;
+  char const *max_p = nullptr;
+  size_t text_size  = 0;
+  for (auto const &pair : big) {
+    auto *p = pair._name.data();
+    min_p   = (nullptr == min_p || p < min_p) ? p : min_p;
+    max_p   = (nullptr == max_p || p > max_p) ? p : max_p;
+    text_size += pair._name.size();
+  }
+  // 500 items - node overhead plus name bytes plus alignment padding, all in one block.
+  REQUIRE(size_t(max_p - min_p) < 500 * 128);
+  REQUIRE(text_size > 0);
+}
+
+TEST_CASE("Lexicon name policy", "[libts][Lexicon]") {
+  // The case folding hash must match hashing the upper cased text, with no copy.
+  REQUIRE(swoc::Hash32FNV1a().hash_nocase_immediate("Content-Length") ==
+          swoc::Hash32FNV1a().hash_immediate("CONTENT-LENGTH"));
+  REQUIRE(swoc::Hash64FNV1a().hash_nocase_immediate("Content-Length") ==
+          swoc::Hash64FNV1a().hash_immediate("CONTENT-LENGTH"));
+
+  // Case sensitive lexicon - distinct names that differ only in case.
+  using ExactNames = swoc::Lexicon<Example, swoc::LexiconExact>;
+  ExactNames exact{
+    ExactNames::with{{Example::Value_0, "zero"}, {Example::Value_1, "Zero"}},
+    Example::INVALID
+  };
+  REQUIRE(exact["zero"] == Example::Value_0);
+  REQUIRE(exact["Zero"] == Example::Value_1);
+  REQUIRE(exact["ZERO"] == Example::INVALID);
+  exact.freeze(); // frozen lookup uses the policy hash as well.
+  REQUIRE(exact["zero"] == Example::Value_0);
+  REQUIRE(exact["Zero"] == Example::Value_1);
+  REQUIRE(exact["ZERO"] == Example::INVALID);
+}
@@ -24,8 +24,10 @@
 #include <map>
 #include <set>
 #include <random>
+#include <thread>
 
 #include "swoc/MemArena.h"
+#include "swoc/BufferWriter.h"
 #include "swoc/TextView.h"
 #include "catch.hpp"
 
@@ -463,6 +465,119 @@ TEST_CASE("FixedArena", "[libswoc][FixedArena]") {
   REQUIRE(two == three);
 };
 
+TEST_CASE("MemArena options", "[libswoc][MemArena]") {
+  // mmap backed blocks - allocation behavior is identical, memory source differs.
+  MemArena::Options opts;
+  opts.use_mmap       = true;
+  opts.min_block_size = 1 << 20;
+  MemArena arena{opts};
+  auto span = arena.alloc(1000);
+  REQUIRE(span.size() == 1000);
+  REQUIRE(arena.contains(span.data()));
+  REQUIRE(arena.reserved_size() >= opts.min_block_size);
+  memset(span.data(), 0x5A, span.size()); // must be writable.
+  arena.freeze();
+  auto span2 = arena.alloc(2000);
+  REQUIRE(arena.contains(span2.data()));
+  arena.thaw();
+  arena.clear();
+
+  // Huge page request - falls back cleanly if huge pages aren't provisioned.
+  MemArena::Options huge;
+  huge.huge_pages = true;
+  MemArena harena{huge};
+  auto hspan = harena.alloc(100);
+  REQUIRE(harena.contains(hspan.data()));
+  memset(hspan.data(), 0xA5, hspan.size());
+
+  // Move semantics carry the options.
+  MemArena moved{std::move(harena)};
+  auto mspan = moved.alloc(100);
+  REQUIRE(moved.contains(mspan.data()));
+}
+
+TEST_CASE("ArenaPool", "[libswoc][ArenaPool]") {
+  swoc::ArenaPool::drain(); // start from a known state.
+  REQUIRE(swoc::ArenaPool::local_count() == 0);
+
+  // First arena - nothing pooled yet, block comes from the heap.
+  auto arena = swoc::ArenaPool::make(1024);
+  auto span  = arena.alloc(512);
+  auto base  = span.data();
+  REQUIRE(arena.reserved_size() >= 1024);
+  swoc::ArenaPool::retire(std::move(arena));
+  REQUIRE(swoc::ArenaPool::local_count() == 1);
+
+  // Second arena - must reuse the retired block.
+  auto arena2 = swoc::ArenaPool::make(1024);
+  REQUIRE(swoc::ArenaPool::local_count() == 0);
+  REQUIRE(arena2.reserved_size() > 0); // reserve present before any allocation.
+  auto span2 = arena2.alloc(512);
+  REQUIRE(span2.data() == base);
+  swoc::ArenaPool::retire(std::move(arena2));
+
+  // A request too large for any cached block falls back to the heap.
+  auto arena3 = swoc::ArenaPool::make(1 << 20);
+  REQUIRE(swoc::ArenaPool::local_count() == 1); // retired block still cached.
+  auto span3 = arena3.alloc(1 << 19);
+  REQUIRE(span3.data() != base);
+  swoc::ArenaPool::retire(std::move(arena3));
+  REQUIRE(swoc::ArenaPool::local_count() == 2);
+
+  swoc::ArenaPool::drain();
+  REQUIRE(swoc::ArenaPool::local_count() == 0);
+};
+
+TEST_CASE("TieredArena", "[libswoc][TieredArena]") {
+  MemArena arena;
+  swoc::TieredArena ta{arena};
+
+  // Spans of the same size class are recycled.
+  auto s1 = ta.alloc(24);
+  REQUIRE(s1.size() == 24);
+  auto p1 = s1.data();
+  ta.free(s1);
+  auto s2 = ta.alloc(20); // still the 32 byte class.
+  REQUIRE(s2.data() == p1);
+
+  // A different size class doesn't touch the 32 byte list.
+  auto s3 = ta.alloc(100);
+  REQUIRE(s3.data() != p1);
+  ta.free(s3);
+  REQUIRE(ta.alloc(128).data() == s3.data()); // 100 rounds up to the 128 byte class.
+
+  // Oversize requests pass through and are not recycled.
+  auto big   = ta.alloc(swoc::TieredArena::MAX_CLASS + 1);
+  auto big_p = big.data();
+  ta.free(big);
+  REQUIRE(ta.alloc(swoc::TieredArena::MAX_CLASS + 1).data() != big_p);
+
+  // Object interface - storage is recycled, instance is reconstructed.
+  struct Thing {
+    int x = 0;
+    std::string name;
+  };
+  Thing *one = ta.make<Thing>();
+  one->x     = 17;
+  ta.destroy(one);
+  Thing *twin = ta.make<Thing>();
+  REQUIRE(twin == one);
+  REQUIRE(twin->x == 0);
+  ta.destroy(twin);
+
+  // Steady state recycling - no new arena memory once the free lists are primed.
+  auto reserved = arena.reserved_size();
+  for (int i = 0; i < 1000; ++i) {
+    auto span = ta.alloc(48);
+    ta.free(span);
+  }
+  REQUIRE(arena.reserved_size() == reserved);
+
+  ta.clear(); // drop the free lists - further allocation comes from the arena.
+  auto s4 = ta.alloc(48);
+  REQUIRE(s4.size() == 48);
+};
+
 TEST_CASE("MemArena disard", "[libswoc][MemArena][discard]") {
   MemArena a{512};
   a.require(0); // force allocation.
@@ -628,6 +743,38 @@ TEST_CASE("PMR 3", "[libswoc][arena][pmr]") {
   REQUIRE(pre > post);
 }
 
+TEST_CASE("PMR ArenaResource", "[libswoc][arena][pmr]") {
+  MemArena arena;
+  swoc::ArenaResource res{arena};
+
+  // Equality - to itself, to the arena, and to another resource on the same arena.
+  swoc::ArenaResource res2{arena};
+  REQUIRE(res.is_equal(res));
+  REQUIRE(res.is_equal(arena));
+  REQUIRE(res.is_equal(res2));
+  MemArena other_arena;
+  swoc::ArenaResource other{other_arena};
+  REQUIRE(!res.is_equal(other));
+
+  // Direct allocate / deallocate - the tail allocation should be reclaimed.
+  auto *p = res.allocate(1000, 8);
+  REQUIRE(arena.contains(p));
+  auto mark = arena.allocated_size();
+  res.deallocate(p, 1000, 8);
+  REQUIRE(arena.allocated_size() < mark);
+
+  // Containers draw from the arena through the resource.
+  std::pmr::vector<int> v{res.allocator<int>()};
+  for (int i = 0; i < 1000; ++i) {
+    v.push_back(i);
+  }
+  REQUIRE(arena.contains(v.data()));
+  REQUIRE(v[999] == 999);
+
+  std::pmr::string s{"a string long enough to dodge the small string optimization", &res};
+  REQUIRE(arena.contains(s.data()));
+}
+
 TEST_CASE("MemArena static", "[libswoc][MemArena][static]") {
   static constexpr size_t SIZE = 2048;
   std::byte buffer[SIZE];
@@ -661,3 +808,177 @@ TEST_CASE("MemArena static", "[libswoc][MemArena][static]") {
 }
 
 #endif // has memory_resource header.
+
+TEST_CASE("swoc_stats snapshot", "[libswoc][MemArena][stats]") {
+  auto s0 = swoc::stats::snapshot();
+
+  MemArena arena;
+  arena.alloc(1024); // forces a block allocation.
+  char small[8];
+  swoc::FixedBufferWriter w{small, sizeof(small)};
+  w.write("definitely too long", 19); // truncates.
+
+  auto s1 = swoc::stats::snapshot();
+  if (SWOC_ENABLE_INSTRUMENTATION) {
+    REQUIRE(s1._arena_block_alloc > s0._arena_block_alloc);
+    REQUIRE(s1._buffer_truncate > s0._buffer_truncate);
+  } else { // compiled out - always zero.
+    REQUIRE(s1._arena_block_alloc == 0);
+    REQUIRE(s1._buffer_truncate == 0);
+    REQUIRE(s1._hash_map_expand == 0);
+    REQUIRE(s1._fixed_arena_alloc == 0);
+  }
+}
+
+TEST_CASE("MemArena telemetry", "[libswoc][MemArena]") {
+  MemArena arena{1024};
+
+  arena.alloc(500);
+  arena.alloc(500);
+  size_t peak = arena.allocated_size();
+  REQUIRE(arena.high_water() == peak);
+
+  arena.freeze();
+  arena.alloc(100);
+  REQUIRE(arena.high_water() == peak + 100); // both generations are live.
+  arena.thaw();
+  REQUIRE(arena.high_water() == peak + 100); // mark persists past the thaw.
+  REQUIRE(arena.allocated_size() == 100);
+
+  auto t = arena.telemetry();
+  REQUIRE(t._high_water == arena.high_water());
+  REQUIRE(t._block_count >= 1);
+  REQUIRE(t._block_total >= t._block_count);
+  size_t histo_sum = 0;
+  for (auto count : t._block_sizes) {
+    histo_sum += count;
+  }
+  REQUIRE(histo_sum == t._block_count);
+
+  arena.clear();
+  REQUIRE(arena.high_water() == peak + 100);
+  REQUIRE(arena.telemetry()._block_count == 0);
+
+  // Block allocation hook.
+  size_t hook_count = 0;
+  size_t hook_bytes = 0;
+  arena.set_block_alloc_hook([&](MemArena &, size_t bytes) -> void {
+    ++hook_count;
+    hook_bytes += bytes;
+  });
+  arena.alloc(2000); // forces a fresh block.
+  REQUIRE(hook_count == 1);
+  REQUIRE(hook_bytes >= 2000);
+
+  arena.set_block_alloc_hook(nullptr); // removable.
+  arena.alloc(8000);
+  REQUIRE(hook_count == 1);
+
+  // Telemetry travels with a move.
+  size_t hw = arena.high_water();
+  MemArena other{std::move(arena)};
+  REQUIRE(other.high_water() == hw);
+  REQUIRE(arena.high_water() == 0);
+}
+
+namespace {
+/// Instrumented payload for @c ConcurrentFixedArena tests.
+struct CountedThing {
+  intptr_t _x = 0; ///< Pointer sized so the instance can hold a free list link.
+  CountedThing() { ++_ctor; }
+  explicit CountedThing(int x) : _x(x) { ++_ctor; }
+  ~CountedThing() { ++_dtor; }
+  inline static std::atomic<int> _ctor{0};
+  inline static std::atomic<int> _dtor{0};
+};
+} // namespace
+
+TEST_CASE("ConcurrentFixedArena", "[libswoc][FixedArena][concurrent]") {
+  using Thing = CountedThing;
+  static_assert(sizeof(Thing) >= sizeof(void *)); // required by the arena.
+
+  using CFA = swoc::ConcurrentFixedArena<Thing>;
+
+  { // Single thread - behaves like FixedArena.
+    CFA cfa;
+    Thing *one = cfa.make(956);
+    REQUIRE(one->_x == 956);
+    cfa.destroy(one);
+    Thing *two = cfa.make();
+    REQUIRE(two == one);  // reused instance.
+    REQUIRE(two->_x == 0); // but reconstructed.
+    cfa.destroy(two);
+  }
+
+  { // Cross thread free - instances freed on another thread are recycled via the remote list.
+    static constexpr size_t N = 7 * CFA::BATCH; // full carves - the local cache is empty afterwards.
+    CFA cfa;
+    std::set<Thing *> first_round;
+    std::vector<Thing *> things;
+    for (size_t i = 0; i < N; ++i) {
+      things.push_back(cfa.make());
+      first_round.insert(things.back());
+    }
+    std::thread worker{[&]() {
+      for (auto *t : things) {
+        cfa.destroy(t);
+      }
+    }};
+    worker.join();
+    // The worker flushed batches to the remote list as its cache overflowed. The tail of its
+    // cache is stranded by thread exit, but every flushed batch must be recycled here.
+    static constexpr size_t N_FLUSHED = CFA::BATCH * ((N - CFA::CACHE_MAX) / CFA::BATCH);
+    for (size_t i = 0; i < N_FLUSHED; ++i) {
+      Thing *t = cfa.make();
+      REQUIRE(first_round.count(t) == 1); // recycled, not fresh.
+      cfa.destroy(t);
+    }
+  }
+
+  { // Concurrent stress - allocate on one set of threads, free on another.
+    static constexpr size_t N_THREAD = 4;
+    static constexpr size_t N_ITER   = 2000;
+    Thing::_ctor = 0;
+    Thing::_dtor = 0;
+    CFA cfa;
+    std::array<std::vector<Thing *>, N_THREAD> made;
+    std::array<int, N_THREAD> bad;
+    bad.fill(0);
+
+    std::vector<std::thread> threads;
+    for (size_t idx = 0; idx < N_THREAD; ++idx) {
+      threads.emplace_back([&, idx]() {
+        for (size_t i = 0; i < N_ITER; ++i) {
+          made[idx].push_back(cfa.make(int(idx)));
+        }
+      });
+    }
+    for (auto &t : threads) {
+      t.join();
+    }
+    threads.clear();
+    for (size_t idx = 0; idx < N_THREAD; ++idx) { // each thread frees another thread's instances.
+      threads.emplace_back([&, idx]() {
+        for (auto *t : made[(idx + 1) % N_THREAD]) {
+          if (t->_x != int((idx + 1) % N_THREAD)) {
+            ++bad[idx];
+          }
+          cfa.destroy(t);
+        }
+      });
+    }
+    for (auto &t : threads) {
+      t.join();
+    }
+    for (auto n : bad) {
+      REQUIRE(n == 0);
+    }
+    REQUIRE(Thing::_ctor == N_THREAD * N_ITER);
+    REQUIRE(Thing::_dtor == N_THREAD * N_ITER); // every instance destructed exactly once.
+
+    cfa.clear(); // quiescent - drop everything, thread caches invalidated.
+    Thing *fresh = cfa.make(1);
+    REQUIRE(fresh->_x == 1);
+    cfa.destroy(fresh);
+  }
+}
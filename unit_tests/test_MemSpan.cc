@@ -308,3 +308,55 @@ TEST_CASE("MemSpan arena", "[libswoc][MemSpan]") {
 
   REQUIRE(raw.rebind<Thing>().length() == 1);
 }
+
+TEST_CASE("MemSpan carver", "[libswoc][MemSpan]") {
+  struct Header {
+    uint32_t _count;
+    uint16_t _name_size;
+  };
+
+  // Build an image: header, padding to 8, array of uint64_t, then raw names.
+  alignas(8) char image[256];
+  swoc::SpanCarver builder{swoc::MemSpan<void>{image, sizeof(image)}};
+  auto h = builder.carve<Header>();
+  REQUIRE(h.count() == 1);
+  h[0]._count     = 4;
+  h[0]._name_size = 5;
+  auto values = builder.carve<uint64_t>(4);
+  REQUIRE(values.count() == 4);
+  for (unsigned idx = 0; idx < 4; ++idx) {
+    values[idx] = 100 + idx;
+  }
+  auto names = builder.carve<char>(5);
+  memcpy(names.data(), "names", 5);
+  REQUIRE(builder);
+
+  // Decode through a read only view - carves yield const spans.
+  swoc::SpanCarver carver{swoc::MemSpan<void const>{image, sizeof(image)}};
+  auto rh = carver.carve<Header>();
+  REQUIRE(rh.count() == 1);
+  REQUIRE(rh[0]._count == 4);
+  auto rv = carver.carve<uint64_t>(rh[0]._count);
+  REQUIRE(rv.count() == 4);
+  REQUIRE(rv[3] == 103);
+  REQUIRE(uintptr_t(rv.data()) % alignof(uint64_t) == 0); // alignment padding was consumed.
+  auto rn = carver.carve<char>(rh[0]._name_size);
+  REQUIRE(swoc::TextView(rn.data(), rn.size()) == "names");
+  REQUIRE_FALSE(carver.overflow());
+  REQUIRE(carver.remaining().size() < sizeof(image));
+
+  // Overflow latches and later carves are empty even if they would fit.
+  auto big = carver.carve<uint64_t>(1000);
+  REQUIRE(big.empty());
+  REQUIRE(carver.overflow());
+  REQUIRE_FALSE(carver);
+  REQUIRE(carver.carve<char>(1).empty());
+
+  // Explicit alignment and raw byte carves.
+  swoc::SpanCarver c2{swoc::MemSpan<void>{image, sizeof(image)}};
+  c2.skip(1);
+  auto aligned = c2.carve_aligned<char>(8, 64);
+  REQUIRE(uintptr_t(aligned.data()) % 64 == 0);
+  auto raw = c2.carve_bytes(3);
+  REQUIRE(raw.size() == 3);
+}
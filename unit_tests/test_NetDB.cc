@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    NetDB unit tests.
+*/
+
+#include "swoc/NetDB.h"
+#include "catch.hpp"
+
+using swoc::TextView;
+using swoc::IPAddr;
+using swoc::ip::NetDB;
+using namespace swoc::literals;
+
+static constexpr TextView HOSTS_1{R"(
+127.0.0.1   localhost localhost.localdomain
+::1         localhost6 localhost6.localdomain6
+
+192.168.2.2  ns1 ns1.cdn.swoc.io
+192.168.2.3  ns2 ns2.cdn.swoc.io
+# comment line
+192.168.2.19 mid-ts
+)"};
+
+static constexpr TextView HOSTS_2{R"(
+127.0.0.1   localhost localhost.localdomain
+::1         localhost6 localhost6.localdomain6
+
+192.168.2.2  ns1 ns1.cdn.swoc.io
+192.168.2.3  ns2a ns2.cdn.swoc.io
+192.168.2.32 edge-ts
+)"};
+
+TEST_CASE("NetDB", "[libswoc][NetDB]") {
+  NetDB db;
+
+  // Empty database - valid, empty snapshot.
+  auto empty = db.snapshot();
+  REQUIRE(empty->count() == 0);
+  REQUIRE_FALSE(empty->find("ns1"_tv).is_valid());
+
+  auto &&[update, errata]{db.load(HOSTS_1)};
+  REQUIRE(errata.is_ok());
+  REQUIRE(update._added == 5);
+  REQUIRE(update._removed == 0);
+  REQUIRE(update._generation == 1);
+  REQUIRE(db.generation() == 1);
+
+  auto snap = db.snapshot();
+  REQUIRE(snap->generation() == 1);
+  REQUIRE(snap->find("ns1"_tv) == IPAddr("192.168.2.2"));
+  REQUIRE(snap->find("ns2.cdn.swoc.io"_tv) == IPAddr("192.168.2.3"));
+  REQUIRE(snap->find("localhost6"_tv) == IPAddr("::1"));
+  REQUIRE_FALSE(snap->find("nope"_tv).is_valid());
+
+  // Reverse lookup yields the primary (first) name.
+  REQUIRE(snap->find(IPAddr("192.168.2.3")) == "ns2");
+  REQUIRE(snap->find(IPAddr("127.0.0.1")) == "localhost");
+  REQUIRE(snap->find(IPAddr("192.168.2.4")).empty());
+
+  // Reload - one address removed, one added, one primary renamed.
+  auto &&[u2, e2]{db.load(HOSTS_2)};
+  REQUIRE(e2.is_ok());
+  REQUIRE(u2._added == 1);    // 192.168.2.32
+  REQUIRE(u2._removed == 1);  // 192.168.2.19
+  REQUIRE(u2._changed == 1);  // ns2 -> ns2a
+  REQUIRE(u2._generation == 2);
+
+  // The old snapshot is unaffected by the reload.
+  REQUIRE(snap->find("mid-ts"_tv) == IPAddr("192.168.2.19"));
+  REQUIRE(snap->find(IPAddr("192.168.2.3")) == "ns2");
+
+  auto snap2 = db.snapshot();
+  REQUIRE(snap2->find("mid-ts"_tv).is_valid() == false);
+  REQUIRE(snap2->find("edge-ts"_tv) == IPAddr("192.168.2.32"));
+  REQUIRE(snap2->find(IPAddr("192.168.2.3")) == "ns2a");
+  REQUIRE(snap2->find(IPAddr("192.168.2.19")).empty());
+
+  // Malformed lines are noted, not fatal.
+  auto &&[u3, e3]{db.load("not-an-address host\n10.1.1.1 alpha\n"_tv)};
+  REQUIRE(e3.length() == 1);
+  REQUIRE(db.snapshot()->find("alpha"_tv) == IPAddr("10.1.1.1"));
+}
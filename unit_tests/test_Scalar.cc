@@ -18,7 +18,11 @@
     limitations under the License.
 */
 
+#include <array>
+#include <limits>
+
 #include "swoc/Scalar.h"
+#include "swoc/MemSpan.h"
 #include "swoc/bwf_base.h"
 #include "catch.hpp"
 
@@ -255,3 +259,45 @@ TEST_CASE("Scalar Formatting", "[libswoc][Scalar][bwf]") {
   w.clear().print("y is {}", y);
   REQUIRE(w.view() == "y is 12000");
 }
+
+TEST_CASE("Scalar span operations", "[libswoc][Scalar][span]") {
+  using Blocks = swoc::Scalar<4096, int64_t>;
+
+  // Span conversion with rounding.
+  std::array<int64_t, 6> extents{0, 1, 4095, 4096, 4097, 3 * 4096};
+  std::array<Blocks, 6> blocks;
+  swoc::MemSpan<Blocks> dst{blocks.data(), blocks.size()};
+  swoc::MemSpan<int64_t const> src{extents.data(), extents.size()};
+
+  REQUIRE(swoc::round_up(dst, src) == extents.size());
+  REQUIRE(blocks[0].count() == 0);
+  REQUIRE(blocks[1].count() == 1);
+  REQUIRE(blocks[2].count() == 1);
+  REQUIRE(blocks[3].count() == 1);
+  REQUIRE(blocks[4].count() == 2);
+  REQUIRE(blocks[5].count() == 3);
+
+  REQUIRE(swoc::round_down(dst, src) == extents.size());
+  REQUIRE(blocks[1].count() == 0);
+  REQUIRE(blocks[2].count() == 0);
+  REQUIRE(blocks[4].count() == 1);
+
+  // Mismatched span sizes convert the overlap only.
+  swoc::MemSpan<Blocks> dst_short{blocks.data(), 2};
+  REQUIRE(swoc::round_up(dst_short, src) == 2);
+
+  // Sum.
+  swoc::round_up(dst, src);
+  auto total = swoc::sum(swoc::MemSpan<Blocks const>{blocks.data(), blocks.size()});
+  REQUIRE(total.count() == 0 + 1 + 1 + 1 + 2 + 3);
+  REQUIRE(total.value() == total.count() * 4096);
+
+  // Checked sum - valid and overflowing cases.
+  swoc::Scalar<4096, intmax_t> checked;
+  REQUIRE(swoc::sum_checked(swoc::MemSpan<Blocks const>{blocks.data(), blocks.size()}, checked));
+  REQUIRE(checked.count() == total.count());
+
+  std::array<Blocks, 3> huge;
+  huge.fill(Blocks{std::numeric_limits<int64_t>::max() / 2});
+  REQUIRE_FALSE(swoc::sum_checked(swoc::MemSpan<Blocks const>{huge.data(), huge.size()}, checked));
+}
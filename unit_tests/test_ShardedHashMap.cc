@@ -0,0 +1,172 @@
+/** @file
+
+    ShardedHashMap unit tests.
+
+    @section license License
+
+    Licensed to the Apache Software Foundation (ASF) under one or more contributor license
+    agreements.  See the NOTICE file distributed with this work for additional information regarding
+    copyright ownership.  The ASF licenses this file to you under the Apache License, Version 2.0
+    (the "License"); you may not use this file except in compliance with the License.  You may
+    obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software distributed under the
+    License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+    either express or implied. See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "swoc/ShardedHashMap.h"
+#include "catch.hpp"
+
+using swoc::ShardedHashMap;
+
+namespace {
+struct Item {
+  std::string _key;
+  int _n{0};
+
+  Item(std::string_view key, int n) : _key(key), _n(n) {}
+
+  Item *_next{nullptr};
+  Item *_prev{nullptr};
+};
+
+struct ItemMapDescriptor {
+  static Item *&
+  next_ptr(Item *item) {
+    return item->_next;
+  }
+  static Item *&
+  prev_ptr(Item *item) {
+    return item->_prev;
+  }
+  static std::string_view
+  key_of(Item *item) {
+    return item->_key;
+  }
+  static constexpr std::hash<std::string_view> hasher{};
+  static auto
+  hash_of(std::string_view s) -> decltype(hasher(s)) {
+    return hasher(s);
+  }
+  static bool
+  equal(std::string_view const &lhs, std::string_view const &rhs) {
+    return lhs == rhs;
+  }
+};
+
+using Map = ShardedHashMap<ItemMapDescriptor, 8>;
+
+std::string
+key_for(int i) {
+  return "key-" + std::to_string(i);
+}
+
+} // namespace
+
+TEST_CASE("ShardedHashMap basic", "[libswoc][ShardedHashMap]") {
+  static constexpr int N = 1000;
+  Map map;
+
+  REQUIRE(map.count() == 0);
+  REQUIRE(map.begin() == map.end());
+  REQUIRE(map.find("nope") == nullptr);
+
+  for (int i = 0; i < N; ++i) {
+    map.insert(new Item(key_for(i), i));
+  }
+  REQUIRE(map.count() == N);
+
+  bool miss_p = false;
+  for (int i = 0; i < N; ++i) {
+    auto *item = map.find(key_for(i));
+    if (nullptr == item || item->_n != i) {
+      miss_p = true;
+    }
+  }
+  REQUIRE(miss_p == false);
+
+  // Aggregate iteration visits every element exactly once.
+  size_t n       = 0;
+  long key_total = 0;
+  for (auto &item : map) {
+    ++n;
+    key_total += item._n;
+  }
+  REQUIRE(n == N);
+  REQUIRE(key_total == (long(N) * (N - 1)) / 2);
+
+  // Keyed apply runs under the shard lock and reports the element count.
+  map.insert(new Item(key_for(56), 5600)); // duplicate key.
+  REQUIRE(map.apply(key_for(56), [](Item &item) { item._n += 1; }) == 2);
+  REQUIRE(map.find(key_for(56))->_n == 57);
+
+  // take() removes atomically.
+  auto *taken = map.take(key_for(56));
+  REQUIRE(taken != nullptr);
+  delete taken;
+  taken = map.take(key_for(56)); // the duplicate.
+  REQUIRE(taken != nullptr);
+  REQUIRE(taken->_n == 5601);
+  delete taken;
+  REQUIRE(map.find(key_for(56)) == nullptr);
+  REQUIRE(map.count() == N - 1);
+
+  // erase by element.
+  auto *item = map.find(key_for(10));
+  REQUIRE(map.erase(item) == true);
+  REQUIRE(map.erase(item) == false);
+  delete item;
+
+  map.apply([](Item *i) { delete i; });
+  map.clear();
+  REQUIRE(map.count() == 0);
+}
+
+TEST_CASE("ShardedHashMap threads", "[libswoc][ShardedHashMap]") {
+  static constexpr int N_THREAD = 4;
+  static constexpr int N_KEY    = 500;
+  Map map;
+
+  // Each thread inserts its own key space, then looks all of its keys back up.
+  std::vector<std::thread> threads;
+  std::array<bool, N_THREAD> ok;
+  ok.fill(false);
+  for (int t = 0; t < N_THREAD; ++t) {
+    threads.emplace_back([&map, &ok, t]() {
+      for (int i = 0; i < N_KEY; ++i) {
+        map.insert(new Item(key_for(t * N_KEY + i), t));
+      }
+      bool valid_p = true;
+      for (int i = 0; i < N_KEY; ++i) {
+        auto *item = map.find(key_for(t * N_KEY + i));
+        valid_p    = valid_p && item != nullptr && item->_n == t;
+      }
+      // Pull half of them back out.
+      for (int i = 0; i < N_KEY; i += 2) {
+        auto *item = map.take(key_for(t * N_KEY + i));
+        valid_p    = valid_p && item != nullptr;
+        delete item;
+      }
+      ok[t] = valid_p;
+    });
+  }
+  for (auto &th : threads) {
+    th.join();
+  }
+  for (int t = 0; t < N_THREAD; ++t) {
+    REQUIRE(ok[t] == true);
+  }
+  REQUIRE(map.count() == N_THREAD * (N_KEY / 2));
+
+  map.apply([](Item *item) { delete item; });
+  map.clear();
+}
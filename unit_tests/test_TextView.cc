@@ -10,8 +10,10 @@
 #include <string>
 #include <map>
 #include <unordered_map>
+#include <array>
 
 #include "swoc/TextView.h"
+#include "swoc/MemSpan.h"
 #include "catch.hpp"
 
 using swoc::TextView;
@@ -88,6 +90,19 @@ TEST_CASE("TextView Operations", "[libswoc][TextView]") {
   REQUIRE(strcasecmp(tv, tv_lower) == 0);
   REQUIRE(strcasecmp(nothing, tv) != 0);
 
+  // Case folded comparison on views long enough to exercise the vectorized path, with the
+  // mismatch in the lead chunk, past the chunk boundary, and in the tail.
+  TextView h1{"Access-Control-Allow-Credentials"};
+  TextView h2{"access-control-allow-credentials"};
+  TextView h3{"ACCESS-CONTROL-ALLOW-CREDENTIALS"};
+  REQUIRE(strcasecmp(h1, h2) == 0);
+  REQUIRE(strcasecmp(h1, h3) == 0);
+  REQUIRE(strcasecmp(h1, TextView{"Access-Control-Allow-CredentialZ"}) < 0);
+  REQUIRE(strcasecmp(h1, TextView{"Bccess-Control-Allow-Credentials"}) < 0);
+  REQUIRE(strcasecmp(TextView{"access-control-bllow-credentials"}, h1) > 0);
+  // '@' (0x40) and '`' (0x60) differ only in the case bit but are not alphabetic.
+  REQUIRE(strcasecmp(TextView{"0123456789012345@"}, TextView{"0123456789012345`"}) != 0);
+
   // Check generic construction from a "string like" class.
   struct Stringy {
     char const *
@@ -538,6 +553,32 @@ TEST_CASE("TextView Conversions", "[libswoc][TextView]") {
   CHECK(svtou(x) == uintmax_t(IMAX) + 1);
   CHECK(svtoi(x) == IMAX);
 
+  // Long values - these exercise the 8 digit per chunk fast path, including the
+  // transition from chunked to scalar parsing and chunk-boundary digit breaks.
+  x.assign("12345678901234567");
+  REQUIRE(12345678901234567ull == swoc::svto_radix<10>(x));
+  REQUIRE(x.size() == 0);
+  x.assign("12345678abc");
+  REQUIRE(12345678 == swoc::svto_radix<10>(x));
+  REQUIRE(x == "abc");
+  x.assign("1234567x8");
+  REQUIRE(1234567 == swoc::svto_radix<10>(x));
+  REQUIRE(x == "x8");
+
+  x.assign("DeadBeefF00d");
+  REQUIRE(0xDeadBeefF00dull == swoc::svto_radix<16>(x));
+  REQUIRE(x.size() == 0);
+  x.assign("deadBEEF9876fedc");
+  REQUIRE(0xdeadBEEF9876fedcull == swoc::svto_radix<16>(x));
+  REQUIRE(x.size() == 0);
+  x.assign("ffffffffffffffffff"); // 18 digits - clamps.
+  REQUIRE(UMAX == swoc::svto_radix<16>(x));
+  REQUIRE(x.size() == 0);
+  x.assign("0123456789abcdefgh");
+  REQUIRE(0x0123456789abcdefull == swoc::svto_radix<16>(x));
+  REQUIRE(x == "gh");
+  CHECK(0xDeadBeefF00dull == svtou("0xDeadBeefF00d"_tv));
+
   x.assign("-9223372036854775807");
   CHECK(svtoi(x) == IMIN + 1);
   x.assign("-9223372036854775808");
@@ -648,4 +689,62 @@ TEST_CASE("TextView tokenizing", "[libswoc][TextView]") {
   for (auto token : tokens) {
     REQUIRE(src.take_prefix_at(',') == token);
   }
+
+  // Batch tokenizer - one pass, tokens land in caller storage.
+  std::array<TextView, 8> slots;
+  TextView batch = "alpha,bravo,,charlie";
+  auto n         = batch.tokenize(","sv, swoc::MemSpan<TextView>(slots.data(), slots.size()));
+  REQUIRE(n == 4);
+  REQUIRE(batch.empty());
+  size_t idx = 0;
+  for (auto token : tokens) {
+    REQUIRE(slots[idx++] == token);
+  }
+
+  // Output too small - remnant is left for a second round.
+  TextView resume = "a b c d e";
+  n               = resume.tokenize(" "sv, swoc::MemSpan<TextView>(slots.data(), size_t(3)));
+  REQUIRE(n == 3);
+  REQUIRE(resume == "d e");
+  n = resume.tokenize(" "sv, swoc::MemSpan<TextView>(slots.data(), slots.size()));
+  REQUIRE(n == 2);
+  REQUIRE(slots[0] == "d");
+  REQUIRE(slots[1] == "e");
+  REQUIRE(resume.empty());
+}
+
+TEST_CASE("TextView delimiter scan", "[libswoc][TextView]") {
+  // Exercise the accelerated multi-delimiter scan - the text is long enough to cross the
+  // vector chunk boundaries and the delimiters land in the lead chunk, a middle chunk, and
+  // the scalar tail.
+  TextView src = "alpha bravo charlie delta echo foxtrot golf hotel india juliet kilo";
+  REQUIRE(src.prefix_at(" \t"sv) == "alpha");
+  REQUIRE(src.suffix(10).prefix_at(" \t"sv) == "uliet");
+
+  TextView run{src};
+  REQUIRE(run.take_prefix_at(" \t"sv) == "alpha");
+  REQUIRE(run.take_prefix_at(" \t"sv) == "bravo");
+  run.remove_prefix_at(" \t"sv);
+  REQUIRE(run.starts_with("delta"));
+
+  // No delimiter present - whole view taken, none found by prefix_at.
+  TextView clean = "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz";
+  REQUIRE(clean.prefix_at(",;"sv).empty());
+  TextView tmp{clean};
+  REQUIRE(tmp.take_prefix_at(",;"sv) == clean);
+  REQUIRE(tmp.empty());
+
+  // Delimiter in the scalar tail past the last full chunk.
+  TextView tail = "0123456789012345678901234567890123456789;x";
+  REQUIRE(tail.prefix_at(";,"sv).size() == 40);
+
+  // Large delimiter set - exercises the bitset fallback.
+  TextView hex = "zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz3f";
+  REQUIRE(hex.prefix_at("0123456789abcdef"sv).size() == 36);
+
+  // ltrim via the non-delimiter scan, including trimming the entire view.
+  TextView pad = "    \t\t  value";
+  REQUIRE(pad.ltrim(" \t"sv) == "value");
+  TextView all_pad = "                                          ";
+  REQUIRE(all_pad.ltrim(" \t"sv).empty());
 }
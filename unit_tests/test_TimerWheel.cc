@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    TimerWheel unit tests.
+*/
+
+#include <vector>
+
+#include "swoc/TimerWheel.h"
+#include "catch.hpp"
+
+using swoc::TimerWheel;
+
+namespace {
+struct Timeout {
+  unsigned _id{0};
+  uint64_t _fired_at{0}; ///< Tick at which the timeout fired, 0 if never.
+
+  uint64_t _expiry{0};
+  Timeout *_next{nullptr};
+  Timeout *_prev{nullptr};
+
+  struct Linkage {
+    static Timeout *&
+    next_ptr(Timeout *t) {
+      return t->_next;
+    }
+    static Timeout *&
+    prev_ptr(Timeout *t) {
+      return t->_prev;
+    }
+    static uint64_t &
+    expiry_of(Timeout *t) {
+      return t->_expiry;
+    }
+  };
+};
+
+using Wheel = TimerWheel<Timeout::Linkage>;
+} // namespace
+
+TEST_CASE("TimerWheel", "[libswoc][TimerWheel]") {
+  Wheel wheel;
+
+  // Expiries crossing every wheel level, deliberately out of order.
+  std::vector<uint64_t> expiries{3, 70, 64, 5000, 4097, 300000, 63, 65537, 1};
+  std::vector<Timeout> timeouts(expiries.size());
+  for (unsigned idx = 0; idx < expiries.size(); ++idx) {
+    timeouts[idx]._id = idx;
+    wheel.schedule(&timeouts[idx], expiries[idx]);
+  }
+  REQUIRE(wheel.count() == expiries.size());
+
+  // Advance in uneven jumps - every timeout must fire exactly at its expiry tick.
+  size_t n_fired = 0;
+  for (uint64_t now : {uint64_t{2}, uint64_t{100}, uint64_t{4100}, uint64_t{65537}, uint64_t{400000}}) {
+    n_fired += wheel.expire(now, [&](Timeout &t) {
+      REQUIRE(t._fired_at == 0); // exactly once.
+      t._fired_at = wheel.now();
+    });
+  }
+  REQUIRE(n_fired == expiries.size());
+  REQUIRE(wheel.count() == 0);
+  for (auto &t : timeouts) {
+    REQUIRE(t._fired_at == t._expiry);
+  }
+
+  // A late schedule fires on the next advance.
+  Timeout late;
+  wheel.schedule(&late, wheel.now() - 56);
+  wheel.expire(wheel.now() + 1, [](Timeout &t) { t._fired_at = 1; });
+  REQUIRE(late._fired_at == 1);
+}
+
+TEST_CASE("TimerWheel cancel", "[libswoc][TimerWheel]") {
+  Wheel wheel;
+  std::vector<Timeout> timeouts(100);
+  for (unsigned idx = 0; idx < timeouts.size(); ++idx) {
+    timeouts[idx]._id = idx;
+    wheel.schedule(&timeouts[idx], 10 + idx * 97); // spread across levels.
+  }
+
+  // Cancel every third, including ones that have cascaded part way down.
+  wheel.expire(500, [](Timeout &t) { t._fired_at = t._expiry; });
+  size_t n_cancelled = 0;
+  for (auto &t : timeouts) {
+    if (t._id % 3 == 0 && 0 == t._fired_at) {
+      REQUIRE(wheel.cancel(&t));
+      REQUIRE_FALSE(wheel.cancel(&t)); // already off the wheel.
+      ++n_cancelled;
+    }
+  }
+  REQUIRE(n_cancelled == 32);
+  REQUIRE(wheel.count() == timeouts.size() - 6 - n_cancelled); // 6 fired by tick 500.
+
+  wheel.expire(20000, [](Timeout &t) { t._fired_at = t._expiry; });
+  REQUIRE(wheel.count() == 0);
+  for (auto &t : timeouts) {
+    if (t._id % 3 == 0 && t._expiry > 500) {
+      REQUIRE(t._fired_at == 0); // cancelled - never fired.
+    } else {
+      REQUIRE(t._fired_at == t._expiry);
+    }
+  }
+
+  // Rescheduling from the expiry callback is allowed - the classic keepalive pattern.
+  Timeout ka;
+  unsigned n_fires = 0;
+  wheel.schedule(&ka, wheel.now() + 10);
+  while (n_fires < 3) {
+    wheel.expire(wheel.now() + 1, [&](Timeout &t) {
+      ++n_fires;
+      wheel.schedule(&t, wheel.now() + 10);
+    });
+  }
+  REQUIRE(wheel.count() == 1);
+  REQUIRE(wheel.cancel(&ka));
+  REQUIRE(wheel.count() == 0);
+}
@@ -6,7 +6,9 @@
 */
 
 #include <iostream>
+#include <string>
 #include "swoc/Vectray.h"
+#include "swoc/MemArena.h"
 #include "catch.hpp"
 
 using swoc::Vectray;
@@ -80,3 +82,56 @@ TEST_CASE("Vectray Destructor", "[libswoc][Vectray]") {
   // But first object should be at least double deleted because of transfer.
   REQUIRE(count >= 4);
 }
+
+TEST_CASE("Vectray Arena", "[libswoc][Vectray]") {
+  swoc::MemArena arena;
+  Vectray<int, 2, swoc::ArenaAllocator<int>> va{arena};
+
+  REQUIRE(va.capacity() == 2);
+  va.push_back(1);
+  va.push_back(2);
+  REQUIRE(arena.size() == 0); // still in fixed storage, arena untouched.
+  va.push_back(3); // spill to dynamic storage.
+  REQUIRE(va.size() == 3);
+  REQUIRE(arena.size() >= 3 * sizeof(int)); // overflow came from the arena.
+
+  for (int i = 4; i <= 100; ++i) {
+    va.push_back(i);
+  }
+  for (int i = 0; i < 100; ++i) {
+    REQUIRE(va[i] == i + 1);
+  }
+
+  auto const &cva{va};
+  REQUIRE(cva[0] == 1);
+  REQUIRE(cva.front() == 1);
+  REQUIRE(cva.back() == 100);
+  REQUIRE(cva.data() == va.data());
+
+  // Growth hint - a single allocation, then stable storage.
+  Vectray<int, 4, swoc::ArenaAllocator<int>> vb{arena};
+  vb.reserve(64);
+  REQUIRE(vb.capacity() >= 64);
+  vb.push_back(0);
+  int *addr = vb.data();
+  for (int i = 1; i < 64; ++i) {
+    vb.push_back(i);
+  }
+  REQUIRE(vb.data() == addr); // no reallocation while filling reserved storage.
+
+  // Cross size move of dynamic storage - the vector (and its arena storage) moves over.
+  Vectray<int, 2, swoc::ArenaAllocator<int>> vc{std::move(vb)};
+  REQUIRE(vc.size() == 64);
+  REQUIRE(vc.data() == addr);
+  REQUIRE(vc[63] == 63);
+
+  // Cross size move from fixed storage that doesn't fit the target fixed storage.
+  Vectray<std::string, 4> vs;
+  vs.push_back("alpha");
+  vs.push_back("bravo");
+  vs.push_back("charlie");
+  Vectray<std::string, 2> vs2{std::move(vs)};
+  REQUIRE(vs2.size() == 3);
+  REQUIRE(vs2[0] == "alpha");
+  REQUIRE(vs2[2] == "charlie");
+}
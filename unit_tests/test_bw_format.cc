@@ -4,6 +4,7 @@
     Unit tests for BufferFormat and bwprint.
  */
 
+#include <charconv>
 #include <chrono>
 #include <iostream>
 #include <variant>
@@ -14,6 +15,8 @@
 #include "swoc/BufferWriter.h"
 #include "swoc/bwf_std.h"
 #include "swoc/bwf_ex.h"
+#include "swoc/swoc_transform.h"
+#include "swoc/swoc_hash.h"
 
 #include "catch.hpp"
 
@@ -34,6 +37,117 @@ TEST_CASE("Buffer Writer << operator", "[bufferwriter][stream]") {
   REQUIRE(bw.view() == "x=50");
 }
 
+TEST_CASE("FixedFormat", "[bwprint][fixedformat]") {
+  swoc::LocalBufferWriter<256> w;
+  swoc::LocalBufferWriter<256> w_fixed;
+
+  // The parse happens at compile time, so the item count is a constant expression.
+  static constexpr swoc::bwf::FixedFormat fmt_lit{"Some text"};
+  static_assert(fmt_lit.count() == 1);
+  static constexpr swoc::bwf::FixedFormat fmt_args{"arg 1 {1} and 2 {2} and 0 {0}"};
+  static_assert(fmt_args.count() == 6);
+
+  w.print("Some text");
+  w_fixed.print(fmt_lit);
+  REQUIRE(w.view() == w_fixed.view());
+
+  w.clear().print("arg 1 {1} and 2 {2} and 0 {0}", "zero", "one", "two");
+  w_fixed.clear().print(fmt_args, "zero", "one", "two");
+  REQUIRE(w.view() == w_fixed.view());
+  REQUIRE(w_fixed.view() == "arg 1 one and 2 two and 0 zero");
+
+  // Alignment, fill, sign, radix, max width, type, pointers.
+  static constexpr swoc::bwf::FixedFormat fmt_spec{"|{:<10}|{:.>10}|{:#010x}|{}|{:,4}|{:p}|"};
+  int value = 17;
+  void *ptr = &value;
+  w.clear().print("|{:<10}|{:.>10}|{:#010x}|{}|{:,4}|{:p}|", "text", "text", 0xbeef, true, "overlong", ptr);
+  w_fixed.clear().print(fmt_spec, "text", "text", 0xbeef, true, "overlong", ptr);
+  REQUIRE(w.view() == w_fixed.view());
+
+  static constexpr swoc::bwf::FixedFormat fmt_braces{"match {{rc}} {}"};
+  w.clear().print("match {{rc}} {}", 17);
+  w_fixed.clear().print(fmt_braces, 17);
+  REQUIRE(w.view() == w_fixed.view());
+  REQUIRE(w_fixed.view() == "match {rc} 17");
+
+  // Tuple front end.
+  w_fixed.clear().print_v(fmt_args, std::forward_as_tuple("zero", "one", "two"));
+  REQUIRE(w_fixed.view() == "arg 1 one and 2 two and 0 zero");
+
+  // A malformed format at run time throws, same as @c Format. (A constexpr instance would
+  // fail to compile instead.)
+  REQUIRE_THROWS_AS(swoc::bwf::FixedFormat{"dangle {"}, std::invalid_argument);
+  REQUIRE_THROWS_AS(swoc::bwf::FixedFormat{"close} only"}, std::invalid_argument);
+}
+
+TEST_CASE("BWFormat name cache", "[bwprint][namecache]") {
+  using swoc::BufferWriter;
+  using Spec = swoc::bwf::Spec;
+  swoc::LocalBufferWriter<256> w;
+
+  unsigned alpha_count = 0;
+  swoc::bwf::ExternalNames names;
+  names.assign("alpha", [&alpha_count](BufferWriter &ww, Spec const &spec) -> BufferWriter & {
+    ++alpha_count;
+    return bwformat(ww, spec, "one");
+  });
+
+  swoc::bwf::Format fmt{"{alpha} and {bravo}"};
+
+  // First use resolves "alpha" and caches it. "bravo" is not defined yet.
+  w.print_n(names.bind(), fmt);
+  REQUIRE(w.view() == "one and {~bravo~}");
+  REQUIRE(alpha_count == 1);
+
+  // Assigning a new name bumps the generation - the format must pick it up.
+  names.assign("bravo", [](BufferWriter &ww, Spec const &spec) -> BufferWriter & { return bwformat(ww, spec, "two"); });
+  w.clear().print_n(names.bind(), fmt);
+  REQUIRE(w.view() == "one and two");
+
+  // Steady state - repeated use stays correct.
+  for (int i = 0; i < 5; ++i) {
+    w.clear().print_n(names.bind(), fmt);
+    REQUIRE(w.view() == "one and two");
+  }
+  REQUIRE(alpha_count == 7);
+
+  // Re-assigning a generator must be picked up as well.
+  names.assign("alpha", [](BufferWriter &ww, Spec const &spec) -> BufferWriter & { return bwformat(ww, spec, "uno"); });
+  w.clear().print_n(names.bind(), fmt);
+  REQUIRE(w.view() == "uno and two");
+
+  // A different name set bypasses the cache but must still resolve correctly, and must not
+  // disturb the cached resolutions for the original name set.
+  swoc::bwf::ExternalNames other;
+  other.assign("alpha", [](BufferWriter &ww, Spec const &spec) -> BufferWriter & { return bwformat(ww, spec, "ichi"); });
+  other.assign("bravo", [](BufferWriter &ww, Spec const &spec) -> BufferWriter & { return bwformat(ww, spec, "ni"); });
+  w.clear().print_n(other.bind(), fmt);
+  REQUIRE(w.view() == "ichi and ni");
+  w.clear().print_n(names.bind(), fmt);
+  REQUIRE(w.view() == "uno and two");
+
+  // Arguments and names mixed through the cached path.
+  swoc::bwf::Format mixed_fmt{"{} - {alpha}"};
+  w.clear().print_nfv(names.bind(), mixed_fmt.bind(), swoc::bwf::ArgTuple{std::make_tuple(956)});
+  REQUIRE(w.view() == "956 - uno");
+
+  // Context bindings cache through the same mechanism.
+  struct Context {
+    std::string _tag;
+  };
+  swoc::bwf::ContextNames<Context> ctx_names;
+  ctx_names.assign("tag", [](BufferWriter &ww, Spec const &spec, Context &ctx) -> BufferWriter & {
+    return bwformat(ww, spec, ctx._tag);
+  });
+  swoc::bwf::Format ctx_fmt{"tag is {tag}"};
+  Context ctx{"fast"};
+  w.clear().print_n(ctx_names.bind(ctx), ctx_fmt);
+  REQUIRE(w.view() == "tag is fast");
+  ctx._tag = "cached";
+  w.clear().print_n(ctx_names.bind(ctx), ctx_fmt);
+  REQUIRE(w.view() == "tag is cached");
+}
+
 TEST_CASE("bwprint basics", "[bwprint]") {
   swoc::LocalBufferWriter<256> bw;
   std::string_view fmt1{"Some text"sv};
@@ -394,13 +508,13 @@ TEST_CASE("BWFormat floating", "[bwprint][bwformat]") {
   REQUIRE(bw.view() == "3.14");
   bw.clear();
   bw.print("{} {:.2} {:.0} ", 32.7, 32.7, 32.7);
-  REQUIRE(bw.view() == "32.70 32.70 32 ");
+  REQUIRE(bw.view() == "32.7 32.70 32 ");
   bw.clear();
   bw.print("{} neg {:.3}", -123.2, -123.2);
-  REQUIRE(bw.view() == "-123.20 neg -123.200");
+  REQUIRE(bw.view() == "-123.2 neg -123.200");
   bw.clear();
   bw.print("zero {} quarter {} half {} 3/4 {}", 0, 0.25, 0.50, 0.75);
-  REQUIRE(bw.view() == "zero 0 quarter 0.25 half 0.50 3/4 0.75");
+  REQUIRE(bw.view() == "zero 0 quarter 0.25 half 0.5 3/4 0.75");
   bw.clear();
   bw.print("long {:.11}", 64.9);
   REQUIRE(bw.view() == "long 64.90000000000");
@@ -409,7 +523,7 @@ TEST_CASE("BWFormat floating", "[bwprint][bwformat]") {
   double n   = 180.278;
   double neg = -238.47;
   bwformat(bw, spec, n);
-  REQUIRE(bw.view() == "180.28");
+  REQUIRE(bw.view() == "180.278");
   bw.clear();
   bwformat(bw, spec, neg);
   REQUIRE(bw.view() == "-238.47");
@@ -438,16 +552,16 @@ TEST_CASE("BWFormat floating", "[bwprint][bwformat]") {
   bw.clear();
 
   bw << 1234 << .567;
-  REQUIRE(bw.view() == "12340.57");
+  REQUIRE(bw.view() == "12340.567");
   bw.clear();
   bw << f;
-  REQUIRE(bw.view() == "1234.57");
+  REQUIRE(bw.view() == "1234.5667");
   bw.clear();
   bw << n;
-  REQUIRE(bw.view() == "180.28");
+  REQUIRE(bw.view() == "180.278");
   bw.clear();
   bw << f << n;
-  REQUIRE(bw.view() == "1234.57180.28");
+  REQUIRE(bw.view() == "1234.5667180.278");
   bw.clear();
 
   double edge = 0.345;
@@ -484,7 +598,7 @@ TEST_CASE("BWFormat floating", "[bwprint][bwformat]") {
   bwformat(bw, right, second);
   REQUIRE(bw.view() == "1.23  2.35 2.35");
   bwformat(bw, center, third);
-  REQUIRE(bw.view() == "1.23  2.35 2.35-3.50");
+  REQUIRE(bw.view() == "1.23  2.35 2.35-3.5 ");
   bw.clear();
 
   double over = 1.4444444;
@@ -495,6 +609,25 @@ TEST_CASE("BWFormat floating", "[bwprint][bwformat]") {
   REQUIRE(bw.view() == "1.4444444");
   bw.clear();
 
+#if defined(__cpp_lib_to_chars)
+  // Shortest round trip output - these would be truncated by a fixed default precision.
+  bw.print("{}", 0.1);
+  REQUIRE(bw.view() == "0.1");
+  bw.clear();
+  bw.print("{}", 2.718281828459045);
+  REQUIRE(bw.view() == "2.718281828459045");
+  bw.clear();
+  bw.print("{}", 1e300);
+  REQUIRE(bw.view() == "1e+300");
+  bw.clear();
+  bw.print("{}", 5e-324); // subnormal
+  REQUIRE(bw.view() == "5e-324");
+  bw.clear();
+  bw.print("{}", 0.1f); // shortest for the float value, not the wider double.
+  REQUIRE(bw.view() == "0.1");
+  bw.clear();
+#endif
+
   // Edge
   bw.print("{}", (1.0 / 0.0));
   REQUIRE(bw.view() == "Inf");
@@ -642,6 +775,108 @@ TEST_CASE("bwstring std formats", "[libswoc][bwprint]") {
   }
 };
 
+TEST_CASE("bwf transforms", "[bwf][transforms]") {
+  using namespace swoc::transforms;
+  swoc::LocalBufferWriter<512> w;
+
+  // Lower casing, including text longer than the internal streaming chunk.
+  w.clear().print("{}", lower("Evil Dave RULZ"_tv));
+  REQUIRE(w.view() == "evil dave rulz");
+  std::string big;
+  for (int i = 0; i < 40; ++i) {
+    big += "MiXeD cAsE";
+  }
+  w.clear().print("{}", lower(swoc::TextView{big}));
+  REQUIRE(w.size() == big.size());
+  REQUIRE(TextView{w.view()}.starts_with("mixed case"));
+
+  // Percent decoding - literal runs, escapes, and invalid escapes passed through.
+  w.clear().print("{}", percent_decode("a%20b%2Fc"_tv));
+  REQUIRE(w.view() == "a b/c");
+  w.clear().print("{}", percent_decode("100%25 done"_tv));
+  REQUIRE(w.view() == "100% done");
+  w.clear().print("{}", percent_decode("bad%2gscape%"_tv));
+  REQUIRE(w.view() == "bad%2gscape%");
+
+  // Trimming is plain view arithmetic.
+  REQUIRE(trim("  padded\t"_tv) == "padded");
+  REQUIRE(trim("clean"_tv) == "clean");
+
+  // Transforms feed incremental hashers without materialization.
+  swoc::hash::HashCRC32C h1, h2;
+  h1.update("evil dave");
+  hash_update(h2, lower("Evil Dave"_tv));
+  REQUIRE(h1.final().get() == h2.final().get());
+
+  swoc::hash::HashCRC32C h3, h4;
+  h3.update("a b/c");
+  hash_update(h4, percent_decode("a%20b%2Fc"_tv));
+  REQUIRE(h3.final().get() == h4.final().get());
+}
+
+namespace {
+// Counts how many times it is formatted - used to verify the single pass string printing.
+struct CountedText {
+  swoc::TextView _text; ///< Text to emit.
+  unsigned *_count;     ///< Format invocation counter.
+
+  /// String like conversion so the size hint is exact.
+  operator std::string_view() const { return _text; }
+};
+
+swoc::BufferWriter &
+bwformat(swoc::BufferWriter &w, swoc::bwf::Spec const &, CountedText const &ct) {
+  ++*ct._count;
+  return w.write(ct._text);
+}
+} // namespace
+
+TEST_CASE("bwstring size hint", "[libswoc][bwprint]") {
+  // A string argument larger than any initial capacity - the hint is exact so the output must
+  // be formatted only once.
+  std::string big(1000, 'x');
+  unsigned count = 0;
+  std::string s;
+  swoc::bwprint(s, "<{}>", CountedText{big, &count});
+  REQUIRE(s.size() == big.size() + 2);
+  REQUIRE(count == 1);
+
+  // Shrinking reuses capacity and still formats once.
+  count = 0;
+  swoc::bwprint(s, "{}!", CountedText{"small", &count});
+  REQUIRE(s == "small!");
+  REQUIRE(count == 1);
+
+  // Append reuses existing capacity - no growth, single pass.
+  s.clear();
+  s.reserve(2048);
+  auto const cap = s.capacity();
+  count          = 0;
+  for (int i = 0; i < 3; ++i) {
+    swoc::bwappend(s, "[{}]", CountedText{big, &count});
+  }
+  REQUIRE(s.size() == 3 * (big.size() + 2));
+  REQUIRE(count == 3); // each append formatted exactly once.
+  REQUIRE(s.front() == '[');
+
+  // Append that must grow does so once up front.
+  s.clear();
+  s.shrink_to_fit();
+  count = 0;
+  swoc::bwappend(s, "{}", CountedText{big, &count});
+  REQUIRE(s == big);
+  REQUIRE(count == 1);
+  (void)cap;
+
+  // Under estimated hint (opaque type) still yields correct output via the retry pass.
+  std::string t;
+  t.shrink_to_fit();
+  swoc::bwprint(t, "{} {} {} {} {} {} {} {} {} {}", 1111111, 2222222, 3333333, 4444444, 5555555, 6666666, 7777777, 8888888,
+                9999999, big);
+  REQUIRE(t.size() == 9 * 7 + 9 + big.size());
+  REQUIRE(swoc::TextView(t).starts_with("1111111 2222222"));
+}
+
 // Normally there's no point in running the performance tests, but it's worth keeping the code
 // for when additional testing needs to be done.
 #if 0
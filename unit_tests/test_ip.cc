@@ -8,10 +8,13 @@
 #include "catch.hpp"
 
 #include <set>
+#include <fstream>
 #include <iostream>
 
 #include "swoc/TextView.h"
 #include "swoc/swoc_ip.h"
+#include "swoc/IPRangeFeed.h"
+#include "swoc/IPAddrColumn.h"
 #include "swoc/bwf_ip.h"
 #include "swoc/bwf_std.h"
 #include "swoc/Lexicon.h"
@@ -657,6 +660,49 @@ TEST_CASE("IP Formatting", "[libswoc][ip][bwformat]") {
   REQUIRE(r.load(r_7));
 }
 
+TEST_CASE("IP to_buffer", "[libswoc][ip][bwformat]") {
+  using swoc::ip::to_buffer;
+  swoc::LocalBufferWriter<1024> w;
+  char buf[swoc::ip::IP6_ENDPOINT_TXT_SIZE];
+  swoc::MemSpan<char> span{buf, sizeof(buf)};
+
+  // The fast path must generate exactly the default BWF text.
+  for (auto text : {"0.0.0.0"_tv, "127.0.0.1"_tv, "172.17.99.231"_tv, "255.255.255.255"_tv}) {
+    IP4Addr a4{text};
+    REQUIRE(to_buffer(a4, span) == text);
+    w.clear().print("{}", a4);
+    REQUIRE(w.view() == text);
+  }
+
+  for (auto text : {"::"_tv, "::1"_tv, "1337::"_tv, "ffee::24c3:3349:3cee:143"_tv, "1337::ded:beef:0:0:956"_tv,
+                    "1337:0:0:ded:beef::"_tv, "1:2:3:4:5:6:7:8"_tv, "fe80:0:1:0:2:0:3:4"_tv}) {
+    IP6Addr a6{text};
+    REQUIRE(to_buffer(a6, span) == text);
+    w.clear().print("{}", a6);
+    REQUIRE(w.view() == text);
+  }
+
+  for (auto text : {"172.17.99.231:23995"_tv, "10.1.2.3:0"_tv, "[ffee::24c3:3349:3cee:143]:8080"_tv, "[::]:53874"_tv,
+                    "[::1]:65535"_tv}) {
+    IPEndpoint ep;
+    REQUIRE(ep.parse(text));
+    REQUIRE(to_buffer(ep, span) == text);
+    w.clear().print("{}", ep);
+    REQUIRE(w.view() == text);
+  }
+
+  // Too small a buffer yields an empty view.
+  IPEndpoint ep{"172.19.3.105:4951"};
+  REQUIRE(to_buffer(ep, span.prefix(8)).empty());
+  REQUIRE(to_buffer(IP6Addr{"::1"}, span.prefix(swoc::ip::IP6_TXT_SIZE - 1)).empty());
+
+  // A default spec but a nearly full writer must still clip instead of dropping the output.
+  swoc::LocalBufferWriter<8> small;
+  small.print("{}", ep);
+  REQUIRE(small.view() == "172.19.3");
+  REQUIRE(small.extent() > small.size());
+}
+
 TEST_CASE("IP ranges and networks", "[libswoc][ip][net][range]") {
   swoc::IP4Range r_0;
   swoc::IP4Range r_1{"1.1.1.0-1.1.1.9"};
@@ -2028,6 +2074,392 @@ TEST_CASE("IPSpace fill", "[libswoc][ipspace][fill]") {
   }
 }
 
+TEST_CASE("IPSpace bulk load", "[libswoc][ipspace][builder]") {
+  using uint_space = swoc::IPSpace<unsigned>;
+
+  uint_space space;
+  // Sorted appends take the fast path and coalesce adjacent equal payloads.
+  space.append(IPRange{"10.0.0.0-10.0.0.255"_tv}, 1);
+  space.append(IPRange{"10.0.1.0-10.0.1.255"_tv}, 1); // adjacent, equal payload - merges.
+  space.append(IPRange{"10.0.3.0-10.0.3.255"_tv}, 2);
+  REQUIRE(space.count() == 2);
+  CHECK(std::get<1>(*space.find(IPAddr{"10.0.1.37"})) == 1);
+  // Out of order append devolves to mark.
+  space.append(IPRange{"10.0.2.0-10.0.2.255"_tv}, 3);
+  REQUIRE(space.count() == 3);
+  CHECK(std::get<1>(*space.find(IPAddr{"10.0.2.1"})) == 3);
+
+  uint_space loaded;
+  uint_space::Builder builder;
+  builder.reserve(5);
+  // Deliberately unsorted, mixed families.
+  builder.insert(IPRange{"192.168.2.0/24"_tv}, 2);
+  builder.insert(IPRange{"ffee::3:0/112"_tv}, 3);
+  builder.insert(IPRange{"192.168.0.0/24"_tv}, 0);
+  builder.insert(IPRange{"ffee::1:0/112"_tv}, 1);
+  builder.insert(IPRange{"192.168.1.0/24"_tv}, 1);
+  REQUIRE(builder.count() == 5);
+  builder.commit(loaded);
+  REQUIRE(builder.count() == 0); // builder is drained by the commit.
+  REQUIRE(loaded.count_ip4() == 3);
+  REQUIRE(loaded.count_ip6() == 2);
+  CHECK(std::get<1>(*loaded.find(IPAddr{"192.168.1.56"})) == 1);
+  CHECK(std::get<1>(*loaded.find(IPAddr{"ffee::3:37"})) == 3);
+
+  // Overlapping pairs - the pair with the larger minimum takes the overlap.
+  builder.insert(IPRange{"172.16.0.0-172.16.1.255"_tv}, 1);
+  builder.insert(IPRange{"172.16.1.0-172.16.2.255"_tv}, 2);
+  builder.commit(loaded);
+  CHECK(std::get<1>(*loaded.find(IPAddr{"172.16.0.10"})) == 1);
+  CHECK(std::get<1>(*loaded.find(IPAddr{"172.16.1.10"})) == 2);
+}
+
+TEST_CASE("FlatIPSpace", "[libswoc][ipspace][flat]") {
+  using uint_space = swoc::IPSpace<unsigned>;
+
+  uint_space space;
+  space.mark(IPRange{"10.1.0.0-10.1.0.127"_tv}, 1);
+  space.mark(IPRange{"10.2.0.0/24"_tv}, 2);
+  space.mark(IPRange{"10.3.0.0/24"_tv}, 3);
+  space.mark(IPRange{"ffee:1f0:656:fa00::/64"_tv}, 4);
+  space.mark(IPRange{"ffee:1f0:656:fb00::/64"_tv}, 5);
+
+  auto flat = space.freeze();
+  REQUIRE(flat.count() == space.count());
+  REQUIRE(flat.count_ip4() == 3);
+  REQUIRE(flat.count_ip6() == 2);
+  REQUIRE(false == flat.empty());
+
+  // Hits.
+  auto spot = flat.find(IPAddr{"10.2.0.37"});
+  REQUIRE(spot != flat.end());
+  CHECK(spot->payload() == 2);
+  CHECK(spot->range() == IPRange{"10.2.0.0/24"_tv});
+  spot = flat.find(IPAddr{"ffee:1f0:656:fb00::1234"});
+  REQUIRE(spot != flat.end());
+  CHECK(spot->payload() == 5);
+  // Edge addresses.
+  CHECK(flat.find(IP4Addr{"10.1.0.0"}) != flat.end());
+  CHECK(flat.find(IP4Addr{"10.3.0.255"}) != flat.end());
+  // Misses - before the first range, in a gap, past the last range.
+  CHECK(flat.find(IPAddr{"9.255.255.255"}) == flat.end());
+  CHECK(flat.find(IPAddr{"10.1.0.128"}) == flat.end());
+  CHECK(flat.find(IPAddr{"10.4.0.0"}) == flat.end());
+  CHECK(flat.find(IPAddr{"ffee:1f0:656:fc00::1"}) == flat.end());
+
+  // Iteration covers the same content in the same order as the source space.
+  auto fspot = flat.begin();
+  for (auto const &v : std::as_const(space)) {
+    REQUIRE(fspot != flat.end());
+    CHECK(fspot->range() == v.range());
+    CHECK(fspot->payload() == v.payload());
+    ++fspot;
+  }
+  REQUIRE(fspot == flat.end());
+
+  // The flat space is independent of the source.
+  space.clear();
+  REQUIRE(space.count() == 0);
+  REQUIRE(flat.count() == 5);
+  CHECK(flat.find(IPAddr{"10.3.0.12"})->payload() == 3);
+
+  // An empty space freezes to an empty flat space.
+  auto empty_flat = space.freeze();
+  REQUIRE(empty_flat.count() == 0);
+  REQUIRE(empty_flat.empty());
+  CHECK(empty_flat.find(IPAddr{"10.2.0.37"}) == empty_flat.end());
+  CHECK(empty_flat.begin() == empty_flat.end());
+}
+
+TEST_CASE("FlatIPSpace serialization", "[libswoc][ipspace][flat][serial]") {
+  using uint_space = swoc::IPSpace<unsigned>;
+  using flat_space = swoc::FlatIPSpace<unsigned>;
+
+  uint_space space;
+  space.mark(IPRange{"10.1.0.0-10.1.0.127"_tv}, 1);
+  space.mark(IPRange{"10.2.0.0/24"_tv}, 2);
+  space.mark(IPRange{"ffee:1f0:656:fa00::/64"_tv}, 3);
+  auto flat = space.freeze();
+
+  std::error_code ec;
+
+  // In memory round trip.
+  std::vector<char> image(flat.serialized_size());
+  auto n = flat.serialize(swoc::MemSpan<void>(image.data(), image.size()), ec);
+  REQUIRE(!ec);
+  REQUIRE(n == flat.serialized_size());
+  auto dup = flat_space::view(swoc::MemSpan<void const>(image.data(), image.size()), ec);
+  REQUIRE(!ec);
+  REQUIRE(dup.count() == flat.count());
+  CHECK(dup.find(IPAddr{"10.2.0.37"})->payload() == 2);
+  CHECK(dup.find(IPAddr{"ffee:1f0:656:fa00::9"})->payload() == 3);
+  CHECK(dup.find(IPAddr{"10.3.0.0"}) == dup.end());
+
+  // A short or corrupt image is rejected.
+  flat_space::view(swoc::MemSpan<void const>(image.data(), sizeof(unsigned)), ec);
+  REQUIRE(ec);
+  ec.clear();
+  image[0] = ~image[0];
+  flat_space::view(swoc::MemSpan<void const>(image.data(), image.size()), ec);
+  REQUIRE(ec);
+  ec.clear();
+
+  // File round trip via mmap.
+  auto path = swoc::file::temp_directory_path() / "flat-ip-space-test.fips";
+  REQUIRE(flat.store(path, ec));
+  REQUIRE(!ec);
+  {
+    auto mapped = flat_space::map(path, ec);
+    REQUIRE(!ec);
+    REQUIRE(mapped.count_ip4() == 2);
+    REQUIRE(mapped.count_ip6() == 1);
+    CHECK(mapped.find(IPAddr{"10.1.0.56"})->payload() == 1);
+    CHECK(mapped.find(IPAddr{"10.1.0.128"}) == mapped.end());
+    auto spot = mapped.begin();
+    CHECK(spot->range() == IPRange{"10.1.0.0-10.1.0.127"_tv});
+  } // mapping is released here.
+  swoc::file::remove(path, ec);
+
+  // Missing file.
+  flat_space::map(swoc::file::path("/no/such/file.fips"), ec);
+  REQUIRE(ec);
+}
+
+TEST_CASE("EpochIPSpace", "[libswoc][ipspace][epoch]") {
+  swoc::EpochIPSpace<unsigned> espace;
+
+  REQUIRE(espace.epoch() == 0);
+  auto s0 = espace.snapshot();
+  REQUIRE(s0->empty());
+
+  auto e1 = espace.update([](swoc::IPSpace<unsigned> &space) {
+    space.mark(IPRange{"10.1.0.0/24"_tv}, 1);
+    space.mark(IPRange{"10.2.0.0/24"_tv}, 2);
+  });
+  REQUIRE(e1 == 1);
+  REQUIRE(espace.epoch() == 1);
+
+  // The pre-update snapshot is unchanged, the new snapshot has the data.
+  REQUIRE(s0->empty());
+  auto s1 = espace.snapshot();
+  REQUIRE(s1->count() == 2);
+  CHECK(s1->find(IPAddr{"10.1.0.56"})->payload() == 1);
+
+  // An incremental update - a reader holding s1 still sees epoch 1 content.
+  espace.update([](swoc::IPSpace<unsigned> &space) { space.erase(IPRange{"10.1.0.0/24"_tv}); });
+  REQUIRE(espace.epoch() == 2);
+  CHECK(s1->find(IPAddr{"10.1.0.56"})->payload() == 1);
+  auto s2 = espace.snapshot();
+  CHECK(s2->find(IPAddr{"10.1.0.56"}) == s2->end());
+  CHECK(s2->find(IPAddr{"10.2.0.56"})->payload() == 2);
+
+  // Old epochs are reclaimed by release, new snapshots are independent of them.
+  s0.reset();
+  s1.reset();
+  CHECK(espace.snapshot()->count() == 1);
+}
+
+TEST_CASE("DiscreteSpace parallel blend", "[libswoc][ipspace][blend][parallel]") {
+  using space_t = swoc::DiscreteSpace<IP4Addr, unsigned>;
+  using pair_t  = std::pair<swoc::DiscreteRange<IP4Addr>, unsigned>;
+  space_t space;
+  space_t ref;
+
+  // Populate enough distinct ranges that the space is actually partitioned.
+  for (in_addr_t i = 0; i < 1000; ++i) {
+    swoc::IP4Range r{IP4Addr{i * 10}, IP4Addr{i * 10 + 4}};
+    space.mark(r, i % 7 + 1);
+    ref.mark(r, i % 7 + 1);
+  }
+  REQUIRE(space.count() == 1000);
+
+  auto blender = [](unsigned &lhs, unsigned rhs) {
+    lhs += rhs;
+    return true;
+  };
+
+  // Deltas that overlap nodes, gaps, and (at stride 37 vs 10) partition boundaries.
+  std::vector<pair_t> deltas;
+  for (in_addr_t i = 0; i < 200; ++i) {
+    deltas.emplace_back(swoc::IP4Range{IP4Addr{i * 37}, IP4Addr{i * 37 + 20}}, i % 5 + 1);
+  }
+
+  for (auto const &[r, c] : deltas) {
+    ref.blend(r, c, blender);
+  }
+  space.blend(swoc::MemSpan<pair_t const>(deltas.data(), deltas.size()), blender, 4);
+
+  // The parallel blend must be identical to the sequential application.
+  REQUIRE(space.count() == ref.count());
+  auto spot = space.begin();
+  for (auto &node : ref) {
+    REQUIRE(spot != space.end());
+    CHECK(spot->range() == node.range());
+    CHECK(spot->payload() == node.payload());
+    ++spot;
+  }
+  REQUIRE(spot == space.end());
+
+  // A small space devolves to the sequential path - results must still match.
+  space_t small;
+  small.mark(swoc::IP4Range{IP4Addr{10}, IP4Addr{20}}, 1);
+  std::vector<pair_t> delta_1{
+    {swoc::IP4Range{IP4Addr{15}, IP4Addr{30}}, 2}
+  };
+  small.blend(swoc::MemSpan<pair_t const>(delta_1.data(), delta_1.size()), blender, 4);
+  REQUIRE(small.count() == 3);
+  CHECK(small.find(IP4Addr{16})->payload() == 3);
+  CHECK(small.find(IP4Addr{25})->payload() == 2);
+}
+
+TEST_CASE("DiscreteSpace compact", "[libswoc][ipspace][compact]") {
+  using space_t = swoc::DiscreteSpace<IP4Addr, unsigned>;
+  space_t space;
+
+  // Mark in shuffled order so node memory order is uncorrelated with key order.
+  constexpr in_addr_t N = 1009; // prime, so the stride visits every slot.
+  for (in_addr_t i = 0; i < N; ++i) {
+    in_addr_t k = (i * 523) % N;
+    space.mark(swoc::IP4Range{IP4Addr{k * 10}, IP4Addr{k * 10 + 4}}, k % 7 + 1);
+  }
+  REQUIRE(space.count() == N);
+
+  space.compact();
+  REQUIRE(space.count() == N);
+
+  // Contents are unchanged and the nodes are now laid out in key order.
+  in_addr_t k       = 0;
+  void const *prior = nullptr;
+  for (auto &node : space) {
+    REQUIRE(node.range() == swoc::IP4Range{IP4Addr{k * 10}, IP4Addr{k * 10 + 4}});
+    REQUIRE(node.payload() == k % 7 + 1);
+    REQUIRE(prior < static_cast<void const *>(&node));
+    prior = &node;
+    ++k;
+  }
+  REQUIRE(k == N);
+
+  // Searches and subsequent mutation still work on the rebuilt tree.
+  REQUIRE(space.find(IP4Addr{5000})->payload() == 500 % 7 + 1);
+  space.mark(swoc::IP4Range{IP4Addr{N * 10 + 100}, IP4Addr{N * 10 + 200}}, 99);
+  REQUIRE(space.find(IP4Addr{N * 10 + 150})->payload() == 99);
+  space.erase(swoc::IP4Range{IP4Addr{20}, IP4Addr{24}});
+  REQUIRE(space.find(IP4Addr{22}) == space.end());
+
+  // Degenerate cases are no-ops.
+  space_t empty_space;
+  empty_space.compact();
+  REQUIRE(empty_space.count() == 0);
+
+  // IPSpace forwards to both families.
+  swoc::IPSpace<unsigned> ip_space;
+  ip_space.mark(IPRange{"10.0.0.0/8"_tv}, 1);
+  ip_space.mark(IPRange{"2001:db8::/48"_tv}, 2);
+  ip_space.compact();
+  REQUIRE(ip_space.count() == 2);
+  auto [r4, p4] = *ip_space.find(IPAddr{"10.1.2.3"});
+  REQUIRE(p4 == 1);
+  auto [r6, p6] = *ip_space.find(IPAddr{"2001:db8::1"});
+  REQUIRE(p6 == 2);
+}
+
+TEST_CASE("TrieIPSpace", "[libswoc][ipspace][trie]") {
+  using uint_space = swoc::IPSpace<unsigned>;
+
+  uint_space space;
+  // CIDR aligned entries of assorted widths.
+  space.mark(IPRange{"10.0.0.0/8"_tv}, 1);
+  space.mark(IPRange{"172.16.0.0/12"_tv}, 2); // not a multiple of the stride - expanded.
+  space.mark(IPRange{"192.168.56.0/25"_tv}, 3);
+  space.mark(IPRange{"192.168.56.128/25"_tv}, 4);
+  // A non-CIDR range - decomposes in to multiple networks.
+  space.mark(IPRange{"203.0.113.5-203.0.113.41"_tv}, 5);
+  space.mark(IPRange{"2001:db8::/32"_tv}, 6);
+  space.mark(IPRange{"2001:db8:dead:beef::/64"_tv}, 7);
+
+  swoc::TrieIPSpace<unsigned> trie{space};
+  REQUIRE(trie.count() == space.count());
+
+  // Hits, including addresses inside expanded and decomposed entries.
+  CHECK(trie.find(IPAddr{"10.56.12.9"})->payload() == 1);
+  CHECK(trie.find(IPAddr{"172.20.0.1"})->payload() == 2);
+  CHECK(trie.find(IPAddr{"192.168.56.57"})->payload() == 3);
+  CHECK(trie.find(IPAddr{"192.168.56.200"})->payload() == 4);
+  CHECK(trie.find(IPAddr{"203.0.113.5"})->payload() == 5);
+  CHECK(trie.find(IPAddr{"203.0.113.33"})->payload() == 5);
+  CHECK(trie.find(IPAddr{"2001:db8:1::1"})->payload() == 6);
+  CHECK(trie.find(IPAddr{"2001:db8:dead:beef::9"})->payload() == 7);
+
+  // Misses - outside all entries and adjacent to entry edges.
+  CHECK(trie.find(IPAddr{"11.0.0.0"}) == trie.end());
+  CHECK(trie.find(IPAddr{"172.32.0.0"}) == trie.end());
+  CHECK(trie.find(IPAddr{"203.0.113.4"}) == trie.end());
+  CHECK(trie.find(IPAddr{"203.0.113.42"}) == trie.end());
+  CHECK(trie.find(IPAddr{"2001:db9::"}) == trie.end());
+
+  // Every address based check must agree with the source space, and iteration must match.
+  auto tspot = trie.begin();
+  for (auto const &v : std::as_const(space)) {
+    REQUIRE(tspot != trie.end());
+    CHECK(tspot->range() == v.range());
+    CHECK(tspot->payload() == v.payload());
+    CHECK(trie.find(v.range().min())->payload() == v.payload());
+    CHECK(trie.find(v.range().max())->payload() == v.payload());
+    ++tspot;
+  }
+  REQUIRE(tspot == trie.end());
+
+  // An empty space yields an empty trie.
+  swoc::TrieIPSpace<unsigned> empty_trie{uint_space{}};
+  REQUIRE(empty_trie.empty());
+  CHECK(empty_trie.find(IPAddr{"10.0.0.1"}) == empty_trie.end());
+}
+
+TEST_CASE("IPSpace batch find", "[libswoc][ipspace][find][batch]") {
+  using uint_space = swoc::IPSpace<unsigned>;
+  uint_space space;
+
+  // Enough ranges to give the interleaved walker real trees to descend.
+  for (in_addr_t i = 0; i < 500; ++i) {
+    space.mark(swoc::IP4Range{IP4Addr{i * 16}, IP4Addr{i * 16 + 7}}, i + 1);
+  }
+  space.mark(IPRange{"2001:db8::/64"_tv}, 9001);
+  space.mark(IPRange{"2001:db8:1::/64"_tv}, 9002);
+
+  // A mix of hits and misses across both families, more than one prefetch window's worth.
+  std::vector<IPAddr> addrs;
+  for (in_addr_t i = 0; i < 100; ++i) {
+    addrs.emplace_back(IP4Addr{i * 80 + (i % 2 ? 3 : 12)}); // odd entries hit, even miss.
+  }
+  addrs.emplace_back(IPAddr{"2001:db8::17"});
+  addrs.emplace_back(IPAddr{"2001:db9::17"});
+
+  std::vector<uint_space::iterator> results(addrs.size());
+  auto n_found = space.find(swoc::MemSpan<IPAddr const>(addrs.data(), addrs.size()),
+                            swoc::MemSpan<uint_space::iterator>(results.data(), results.size()));
+
+  // Every result must agree with the single address find.
+  size_t n_check = 0;
+  for (size_t i = 0; i < addrs.size(); ++i) {
+    auto expected = space.find(addrs[i]);
+    REQUIRE(results[i] == expected);
+    if (expected != space.end()) {
+      CHECK(results[i]->payload() == expected->payload());
+      ++n_check;
+    }
+  }
+  REQUIRE(n_found == n_check);
+  REQUIRE(n_found == 51); // 50 even IPv4 entries plus the IPv6 hit.
+
+  // Degenerate cases - empty batch, empty space.
+  REQUIRE(0 == space.find(swoc::MemSpan<IPAddr const>{}, swoc::MemSpan<uint_space::iterator>{}));
+  uint_space empty_space;
+  std::vector<uint_space::iterator> r1(2);
+  REQUIRE(0 == empty_space.find(swoc::MemSpan<IPAddr const>(addrs.data(), 2), swoc::MemSpan<uint_space::iterator>(r1.data(), 2)));
+  CHECK(r1[0] == empty_space.end());
+  CHECK(r1[1] == empty_space.end());
+}
+
 TEST_CASE("IPSpace intersect", "[libswoc][ipspace][intersect]") {
   std::string dbg;
   using PAYLOAD = unsigned;
@@ -2183,3 +2615,405 @@ TEST_CASE("IPRangeSet", "[libswoc][iprangeset]") {
   REQUIRE(n == addrs.count());
   REQUIRE(valid_p);
 }
+
+TEST_CASE("IPRangeSet compressed", "[libswoc][iprangeset]") {
+  IPRangeSet addrs;
+
+  // Sparse singletons - array format. Every other address in a /16.
+  for (unsigned i = 0; i < 1000; ++i) {
+    addrs.mark(IPRange{IP4Addr(0x0A010000u + 2 * i)});
+  }
+  REQUIRE(addrs.count() == 1000);
+  for (unsigned i = 0; i < 1000; ++i) {
+    REQUIRE(addrs.contains(IPAddr{IP4Addr(0x0A010000u + 2 * i)}));
+    REQUIRE_FALSE(addrs.contains(IPAddr{IP4Addr(0x0A010001u + 2 * i)}));
+  }
+
+  // Push the chunk past the array limit to force bitmap conversion.
+  for (unsigned i = 1000; i < 5000; ++i) {
+    addrs.mark(IPRange{IP4Addr(0x0A010000u + 2 * i)});
+  }
+  REQUIRE(addrs.count() == 5000);
+  for (unsigned i = 0; i < 5000; ++i) {
+    REQUIRE(addrs.contains(IPAddr{IP4Addr(0x0A010000u + 2 * i)}));
+    REQUIRE_FALSE(addrs.contains(IPAddr{IP4Addr(0x0A010001u + 2 * i)}));
+  }
+
+  // Range marking - run format, with coalescing of adjacent and overlapping marks.
+  addrs.mark(IPRange{"10.2.0.10-10.2.0.40"_tv});
+  addrs.mark(IPRange{"10.2.0.41-10.2.0.60"_tv}); // adjacent - merges.
+  addrs.mark(IPRange{"10.2.0.50-10.2.0.80"_tv}); // overlapping - merges.
+  addrs.mark(IPRange{"10.2.0.100-10.2.0.120"_tv});
+  REQUIRE(addrs.count() == 5002);
+  REQUIRE(addrs.contains(IPAddr{"10.2.0.10"_tv}));
+  REQUIRE(addrs.contains(IPAddr{"10.2.0.80"_tv}));
+  REQUIRE_FALSE(addrs.contains(IPAddr{"10.2.0.81"_tv}));
+  REQUIRE_FALSE(addrs.contains(IPAddr{"10.2.0.99"_tv}));
+
+  // A range spanning /16 chunks must iterate and count as a single range.
+  addrs.mark(IPRange{"10.3.250.0-10.5.2.17"_tv});
+  REQUIRE(addrs.count() == 5003);
+  REQUIRE(addrs.contains(IPAddr{"10.4.1.1"_tv}));
+  bool found_p = false;
+  for (auto const &r : addrs) {
+    if (r.min() == IPAddr{"10.3.250.0"_tv}) {
+      REQUIRE(r.max() == IPAddr{"10.5.2.17"_tv});
+      found_p = true;
+    }
+  }
+  REQUIRE(found_p);
+
+  // IPv6 still goes to the tree and shows up after the IPv4 ranges.
+  addrs.mark(IPRange{"2001:db8::1-2001:db8::10"_tv});
+  REQUIRE(addrs.count() == 5004);
+  REQUIRE(addrs.contains(IPAddr{"2001:db8::8"_tv}));
+  auto spot = addrs.begin();
+  std::advance(spot, 5003);
+  REQUIRE(spot->is_ip6());
+  REQUIRE(spot->min() == IPAddr{"2001:db8::1"_tv});
+  REQUIRE(++spot == addrs.end());
+
+  // Iteration is ordered and reversible.
+  IPAddr prev_max;
+  unsigned n = 0;
+  for (auto const &r : addrs) {
+    if (n > 0 && r.is_ip4()) {
+      REQUIRE(prev_max < r.min());
+    }
+    prev_max = r.max();
+    ++n;
+  }
+  REQUIRE(n == addrs.count());
+  auto iter = addrs.end();
+  while (n > 0) {
+    --iter;
+    --n;
+    REQUIRE_FALSE((*iter).empty());
+  }
+  REQUIRE(iter == addrs.begin());
+
+  addrs.clear();
+  REQUIRE(addrs.empty());
+  REQUIRE(addrs.count() == 0);
+  REQUIRE_FALSE(addrs.contains(IPAddr{"10.2.0.10"_tv}));
+}
+
+TEST_CASE("IPAddr parse_many", "[libswoc][ipaddr]") {
+  // Fast path and general parser agreement.
+  REQUIRE(IP4Addr{"10.1.2.3"_tv} == IP4Addr{0x0A010203u});
+  REQUIRE(IP4Addr{"255.255.255.255"_tv} == IP4Addr{0xFFFFFFFFu});
+  REQUIRE(IP4Addr{"010.0.0.1"_tv} == IP4Addr{0x08000001u}); // leading zero is octal.
+  REQUIRE(IP6Addr{"2001:db8:1:2:3:4:5:6"_tv} == IP6Addr{"2001:0DB8:0001:0002:0003:0004:0005:0006"_tv});
+  IP4Addr a4;
+  REQUIRE_FALSE(a4.load("10.1.2.256"));
+  REQUIRE(a4.load("10.1.2")); // short form - final token covers the remaining octets.
+  REQUIRE(a4 == IP4Addr{0x0A010002u});
+  IP6Addr a6;
+  REQUIRE_FALSE(a6.load("2001:db8:1:2:3:4:5:6:7"));
+  REQUIRE_FALSE(a6.load("2001:db8:1:2:3:4:5"));
+
+  std::array<std::string_view, 5> texts = {"10.1.2.3", "2001:db8::1", "not-an-address", "192.168.56.2", "[::1]"};
+  std::array<IPAddr, 5> addrs;
+  REQUIRE(IPAddr::parse_many(swoc::MemSpan<std::string_view const>{texts.data(), texts.size()},
+                             swoc::MemSpan<IPAddr>{addrs.data(), addrs.size()}) == 4);
+  REQUIRE(addrs[0] == IPAddr{IP4Addr{0x0A010203u}});
+  REQUIRE(addrs[1] == IPAddr{"2001:db8::1"_tv});
+  REQUIRE_FALSE(addrs[2].is_valid());
+  REQUIRE(addrs[4] == IPAddr{"::1"_tv});
+
+  std::array<std::string_view, 3> quad_texts = {"10.1.2.3", "bogus", "172.28.56.99"};
+  std::array<IP4Addr, 3> quads;
+  REQUIRE(IP4Addr::parse_many(swoc::MemSpan<std::string_view const>{quad_texts.data(), quad_texts.size()},
+                              swoc::MemSpan<IP4Addr>{quads.data(), quads.size()}) == 2);
+  REQUIRE(quads[2] == IP4Addr{"172.28.56.99"_tv});
+
+  std::array<std::string_view, 2> hex_texts = {"2001:db8:1:2:3:4:5:6", "ffee::24c3:3349:3cee:143"};
+  std::array<IP6Addr, 2> hexes;
+  REQUIRE(IP6Addr::parse_many(swoc::MemSpan<std::string_view const>{hex_texts.data(), hex_texts.size()},
+                              swoc::MemSpan<IP6Addr>{hexes.data(), hexes.size()}) == 2);
+  REQUIRE(hexes[1] == IP6Addr{"ffee::24c3:3349:3cee:143"_tv});
+}
+
+TEST_CASE("IP6Addr arithmetic", "[libswoc][ip6addr]") {
+  // Carry across the 64 bit word boundary.
+  IP6Addr a{"2001:db8:0:0:ffff:ffff:ffff:ffff"_tv};
+  REQUIRE(++a == IP6Addr{"2001:db8:0:1::"_tv});
+  REQUIRE(--a == IP6Addr{"2001:db8:0:0:ffff:ffff:ffff:ffff"_tv});
+
+  // Ordering across the word boundary.
+  REQUIRE(IP6Addr{"2001:db8::ffff:ffff:ffff:ffff"_tv} < IP6Addr{"2001:db8:0:1::"_tv});
+  REQUIRE(IP6Addr{"2001:db8:0:1::"_tv} <= IP6Addr{"2001:db8:0:1::"_tv});
+  REQUIRE_FALSE(IP6Addr{"2001:db8:0:1::"_tv} < IP6Addr{"2001:db8::ffff:0:0:0"_tv});
+
+  // Mask application at the word boundary and the extremes.
+  IP6Addr b{"2001:db8:1:2:3:4:5:6"_tv};
+  REQUIRE((b & IPMask{64}) == IP6Addr{"2001:db8:1:2::"_tv});
+  REQUIRE((b & IPMask{48}) == IP6Addr{"2001:db8:1::"_tv});
+  REQUIRE((b & IPMask{80}) == IP6Addr{"2001:db8:1:2:3::"_tv});
+  REQUIRE((b & IPMask{0}) == IP6Addr{"::"_tv});
+  REQUIRE((b & IPMask{128}) == b);
+  REQUIRE((b | IPMask{64}) == IP6Addr{"2001:db8:1:2:ffff:ffff:ffff:ffff"_tv});
+  REQUIRE((b | IPMask{128}) == b);
+  REQUIRE((b | IPMask{0}) == IP6Addr{"ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"_tv});
+}
+
+TEST_CASE("RangeFeedReader", "[libswoc][feed]") {
+  auto path = swoc::file::temp_directory_path() / "range-feed-test.txt";
+  {
+    std::ofstream feed{path.c_str()};
+    feed << "# test feed\n"
+            "10.1.0.0/16\n"
+            "\n"
+            "172.28.56.12-172.28.56.99\n"
+            "   192.168.56.2   \n" // leading / trailing space is tolerated.
+            "not-an-address\n"     // malformed - skipped and counted.
+            "2001:db8::/48\n"
+            "10.2.0.0-10.2.0.255"; // no trailing newline.
+  }
+
+  std::error_code ec;
+  swoc::ip::RangeFeedReader feed{path, ec};
+  REQUIRE_FALSE(ec);
+
+  IPRange r;
+  REQUIRE(feed.next(r));
+  REQUIRE(r == IPRange{"10.1.0.0/16"_tv});
+  REQUIRE(feed.line_no() == 2);
+  REQUIRE(feed.next(r));
+  REQUIRE(r == IPRange{"172.28.56.12-172.28.56.99"_tv});
+  REQUIRE(feed.next(r));
+  REQUIRE(r == IPRange{"192.168.56.2"_tv});
+  REQUIRE(feed.next(r));
+  REQUIRE(r == IPRange{"2001:db8::/48"_tv});
+  REQUIRE(feed.error_count() == 1);
+  REQUIRE(feed.next(r));
+  REQUIRE(r == IPRange{"10.2.0.0-10.2.0.255"_tv});
+  REQUIRE_FALSE(feed.next(r));
+  REQUIRE_FALSE(feed.next(r)); // stays at end.
+  REQUIRE(feed.line_no() == 8);
+
+  // Batch load in to a span.
+  {
+    std::error_code lec;
+    swoc::ip::RangeFeedReader batch_feed{path, lec};
+    std::array<IPRange, 3> batch;
+    REQUIRE(batch_feed.load(swoc::MemSpan<IPRange>{batch.data(), batch.size()}) == 3);
+    REQUIRE(batch[0] == IPRange{"10.1.0.0/16"_tv});
+    REQUIRE(batch_feed.load(swoc::MemSpan<IPRange>{batch.data(), batch.size()}) == 2);
+    REQUIRE(batch[1] == IPRange{"10.2.0.0-10.2.0.255"_tv});
+  }
+
+  // Bulk load in to a space via the builder, with a small batch size to force multiple commits.
+  {
+    std::error_code lec;
+    swoc::ip::RangeFeedReader bulk_feed{path, lec};
+    IPSpace<unsigned> space;
+    REQUIRE(bulk_feed.load(space, 1u, 2) == 5);
+    REQUIRE(space.count() == 4); // 10.1.0.0/16 and 10.2.0.0-10.2.0.255 coalesce.
+    REQUIRE(space.find(IPAddr{"10.1.56.99"_tv}) != space.end());
+    REQUIRE(space.find(IPAddr{"2001:db8::dead:beef"_tv}) != space.end());
+    REQUIRE(space.find(IPAddr{"10.3.0.1"_tv}) == space.end());
+  }
+
+  // Missing file reports the error.
+  {
+    std::error_code bad_ec;
+    swoc::ip::RangeFeedReader bad{swoc::file::path{"/no/such/feed.txt"}, bad_ec};
+    REQUIRE(bad_ec);
+    REQUIRE_FALSE(bad.next(r));
+  }
+
+  swoc::file::remove(path, ec);
+}
+
+TEST_CASE("AddrColumn", "[libswoc][ip][column]") {
+  swoc::ip::AddrColumn col;
+
+  // Interleave families - indices must track the original order.
+  col.append(IPAddr{"10.0.0.3"_tv});              // 0
+  col.append(IPAddr{"2001:db8::3"_tv});           // 1
+  col.append(IPAddr{"10.0.0.1"_tv});              // 2
+  col.append(IPAddr{});                           // 3 - invalid family, holds its slot.
+  col.append(IPAddr{"10.0.0.2"_tv});              // 4
+  col.append(IPAddr{"2001:db8::1"_tv});           // 5
+  col.append(IPAddr{"10.0.0.2"_tv});              // 6 - duplicate.
+  col.append(IPAddr{"2001:db8::2"_tv});           // 7
+
+  REQUIRE(col.count() == 8);
+  REQUIRE(col.count_ip4() == 4);
+  REQUIRE(col.count_ip6() == 3);
+
+  col.sort();
+  auto v4 = col.ip4();
+  auto x4 = col.ip4_index();
+  REQUIRE(v4[0] == IP4Addr("10.0.0.1"_tv));
+  REQUIRE(v4[1] == IP4Addr("10.0.0.2"_tv));
+  REQUIRE(v4[2] == IP4Addr("10.0.0.2"_tv));
+  REQUIRE(v4[3] == IP4Addr("10.0.0.3"_tv));
+  REQUIRE(x4[0] == 2);
+  REQUIRE(x4[1] == 4); // equal addresses stay in insertion order.
+  REQUIRE(x4[2] == 6);
+  REQUIRE(x4[3] == 0);
+  auto v6 = col.ip6();
+  auto x6 = col.ip6_index();
+  REQUIRE(v6[0] == IP6Addr("2001:db8::1"_tv));
+  REQUIRE(v6[2] == IP6Addr("2001:db8::3"_tv));
+  REQUIRE(x6[0] == 5);
+  REQUIRE(x6[2] == 1);
+
+  col.unique();
+  REQUIRE(col.count_ip4() == 3);
+  REQUIRE(col.count_ip6() == 3);
+  REQUIRE(col.ip4_index()[1] == 4); // first appended duplicate is kept.
+
+  // Membership against a frozen space.
+  IPSpace<unsigned> space;
+  space.mark(IPRange{"10.0.0.2-10.0.0.3"_tv}, 1);
+  space.mark(IPRange{"2001:db8::2-2001:db8::3"_tv}, 2);
+  auto flat = space.freeze();
+  std::vector<bool> hits(col.count());
+  REQUIRE(col.test(flat, hits) == 4);
+  REQUIRE(hits[0]);        // 10.0.0.3
+  REQUIRE(hits[1]);        // 2001:db8::3
+  REQUIRE_FALSE(hits[2]);  // 10.0.0.1
+  REQUIRE_FALSE(hits[3]);  // invalid slot.
+  REQUIRE(hits[4]);        // 10.0.0.2
+  REQUIRE_FALSE(hits[5]);  // 2001:db8::1
+  REQUIRE(hits[7]);        // 2001:db8::2
+
+  // Larger population - sort/unique round trip.
+  col.clear();
+  REQUIRE(col.empty());
+  for (unsigned idx = 0; idx < 1000; ++idx) {
+    col.append(IP4Addr{in_addr_t(0x0A000000 + (idx * 7919) % 500)}); // duplicates by construction.
+  }
+  col.sort().unique();
+  REQUIRE(col.count_ip4() == 500);
+  REQUIRE(std::is_sorted(col.ip4().begin(), col.ip4().end()));
+}
+
+TEST_CASE("IPSpace set algebra", "[libswoc][ipspace][algebra]") {
+  using Space = swoc::IPSpace<unsigned>;
+  Space lhs, rhs, result;
+
+  lhs.mark(IPRange{"10.0.0.0-10.0.0.255"_tv}, 1);
+  lhs.mark(IPRange{"10.1.0.0-10.1.0.127"_tv}, 2);
+  lhs.mark(IPRange{"2001:db8::1-2001:db8::ff"_tv}, 3);
+  rhs.mark(IPRange{"10.0.0.128-10.0.1.10"_tv}, 8);
+  rhs.mark(IPRange{"2001:db8::80-2001:db8::1ff"_tv}, 16);
+
+  // Union - single coverage keeps its payload, overlap is combined.
+  result.assign_union(lhs, rhs, [](unsigned l, unsigned r) { return l + r; });
+  REQUIRE(result.count() == 7);
+  REQUIRE(std::get<1>(*result.find(IPAddr{"10.0.0.5"})) == 1);
+  REQUIRE(std::get<1>(*result.find(IPAddr{"10.0.0.200"})) == 9);
+  REQUIRE(std::get<1>(*result.find(IPAddr{"10.0.1.5"})) == 8);
+  REQUIRE(std::get<1>(*result.find(IPAddr{"10.1.0.64"})) == 2);
+  REQUIRE(std::get<1>(*result.find(IPAddr{"2001:db8::40"})) == 3);
+  REQUIRE(std::get<1>(*result.find(IPAddr{"2001:db8::90"})) == 19);
+  REQUIRE(std::get<1>(*result.find(IPAddr{"2001:db8::150"})) == 16);
+  REQUIRE(result.end() == result.find(IPAddr{"10.0.1.11"}));
+  // Exact boundaries of the combined section.
+  {
+    auto spot = result.find(IPAddr{"10.0.0.128"});
+    auto [r, p] = *spot;
+    REQUIRE(r == IPRange{"10.0.0.128-10.0.0.255"_tv});
+    REQUIRE(p == 9);
+  }
+
+  // Intersection - coverage in both spaces only, left payload by default.
+  result.assign_intersection(lhs, rhs);
+  REQUIRE(result.count() == 2);
+  REQUIRE(std::get<1>(*result.find(IPAddr{"10.0.0.255"})) == 1);
+  REQUIRE(std::get<1>(*result.find(IPAddr{"2001:db8::ff"})) == 3);
+  REQUIRE(result.end() == result.find(IPAddr{"10.0.0.127"}));
+  REQUIRE(result.end() == result.find(IPAddr{"10.0.1.1"}));
+
+  // Intersection with a combiner.
+  result.assign_intersection(lhs, rhs, [](unsigned l, unsigned r) { return l * r; });
+  REQUIRE(std::get<1>(*result.find(IPAddr{"10.0.0.200"})) == 8);
+  REQUIRE(std::get<1>(*result.find(IPAddr{"2001:db8::90"})) == 48);
+
+  // Difference - "blocklist minus allowlist".
+  result.assign_difference(lhs, rhs);
+  REQUIRE(result.count() == 3);
+  REQUIRE(std::get<1>(*result.find(IPAddr{"10.0.0.5"})) == 1);
+  REQUIRE(result.end() == result.find(IPAddr{"10.0.0.128"}));
+  REQUIRE(std::get<1>(*result.find(IPAddr{"10.1.0.5"})) == 2);
+  {
+    auto [r, p] = *result.find(IPAddr{"2001:db8::1"});
+    REQUIRE(r == IPRange{"2001:db8::1-2001:db8::7f"_tv});
+    REQUIRE(p == 3);
+  }
+
+  // Degenerate cases - an empty operand.
+  Space empty;
+  result.assign_union(lhs, empty, [](unsigned l, unsigned r) { return l + r; });
+  REQUIRE(result.count() == lhs.count());
+  result.assign_intersection(lhs, empty);
+  REQUIRE(result.count() == 0);
+  result.assign_difference(lhs, empty);
+  REQUIRE(result.count() == lhs.count());
+  result.assign_difference(empty, lhs);
+  REQUIRE(result.count() == 0);
+}
+
+TEST_CASE("ColumnIPSpace", "[libswoc][ipspace][column]") {
+  using Space = swoc::ColumnIPSpace<std::string>;
+
+  Space space;
+  // Many ranges, few distinct payloads - the classification shape the column is for.
+  std::array<std::string, 3> const POD{"pod-1", "pod-2", "pod-3"};
+  for (unsigned idx = 0; idx < 300; ++idx) {
+    std::string text = "10.0." + std::to_string(idx / 32) + "." + std::to_string((idx % 32) * 8) + //
+                       "-10.0." + std::to_string(idx / 32) + "." + std::to_string((idx % 32) * 8 + 3);
+    space.mark(IPRange{TextView{text}}, POD[idx % POD.size()]);
+  }
+  REQUIRE(space.count() == 300);
+  REQUIRE(space.payload_count() == POD.size()); // deduplicated.
+
+  auto spot = space.find(IPAddr{"10.0.0.2"});
+  REQUIRE(spot != space.end());
+  CHECK(spot->payload() == "pod-1");
+  CHECK(space.find(IPAddr{"10.0.0.10"})->payload() == "pod-2");
+  CHECK(space.find(IPAddr{"10.0.0.4"}) == space.end()); // gap between ranges.
+
+  // Marking with an already interned payload reuses the handle.
+  space.mark(IPRange{"192.168.1.0/24"_tv}, std::string{"pod-2"});
+  REQUIRE(space.payload_count() == POD.size());
+  CHECK(space.find(IPAddr{"192.168.1.57"})->payload() == "pod-2");
+
+  // Adjacent ranges with the same payload share a handle and therefore coalesce.
+  space.mark(IPRange{"172.16.0.0-172.16.0.127"_tv}, std::string{"pod-3"});
+  auto n = space.count();
+  space.mark(IPRange{"172.16.0.128-172.16.0.255"_tv}, std::string{"pod-3"});
+  REQUIRE(space.count() == n); // merged, not added.
+  CHECK(space.find(IPAddr{"172.16.0.0"})->range() == IPRange{"172.16.0.0-172.16.0.255"_tv});
+
+  // fill only colors the uncovered addresses.
+  space.fill(IPRange{"172.16.0.200-172.16.1.10"_tv}, std::string{"pod-1"});
+  CHECK(space.find(IPAddr{"172.16.0.200"})->payload() == "pod-3"); // already marked.
+  CHECK(space.find(IPAddr{"172.16.1.5"})->payload() == "pod-1");   // filled.
+
+  // erase removes coverage, the orphaned color stays in the column.
+  space.erase(IPRange{"192.168.1.0/24"_tv});
+  CHECK(space.find(IPAddr{"192.168.1.57"}) == space.end());
+  REQUIRE(space.payload_count() == POD.size());
+
+  // Iteration is in address order with materialized payloads.
+  unsigned n_iter = 0;
+  IPAddr prev;
+  for (auto const &v : space) {
+    if (n_iter > 0) {
+      CHECK(prev < v.range().min());
+    }
+    prev = v.range().min();
+    CHECK(v.payload().substr(0, 4) == "pod-");
+    ++n_iter;
+  }
+  REQUIRE(n_iter == space.count());
+
+  space.clear();
+  REQUIRE(space.empty());
+  REQUIRE(space.payload_count() == 0);
+}
@@ -3,6 +3,7 @@
  * Test Discrete Range.
  */
 
+#include <vector>
 #include "swoc/DiscreteRange.h"
 #include "swoc/TextView.h"
 #include "catch.hpp"
@@ -37,3 +38,40 @@ TEST_CASE("Discrete Range", "[libswoc][range]") {
   REQUIRE(r3.is_superset_of(r3));
   REQUIRE_FALSE(r3.is_strict_superset_of(r3));
 }
+
+TEST_CASE("RBTree order statistics", "[libswoc][rbtree]") {
+  using swoc::detail::RBNode;
+  constexpr size_t N = 257;
+
+  std::vector<RBNode> nodes(N);
+  std::vector<RBNode *> ptrs;
+  ptrs.reserve(N);
+  for (auto &node : nodes) {
+    ptrs.push_back(&node);
+  }
+
+  // Bulk build from the (implicitly sorted) node array.
+  auto *root = RBNode::build(swoc::MemSpan<RBNode *>{ptrs.data(), ptrs.size()});
+  REQUIRE(root != nullptr);
+  REQUIRE(root->subtree_count() == N);
+
+  bool ok_p = true;
+  for (size_t i = 0; i < N; ++i) {
+    ok_p = ok_p && root->select(i) == ptrs[i] && ptrs[i]->rank() == i;
+  }
+  REQUIRE(ok_p == true);
+  REQUIRE(root->select(N) == nullptr);
+
+  // Counts must survive the normal insert / rebalance path - append a right most node.
+  RBNode extra;
+  root = ptrs[N - 1]->set_child(&extra, RBNode::Direction::RIGHT)->rebalance_after_insert();
+  REQUIRE(root->subtree_count() == N + 1);
+  REQUIRE(extra.rank() == N);
+  REQUIRE(root->select(N) == &extra);
+
+  // And the removal path.
+  root = ptrs[100]->remove();
+  REQUIRE(root->subtree_count() == N);
+  REQUIRE(root->select(100) == ptrs[101]);
+  REQUIRE(ptrs[150]->rank() == 149);
+}
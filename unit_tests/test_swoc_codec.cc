@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    swoc::codec unit tests.
+*/
+
+#include <array>
+#include <string>
+
+#include "swoc/swoc_codec.h"
+#include "swoc/bwf_base.h"
+#include "swoc/bwf_ex.h"
+#include "catch.hpp"
+
+using swoc::MemSpan;
+using swoc::TextView;
+using namespace swoc::literals;
+namespace codec = swoc::codec;
+
+TEST_CASE("codec hex", "[libswoc][codec]") {
+  std::string_view text{"Evil Dave Rulz"};
+  char buff[128];
+  char raw[64];
+
+  auto enc = codec::hex_encode(MemSpan<char>{buff, sizeof(buff)}, text);
+  REQUIRE(TextView(enc) == "4576696c20446176652052756c7a");
+  enc = codec::hex_encode(MemSpan<char>{buff, sizeof(buff)}, text, true);
+  REQUIRE(TextView(enc) == "4576696C20446176652052756C7A");
+
+  auto dec = codec::hex_decode(MemSpan<void>{raw, sizeof(raw)}, "4576696c20446176652052756c7a");
+  REQUIRE(TextView(dec.rebind<char>()) == text);
+  dec = codec::hex_decode(MemSpan<void>{raw, sizeof(raw)}, "4576696C20446176652052756C7A");
+  REQUIRE(TextView(dec.rebind<char>()) == text);
+
+  // Errors - odd length, invalid digit, short destination.
+  REQUIRE(codec::hex_decode(MemSpan<void>{raw, sizeof(raw)}, "457").empty());
+  REQUIRE(codec::hex_decode(MemSpan<void>{raw, sizeof(raw)}, "45g6").empty());
+  REQUIRE(codec::hex_decode(MemSpan<void>{raw, 2}, "457669").empty());
+  REQUIRE(codec::hex_encode(MemSpan<char>{buff, 4}, text).empty());
+  REQUIRE(codec::hex_decode(MemSpan<void>{raw, sizeof(raw)}, "").empty());
+
+  // All byte values round trip.
+  std::array<uint8_t, 256> bytes;
+  for (unsigned v = 0; v < 256; ++v) {
+    bytes[v] = uint8_t(v);
+  }
+  char big[512];
+  enc = codec::hex_encode(MemSpan<char>{big, sizeof(big)}, MemSpan<void const>(bytes.data(), bytes.size()));
+  REQUIRE(enc.size() == 512);
+  std::array<uint8_t, 256> rt;
+  dec = codec::hex_decode(MemSpan<void>(rt.data(), rt.size()), TextView(enc));
+  REQUIRE(dec.size() == 256);
+  REQUIRE(rt == bytes);
+
+  // Streaming variant crosses the internal chunk size.
+  std::string src;
+  for (unsigned idx = 0; idx < 1000; ++idx) {
+    src += char('A' + idx % 26);
+  }
+  swoc::LocalBufferWriter<2048> w;
+  codec::hex_encode(w, src);
+  REQUIRE(w.size() == 2000);
+  std::string verify;
+  verify.resize(1000);
+  REQUIRE(TextView(codec::hex_decode(MemSpan<void>{verify.data(), verify.size()}, w.view()).rebind<char>()) == src);
+}
+
+TEST_CASE("codec base64", "[libswoc][codec]") {
+  char buff[128];
+  char raw[64];
+  // RFC 4648 test vectors.
+  std::array<std::pair<TextView, TextView>, 7> vectors{{
+    {"", ""},
+    {"f", "Zg=="},
+    {"fo", "Zm8="},
+    {"foo", "Zm9v"},
+    {"foob", "Zm9vYg=="},
+    {"fooba", "Zm9vYmE="},
+    {"foobar", "Zm9vYmFy"},
+  }};
+
+  for (auto const &[plain, coded] : vectors) {
+    REQUIRE(codec::base64_encode_size(plain.size()) == coded.size());
+    auto enc = codec::base64_encode(MemSpan<char>{buff, sizeof(buff)}, plain);
+    REQUIRE(TextView(enc) == coded);
+    auto dec = codec::base64_decode(MemSpan<void>{raw, sizeof(raw)}, coded);
+    REQUIRE(TextView(dec.rebind<char>()) == plain);
+    // Padding is optional on decode.
+    TextView bare{coded};
+    bare.rtrim('=');
+    dec = codec::base64_decode(MemSpan<void>{raw, sizeof(raw)}, bare);
+    REQUIRE(TextView(dec.rebind<char>()) == plain);
+  }
+
+  // Errors - invalid digit, impossible length, short destination.
+  REQUIRE(codec::base64_decode(MemSpan<void>{raw, sizeof(raw)}, "Zm9*").empty());
+  REQUIRE(codec::base64_decode(MemSpan<void>{raw, sizeof(raw)}, "Zm9vY").empty());
+  REQUIRE(codec::base64_decode(MemSpan<void>{raw, 2}, "Zm9v").empty());
+  REQUIRE(codec::base64_encode(MemSpan<char>{buff, 3}, "foo"_tv).empty());
+
+  // Streaming variant crosses the internal chunk size and round trips.
+  std::string src;
+  for (unsigned idx = 0; idx < 1001; ++idx) {
+    src += char(idx * 7);
+  }
+  swoc::LocalBufferWriter<2048> w;
+  codec::base64_encode(w, src);
+  REQUIRE(w.size() == codec::base64_encode_size(src.size()));
+  std::string verify;
+  verify.resize(src.size());
+  auto dec = codec::base64_decode(MemSpan<void>{verify.data(), verify.size()}, w.view());
+  REQUIRE(TextView(dec.rebind<char>()) == src);
+}
+
+TEST_CASE("codec bwf", "[libswoc][codec]") {
+  swoc::LocalBufferWriter<256> w;
+  std::string_view text{"Evil Dave Rulz"};
+
+  w.print("{:x}", MemSpan<void const>(text.data(), text.size()));
+  REQUIRE(w.view() == "4576696c20446176652052756c7a");
+
+  w.clear().print("{}", swoc::bwf::B64(text));
+  REQUIRE(w.view() == "RXZpbCBEYXZlIFJ1bHo=");
+  w.clear().print("{}", swoc::bwf::B64(MemSpan<void const>("foo", 3)));
+  REQUIRE(w.view() == "Zm9v");
+}
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    Configuration parsing unit tests.
+*/
+
+#include <vector>
+
+#include "swoc/swoc_config.h"
+#include "catch.hpp"
+
+using swoc::TextView;
+using swoc::MemArena;
+using namespace swoc::config;
+using namespace swoc::literals;
+
+TEST_CASE("config Cursor", "[libswoc][config]") {
+  Cursor c{"alpha bravo # comment\n  charlie"_tv};
+  REQUIRE(c.line() == 1);
+  REQUIRE(c.column() == 1);
+  REQUIRE(c.take_token() == "alpha");
+  REQUIRE(c.column() == 6);
+  c.skip_ws();
+  auto cp = c.mark();
+  REQUIRE(c.take_token() == "bravo");
+  c.skip_ws(); // consumes the comment and the newline.
+  REQUIRE(c.line() == 2);
+  REQUIRE(c.column() == 3);
+  REQUIRE(c.take_token() == "charlie");
+  REQUIRE(c.at_end());
+  // Rewind restores position and line tracking.
+  c.rewind(cp);
+  REQUIRE(c.line() == 1);
+  REQUIRE(c.take_token() == "bravo");
+}
+
+TEST_CASE("config Parser", "[libswoc][config]") {
+  static constexpr TextView CONFIG = R"(
+# Example configuration.
+name "example";
+port 8080;
+hosts [ alpha.ex, bravo.ex, "charlie dot ex" ];
+log {
+  path "/var/log/example.log";
+  level info;
+  rotate { count 10; size 1M; }
+}
+tag = special; # "name = value" style is accepted.
+)";
+
+  MemArena arena;
+  Parser parser{arena};
+  auto &&[root, errata] = parser.parse(CONFIG);
+  REQUIRE(errata.is_ok());
+  REQUIRE(root->is_object());
+  REQUIRE(root->_count == 5);
+
+  auto *name = root->find("name");
+  REQUIRE(name != nullptr);
+  REQUIRE(name->is_string());
+  REQUIRE(name->_text == "example");
+  REQUIRE(root->find("port")->_text == "8080");
+  REQUIRE(root->find("nope") == nullptr);
+
+  auto *hosts = root->find("hosts");
+  REQUIRE(hosts->is_list());
+  REQUIRE(hosts->_count == 3);
+  std::vector<TextView> expected{"alpha.ex", "bravo.ex", "charlie dot ex"};
+  size_t idx = 0;
+  for (auto const &host : *hosts) {
+    REQUIRE(host._text == expected[idx++]);
+  }
+
+  auto *log = root->find("log");
+  REQUIRE(log->is_object());
+  REQUIRE(log->_line == 6);
+  REQUIRE(log->find("level")->_text == "info");
+  REQUIRE(log->find("rotate")->find("count")->_text == "10");
+  REQUIRE(root->find("tag")->_text == "special");
+
+  // Everything reachable from the root is in the arena.
+  REQUIRE(arena.contains(root));
+  REQUIRE(arena.contains(name->_text.data()));
+  REQUIRE(arena.contains(log->find("rotate")->find("size")->_text.data()));
+}
+
+TEST_CASE("config interning", "[libswoc][config]") {
+  MemArena arena;
+  Parser parser{arena};
+  auto &&[root, errata] = parser.parse("a x; b x; c { a y; } d \"x\";"_tv);
+  REQUIRE(errata.is_ok());
+  // Equal strings are one arena copy - pointer identity, even bare vs. quoted.
+  REQUIRE(root->find("a")->_text.data() == root->find("b")->_text.data());
+  REQUIRE(root->find("a")->_text.data() == root->find("d")->_text.data());
+  // Keys are interned along with values.
+  REQUIRE(root->find("a")->_key.data() == root->find("c")->find("a")->_key.data());
+  // Distinct strings: a, x, b, c, y, d.
+  REQUIRE(parser.interner().count() == 6);
+}
+
+TEST_CASE("config escapes", "[libswoc][config]") {
+  MemArena arena;
+  Parser parser{arena};
+  auto &&[root, errata] = parser.parse(R"(msg "line one\nsaid \"hi\"\t\\";)"_tv);
+  REQUIRE(errata.is_ok());
+  REQUIRE(root->find("msg")->_text == "line one\nsaid \"hi\"\t\\");
+  REQUIRE(arena.contains(root->find("msg")->_text.data()));
+}
+
+TEST_CASE("config errors", "[libswoc][config]") {
+  MemArena arena;
+  Parser parser{arena};
+
+  auto &&[r1, e1] = parser.parse("a 1;\nb 2\nc 3;"_tv);
+  REQUIRE_FALSE(e1.is_ok());
+  REQUIRE(e1.front().text() == "Expected ';' after field 'b' at line 3 column 1.");
+
+  auto &&[r2, e2] = parser.parse("outer {\n  inner {\n}"_tv);
+  REQUIRE_FALSE(e2.is_ok());
+  REQUIRE(e2.front().text() == "Unterminated group opened at line 1.");
+
+  auto &&[r3, e3] = parser.parse("a \"runs off the end;"_tv);
+  REQUIRE_FALSE(e3.is_ok());
+  REQUIRE(e3.front().text() == "Unterminated string opened at line 1 column 3.");
+
+  auto &&[r4, e4] = parser.parse("list [ a b ];"_tv);
+  REQUIRE_FALSE(e4.is_ok());
+  REQUIRE(e4.front().text() == "Expected ',' or ']' in list at line 1 column 10.");
+
+  auto &&[r5, e5] = parser.parse("}"_tv);
+  REQUIRE_FALSE(e5.is_ok());
+  REQUIRE(e5.front().text() == "Unmatched '}' at line 1 column 1.");
+}
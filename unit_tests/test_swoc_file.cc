@@ -22,6 +22,8 @@
 #include <unordered_map>
 #include <fstream>
 
+#include <fcntl.h>
+
 #include "swoc/swoc_file.h"
 #include "catch.hpp"
 
@@ -144,6 +146,87 @@ TEST_CASE("path::filename", "[libswoc][file]") {
   CHECK(file::path("alpha/bravo").relative_path() == file::path("alpha/bravo"));
 }
 
+TEST_CASE("swoc_file_map", "[libswoc][swoc_file_io]") {
+  file::path file("unit_tests/test_swoc_file.cc");
+  std::error_code ec;
+
+  auto content = swoc::file::map(file, ec, swoc::file::mapping::advice::SEQUENTIAL);
+  REQUIRE(ec.value() == 0);
+  REQUIRE(bool(content) == true);
+  REQUIRE(content.size() > 0);
+
+  // The mapping should be byte identical to a copying load.
+  std::string copy = swoc::file::load(file, ec);
+  REQUIRE(ec.value() == 0);
+  REQUIRE(content.view() == copy);
+
+  // TextView parsing directly on the mapping - no copy.
+  swoc::TextView text{content};
+  REQUIRE(text.split_prefix_at('\n').size() > 0);
+
+  // Hints can be changed after the fact.
+  REQUIRE_FALSE(content.advise(swoc::file::mapping::advice::RANDOM));
+
+  // Move semantics - the source is emptied.
+  auto other{std::move(content)};
+  REQUIRE(bool(content) == false);
+  REQUIRE(other.view() == copy);
+  other.unmap();
+  REQUIRE(bool(other) == false);
+  REQUIRE(other.size() == 0);
+
+  // Failure case.
+  file    = "../unit-tests/no_such_file.txt";
+  content = swoc::file::map(file, ec);
+  REQUIRE(ec.value() == ENOENT);
+  REQUIRE(bool(content) == false);
+
+  // An empty file yields a valid, empty mapping.
+  auto tmp = swoc::file::temp_directory_path() / "swoc_map_empty.txt";
+  ::close(::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644));
+  content = swoc::file::map(tmp, ec);
+  REQUIRE(ec.value() == 0);
+  REQUIRE(bool(content) == true);
+  REQUIRE(content.size() == 0);
+  swoc::file::remove(tmp, ec);
+}
+
+TEST_CASE("swoc_file_load_many", "[libswoc][swoc_file_io]") {
+  std::error_code ec;
+  auto tmp = swoc::file::temp_directory_path() / "swoc_load_many";
+  swoc::file::create_directories(tmp, ec);
+  REQUIRE(ec.value() == 0);
+
+  static constexpr unsigned N_FILES = 7;
+  std::vector<file::path> paths;
+  for (unsigned idx = 0; idx < N_FILES; ++idx) {
+    auto p = tmp / std::string_view{"file-" + std::to_string(idx) + ".txt"};
+    std::ofstream s{p.string()};
+    s << "content for file " << idx << std::endl;
+    paths.push_back(p);
+  }
+  paths.push_back(tmp / "no_such_file.txt"); // failure mixed in to the batch.
+
+  auto results = swoc::file::load_many(swoc::MemSpan<file::path const>{paths.data(), paths.size()});
+  REQUIRE(results.size() == paths.size());
+  for (unsigned idx = 0; idx < N_FILES; ++idx) { // results are in input order.
+    REQUIRE(results[idx]._path == paths[idx]);
+    REQUIRE(results[idx]._ec.value() == 0);
+    REQUIRE(results[idx]._content.find(std::to_string(idx)) != std::string::npos);
+  }
+  REQUIRE(results.back()._ec.value() == ENOENT);
+
+  // Completion order delivery - everything arrives exactly once.
+  unsigned n_ok = 0, n_fail = 0;
+  swoc::file::load_many(
+    swoc::MemSpan<file::path const>{paths.data(), paths.size()},
+    [&](swoc::file::load_result &&r) { r._ec ? ++n_fail : ++n_ok; }, 3);
+  REQUIRE(n_ok == N_FILES);
+  REQUIRE(n_fail == 1);
+
+  swoc::file::remove_all(tmp, ec);
+}
+
 TEST_CASE("swoc::file::temp_directory_path", "[libswoc][swoc_file]") {
   // Clean all temp dir env variables and save the values.
   std::string s1{set_env_var("TMPDIR")};
@@ -312,3 +395,76 @@ TEST_CASE("file::path::copy", "[libts][swoc_file]") {
   CHECK(file::remove_all(testdir1, ec));
   CHECK_FALSE(file::exists(testdir1));
 }
+
+TEST_CASE("file::LineReader", "[libswoc][swoc_file]") {
+  // Span mode - lines are views directly in to the source.
+  static constexpr TextView CONTENT{"alpha\nbravo charlie\n\ndelta"};
+  file::LineReader reader{CONTENT};
+  TextView line;
+  REQUIRE(reader.next(line));
+  REQUIRE(line == "alpha");
+  REQUIRE(line.data() == CONTENT.data()); // no copy.
+  REQUIRE(reader.next(line));
+  REQUIRE(line == "bravo charlie");
+  REQUIRE(reader.next(line));
+  REQUIRE(line.empty()); // empty line is a line.
+  REQUIRE(reader.next(line));
+  REQUIRE(line == "delta"); // final line without a newline.
+  REQUIRE_FALSE(reader.next(line));
+  REQUIRE(reader.line_no() == 4);
+  REQUIRE_FALSE(bool(reader));
+
+  // File mode - small buffer to force lines across refill boundaries.
+  file::path path{"/tmp/swoc_line_reader_test.txt"};
+  std::string expected;
+  {
+    std::ofstream out(path.string());
+    for (unsigned idx = 0; idx < 200; ++idx) {
+      out << "line-" << idx << "-" << std::string(idx % 50, 'x') << "\n";
+    }
+    out << "unterminated";
+  }
+
+  std::error_code ec;
+  auto lr = file::lines(path, ec, 64);
+  REQUIRE_FALSE(ec);
+  unsigned idx = 0;
+  std::string name;
+  while (lr.next(line)) {
+    if (idx < 200) {
+      name = "line-" + std::to_string(idx) + "-" + std::string(idx % 50, 'x');
+      REQUIRE(line == name);
+    } else {
+      REQUIRE(line == "unterminated");
+    }
+    ++idx;
+  }
+  REQUIRE(idx == 201);
+  REQUIRE(lr.line_no() == 201);
+  REQUIRE_FALSE(lr.error());
+
+  // A line longer than the buffer arrives in buffer sized pieces.
+  {
+    std::ofstream out(path.string());
+    out << std::string(150, 'y') << "\nshort\n";
+  }
+  auto lr2 = file::lines(path, ec, 64);
+  std::string big;
+  REQUIRE(lr2.next(line));
+  while (line.size() == 64) {
+    big.append(line.data(), line.size());
+    REQUIRE(lr2.next(line));
+  }
+  big.append(line.data(), line.size());
+  REQUIRE(big == std::string(150, 'y'));
+  REQUIRE(lr2.next(line));
+  REQUIRE(line == "short");
+  REQUIRE_FALSE(lr2.next(line));
+
+  file::remove(path, ec);
+
+  // Open failure - error reported, reader is exhausted.
+  auto lr3 = file::lines(file::path{"/no/such/file"}, ec);
+  REQUIRE(ec);
+  REQUIRE_FALSE(bool(lr3));
+}
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: Apache-2.0
+/** @file
+
+    Hash module unit tests.
+*/
+
+#include <string>
+#include <unordered_map>
+
+#include "swoc/swoc_hash.h"
+#include "swoc/ext/HashFNV.h"
+#include "catch.hpp"
+
+using namespace swoc::hash;
+
+TEST_CASE("CRC32C", "[libswoc][hash]") {
+  // Standard check value for CRC-32C (iSCSI).
+  REQUIRE(crc32c("123456789", 9) == 0xE3069283u);
+  REQUIRE(crc32c("", 0) == 0u);
+
+  // Chaining over split buffers matches the one shot value.
+  std::string text{"The quick brown fox jumps over the lazy dog"};
+  auto whole = crc32c(text.data(), text.size());
+  for (size_t idx : {size_t(1), size_t(7), text.size() - 1}) {
+    auto part = crc32c(text.data(), idx);
+    REQUIRE(crc32c(text.data() + idx, text.size() - idx, part) == whole);
+  }
+
+  // The incremental hasher agrees with the free function.
+  HashCRC32C hasher;
+  REQUIRE(hasher.hash_immediate(text) == whole);
+  hasher.clear();
+  hasher.update(std::string_view{text}.substr(0, 10));
+  hasher.update(std::string_view{text}.substr(10));
+  REQUIRE(hasher.final().get() == whole);
+
+  // Case folding matches hashing the upper cased input.
+  std::string upper;
+  for (char c : text) {
+    upper.push_back((c >= 'a' && c <= 'z') ? char(c - 0x20) : c);
+  }
+  REQUIRE(HashCRC32C().hash_nocase_immediate(text) == HashCRC32C().hash_immediate(upper));
+  REQUIRE(HashCRC32C().hash_nocase_immediate(upper) == HashCRC32C().hash_immediate(upper));
+}
+
+TEST_CASE("hash_64", "[libswoc][hash]") {
+  std::string text{"GET /some/path/with/segments HTTP/1.1"};
+
+  // Deterministic.
+  REQUIRE(hash_64(text.data(), text.size()) == hash_64(text.data(), text.size()));
+  // Length keyed - a prefix doesn't hash the same.
+  REQUIRE(hash_64(text.data(), text.size()) != hash_64(text.data(), text.size() - 1));
+  // Seed varies the value.
+  REQUIRE(hash_64(text.data(), text.size()) != hash_64(text.data(), text.size(), 1));
+  // Content at a different (unaligned) address hashes identically.
+  std::string copy{"x" + text};
+  REQUIRE(hash_64(copy.data() + 1, text.size()) == hash_64(text.data(), text.size()));
+  // Every tail length works.
+  for (size_t n = 0; n <= text.size(); ++n) {
+    REQUIRE(hash_64(text.data(), n) == hash_64(copy.data() + 1, n));
+  }
+
+  // Usable as a policy / functor - e.g. for standard containers.
+  std::unordered_map<std::string_view, int, Hash64Wide> map;
+  map[text] = 1;
+  REQUIRE(map.count(text) == 1);
+  REQUIRE(Hash64Wide()(text) == hash_64(text.data(), text.size()));
+}
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Apache Software Foundation 2019
+/** @file
+
+    Statistics counter and histogram unit tests.
+*/
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "swoc/swoc_stats.h"
+#include "swoc/bwf_base.h"
+#include "catch.hpp"
+
+using swoc::stats::Counter;
+using swoc::stats::Histogram;
+
+TEST_CASE("stats Counter", "[libswoc][stats]") {
+  Counter counter;
+  REQUIRE(counter.load() == 0);
+
+  ++counter;
+  counter += 9;
+  counter.inc(46);
+  REQUIRE(counter.load() == 56);
+
+  // Concurrent increments - every one must land in the fold.
+  static constexpr size_t N_THREAD = 8;
+  static constexpr size_t N_ITER   = 100000;
+  std::vector<std::thread> threads;
+  for (size_t idx = 0; idx < N_THREAD; ++idx) {
+    threads.emplace_back([&]() {
+      for (size_t i = 0; i < N_ITER; ++i) {
+        counter.inc();
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  REQUIRE(counter.load() == 56 + N_THREAD * N_ITER);
+}
+
+TEST_CASE("stats Histogram", "[libswoc][stats]") {
+  // Bucket math - the linear prefix, octave boundaries, and the roundtrip invariant.
+  REQUIRE(Histogram::bucket_of(0) == 0);
+  REQUIRE(Histogram::bucket_of(3) == 3);
+  REQUIRE(Histogram::bucket_of(4) == 4);
+  REQUIRE(Histogram::bucket_of(7) == 7);
+  REQUIRE(Histogram::bucket_of(8) == 8);     // next octave - buckets now span 2 values.
+  REQUIRE(Histogram::bucket_of(9) == 8);
+  REQUIRE(Histogram::bucket_of(10) == 9);
+  for (uint64_t v : {uint64_t{1}, uint64_t{57}, uint64_t{1000}, uint64_t{1} << 31, (uint64_t{1} << 63) + 12345}) {
+    auto idx = Histogram::bucket_of(v);
+    REQUIRE(Histogram::bucket_min(idx) <= v);
+    if (idx + 1 < Histogram::N_BUCKETS) {
+      REQUIRE(v < Histogram::bucket_min(idx + 1));
+    }
+  }
+
+  Histogram h;
+  REQUIRE(h.fold().count() == 0);
+  REQUIRE(h.fold().quantile(0.5) == 0);
+
+  h.record(10, 90);
+  h.record(1000, 10);
+  auto data = h.fold();
+  REQUIRE(data.count() == 100);
+  REQUIRE(data._count[Histogram::bucket_of(10)] == 90);
+  REQUIRE(data.quantile(0.5) == 10);    // bucket [10, 11].
+  REQUIRE(data.quantile(0.99) == 896);  // bucket [896, 1023] holds 1000.
+
+  // Formatted - each non-empty bucket with its value range.
+  std::string text;
+  swoc::bwprint(text, "{}", h);
+  REQUIRE(text == "10-11: 90 896-1023: 10");
+
+  // Concurrent recording folds exactly.
+  static constexpr size_t N_THREAD = 4;
+  static constexpr size_t N_ITER   = 50000;
+  std::vector<std::thread> threads;
+  for (size_t idx = 0; idx < N_THREAD; ++idx) {
+    threads.emplace_back([&, idx]() {
+      for (size_t i = 0; i < N_ITER; ++i) {
+        h.record(idx * 1000 + 7);
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  REQUIRE(h.fold().count() == 100 + N_THREAD * N_ITER);
+}